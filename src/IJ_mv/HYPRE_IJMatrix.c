@@ -692,6 +692,57 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetValuesCOO( HYPRE_IJMatrix       matrix,
+                            HYPRE_Int            nnz,
+                            const HYPRE_BigInt  *rows,
+                            const HYPRE_BigInt  *cols,
+                            const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nnz < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (nnz && !rows)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (nnz && !cols)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (nnz && !values)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return( hypre_IJMatrixSetValuesCOOParCSR( ijmatrix, nnz, rows, cols, values ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -194,6 +194,25 @@ HYPRE_Int HYPRE_IJMatrixAddToValues2(HYPRE_IJMatrix       matrix,
                                      const HYPRE_BigInt  *cols,
                                      const HYPRE_Complex *values);
 
+/**
+ * Builds the matrix from \e nnz coordinate (COO) triplets
+ * (\e rows[k], \e cols[k], \e values[k]) given in global indices.
+ * Triplets may come in any order and may refer to rows owned by other
+ * processors; duplicates are summed.  This replaces the Initialize,
+ * SetValues/AddToValues and Assemble sequence: any previous content of
+ * the matrix is discarded and the matrix is assembled on return.
+ * Row and diag/offd sizes set beforehand are ignored.
+ *
+ * Only available for matrices in host memory.
+ *
+ * Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetValuesCOO(HYPRE_IJMatrix       matrix,
+                                     HYPRE_Int            nnz,
+                                     const HYPRE_BigInt  *rows,
+                                     const HYPRE_BigInt  *cols,
+                                     const HYPRE_Complex *values);
+
 /**
  * Finalize the construction of the matrix before using.
  **/
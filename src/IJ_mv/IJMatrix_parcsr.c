@@ -683,6 +683,10 @@ hypre_IJMatrixSetValuesParCSR( hypre_IJMatrix       *matrix,
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int num_cols_offd;
       HYPRE_Int j_offd;
+
+      /* values change in place, the SELL shadows are rebuilt on the next matvec */
+      hypre_ParCSRMatrixSellDestroy(par_matrix);
+
       for (ii=0; ii < nrows; ii++)
       {
          row = rows[ii];
@@ -1042,6 +1046,8 @@ hypre_IJMatrixSetConstantValuesParCSRHost( hypre_IJMatrix *matrix,
    HYPRE_Int           nnz_offd   = hypre_CSRMatrixNumNonzeros(offd);
    HYPRE_Int           ii;
 
+   hypre_ParCSRMatrixSellDestroy(par_matrix);
+
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(ii) HYPRE_SMP_SCHEDULE
 #endif
@@ -1158,6 +1164,9 @@ hypre_IJMatrixAddToValuesParCSR( hypre_IJMatrix       *matrix,
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int j_offd;
 
+      /* values change in place, the SELL shadows are rebuilt on the next matvec */
+      hypre_ParCSRMatrixSellDestroy(par_matrix);
+
       /* AB - 4/06 - need to get this object*/
       aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
 
@@ -2804,6 +2813,10 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       hypre_IJMatrixAssembleFlag(matrix) = 1;
    }
 
+   /* values may have been changed in place, drop the SELL matvec shadows */
+   hypre_CSRMatrixSellDestroy(diag);
+   hypre_CSRMatrixSellDestroy(offd);
+
    hypre_AuxParCSRMatrixDestroy(aux_matrix);
    hypre_IJMatrixTranslator(matrix) = NULL;
 
@@ -2904,6 +2917,9 @@ hypre_IJMatrixSetValuesOMPParCSR( hypre_IJMatrix       *matrix,
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int num_cols_offd;
 
+      /* values change in place, the SELL shadows are rebuilt on the next matvec */
+      hypre_ParCSRMatrixSellDestroy(par_matrix);
+
       diag = hypre_ParCSRMatrixDiag(par_matrix);
       diag_i = hypre_CSRMatrixI(diag);
       diag_j = hypre_CSRMatrixJ(diag);
@@ -3533,6 +3549,9 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
       HYPRE_Int num_cols_offd;
       HYPRE_BigInt *col_map_offd;
 
+      /* values change in place, the SELL shadows are rebuilt on the next matvec */
+      hypre_ParCSRMatrixSellDestroy(par_matrix);
+
       diag = hypre_ParCSRMatrixDiag(par_matrix);
       diag_i = hypre_CSRMatrixI(diag);
       diag_j = hypre_CSRMatrixJ(diag);
@@ -0,0 +1,663 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * IJMatrix_ParCSR bulk COO ingestion
+ *
+ * The matrix is built directly from (row, col, value) triplets without going
+ * through the AuxParCSRMatrix. Triplets of rows owned by other processes are
+ * shipped to their owners in one round of messages; the local triplets are
+ * then binned by row with a thread-parallel count/scan/scatter and
+ * duplicates are summed with per-thread column markers, so no global sort
+ * of the triplets is needed.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+#include "../HYPRE.h"
+
+/* entry k of the concatenation of the user triplets and the received ones */
+#define hypre_COORow(k) ( (k) < nnz ? rows[k]   : recv_rows[(k) - nnz] )
+#define hypre_COOCol(k) ( (k) < nnz ? cols[k]   : recv_cols[(k) - nnz] )
+#define hypre_COOVal(k) ( (k) < nnz ? values[k] : recv_data[(k) - nnz] )
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixExchangeCOOParCSR
+ *
+ * Sends the triplets listed in off_idx to the processes owning their rows
+ * and receives the triplets other processes have for this one. Message
+ * sizes are exchanged with one all-to-all, the triplets themselves with a
+ * single round of nonblocking point-to-point messages.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixExchangeCOOParCSR( hypre_IJMatrix       *matrix,
+                                 HYPRE_Int             num_off,
+                                 HYPRE_Int            *off_idx,
+                                 const HYPRE_BigInt   *rows,
+                                 const HYPRE_BigInt   *cols,
+                                 const HYPRE_Complex  *values,
+                                 HYPRE_Int            *num_recv_ptr,
+                                 HYPRE_BigInt        **recv_rows_ptr,
+                                 HYPRE_BigInt        **recv_cols_ptr,
+                                 HYPRE_Complex       **recv_data_ptr )
+{
+   MPI_Comm             comm = hypre_IJMatrixComm(matrix);
+   HYPRE_BigInt        *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt        *row_starts;
+   HYPRE_Int           *owner;
+   HYPRE_Int           *send_counts, *recv_counts;
+   HYPRE_Int           *send_starts, *recv_starts;
+   HYPRE_BigInt        *send_rows, *send_cols;
+   HYPRE_Complex       *send_data;
+   HYPRE_BigInt        *recv_rows, *recv_cols;
+   HYPRE_Complex       *recv_data;
+   hypre_MPI_Request   *requests;
+   hypre_MPI_Status    *status;
+   HYPRE_Int            num_procs, num_requests, num_recv, num_invalid;
+   HYPRE_Int            i, k, p;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   row_starts = hypre_TAlloc(HYPRE_BigInt, num_procs + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&row_partitioning[0], 1, HYPRE_MPI_BIG_INT,
+                       row_starts, 1, HYPRE_MPI_BIG_INT, comm);
+   row_starts[num_procs] = hypre_IJMatrixGlobalFirstRow(matrix) +
+                           hypre_IJMatrixGlobalNumRows(matrix);
+
+   /* find the owner of every off-process row */
+   owner       = hypre_TAlloc(HYPRE_Int, num_off, HYPRE_MEMORY_HOST);
+   send_counts = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   recv_counts = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   send_starts = hypre_CTAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   recv_starts = hypre_CTAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   num_invalid = 0;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) reduction(+:num_invalid) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_off; i++)
+   {
+      owner[i] = hypre_FindProc(row_starts, rows[off_idx[i]], num_procs);
+      if (owner[i] < 0)
+      {
+         num_invalid++;
+      }
+   }
+
+   if (num_invalid)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "COO row index outside of the matrix, entry ignored\n");
+   }
+
+   for (i = 0; i < num_off; i++)
+   {
+      if (owner[i] >= 0)
+      {
+         send_counts[owner[i]]++;
+      }
+   }
+
+   hypre_MPI_Alltoall(send_counts, 1, HYPRE_MPI_INT, recv_counts, 1, HYPRE_MPI_INT, comm);
+
+   for (p = 0; p < num_procs; p++)
+   {
+      send_starts[p + 1] = send_starts[p] + send_counts[p];
+      recv_starts[p + 1] = recv_starts[p] + recv_counts[p];
+   }
+   num_recv = recv_starts[num_procs];
+
+   /* pack, reusing send_counts as fill pointers */
+   send_rows = hypre_TAlloc(HYPRE_BigInt,  send_starts[num_procs], HYPRE_MEMORY_HOST);
+   send_cols = hypre_TAlloc(HYPRE_BigInt,  send_starts[num_procs], HYPRE_MEMORY_HOST);
+   send_data = hypre_TAlloc(HYPRE_Complex, send_starts[num_procs], HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_procs; p++)
+   {
+      send_counts[p] = send_starts[p];
+   }
+   for (i = 0; i < num_off; i++)
+   {
+      if (owner[i] >= 0)
+      {
+         k = send_counts[owner[i]]++;
+         send_rows[k] = rows[off_idx[i]];
+         send_cols[k] = cols[off_idx[i]];
+         send_data[k] = values[off_idx[i]];
+      }
+   }
+
+   recv_rows = hypre_TAlloc(HYPRE_BigInt,  num_recv, HYPRE_MEMORY_HOST);
+   recv_cols = hypre_TAlloc(HYPRE_BigInt,  num_recv, HYPRE_MEMORY_HOST);
+   recv_data = hypre_TAlloc(HYPRE_Complex, num_recv, HYPRE_MEMORY_HOST);
+
+   requests = hypre_CTAlloc(hypre_MPI_Request, 6 * num_procs, HYPRE_MEMORY_HOST);
+   status   = hypre_CTAlloc(hypre_MPI_Status,  6 * num_procs, HYPRE_MEMORY_HOST);
+   num_requests = 0;
+
+   for (p = 0; p < num_procs; p++)
+   {
+      HYPRE_Int n = recv_starts[p + 1] - recv_starts[p];
+
+      if (n)
+      {
+         hypre_MPI_Irecv(&recv_rows[recv_starts[p]], n, HYPRE_MPI_BIG_INT, p, 0,
+                         comm, &requests[num_requests++]);
+         hypre_MPI_Irecv(&recv_cols[recv_starts[p]], n, HYPRE_MPI_BIG_INT, p, 1,
+                         comm, &requests[num_requests++]);
+         hypre_MPI_Irecv(&recv_data[recv_starts[p]], n, HYPRE_MPI_COMPLEX, p, 2,
+                         comm, &requests[num_requests++]);
+      }
+   }
+   for (p = 0; p < num_procs; p++)
+   {
+      HYPRE_Int n = send_starts[p + 1] - send_starts[p];
+
+      if (n)
+      {
+         hypre_MPI_Isend(&send_rows[send_starts[p]], n, HYPRE_MPI_BIG_INT, p, 0,
+                         comm, &requests[num_requests++]);
+         hypre_MPI_Isend(&send_cols[send_starts[p]], n, HYPRE_MPI_BIG_INT, p, 1,
+                         comm, &requests[num_requests++]);
+         hypre_MPI_Isend(&send_data[send_starts[p]], n, HYPRE_MPI_COMPLEX, p, 2,
+                         comm, &requests[num_requests++]);
+      }
+   }
+   hypre_MPI_Waitall(num_requests, requests, status);
+
+   hypre_TFree(requests,    HYPRE_MEMORY_HOST);
+   hypre_TFree(status,      HYPRE_MEMORY_HOST);
+   hypre_TFree(send_rows,   HYPRE_MEMORY_HOST);
+   hypre_TFree(send_cols,   HYPRE_MEMORY_HOST);
+   hypre_TFree(send_data,   HYPRE_MEMORY_HOST);
+   hypre_TFree(send_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(owner,       HYPRE_MEMORY_HOST);
+   hypre_TFree(row_starts,  HYPRE_MEMORY_HOST);
+
+   *num_recv_ptr  = num_recv;
+   *recv_rows_ptr = recv_rows;
+   *recv_cols_ptr = recv_cols;
+   *recv_data_ptr = recv_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixSetValuesCOOParCSR
+ *
+ * Builds and assembles the ParCSR matrix from nnz COO triplets. Duplicate
+ * triplets are summed in input order, so the result does not depend on the
+ * number of threads. Any previous content of the matrix is discarded.
+ * Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixSetValuesCOOParCSR( hypre_IJMatrix       *matrix,
+                                  HYPRE_Int             nnz,
+                                  const HYPRE_BigInt   *rows,
+                                  const HYPRE_BigInt   *cols,
+                                  const HYPRE_Complex  *values )
+{
+   MPI_Comm             comm             = hypre_IJMatrixComm(matrix);
+   HYPRE_BigInt        *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt        *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt         row_0            = row_partitioning[0];
+   HYPRE_BigInt         row_n            = row_partitioning[1];
+   HYPRE_BigInt         col_0            = col_partitioning[0];
+   HYPRE_BigInt         col_n            = col_partitioning[1];
+   HYPRE_BigInt         base             = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_Int            num_rows         = (HYPRE_Int)(row_n - row_0);
+   HYPRE_Int            num_cols         = (HYPRE_Int)(col_n - col_0);
+   HYPRE_Int            num_threads      = hypre_NumThreads();
+
+   hypre_ParCSRMatrix  *par_matrix;
+   hypre_CSRMatrix     *diag, *offd;
+   HYPRE_Int           *diag_i, *offd_i;
+   HYPRE_Int           *diag_j    = NULL;
+   HYPRE_Int           *offd_j    = NULL;
+   HYPRE_Complex       *diag_data = NULL;
+   HYPRE_Complex       *offd_data = NULL;
+   HYPRE_BigInt        *col_map_offd = NULL;
+   HYPRE_Int            num_cols_offd = 0;
+
+   HYPRE_Int           *workspace;
+   HYPRE_Int           *block_counts;
+   HYPRE_Int           *block_ptr;
+   HYPRE_Int           *bucket  = NULL;
+   HYPRE_Int           *off_idx = NULL;
+   HYPRE_Int            num_off = 0, num_off_global = 0;
+   HYPRE_Int            num_recv = 0;
+   HYPRE_BigInt        *recv_rows = NULL;
+   HYPRE_BigInt        *recv_cols = NULL;
+   HYPRE_Complex       *recv_data = NULL;
+
+   HYPRE_Int           *row_ptr, *perm;
+   HYPRE_BigInt       **offd_lists;
+   HYPRE_Int           *offd_sizes;
+   HYPRE_BigInt        *big_offd;
+   HYPRE_Int            num_recv_local, num_big_offd, num_diag, num_offd;
+   HYPRE_Int            i, k;
+
+   if (hypre_GetExecPolicy1(hypre_HandleMemoryLocation(hypre_handle())) != HYPRE_EXEC_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "COO ingestion is only available on the host\n");
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   /* start over from an empty matrix */
+   hypre_IJMatrixDestroyParCSR(matrix);
+   hypre_IJMatrixObject(matrix)       = NULL;
+   hypre_IJMatrixTranslator(matrix)   = NULL;
+   hypre_IJMatrixAssembleFlag(matrix) = 0;
+
+   hypre_IJMatrixCreateParCSR(matrix);
+   par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_ParCSRMatrixInitialize_v2(par_matrix, HYPRE_MEMORY_HOST);
+   diag   = hypre_ParCSRMatrixDiag(par_matrix);
+   offd   = hypre_ParCSRMatrixOffd(par_matrix);
+   diag_i = hypre_CSRMatrixI(diag);
+   offd_i = hypre_CSRMatrixI(offd);
+
+   workspace    = hypre_TAlloc(HYPRE_Int, 2 * (num_threads + 1), HYPRE_MEMORY_HOST);
+   block_ptr    = hypre_CTAlloc(HYPRE_Int, num_threads + 1, HYPRE_MEMORY_HOST);
+   block_counts = hypre_CTAlloc(HYPRE_Int, num_threads * num_threads, HYPRE_MEMORY_HOST);
+   row_ptr      = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   offd_lists   = hypre_CTAlloc(HYPRE_BigInt *, num_threads, HYPRE_MEMORY_HOST);
+   offd_sizes   = hypre_CTAlloc(HYPRE_Int, num_threads, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Split the triplets: those of rows owned by other processes are listed
+    * in off_idx, the local ones are bucketed by row block, one block of
+    * rows per thread. This is a stable count/scan/scatter: block b holds
+    * the local triplets of thread 0's input chunk first, then thread 1's...
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, k)
+#endif
+   {
+      HYPRE_Int  nt             = hypre_NumActiveThreads();
+      HYPRE_Int  my             = hypre_GetThreadNum();
+      HYPRE_Int  rows_per_block = (num_rows + nt - 1) / nt;
+      HYPRE_Int *counts         = block_counts + my * nt;
+      HYPRE_Int  ks, ke, b, pos, cnt = 0;
+
+      hypre_GetSimpleThreadPartition(&ks, &ke, nnz);
+      for (k = ks; k < ke; k++)
+      {
+         if (rows[k] >= row_0 && rows[k] < row_n)
+         {
+            counts[(HYPRE_Int)(rows[k] - row_0) / rows_per_block]++;
+         }
+         else
+         {
+            cnt++;
+         }
+      }
+
+      hypre_prefix_sum(&cnt, &num_off, workspace);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp master
+#endif
+      {
+         pos = 0;
+         for (b = 0; b < nt; b++)
+         {
+            block_ptr[b] = pos;
+            for (i = 0; i < nt; i++)
+            {
+               HYPRE_Int n = block_counts[i * nt + b];
+
+               block_counts[i * nt + b] = pos;
+               pos += n;
+            }
+         }
+         block_ptr[nt] = pos;
+         bucket  = hypre_TAlloc(HYPRE_Int, pos,     HYPRE_MEMORY_HOST);
+         off_idx = hypre_TAlloc(HYPRE_Int, num_off, HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      for (k = ks; k < ke; k++)
+      {
+         if (rows[k] >= row_0 && rows[k] < row_n)
+         {
+            bucket[counts[(HYPRE_Int)(rows[k] - row_0) / rows_per_block]++] = k;
+         }
+         else
+         {
+            off_idx[cnt++] = k;
+         }
+      }
+   }
+
+   hypre_MPI_Allreduce(&num_off, &num_off_global, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (num_off_global)
+   {
+      hypre_IJMatrixExchangeCOOParCSR(matrix, num_off, off_idx, rows, cols, values,
+                                      &num_recv, &recv_rows, &recv_cols, &recv_data);
+   }
+   hypre_TFree(off_idx, HYPRE_MEMORY_HOST);
+
+   perm = hypre_TAlloc(HYPRE_Int, block_ptr[num_threads] + num_recv, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, k)
+#endif
+   {
+      HYPRE_Int      nt   = hypre_NumActiveThreads();
+      HYPRE_Int      my   = hypre_GetThreadNum();
+      HYPRE_Int      size = 0, alloc = 0;
+      HYPRE_BigInt  *list = NULL;
+      HYPRE_Int     *diag_marker, *offd_marker;
+      HYPRE_Int      is, ie, jj, s, e, jd, jo, c, cnt, pos;
+      HYPRE_Int      diag_cnt, offd_cnt;
+
+      /*--------------------------------------------------------------------
+       * Sort the block of rows is:ie-1 by row, taking the received triplets
+       * after the local ones. row_ptr[i+1] first counts the entries of row
+       * i, perm then lists, row by row and in input order, the index of
+       * each triplet in the concatenation of the local and received ones.
+       * The off-diagonal columns are collected next, for col_map_offd.
+       *--------------------------------------------------------------------*/
+
+      hypre_GetSimpleThreadPartition(&is, &ie, num_rows);
+      for (jj = block_ptr[my]; jj < block_ptr[my + 1]; jj++)
+      {
+         row_ptr[rows[bucket[jj]] - row_0 + 1]++;
+      }
+      cnt = 0;
+      for (k = 0; k < num_recv; k++)
+      {
+         if (recv_rows[k] >= row_0 + is && recv_rows[k] < row_0 + ie)
+         {
+            row_ptr[recv_rows[k] - row_0 + 1]++;
+            cnt++;
+         }
+      }
+
+      hypre_prefix_sum(&cnt, &num_recv_local, workspace);
+
+      /* shift the local part of the rows by the received entries of
+         earlier blocks, then scan the row counts of this block */
+      pos = block_ptr[my] + cnt;
+      for (i = is; i < ie; i++)
+      {
+         c = row_ptr[i + 1];
+         row_ptr[i + 1] = pos;
+         pos += c;
+      }
+
+      /* row_ptr[i+1] is now the start of row i, used as fill pointer */
+      for (jj = block_ptr[my]; jj < block_ptr[my + 1]; jj++)
+      {
+         k = bucket[jj];
+         perm[row_ptr[rows[k] - row_0 + 1]++] = k;
+      }
+      for (k = 0; k < num_recv; k++)
+      {
+         if (recv_rows[k] >= row_0 + is && recv_rows[k] < row_0 + ie)
+         {
+            perm[row_ptr[recv_rows[k] - row_0 + 1]++] = nnz + k;
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      for (jj = row_ptr[is]; jj < row_ptr[ie]; jj++)
+      {
+         HYPRE_BigInt col = hypre_COOCol(perm[jj]);
+
+         if (col < col_0 || col >= col_n)
+         {
+            if (size == alloc)
+            {
+               alloc = hypre_max(2 * alloc, 64);
+               list  = hypre_TReAlloc(list, HYPRE_BigInt, alloc, HYPRE_MEMORY_HOST);
+            }
+            list[size++] = col;
+         }
+      }
+      offd_lists[my] = list;
+      offd_sizes[my] = size;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#pragma omp master
+#endif
+      {
+         /* col_map_offd: the sorted distinct off-diagonal columns */
+         num_big_offd = 0;
+         for (i = 0; i < nt; i++)
+         {
+            num_big_offd += offd_sizes[i];
+         }
+         big_offd = hypre_TAlloc(HYPRE_BigInt, num_big_offd, HYPRE_MEMORY_HOST);
+         num_big_offd = 0;
+         for (i = 0; i < nt; i++)
+         {
+            hypre_TMemcpy(big_offd + num_big_offd, offd_lists[i], HYPRE_BigInt, offd_sizes[i],
+                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            num_big_offd += offd_sizes[i];
+            hypre_TFree(offd_lists[i], HYPRE_MEMORY_HOST);
+         }
+
+         if (num_big_offd)
+         {
+            hypre_BigQsort0(big_offd, 0, num_big_offd - 1);
+            num_cols_offd = 1;
+            for (i = 1; i < num_big_offd; i++)
+            {
+               if (big_offd[i] > big_offd[num_cols_offd - 1])
+               {
+                  big_offd[num_cols_offd++] = big_offd[i];
+               }
+            }
+            col_map_offd = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+            hypre_TMemcpy(col_map_offd, big_offd, HYPRE_BigInt, num_cols_offd,
+                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(big_offd, HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      /*--------------------------------------------------------------------
+       * Sum duplicates in two sweeps over the rows of the block, the first
+       * counting the distinct entries, the second writing them in place.
+       * The markers of the first sweep hold the last row a column was seen
+       * in, those of the second the position of the column's entry;
+       * positions from earlier rows precede the current row start, so the
+       * markers never need resetting within a sweep.
+       *--------------------------------------------------------------------*/
+
+      diag_marker = hypre_TAlloc(HYPRE_Int, num_cols,      HYPRE_MEMORY_HOST);
+      offd_marker = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+      for (c = 0; c < num_cols; c++)
+      {
+         diag_marker[c] = -1;
+      }
+      for (c = 0; c < num_cols_offd; c++)
+      {
+         offd_marker[c] = -1;
+      }
+
+      diag_cnt = offd_cnt = 0;
+      for (i = is; i < ie; i++)
+      {
+         for (jj = row_ptr[i]; jj < row_ptr[i + 1]; jj++)
+         {
+            HYPRE_BigInt col = hypre_COOCol(perm[jj]);
+
+            if (col >= col_0 && col < col_n)
+            {
+               c = (HYPRE_Int)(col - col_0);
+               if (diag_marker[c] < i)
+               {
+                  diag_marker[c] = i;
+                  diag_cnt++;
+               }
+            }
+            else
+            {
+               c = hypre_BigBinarySearch(col_map_offd, col, num_cols_offd);
+               if (offd_marker[c] < i)
+               {
+                  offd_marker[c] = i;
+                  offd_cnt++;
+               }
+            }
+         }
+      }
+
+      hypre_prefix_sum_pair(&diag_cnt, &num_diag, &offd_cnt, &num_offd, workspace);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp master
+#endif
+      {
+         diag_j    = hypre_TAlloc(HYPRE_Int,     num_diag, HYPRE_MEMORY_HOST);
+         diag_data = hypre_TAlloc(HYPRE_Complex, num_diag, HYPRE_MEMORY_HOST);
+         offd_j    = hypre_TAlloc(HYPRE_Int,     num_offd, HYPRE_MEMORY_HOST);
+         offd_data = hypre_TAlloc(HYPRE_Complex, num_offd, HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      for (c = 0; c < num_cols; c++)
+      {
+         diag_marker[c] = -1;
+      }
+      for (c = 0; c < num_cols_offd; c++)
+      {
+         offd_marker[c] = -1;
+      }
+
+      jd = diag_cnt;
+      jo = offd_cnt;
+      for (i = is; i < ie; i++)
+      {
+         s = jd;
+         e = jo;
+         diag_i[i] = s;
+         offd_i[i] = e;
+
+         for (jj = row_ptr[i]; jj < row_ptr[i + 1]; jj++)
+         {
+            HYPRE_BigInt  col = hypre_COOCol(perm[jj]);
+            HYPRE_Complex val = hypre_COOVal(perm[jj]);
+
+            if (col >= col_0 && col < col_n)
+            {
+               c = (HYPRE_Int)(col - col_0);
+               if (diag_marker[c] < s)
+               {
+                  diag_marker[c]  = jd;
+                  diag_j[jd]      = c;
+                  diag_data[jd++] = val;
+               }
+               else
+               {
+                  diag_data[diag_marker[c]] += val;
+               }
+            }
+            else
+            {
+               c = hypre_BigBinarySearch(col_map_offd, col, num_cols_offd);
+               if (offd_marker[c] < e)
+               {
+                  offd_marker[c]  = jo;
+                  offd_j[jo]      = c;
+                  offd_data[jo++] = val;
+               }
+               else
+               {
+                  offd_data[offd_marker[c]] += val;
+               }
+            }
+         }
+
+         /* move the diagonal entry into first position */
+         if (i < num_cols && diag_marker[i] > s)
+         {
+            HYPRE_Complex temp = diag_data[s];
+
+            jj              = diag_marker[i];
+            diag_j[jj]      = diag_j[s];
+            diag_data[s]    = diag_data[jj];
+            diag_data[jj]   = temp;
+            diag_j[s]       = i;
+         }
+      }
+
+      if (my == nt - 1)
+      {
+         diag_i[num_rows] = num_diag;
+         offd_i[num_rows] = num_offd;
+      }
+
+      hypre_TFree(diag_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(offd_marker, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(perm,         HYPRE_MEMORY_HOST);
+   hypre_TFree(bucket,       HYPRE_MEMORY_HOST);
+   hypre_TFree(row_ptr,      HYPRE_MEMORY_HOST);
+   hypre_TFree(block_ptr,    HYPRE_MEMORY_HOST);
+   hypre_TFree(block_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_lists,   HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_sizes,   HYPRE_MEMORY_HOST);
+   hypre_TFree(workspace,    HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_rows,    HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_cols,    HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_data,    HYPRE_MEMORY_HOST);
+
+   if (base)
+   {
+      for (i = 0; i < num_cols_offd; i++)
+      {
+         col_map_offd[i] -= base;
+      }
+   }
+
+   hypre_CSRMatrixJ(diag)           = diag_j;
+   hypre_CSRMatrixData(diag)        = diag_data;
+   hypre_CSRMatrixNumNonzeros(diag) = num_diag;
+   hypre_CSRMatrixJ(offd)           = offd_j;
+   hypre_CSRMatrixData(offd)        = offd_data;
+   hypre_CSRMatrixNumNonzeros(offd) = num_offd;
+   hypre_CSRMatrixNumCols(offd)     = num_cols_offd;
+   hypre_TFree(hypre_ParCSRMatrixColMapOffd(par_matrix), HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixColMapOffd(par_matrix) = col_map_offd;
+
+   hypre_CSRMatrixSetRownnz(diag);
+   hypre_CSRMatrixSetRownnz(offd);
+
+   hypre_IJMatrixAssembleFlag(matrix) = 1;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+#undef hypre_COORow
+#undef hypre_COOCol
+#undef hypre_COOVal
@@ -67,6 +67,9 @@ HYPRE_Int hypre_IJMatrixAssembleParCSRDevice(hypre_IJMatrix *matrix);
 HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix, HYPRE_Complex value );
 
+/* IJMatrix_parcsr_coo.c */
+HYPRE_Int hypre_IJMatrixSetValuesCOOParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nnz , const HYPRE_BigInt *rows , const HYPRE_BigInt *cols , const HYPRE_Complex *values );
+
 /* IJMatrix_petsc.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizePETSc ( hypre_IJMatrix *matrix , HYPRE_Int local_m , HYPRE_Int local_n );
 HYPRE_Int hypre_IJMatrixCreatePETSc ( hypre_IJMatrix *matrix );
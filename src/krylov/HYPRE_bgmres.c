@@ -0,0 +1,210 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * HYPRE_BGMRES interface
+ *
+ *****************************************************************************/
+#include "krylov.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESSetup( HYPRE_Solver  solver,
+                   HYPRE_Matrix  A,
+                   HYPRE_Int     num_rhs,
+                   HYPRE_Vector *b,
+                   HYPRE_Vector *x      )
+{
+   return( hypre_BGMRESSetup( solver, A, num_rhs, (void **) b, (void **) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESSolve( HYPRE_Solver  solver,
+                   HYPRE_Matrix  A,
+                   HYPRE_Int     num_rhs,
+                   HYPRE_Vector *b,
+                   HYPRE_Vector *x      )
+{
+   return( hypre_BGMRESSolve( solver, A, num_rhs, (void **) b, (void **) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESSetKDim, HYPRE_BGMRESGetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESSetKDim( HYPRE_Solver solver,
+                     HYPRE_Int    k_dim )
+{
+   return( hypre_BGMRESSetKDim( (void *) solver, k_dim ) );
+}
+
+HYPRE_Int
+HYPRE_BGMRESGetKDim( HYPRE_Solver solver,
+                     HYPRE_Int   *k_dim )
+{
+   return( hypre_BGMRESGetKDim( (void *) solver, k_dim ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESSetTol, HYPRE_BGMRESGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESSetTol( HYPRE_Solver solver,
+                    HYPRE_Real   tol )
+{
+   return( hypre_BGMRESSetTol( (void *) solver, tol ) );
+}
+
+HYPRE_Int
+HYPRE_BGMRESGetTol( HYPRE_Solver solver,
+                    HYPRE_Real  *tol )
+{
+   return( hypre_BGMRESGetTol( (void *) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESSetAbsoluteTol, HYPRE_BGMRESGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESSetAbsoluteTol( HYPRE_Solver solver,
+                            HYPRE_Real   a_tol )
+{
+   return( hypre_BGMRESSetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+HYPRE_Int
+HYPRE_BGMRESGetAbsoluteTol( HYPRE_Solver solver,
+                            HYPRE_Real  *a_tol )
+{
+   return( hypre_BGMRESGetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESSetMaxIter, HYPRE_BGMRESGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESSetMaxIter( HYPRE_Solver solver,
+                        HYPRE_Int    max_iter )
+{
+   return( hypre_BGMRESSetMaxIter( (void *) solver, max_iter ) );
+}
+
+HYPRE_Int
+HYPRE_BGMRESGetMaxIter( HYPRE_Solver solver,
+                        HYPRE_Int   *max_iter )
+{
+   return( hypre_BGMRESGetMaxIter( (void *) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESSetPrecond( HYPRE_Solver          solver,
+                        HYPRE_PtrToSolverFcn  precond,
+                        HYPRE_PtrToSolverFcn  precond_setup,
+                        HYPRE_Solver          precond_solver )
+{
+   return( hypre_BGMRESSetPrecond( (void *) solver,
+                                   (HYPRE_Int (*)(void*, void*, void*, void*))precond,
+                                   (HYPRE_Int (*)(void*, void*, void*, void*))precond_setup,
+                                   (void *) precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESGetPrecond( HYPRE_Solver  solver,
+                        HYPRE_Solver *precond_data_ptr )
+{
+   return( hypre_BGMRESGetPrecond( (void *)     solver,
+                                   (HYPRE_Solver *) precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESSetPrintLevel, HYPRE_BGMRESGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESSetPrintLevel( HYPRE_Solver solver,
+                           HYPRE_Int    level )
+{
+   return( hypre_BGMRESSetPrintLevel( (void *) solver, level ) );
+}
+
+HYPRE_Int
+HYPRE_BGMRESGetPrintLevel( HYPRE_Solver solver,
+                           HYPRE_Int   *level )
+{
+   return( hypre_BGMRESGetPrintLevel( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESSetLogging, HYPRE_BGMRESGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESSetLogging( HYPRE_Solver solver,
+                        HYPRE_Int    level )
+{
+   return( hypre_BGMRESSetLogging( (void *) solver, level ) );
+}
+
+HYPRE_Int
+HYPRE_BGMRESGetLogging( HYPRE_Solver solver,
+                        HYPRE_Int   *level )
+{
+   return( hypre_BGMRESGetLogging( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESGetNumIterations( HYPRE_Solver  solver,
+                              HYPRE_Int    *num_iterations )
+{
+   return( hypre_BGMRESGetNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESGetConverged( HYPRE_Solver  solver,
+                          HYPRE_Int    *converged )
+{
+   return( hypre_BGMRESGetConverged( (void *) solver, converged ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BGMRESGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BGMRESGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                          HYPRE_Real   *norm )
+{
+   return( hypre_BGMRESGetFinalRelativeResidualNorm( (void *) solver, norm ) );
+}
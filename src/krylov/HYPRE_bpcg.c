@@ -0,0 +1,192 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * HYPRE_BPCG interface
+ *
+ *****************************************************************************/
+#include "krylov.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGSetup( HYPRE_Solver  solver,
+                 HYPRE_Matrix  A,
+                 HYPRE_Int     num_rhs,
+                 HYPRE_Vector *b,
+                 HYPRE_Vector *x      )
+{
+   return( hypre_BPCGSetup( solver, A, num_rhs, (void **) b, (void **) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGSolve( HYPRE_Solver  solver,
+                 HYPRE_Matrix  A,
+                 HYPRE_Int     num_rhs,
+                 HYPRE_Vector *b,
+                 HYPRE_Vector *x      )
+{
+   return( hypre_BPCGSolve( solver, A, num_rhs, (void **) b, (void **) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGSetTol, HYPRE_BPCGGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGSetTol( HYPRE_Solver solver,
+                  HYPRE_Real   tol )
+{
+   return( hypre_BPCGSetTol( (void *) solver, tol ) );
+}
+
+HYPRE_Int
+HYPRE_BPCGGetTol( HYPRE_Solver solver,
+                  HYPRE_Real  *tol )
+{
+   return( hypre_BPCGGetTol( (void *) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGSetAbsoluteTol, HYPRE_BPCGGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGSetAbsoluteTol( HYPRE_Solver solver,
+                          HYPRE_Real   a_tol )
+{
+   return( hypre_BPCGSetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+HYPRE_Int
+HYPRE_BPCGGetAbsoluteTol( HYPRE_Solver solver,
+                          HYPRE_Real  *a_tol )
+{
+   return( hypre_BPCGGetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGSetMaxIter, HYPRE_BPCGGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGSetMaxIter( HYPRE_Solver solver,
+                      HYPRE_Int    max_iter )
+{
+   return( hypre_BPCGSetMaxIter( (void *) solver, max_iter ) );
+}
+
+HYPRE_Int
+HYPRE_BPCGGetMaxIter( HYPRE_Solver solver,
+                      HYPRE_Int   *max_iter )
+{
+   return( hypre_BPCGGetMaxIter( (void *) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGSetPrecond( HYPRE_Solver          solver,
+                      HYPRE_PtrToSolverFcn  precond,
+                      HYPRE_PtrToSolverFcn  precond_setup,
+                      HYPRE_Solver          precond_solver )
+{
+   return( hypre_BPCGSetPrecond( (void *) solver,
+                                 (HYPRE_Int (*)(void*, void*, void*, void*))precond,
+                                 (HYPRE_Int (*)(void*, void*, void*, void*))precond_setup,
+                                 (void *) precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGGetPrecond( HYPRE_Solver  solver,
+                      HYPRE_Solver *precond_data_ptr )
+{
+   return( hypre_BPCGGetPrecond( (void *)     solver,
+                                 (HYPRE_Solver *) precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGSetPrintLevel, HYPRE_BPCGGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGSetPrintLevel( HYPRE_Solver solver,
+                         HYPRE_Int    level )
+{
+   return( hypre_BPCGSetPrintLevel( (void *) solver, level ) );
+}
+
+HYPRE_Int
+HYPRE_BPCGGetPrintLevel( HYPRE_Solver solver,
+                         HYPRE_Int   *level )
+{
+   return( hypre_BPCGGetPrintLevel( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGSetLogging, HYPRE_BPCGGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGSetLogging( HYPRE_Solver solver,
+                      HYPRE_Int    level )
+{
+   return( hypre_BPCGSetLogging( (void *) solver, level ) );
+}
+
+HYPRE_Int
+HYPRE_BPCGGetLogging( HYPRE_Solver solver,
+                      HYPRE_Int   *level )
+{
+   return( hypre_BPCGGetLogging( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGGetNumIterations( HYPRE_Solver  solver,
+                            HYPRE_Int    *num_iterations )
+{
+   return( hypre_BPCGGetNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGGetConverged( HYPRE_Solver  solver,
+                        HYPRE_Int    *converged )
+{
+   return( hypre_BPCGGetConverged( (void *) solver, converged ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BPCGGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                        HYPRE_Real   *norm )
+{
+   return( hypre_BPCGGetFinalRelativeResidualNorm( (void *) solver, norm ) );
+}
@@ -163,6 +163,24 @@ HYPRE_FlexGMRESGetMaxIter( HYPRE_Solver solver,
    return( hypre_FlexGMRESGetMaxIter( (void *) solver, max_iter ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_FlexGMRESSetCGS, HYPRE_FlexGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FlexGMRESSetCGS( HYPRE_Solver solver,
+                       HYPRE_Int    cgs )
+{
+   return( hypre_FlexGMRESSetCGS( (void *) solver, cgs ) );
+}
+
+HYPRE_Int
+HYPRE_FlexGMRESGetCGS( HYPRE_Solver  solver,
+                       HYPRE_Int    *cgs )
+{
+   return( hypre_FlexGMRESGetCGS( (void *) solver, cgs ) );
+}
+
 
 
 /*--------------------------------------------------------------------------
@@ -199,6 +199,24 @@ HYPRE_GMRESGetRelChange( HYPRE_Solver solver,
    return( hypre_GMRESGetRelChange( (void *) solver, rel_change ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_GMRESSetCGS, HYPRE_GMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GMRESSetCGS( HYPRE_Solver solver,
+                   HYPRE_Int    cgs )
+{
+   return( hypre_GMRESSetCGS( (void *) solver, cgs ) );
+}
+
+HYPRE_Int
+HYPRE_GMRESGetCGS( HYPRE_Solver  solver,
+                   HYPRE_Int    *cgs )
+{
+   return( hypre_GMRESGetCGS( (void *) solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_GMRESSetSkipRealResidualCheck, HYPRE_GMRESGetSkipRealResidualCheck
  *--------------------------------------------------------------------------*/
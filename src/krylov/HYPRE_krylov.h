@@ -178,6 +178,19 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
                                          HYPRE_Int    recompute_residual_p);
 
+/**
+ * (Optional) Select the CG recurrence.  The default 0 is standard PCG.  With 1
+ * (Chronopoulos-Gear) the inner products of each iteration are combined into a
+ * single global reduction.  With 2 (Ghysels-Vanroose pipelined CG) that
+ * reduction is also non-blocking and overlapped with the preconditioner and
+ * matvec, at the cost of extra vector updates and a somewhat less stable
+ * recurrence.  Variants 1 and 2 require a fixed preconditioner and are not
+ * used together with RelChange, RecomputeResidual(P), ResidualTol or
+ * ConvergenceFactorTol; standard PCG is used in that case.
+ **/
+HYPRE_Int HYPRE_PCGSetVariant(HYPRE_Solver solver,
+                              HYPRE_Int    variant);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -259,6 +272,11 @@ HYPRE_Int HYPRE_PCGGetTwoNorm(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_PCGGetRelChange(HYPRE_Solver  solver,
                                 HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetVariant(HYPRE_Solver  solver,
+                              HYPRE_Int    *variant);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck(HYPRE_Solver solver,
@@ -376,6 +394,25 @@ HYPRE_Int HYPRE_GMRESSetRelChange(HYPRE_Solver solver,
 HYPRE_Int HYPRE_GMRESSetSkipRealResidualCheck(HYPRE_Solver solver,
                                               HYPRE_Int    skip_real_r_check);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant used to orthogonalize each new
+ * Krylov vector.  The options are:
+ *
+ *    - 0 : modified Gram-Schmidt, one global reduction per basis vector (default)
+ *    - 1 : classical Gram-Schmidt, two global reductions per iteration
+ *    - 2 : classical Gram-Schmidt with reorthogonalization (CGS2), two global
+ *          reductions per iteration
+ *
+ * Options 1 and 2 batch the inner products of each pass into a single
+ * reduction, so the number of reductions no longer grows with the Krylov
+ * dimension.  Classical Gram-Schmidt alone can lose orthogonality on
+ * ill-conditioned problems; CGS2 is as stable as modified Gram-Schmidt and
+ * is the recommended low-synchronization choice.  The variants round
+ * differently, so iteration counts can differ, most on hard problems.
+ **/
+HYPRE_Int HYPRE_GMRESSetCGS(HYPRE_Solver solver,
+                            HYPRE_Int    cgs);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -457,6 +494,11 @@ HYPRE_Int HYPRE_GMRESGetKDim(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_GMRESGetRelChange(HYPRE_Solver  solver,
                                   HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_GMRESGetCGS(HYPRE_Solver  solver,
+                            HYPRE_Int    *cgs);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetPrecond(HYPRE_Solver  solver,
@@ -544,6 +586,12 @@ HYPRE_Int HYPRE_FlexGMRESSetMaxIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_FlexGMRESSetKDim(HYPRE_Solver solver,
                                  HYPRE_Int    k_dim);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant (see HYPRE_GMRESSetCGS).
+ **/
+HYPRE_Int HYPRE_FlexGMRESSetCGS(HYPRE_Solver solver,
+                                HYPRE_Int    cgs);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -615,6 +663,11 @@ HYPRE_Int HYPRE_FlexGMRESGetMaxIter(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_FlexGMRESGetKDim(HYPRE_Solver  solver,
                                  HYPRE_Int    *k_dim);
 
+/**
+ **/
+HYPRE_Int HYPRE_FlexGMRESGetCGS(HYPRE_Solver  solver,
+                                HYPRE_Int    *cgs);
+
 /**
  **/
 HYPRE_Int HYPRE_FlexGMRESGetPrecond(HYPRE_Solver  solver,
@@ -722,6 +775,12 @@ HYPRE_Int HYPRE_LGMRESSetKDim(HYPRE_Solver solver,
 HYPRE_Int HYPRE_LGMRESSetAugDim(HYPRE_Solver solver,
                                 HYPRE_Int    aug_dim);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant (see HYPRE_GMRESSetCGS).
+ **/
+HYPRE_Int HYPRE_LGMRESSetCGS(HYPRE_Solver solver,
+                             HYPRE_Int    cgs);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -798,6 +857,11 @@ HYPRE_Int HYPRE_LGMRESGetKDim(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_LGMRESGetAugDim(HYPRE_Solver  solver,
                                 HYPRE_Int    *k_dim);
 
+/**
+ **/
+HYPRE_Int HYPRE_LGMRESGetCGS(HYPRE_Solver  solver,
+                             HYPRE_Int    *cgs);
+
 /**
  **/
 HYPRE_Int HYPRE_LGMRESGetPrecond(HYPRE_Solver  solver,
@@ -1008,6 +1072,462 @@ HYPRE_Int HYPRE_COGMRESSetModifyPC(HYPRE_Solver           solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name CAGMRES Solver
+ *
+ * Communication-avoiding (s-step) GMRES.  The Krylov basis is generated s
+ * vectors at a time with back-to-back preconditioned matvecs and
+ * orthogonalized as a block, so that s iterations cost a fixed number of
+ * global reductions (four) instead of O(s k).  The Newton basis uses the
+ * Leja-ordered Ritz values of the first s iterations as shifts, which keeps
+ * the block well conditioned for larger s than the monomial basis.
+ *
+ * @{
+ **/
+
+/**
+ * Prepare to solve the system.  The coefficient data in \e b and \e x is
+ * ignored here, but information about the layout of the data may be used.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetup(HYPRE_Solver solver,
+                             HYPRE_Matrix A,
+                             HYPRE_Vector b,
+                             HYPRE_Vector x);
+
+/**
+ * Solve the system.
+ **/
+HYPRE_Int HYPRE_CAGMRESSolve(HYPRE_Solver solver,
+                             HYPRE_Matrix A,
+                             HYPRE_Vector b,
+                             HYPRE_Vector x);
+
+/**
+ * (Optional) Set the convergence tolerance.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetTol(HYPRE_Solver solver,
+                              HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the absolute convergence tolerance (default is 0).
+ * If one desires
+ * the convergence test to check the absolute convergence tolerance \e only, then
+ * set the relative convergence tolerance to 0.0.  (The convergence test is
+ * \f$\|r\| \leq\f$ max(relative\f$\_\f$tolerance\f$\ast \|b\|\f$, absolute\f$\_\f$tolerance).)
+ *
+ **/
+HYPRE_Int HYPRE_CAGMRESSetAbsoluteTol(HYPRE_Solver solver,
+                                      HYPRE_Real   a_tol);
+
+/*
+ * RE-VISIT
+ **/
+HYPRE_Int HYPRE_CAGMRESSetMinIter(HYPRE_Solver solver,
+                                  HYPRE_Int    min_iter);
+
+/**
+ * (Optional) Set maximum number of iterations.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetMaxIter(HYPRE_Solver solver,
+                                  HYPRE_Int    max_iter);
+
+/**
+ * (Optional) Set the maximum size of the Krylov space (default is 20).
+ **/
+HYPRE_Int HYPRE_CAGMRESSetKDim(HYPRE_Solver solver,
+                               HYPRE_Int    k_dim);
+
+/**
+ * (Optional) Set the number of basis vectors generated per block (default
+ * is 4).  s = 1 gives GMRES with two-pass classical Gram-Schmidt.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetSStep(HYPRE_Solver solver,
+                                HYPRE_Int    s_step);
+
+/**
+ * (Optional) Set the basis of the s-step blocks.  0: monomial, 1: Newton
+ * (default).
+ **/
+HYPRE_Int HYPRE_CAGMRESSetBasis(HYPRE_Solver solver,
+                                HYPRE_Int    basis);
+
+/**
+ * (Optional) Skip the check of the true residual when the recursive
+ * residual norm converges.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetSkipRealResidualCheck(HYPRE_Solver solver,
+                                                HYPRE_Int    skip_real_r_check);
+
+/**
+ * (Optional) Set the preconditioner to use.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetPrecond(HYPRE_Solver         solver,
+                                  HYPRE_PtrToSolverFcn precond,
+                                  HYPRE_PtrToSolverFcn precond_setup,
+                                  HYPRE_Solver         precond_solver);
+
+/**
+ * (Optional) Set the amount of logging to do.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetLogging(HYPRE_Solver solver,
+                                  HYPRE_Int    logging);
+
+/**
+ * (Optional) Set the amount of printing to do to the screen.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetPrintLevel(HYPRE_Solver solver,
+                                     HYPRE_Int    level);
+
+/**
+ * Return the number of iterations taken.
+ **/
+HYPRE_Int HYPRE_CAGMRESGetNumIterations(HYPRE_Solver  solver,
+                                        HYPRE_Int    *num_iterations);
+
+/**
+ * Return the norm of the final relative residual.
+ **/
+HYPRE_Int HYPRE_CAGMRESGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                    HYPRE_Real   *norm);
+
+/**
+ * Return the residual.
+ **/
+HYPRE_Int HYPRE_CAGMRESGetResidual(HYPRE_Solver   solver,
+                                   void          *residual);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetTol(HYPRE_Solver  solver,
+                              HYPRE_Real   *tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetAbsoluteTol(HYPRE_Solver  solver,
+                                      HYPRE_Real   *a_tol);
+
+/*
+ * RE-VISIT
+ **/
+HYPRE_Int HYPRE_CAGMRESGetMinIter(HYPRE_Solver  solver,
+                                  HYPRE_Int    *min_iter);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetMaxIter(HYPRE_Solver  solver,
+                                  HYPRE_Int    *max_iter);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetKDim(HYPRE_Solver  solver,
+                               HYPRE_Int    *k_dim);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetSStep(HYPRE_Solver  solver,
+                                HYPRE_Int    *s_step);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetBasis(HYPRE_Solver  solver,
+                                HYPRE_Int    *basis);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetSkipRealResidualCheck(HYPRE_Solver  solver,
+                                                HYPRE_Int    *skip_real_r_check);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetPrecond(HYPRE_Solver  solver,
+                                  HYPRE_Solver *precond_data_ptr);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetLogging(HYPRE_Solver  solver,
+                                  HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetPrintLevel(HYPRE_Solver  solver,
+                                     HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetConverged(HYPRE_Solver  solver,
+                                    HYPRE_Int    *converged);
+
+/**@}*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name BPCG Solver
+ *
+ * Block preconditioned conjugate gradient for several right-hand sides with
+ * the same matrix.  The unconverged systems share one Krylov space: the
+ * matrix and the preconditioner are applied to a block of search directions,
+ * and all inner products of an iteration are computed in three global
+ * reductions, independently of the number of right-hand sides.  Linearly
+ * dependent search directions are dropped and converged systems are removed
+ * from the block.
+ *
+ * @{
+ **/
+
+/**
+ * Prepare to solve the systems A x_j = b_j, j < num\_rhs.  The coefficient
+ * data in \e b and \e x is ignored here, but information about the layout of
+ * the data may be used.  The work space is allocated for num\_rhs systems.
+ **/
+HYPRE_Int HYPRE_BPCGSetup(HYPRE_Solver  solver,
+                          HYPRE_Matrix  A,
+                          HYPRE_Int     num_rhs,
+                          HYPRE_Vector *b,
+                          HYPRE_Vector *x);
+
+/**
+ * Solve the systems A x_j = b_j, j < num\_rhs.  At most as many right-hand
+ * sides as in the setup can be used.
+ **/
+HYPRE_Int HYPRE_BPCGSolve(HYPRE_Solver  solver,
+                          HYPRE_Matrix  A,
+                          HYPRE_Int     num_rhs,
+                          HYPRE_Vector *b,
+                          HYPRE_Vector *x);
+
+/**
+ * (Optional) Set the relative convergence tolerance.  Each system is
+ * converged when \f$\|r_j\| \leq\f$ max(relative\f$\_\f$tolerance\f$\ast
+ * \|b_j\|\f$, absolute\f$\_\f$tolerance), in the 2-norm.
+ **/
+HYPRE_Int HYPRE_BPCGSetTol(HYPRE_Solver solver,
+                           HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the absolute convergence tolerance (default is 0).
+ **/
+HYPRE_Int HYPRE_BPCGSetAbsoluteTol(HYPRE_Solver solver,
+                                   HYPRE_Real   a_tol);
+
+/**
+ * (Optional) Set maximum number of (block) iterations.
+ **/
+HYPRE_Int HYPRE_BPCGSetMaxIter(HYPRE_Solver solver,
+                               HYPRE_Int    max_iter);
+
+/**
+ * (Optional) Set the preconditioner to use.  It is applied to each vector of
+ * a block.
+ **/
+HYPRE_Int HYPRE_BPCGSetPrecond(HYPRE_Solver         solver,
+                               HYPRE_PtrToSolverFcn precond,
+                               HYPRE_PtrToSolverFcn precond_setup,
+                               HYPRE_Solver         precond_solver);
+
+/**
+ * (Optional) Set the amount of logging to do.
+ **/
+HYPRE_Int HYPRE_BPCGSetLogging(HYPRE_Solver solver,
+                               HYPRE_Int    logging);
+
+/**
+ * (Optional) Set the amount of printing to do to the screen.
+ **/
+HYPRE_Int HYPRE_BPCGSetPrintLevel(HYPRE_Solver solver,
+                                  HYPRE_Int    level);
+
+/**
+ * Return the number of block iterations taken.
+ **/
+HYPRE_Int HYPRE_BPCGGetNumIterations(HYPRE_Solver  solver,
+                                     HYPRE_Int    *num_iterations);
+
+/**
+ * Return the largest final relative residual norm of the systems.
+ **/
+HYPRE_Int HYPRE_BPCGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                 HYPRE_Real   *norm);
+
+/**
+ **/
+HYPRE_Int HYPRE_BPCGGetTol(HYPRE_Solver  solver,
+                           HYPRE_Real   *tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_BPCGGetAbsoluteTol(HYPRE_Solver  solver,
+                                   HYPRE_Real   *a_tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_BPCGGetMaxIter(HYPRE_Solver  solver,
+                               HYPRE_Int    *max_iter);
+
+/**
+ **/
+HYPRE_Int HYPRE_BPCGGetPrecond(HYPRE_Solver  solver,
+                               HYPRE_Solver *precond_data_ptr);
+
+/**
+ **/
+HYPRE_Int HYPRE_BPCGGetLogging(HYPRE_Solver  solver,
+                               HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_BPCGGetPrintLevel(HYPRE_Solver  solver,
+                                  HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_BPCGGetConverged(HYPRE_Solver  solver,
+                                 HYPRE_Int    *converged);
+
+/**@}*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name BGMRES Solver
+ *
+ * Restarted block GMRES for several right-hand sides with the same matrix.
+ * The unconverged systems share one block Krylov space; a block step costs
+ * four global reductions, independently of the number of right-hand sides.
+ * Dependent basis vectors are dropped, and converged systems are removed from
+ * the block at each restart.
+ *
+ * @{
+ **/
+
+/**
+ * Prepare to solve the systems A x_j = b_j, j < num\_rhs.  The coefficient
+ * data in \e b and \e x is ignored here, but information about the layout of
+ * the data may be used.  The work space is allocated for num\_rhs systems.
+ **/
+HYPRE_Int HYPRE_BGMRESSetup(HYPRE_Solver  solver,
+                            HYPRE_Matrix  A,
+                            HYPRE_Int     num_rhs,
+                            HYPRE_Vector *b,
+                            HYPRE_Vector *x);
+
+/**
+ * Solve the systems A x_j = b_j, j < num\_rhs.  At most as many right-hand
+ * sides as in the setup can be used.
+ **/
+HYPRE_Int HYPRE_BGMRESSolve(HYPRE_Solver  solver,
+                            HYPRE_Matrix  A,
+                            HYPRE_Int     num_rhs,
+                            HYPRE_Vector *b,
+                            HYPRE_Vector *x);
+
+/**
+ * (Optional) Set the relative convergence tolerance.  Each system is
+ * converged when \f$\|r_j\| \leq\f$ max(relative\f$\_\f$tolerance\f$\ast
+ * \|b_j\|\f$, absolute\f$\_\f$tolerance), in the 2-norm.
+ **/
+HYPRE_Int HYPRE_BGMRESSetTol(HYPRE_Solver solver,
+                             HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the absolute convergence tolerance (default is 0).
+ **/
+HYPRE_Int HYPRE_BGMRESSetAbsoluteTol(HYPRE_Solver solver,
+                                     HYPRE_Real   a_tol);
+
+/**
+ * (Optional) Set maximum number of (block) iterations.
+ **/
+HYPRE_Int HYPRE_BGMRESSetMaxIter(HYPRE_Solver solver,
+                                 HYPRE_Int    max_iter);
+
+/**
+ * (Optional) Set the number of block steps between restarts (default is 5).
+ * The basis holds up to (k\_dim+1) num\_rhs vectors.
+ **/
+HYPRE_Int HYPRE_BGMRESSetKDim(HYPRE_Solver solver,
+                              HYPRE_Int    k_dim);
+
+/**
+ * (Optional) Set the preconditioner to use.  It is applied to each vector of
+ * a block.
+ **/
+HYPRE_Int HYPRE_BGMRESSetPrecond(HYPRE_Solver         solver,
+                                 HYPRE_PtrToSolverFcn precond,
+                                 HYPRE_PtrToSolverFcn precond_setup,
+                                 HYPRE_Solver         precond_solver);
+
+/**
+ * (Optional) Set the amount of logging to do.
+ **/
+HYPRE_Int HYPRE_BGMRESSetLogging(HYPRE_Solver solver,
+                                 HYPRE_Int    logging);
+
+/**
+ * (Optional) Set the amount of printing to do to the screen.
+ **/
+HYPRE_Int HYPRE_BGMRESSetPrintLevel(HYPRE_Solver solver,
+                                    HYPRE_Int    level);
+
+/**
+ * Return the number of block iterations taken.
+ **/
+HYPRE_Int HYPRE_BGMRESGetNumIterations(HYPRE_Solver  solver,
+                                       HYPRE_Int    *num_iterations);
+
+/**
+ * Return the largest final relative residual norm of the systems.
+ **/
+HYPRE_Int HYPRE_BGMRESGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                   HYPRE_Real   *norm);
+
+/**
+ **/
+HYPRE_Int HYPRE_BGMRESGetTol(HYPRE_Solver  solver,
+                             HYPRE_Real   *tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_BGMRESGetAbsoluteTol(HYPRE_Solver  solver,
+                                     HYPRE_Real   *a_tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_BGMRESGetMaxIter(HYPRE_Solver  solver,
+                                 HYPRE_Int    *max_iter);
+
+/**
+ **/
+HYPRE_Int HYPRE_BGMRESGetKDim(HYPRE_Solver  solver,
+                              HYPRE_Int    *k_dim);
+
+/**
+ **/
+HYPRE_Int HYPRE_BGMRESGetPrecond(HYPRE_Solver  solver,
+                                 HYPRE_Solver *precond_data_ptr);
+
+/**
+ **/
+HYPRE_Int HYPRE_BGMRESGetLogging(HYPRE_Solver  solver,
+                                 HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_BGMRESGetPrintLevel(HYPRE_Solver  solver,
+                                    HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_BGMRESGetConverged(HYPRE_Solver  solver,
+                                   HYPRE_Int    *converged);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
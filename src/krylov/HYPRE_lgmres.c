@@ -180,6 +180,24 @@ HYPRE_LGMRESGetMaxIter( HYPRE_Solver solver,
    return( hypre_LGMRESGetMaxIter( (void *) solver, max_iter ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_LGMRESSetCGS, HYPRE_LGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_LGMRESSetCGS( HYPRE_Solver solver,
+                    HYPRE_Int    cgs )
+{
+   return( hypre_LGMRESSetCGS( (void *) solver, cgs ) );
+}
+
+HYPRE_Int
+HYPRE_LGMRESGetCGS( HYPRE_Solver  solver,
+                    HYPRE_Int    *cgs )
+{
+   return( hypre_LGMRESGetCGS( (void *) solver, cgs ) );
+}
+
 
 
 /*--------------------------------------------------------------------------
@@ -252,6 +252,24 @@ HYPRE_PCGGetRecomputeResidualP( HYPRE_Solver  solver,
    return( hypre_PCGGetRecomputeResidualP( (void *) solver, recompute_residual_p ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGSetVariant, HYPRE_PCGGetVariant
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGSetVariant( HYPRE_Solver solver,
+                     HYPRE_Int    variant )
+{
+   return( hypre_PCGSetVariant( (void *) solver, variant ) );
+}
+
+HYPRE_Int
+HYPRE_PCGGetVariant( HYPRE_Solver  solver,
+                     HYPRE_Int    *variant )
+{
+   return( hypre_PCGGetVariant( (void *) solver, variant ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_PCGSetPrecond
  *--------------------------------------------------------------------------*/
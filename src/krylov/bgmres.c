@@ -0,0 +1,1253 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * BGMRES bgmres
+ *
+ * Restarted block GMRES for several right-hand sides.  The unconverged
+ * systems share one block Krylov space, built a block at a time with a fixed
+ * number of global reductions per block; dependent basis vectors are dropped
+ * and converged systems are removed from the block at each restart.
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESFunctionsCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_BGMRESFunctions *
+hypre_BGMRESFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecBlock)   ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   HYPRE_Int k, void **x, HYPRE_Complex beta, void **y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+   )
+{
+   hypre_BGMRESFunctions * bgmres_functions;
+   bgmres_functions = (hypre_BGMRESFunctions *)
+    CAlloc( 1, sizeof(hypre_BGMRESFunctions), HYPRE_MEMORY_HOST );
+
+   bgmres_functions->CAlloc            = CAlloc;
+   bgmres_functions->Free              = Free;
+   bgmres_functions->CommInfo          = CommInfo;
+   bgmres_functions->CreateVector      = CreateVector;
+   bgmres_functions->CreateVectorArray = CreateVectorArray;
+   bgmres_functions->DestroyVector     = DestroyVector;
+   bgmres_functions->MatvecCreate      = MatvecCreate;
+   bgmres_functions->Matvec            = Matvec;
+   bgmres_functions->MatvecBlock       = MatvecBlock;
+   bgmres_functions->MatvecDestroy     = MatvecDestroy;
+   bgmres_functions->InnerProd         = InnerProd;
+   bgmres_functions->MultiInnerProd    = MultiInnerProd;
+   bgmres_functions->CopyVector        = CopyVector;
+   bgmres_functions->ClearVector       = ClearVector;
+   bgmres_functions->ScaleVector       = ScaleVector;
+   bgmres_functions->Axpy              = Axpy;
+   /* default preconditioner must be set here but can be changed later... */
+   bgmres_functions->precond_setup     = PrecondSetup;
+   bgmres_functions->precond           = Precond;
+   bgmres_functions->precond_block     = NULL;
+
+   return bgmres_functions;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_BGMRESCreate( hypre_BGMRESFunctions *bgmres_functions )
+{
+   hypre_BGMRESData *bgmres_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   bgmres_data = hypre_CTAllocF(hypre_BGMRESData, 1, bgmres_functions, HYPRE_MEMORY_HOST);
+   bgmres_data->functions = bgmres_functions;
+
+   /* set defaults */
+   (bgmres_data -> k_dim)          = 5;
+   (bgmres_data -> num_rhs)        = 0;
+   (bgmres_data -> tol)            = 1.0e-06; /* relative residual tol */
+   (bgmres_data -> a_tol)          = 0.0; /* abs. residual tol */
+   (bgmres_data -> max_iter)       = 1000;
+   (bgmres_data -> converged)      = 0;
+   (bgmres_data -> precond_data)   = NULL;
+   (bgmres_data -> print_level)    = 0;
+   (bgmres_data -> logging)        = 0;
+   (bgmres_data -> p)              = NULL;
+   (bgmres_data -> r)              = NULL;
+   (bgmres_data -> w)              = NULL;
+   (bgmres_data -> matvec_data)    = NULL;
+   (bgmres_data -> norms)          = NULL;
+   (bgmres_data -> log_file_name)  = NULL;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return (void *) bgmres_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESDestroyVectorArray
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BGMRESDestroyVectorArray( hypre_BGMRESFunctions  *bgmres_functions,
+                                HYPRE_Int               n,
+                                void                  **v )
+{
+   HYPRE_Int i;
+
+   if (v != NULL)
+   {
+      for (i = 0; i < n; i++)
+      {
+         if (v[i] != NULL)
+            (*(bgmres_functions->DestroyVector))(v[i]);
+      }
+      hypre_TFreeF( v, bgmres_functions );
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESDestroy( void *bgmres_vdata )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+   if (bgmres_data)
+   {
+      hypre_BGMRESFunctions *bgmres_functions = bgmres_data->functions;
+      HYPRE_Int              num_rhs          = (bgmres_data -> num_rhs);
+      HYPRE_Int              k_dim            = (bgmres_data -> k_dim);
+
+      if ( (bgmres_data -> norms) != NULL )
+         hypre_TFreeF( bgmres_data -> norms, bgmres_functions );
+
+      if ( (bgmres_data -> matvec_data) != NULL )
+         (*(bgmres_functions->MatvecDestroy))(bgmres_data -> matvec_data);
+
+      hypre_BGMRESDestroyVectorArray(bgmres_functions, num_rhs, bgmres_data -> r);
+      hypre_BGMRESDestroyVectorArray(bgmres_functions, num_rhs, bgmres_data -> w);
+      hypre_BGMRESDestroyVectorArray(bgmres_functions, (k_dim+1)*num_rhs, bgmres_data -> p);
+
+      hypre_TFreeF( bgmres_data, bgmres_functions );
+      hypre_TFreeF( bgmres_functions, bgmres_functions );
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESSetup
+ *
+ * The work vectors are allocated for num_rhs right-hand sides; a later solve
+ * may use at most as many.  The basis holds (k_dim+1)*num_rhs vectors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESSetup( void       *bgmres_vdata,
+                   void       *A,
+                   HYPRE_Int   num_rhs,
+                   void      **b,
+                   void      **x )
+{
+   hypre_BGMRESData *bgmres_data     = (hypre_BGMRESData *)bgmres_vdata;
+   hypre_BGMRESFunctions *bgmres_functions = bgmres_data->functions;
+
+   HYPRE_Int k_dim            = (bgmres_data -> k_dim);
+   HYPRE_Int max_iter         = (bgmres_data -> max_iter);
+   HYPRE_Int (*precond_setup)(void*,void*,void*,void*) = (bgmres_functions->precond_setup);
+   void       *precond_data   = (bgmres_data -> precond_data);
+
+   if (num_rhs < 1)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (bgmres_data -> A) = A;
+
+   /*--------------------------------------------------
+    * The arguments for NewVector are important to
+    * maintain consistency between the setup and
+    * compute phases of matvec and the preconditioner.
+    *--------------------------------------------------*/
+
+   if ((bgmres_data -> num_rhs) != num_rhs)
+   {
+      hypre_BGMRESDestroyVectorArray(bgmres_functions, bgmres_data -> num_rhs,
+                                     bgmres_data -> r);
+      hypre_BGMRESDestroyVectorArray(bgmres_functions, bgmres_data -> num_rhs,
+                                     bgmres_data -> w);
+      hypre_BGMRESDestroyVectorArray(bgmres_functions, (k_dim+1)*(bgmres_data -> num_rhs),
+                                     bgmres_data -> p);
+      (bgmres_data -> r) = NULL;
+      (bgmres_data -> w) = NULL;
+      (bgmres_data -> p) = NULL;
+      (bgmres_data -> num_rhs) = num_rhs;
+   }
+
+   if ((bgmres_data -> p) == NULL)
+      (bgmres_data -> p) = (void**)(*(bgmres_functions->CreateVectorArray))((k_dim+1)*num_rhs,x[0]);
+   if ((bgmres_data -> r) == NULL)
+      (bgmres_data -> r) = (void**)(*(bgmres_functions->CreateVectorArray))(num_rhs,b[0]);
+   if ((bgmres_data -> w) == NULL)
+      (bgmres_data -> w) = (void**)(*(bgmres_functions->CreateVectorArray))(num_rhs,b[0]);
+
+   if ((bgmres_data -> matvec_data) == NULL)
+      (bgmres_data -> matvec_data) = (*(bgmres_functions->MatvecCreate))(A, x[0]);
+
+   precond_setup(precond_data, A, b[0], x[0]);
+
+   /*-----------------------------------------------------
+    * Allocate space for log info
+    *-----------------------------------------------------*/
+
+   if ( (bgmres_data->logging)>0 || (bgmres_data->print_level) > 0 )
+   {
+      if ((bgmres_data -> norms) == NULL)
+         (bgmres_data -> norms) = hypre_CTAllocF(HYPRE_Real, max_iter + 1,bgmres_functions, HYPRE_MEMORY_HOST);
+   }
+   if ( (bgmres_data->print_level) > 0 )
+   {
+      if ((bgmres_data -> log_file_name) == NULL)
+         (bgmres_data -> log_file_name) = (char*)"bgmres.out.log";
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESMatvecBlock
+ *
+ * y[j] = alpha A x[j] + beta y[j], j < k, with the block matvec if there is
+ * one, and one column at a time otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BGMRESMatvecBlock( hypre_BGMRESFunctions  *bgmres_functions,
+                         void                   *matvec_data,
+                         HYPRE_Complex           alpha,
+                         void                   *A,
+                         HYPRE_Int               k,
+                         void                  **x,
+                         HYPRE_Complex           beta,
+                         void                  **y )
+{
+   HYPRE_Int j;
+
+   if (bgmres_functions->MatvecBlock)
+   {
+      return (*(bgmres_functions->MatvecBlock))(matvec_data, alpha, A, k, x, beta, y);
+   }
+
+   for (j = 0; j < k; j++)
+   {
+      (*(bgmres_functions->Matvec))(matvec_data, alpha, A, x[j], beta, y[j]);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESPrecondBlock
+ *
+ * x[j] = M b[j], j < k, starting from zero initial guesses, with the block
+ * preconditioner if there is one, and one column at a time otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BGMRESPrecondBlock( hypre_BGMRESFunctions  *bgmres_functions,
+                          void                   *precond_data,
+                          void                   *A,
+                          HYPRE_Int               k,
+                          void                  **b,
+                          void                  **x )
+{
+   HYPRE_Int (*precond)(void*,void*,void*,void*) = (bgmres_functions -> precond);
+   HYPRE_Int (*precond_block)(void*,void*,HYPRE_Int,void**,void**) = (bgmres_functions -> precond_block);
+   HYPRE_Int j;
+
+   for (j = 0; j < k; j++)
+   {
+      (*(bgmres_functions->ClearVector))(x[j]);
+   }
+
+   if (precond_block)
+   {
+      return precond_block(precond_data, A, k, b, x);
+   }
+
+   for (j = 0; j < k; j++)
+   {
+      precond(precond_data, A, b[j], x[j]);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESBlockQR
+ *
+ * Rank-revealing QR of the n vectors v, in place.  The first pass is a
+ * Cholesky QR of the Gram matrix scaled to unit diagonal, which skips the
+ * columns whose pivot falls below drop_tol, as well as the columns whose norm
+ * has dropped below 1e-12 of ref_norm2 (squared norms before an earlier
+ * orthogonalization, if given).  The kept columns are moved to the front of v
+ * and orthonormalized; a second Cholesky QR pass restores orthogonality.
+ * Returns the number nk of kept columns and the nk x n factor R (row-major,
+ * leading dimension n), so that v_in[j] = sum_i v_out[i] R[i][j] for all j,
+ * up to the dropped components.
+ *
+ * The work arrays G, Rp have length n*n, keep and scale length n, and dot_x,
+ * dot_y, local and result length at least n*(n+1)/2.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BGMRESBlockQR( hypre_BGMRESFunctions  *bgmres_functions,
+                     HYPRE_Int               n,
+                     void                  **v,
+                     HYPRE_Real             *R,
+                     HYPRE_Real             *ref_norm2,
+                     HYPRE_Real             *G,
+                     HYPRE_Real             *Rp,
+                     HYPRE_Int              *keep,
+                     HYPRE_Real             *scale,
+                     void                  **dot_x,
+                     void                  **dot_y,
+                     HYPRE_Real             *local,
+                     HYPRE_Real             *result )
+{
+   hypre_MPI_Request  request;
+   hypre_MPI_Status   status;
+   HYPRE_Int          i, j, k, l, nk, kj, cnt;
+   HYPRE_Real         d, t;
+   void              *tmp;
+
+   HYPRE_Real         drop_tol = 1.0e-10;
+
+   /* first pass: Gram matrix, upper triangle */
+   cnt = 0;
+   for (i = 0; i < n; i++)
+   {
+      for (j = i; j < n; j++)
+      {
+         dot_x[cnt] = v[i];
+         dot_y[cnt] = v[j];
+         cnt++;
+      }
+   }
+   hypre_KrylovMultiInnerProd(bgmres_functions->MultiInnerProd, bgmres_functions->InnerProd,
+                              cnt, dot_x, dot_y, local, result, &request);
+   hypre_MPI_Wait(&request, &status);
+
+   cnt = 0;
+   for (i = 0; i < n; i++)
+   {
+      for (j = i; j < n; j++)
+      {
+         G[i*n+j] = result[cnt++];
+      }
+   }
+
+   for (i = 0; i < n*n; i++)
+   {
+      R[i] = 0.0;
+   }
+
+   /* Cholesky factorization of D G D, D = diag(G)^{-1/2}, skipping the
+      dependent columns; column j of R is kept at its original index */
+   nk = 0;
+   for (j = 0; j < n; j++)
+   {
+      if (!(G[j*n+j] > 0.0) ||
+          (ref_norm2 != NULL && G[j*n+j] <= 1.0e-24 * ref_norm2[j]))
+      {
+         scale[j] = 0.0;
+         continue;
+      }
+      scale[j] = 1.0 / sqrt(G[j*n+j]);
+
+      d = 1.0;
+      for (k = 0; k < nk; k++)
+      {
+         kj = keep[k];
+         t = G[kj*n+j] * scale[kj] * scale[j];
+         for (l = 0; l < k; l++)
+         {
+            t -= R[l*n+kj] * R[l*n+j];
+         }
+         R[k*n+j] = t / R[k*n+kj];
+         d -= R[k*n+j] * R[k*n+j];
+      }
+      if (d <= drop_tol)
+      {
+         continue;
+      }
+      R[nk*n+j] = sqrt(d);
+      keep[nk++] = j;
+   }
+
+   /* undo the scaling: R <- R D^{-1} */
+   for (i = 0; i < nk; i++)
+   {
+      for (j = 0; j < n; j++)
+      {
+         R[i*n+j] = (scale[j] > 0.0) ? R[i*n+j] / scale[j] : 0.0;
+      }
+   }
+
+   /* move the kept columns to the front; keep is increasing */
+   for (k = 0; k < nk; k++)
+   {
+      tmp = v[k]; v[k] = v[keep[k]]; v[keep[k]] = tmp;
+   }
+
+   /* v <- v R(:,keep)^{-1} */
+   for (j = 0; j < nk; j++)
+   {
+      for (k = 0; k < j; k++)
+      {
+         (*(bgmres_functions->Axpy))(-R[k*n+keep[j]], v[k], v[j]);
+      }
+      (*(bgmres_functions->ScaleVector))(1.0/R[j*n+keep[j]], v[j]);
+   }
+
+   if (nk == 0)
+   {
+      return nk;
+   }
+
+   /* second pass on the kept columns */
+   cnt = 0;
+   for (i = 0; i < nk; i++)
+   {
+      for (j = i; j < nk; j++)
+      {
+         dot_x[cnt] = v[i];
+         dot_y[cnt] = v[j];
+         cnt++;
+      }
+   }
+   hypre_KrylovMultiInnerProd(bgmres_functions->MultiInnerProd, bgmres_functions->InnerProd,
+                              cnt, dot_x, dot_y, local, result, &request);
+   hypre_MPI_Wait(&request, &status);
+
+   cnt = 0;
+   for (i = 0; i < nk; i++)
+   {
+      for (j = i; j < nk; j++)
+      {
+         G[i*nk+j] = result[cnt++];
+      }
+   }
+   for (j = 0; j < nk; j++)
+   {
+      d = G[j*nk+j];
+      for (k = 0; k < j; k++)
+      {
+         d -= Rp[k*nk+j] * Rp[k*nk+j];
+      }
+      if (d <= 0.0)
+      {
+         /* keep the result of the first pass */
+         return nk;
+      }
+      Rp[j*nk+j] = sqrt(d);
+      for (i = j+1; i < nk; i++)
+      {
+         t = G[j*nk+i];
+         for (k = 0; k < j; k++)
+         {
+            t -= Rp[k*nk+j] * Rp[k*nk+i];
+         }
+         Rp[j*nk+i] = t / Rp[j*nk+j];
+      }
+   }
+
+   /* v <- v Rp^{-1}, R <- Rp R */
+   for (j = 0; j < nk; j++)
+   {
+      for (k = 0; k < j; k++)
+      {
+         (*(bgmres_functions->Axpy))(-Rp[k*nk+j], v[k], v[j]);
+      }
+      (*(bgmres_functions->ScaleVector))(1.0/Rp[j*nk+j], v[j]);
+   }
+   for (i = 0; i < nk; i++)
+   {
+      for (j = 0; j < n; j++)
+      {
+         t = 0.0;
+         for (k = i; k < nk; k++)
+         {
+            t += Rp[i*nk+k] * R[k*n+j];
+         }
+         R[i*n+j] = t;
+      }
+   }
+
+   return nk;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESSolve
+ *
+ * Restarted block GMRES with right preconditioning.  A cycle starts from the
+ * residuals R of the na active systems, R = V_0 S.  Block step c applies A M
+ * to the newest block V_c, orthogonalizes the result against V_0,...,V_c
+ * (block CGS2) and factors it into V_{c+1} (rank-revealing Cholesky QR), which
+ * gives the banded Hessenberg matrix H with A M [V_0..V_c] = [V_0..V_{c+1}] H.
+ * H is reduced to triangular form with Givens rotations, which are also
+ * applied to S, so that the residual norm of every system is available after
+ * each block step.  The cycle ends after k_dim block steps or when all active
+ * systems have converged; the systems that have converged are then removed
+ * from the block.  The convergence test is on the 2-norm of each residual:
+ * |r_j| <= max(a_tol, r_tol |b_j|).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESSolve( void       *bgmres_vdata,
+                   void       *A,
+                   HYPRE_Int   num_rhs,
+                   void      **b,
+                   void      **x )
+{
+   hypre_BGMRESData      *bgmres_data      = (hypre_BGMRESData *)bgmres_vdata;
+   hypre_BGMRESFunctions *bgmres_functions = bgmres_data->functions;
+   HYPRE_Int     k_dim             = (bgmres_data -> k_dim);
+   HYPRE_Int     max_iter          = (bgmres_data -> max_iter);
+   HYPRE_Real    r_tol             = (bgmres_data -> tol);
+   HYPRE_Real    a_tol             = (bgmres_data -> a_tol);
+   void         *matvec_data       = (bgmres_data -> matvec_data);
+
+   void        **r                 = (bgmres_data -> r);
+   void        **w                 = (bgmres_data -> w);
+   void        **p                 = (bgmres_data -> p);
+
+   void       *precond_data       = (bgmres_data -> precond_data);
+
+   HYPRE_Int print_level = (bgmres_data -> print_level);
+   HYPRE_Int logging     = (bgmres_data -> logging);
+
+   HYPRE_Real     *norms          = (bgmres_data -> norms);
+
+   hypre_MPI_Request  request;
+   hypre_MPI_Status   status;
+
+   HYPRE_Int   i, j, k, l, n, m, na, nb, nk, nv, nc, b0, b1;
+   HYPRE_Int   iter, blk, cycle_done, est_conv, ldh, nrot;
+   HYPRE_Int   my_id, num_procs;
+   HYPRE_Int  *active, *keep, *rot_i, *rot_k;
+   void      **xa, **dot_x, **dot_y;
+   void       *vtmp;
+   HYPRE_Real *b_norm, *r_norm, *epsilon, *rel_norm, *ref_norm2;
+   HYPRE_Real *hh, *rs, *cs, *sn, *col, *Rq, *G, *Rp, *scale;
+   HYPRE_Real *local, *result;
+   HYPRE_Real  t, ta, tb, gamma, max_rel_norm, max_rel_norm_old;
+
+   HYPRE_Real epsmac = 1.e-16;
+   HYPRE_Real ieee_check = 0.;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (bgmres_data -> converged) = 0;
+
+   m = num_rhs;
+   if (m < 1 || m > (bgmres_data -> num_rhs))
+   {
+      hypre_error_in_arg(3);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   (*(bgmres_functions->CommInfo))(A,&my_id,&num_procs);
+   if ( logging>0 || print_level>0 )
+   {
+      norms = (bgmres_data -> norms);
+   }
+
+   /* rows of the block Hessenberg matrix; the largest reduction is the
+      projection of a block onto the whole basis */
+   ldh = (k_dim+1)*m;
+   n = ldh*m + m;
+
+   b_norm   = hypre_CTAllocF(HYPRE_Real, m, bgmres_functions, HYPRE_MEMORY_HOST);
+   r_norm   = hypre_CTAllocF(HYPRE_Real, m, bgmres_functions, HYPRE_MEMORY_HOST);
+   local    = hypre_CTAllocF(HYPRE_Real, n, bgmres_functions, HYPRE_MEMORY_HOST);
+   result   = hypre_CTAllocF(HYPRE_Real, n, bgmres_functions, HYPRE_MEMORY_HOST);
+   dot_x    = hypre_CTAllocF(void *, n, bgmres_functions, HYPRE_MEMORY_HOST);
+   dot_y    = hypre_CTAllocF(void *, n, bgmres_functions, HYPRE_MEMORY_HOST);
+
+   /* compute initial residuals and the norms of b and r in one reduction */
+   for (j = 0; j < m; j++)
+   {
+      (*(bgmres_functions->CopyVector))(b[j], r[j]);
+   }
+   hypre_BGMRESMatvecBlock(bgmres_functions, matvec_data, -1.0, A, m, x, 1.0, r);
+   for (j = 0; j < m; j++)
+   {
+      dot_x[j]   = b[j];
+      dot_y[j]   = b[j];
+      dot_x[m+j] = r[j];
+      dot_y[m+j] = r[j];
+   }
+   hypre_KrylovMultiInnerProd(bgmres_functions->MultiInnerProd, bgmres_functions->InnerProd,
+                              2*m, dot_x, dot_y, local, result, &request);
+   hypre_MPI_Wait(&request, &status);
+
+   t = 0.0;
+   for (j = 0; j < m; j++)
+   {
+      b_norm[j] = sqrt(result[j]);
+      r_norm[j] = sqrt(result[m+j]);
+      t += result[j] + result[m+j];
+   }
+
+   /* Since it is does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input. */
+   if (t != 0.) ieee_check = t/t; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      /* ...INFs or NaNs in input can make ieee_check a NaN.  This test
+         for ieee_check self-equality works on all IEEE-compliant compilers/
+         machines, c.f. page 8 of "Lecture Notes on the Status of IEEE 754"
+         by W. Kahan, May 31, 1996.  Currently (July 2002) this paper may be
+         found at http://HTTP.CS.Berkeley.EDU/~wkahan/ieee754status/IEEE754.PDF */
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_BGMRESSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A, b or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+
+      hypre_TFreeF(b_norm,bgmres_functions);
+      hypre_TFreeF(r_norm,bgmres_functions);
+      hypre_TFreeF(local,bgmres_functions);
+      hypre_TFreeF(result,bgmres_functions);
+      hypre_TFreeF(dot_x,bgmres_functions);
+      hypre_TFreeF(dot_y,bgmres_functions);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   epsilon   = hypre_CTAllocF(HYPRE_Real, m, bgmres_functions, HYPRE_MEMORY_HOST);
+   rel_norm  = hypre_CTAllocF(HYPRE_Real, m, bgmres_functions, HYPRE_MEMORY_HOST);
+   ref_norm2 = hypre_CTAllocF(HYPRE_Real, m, bgmres_functions, HYPRE_MEMORY_HOST);
+   active    = hypre_CTAllocF(HYPRE_Int, m, bgmres_functions, HYPRE_MEMORY_HOST);
+   keep      = hypre_CTAllocF(HYPRE_Int, m, bgmres_functions, HYPRE_MEMORY_HOST);
+   scale     = hypre_CTAllocF(HYPRE_Real, m, bgmres_functions, HYPRE_MEMORY_HOST);
+   xa        = hypre_CTAllocF(void *, m, bgmres_functions, HYPRE_MEMORY_HOST);
+   Rq        = hypre_CTAllocF(HYPRE_Real, m*m, bgmres_functions, HYPRE_MEMORY_HOST);
+   G         = hypre_CTAllocF(HYPRE_Real, m*m, bgmres_functions, HYPRE_MEMORY_HOST);
+   Rp        = hypre_CTAllocF(HYPRE_Real, m*m, bgmres_functions, HYPRE_MEMORY_HOST);
+   /* block Hessenberg matrix by columns, and the rotated right-hand sides */
+   hh        = hypre_CTAllocF(HYPRE_Real, ldh*k_dim*m, bgmres_functions, HYPRE_MEMORY_HOST);
+   rs        = hypre_CTAllocF(HYPRE_Real, ldh*m, bgmres_functions, HYPRE_MEMORY_HOST);
+   /* a column eliminates at most 2m-1 subdiagonal entries */
+   rot_i     = hypre_CTAllocF(HYPRE_Int, 2*k_dim*m*m, bgmres_functions, HYPRE_MEMORY_HOST);
+   rot_k     = hypre_CTAllocF(HYPRE_Int, 2*k_dim*m*m, bgmres_functions, HYPRE_MEMORY_HOST);
+   cs        = hypre_CTAllocF(HYPRE_Real, 2*k_dim*m*m, bgmres_functions, HYPRE_MEMORY_HOST);
+   sn        = hypre_CTAllocF(HYPRE_Real, 2*k_dim*m*m, bgmres_functions, HYPRE_MEMORY_HOST);
+
+   /* convergence criteria: |r_j| <= max( a_tol, r_tol * |b_j| ), or
+      relative to |r_j| at the start if b_j = 0 */
+   na = 0;
+   max_rel_norm = 0.0;
+   for (j = 0; j < m; j++)
+   {
+      t = (b_norm[j] > 0.0) ? b_norm[j] : r_norm[j];
+      epsilon[j]  = hypre_max(a_tol, r_tol*t);
+      rel_norm[j] = (t > 0.0) ? r_norm[j]/t : r_norm[j];
+      max_rel_norm = hypre_max(max_rel_norm, rel_norm[j]);
+      b_norm[j]   = t;
+      if (r_norm[j] > epsilon[j])
+      {
+         /* keep the residuals of the active systems in front */
+         vtmp = r[na]; r[na] = r[j]; r[j] = vtmp;
+         active[na] = j;
+         xa[na] = x[j];
+         na++;
+      }
+   }
+
+   if ( logging>0 || print_level > 0)
+   {
+      norms[0] = max_rel_norm;
+      if ( print_level>1 && my_id == 0 )
+      {
+         hypre_printf("Number of right-hand sides: %d\n", m);
+         hypre_printf("Initial max. relative residual norm: %e\n", max_rel_norm);
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters   active   max.rel.res.norm   conv.rate\n");
+         hypre_printf("-----   ------   ----------------   ---------\n");
+      }
+   }
+
+   iter = 0;
+   while (na > 0 && iter < max_iter)
+   {
+      /* R = V_0 S, S in the first rows of rs */
+      for (j = 0; j < na; j++)
+      {
+         (*(bgmres_functions->CopyVector))(r[j], p[j]);
+      }
+      nv = hypre_BGMRESBlockQR(bgmres_functions, na, p, Rq, NULL, G, Rp,
+                               keep, scale, dot_x, dot_y, local, result);
+      if (nv == 0)
+      {
+         break;
+      }
+      for (i = 0; i < ldh*na; i++)
+      {
+         rs[i] = 0.0;
+      }
+      for (j = 0; j < na; j++)
+      {
+         for (i = 0; i < nv; i++)
+         {
+            rs[j*ldh+i] = Rq[i*na+j];
+         }
+      }
+
+      nrot = 0;
+      nc = 0;
+      est_conv = 0;
+      b0 = 0;
+      b1 = nv;
+      cycle_done = 0;
+      for (blk = 0; blk < k_dim && !cycle_done; blk++)
+      {
+         nb = b1 - b0;
+
+         /* W = A M V_c, in p[b1], ..., p[b1+nb-1] */
+         hypre_BGMRESPrecondBlock(bgmres_functions, precond_data, A, nb, &p[b0], w);
+         hypre_BGMRESMatvecBlock(bgmres_functions, matvec_data, 1.0, A, nb, w, 0.0, &p[b1]);
+
+         /* block CGS2 against V_0,...,V_c; the first reduction also gives
+            the norms of W for the rank test */
+         for (i = 0; i < nb; i++)
+         {
+            col = &hh[(b0+i)*ldh];
+            for (k = 0; k < ldh; k++)
+            {
+               col[k] = 0.0;
+            }
+         }
+         for (l = 0; l < 2; l++)
+         {
+            n = 0;
+            for (i = 0; i < nb; i++)
+            {
+               for (k = 0; k < b1; k++)
+               {
+                  dot_x[n] = p[k];
+                  dot_y[n] = p[b1+i];
+                  n++;
+               }
+            }
+            if (l == 0)
+            {
+               for (i = 0; i < nb; i++)
+               {
+                  dot_x[n] = p[b1+i];
+                  dot_y[n] = p[b1+i];
+                  n++;
+               }
+            }
+            hypre_KrylovMultiInnerProd(bgmres_functions->MultiInnerProd, bgmres_functions->InnerProd,
+                                       n, dot_x, dot_y,
+                                       local, result, &request);
+            hypre_MPI_Wait(&request, &status);
+
+            for (i = 0; i < nb; i++)
+            {
+               col = &hh[(b0+i)*ldh];
+               for (k = 0; k < b1; k++)
+               {
+                  col[k] += result[i*b1+k];
+                  (*(bgmres_functions->Axpy))(-result[i*b1+k], p[k], p[b1+i]);
+               }
+               if (l == 0)
+               {
+                  ref_norm2[i] = result[nb*b1+i];
+               }
+            }
+         }
+
+         /* W = V_{c+1} R_c */
+         nk = hypre_BGMRESBlockQR(bgmres_functions, nb, &p[b1], Rq, ref_norm2, G, Rp,
+                                  keep, scale, dot_x, dot_y, local, result);
+         for (i = 0; i < nb; i++)
+         {
+            col = &hh[(b0+i)*ldh];
+            for (k = 0; k < nk; k++)
+            {
+               col[b1+k] = Rq[k*nb+i];
+            }
+         }
+
+         /* reduce the new columns to triangular form */
+         for (i = 0; i < nb; i++)
+         {
+            nc = b0+i;
+            col = &hh[nc*ldh];
+            for (l = 0; l < nrot; l++)
+            {
+               ta = col[rot_i[l]];
+               tb = col[rot_k[l]];
+               col[rot_i[l]] =  cs[l]*ta + sn[l]*tb;
+               col[rot_k[l]] = -sn[l]*ta + cs[l]*tb;
+            }
+            for (k = nc+1; k < b1+nk; k++)
+            {
+               if (col[k] == 0.0)
+               {
+                  continue;
+               }
+               gamma = sqrt(col[nc]*col[nc] + col[k]*col[k]);
+               rot_i[nrot] = nc;
+               rot_k[nrot] = k;
+               cs[nrot] = col[nc]/gamma;
+               sn[nrot] = col[k]/gamma;
+               col[nc] = gamma;
+               col[k] = 0.0;
+               for (j = 0; j < na; j++)
+               {
+                  ta = rs[j*ldh+nc];
+                  tb = rs[j*ldh+k];
+                  rs[j*ldh+nc] =  cs[nrot]*ta + sn[nrot]*tb;
+                  rs[j*ldh+k]  = -sn[nrot]*ta + cs[nrot]*tb;
+               }
+               nrot++;
+            }
+            if (col[nc] == 0.0)
+            {
+               col[nc] = epsmac;
+            }
+         }
+         nc = b1;
+         b0 = b1;
+         b1 = b1+nk;
+         iter++;
+
+         /* residual norms of the active systems */
+         est_conv = 1;
+         for (j = 0; j < na; j++)
+         {
+            t = 0.0;
+            for (k = nc; k < b1; k++)
+            {
+               t += rs[j*ldh+k]*rs[j*ldh+k];
+            }
+            i = active[j];
+            r_norm[i] = sqrt(t);
+            rel_norm[i] = (b_norm[i] > 0.0) ? r_norm[i]/b_norm[i] : r_norm[i];
+            if (r_norm[i] > epsilon[i])
+            {
+               est_conv = 0;
+            }
+         }
+         cycle_done = est_conv;
+
+         max_rel_norm_old = max_rel_norm;
+         max_rel_norm = 0.0;
+         for (j = 0; j < m; j++)
+         {
+            max_rel_norm = hypre_max(max_rel_norm, rel_norm[j]);
+         }
+         if ( logging>0 || print_level>0 )
+         {
+            norms[iter] = max_rel_norm;
+            if ( print_level>1 && my_id == 0 )
+            {
+               hypre_printf("% 5d   % 6d   %e       %f\n", iter, na, max_rel_norm,
+                            (max_rel_norm_old > 0.0) ? max_rel_norm/max_rel_norm_old : 0.0);
+            }
+         }
+
+         /* exact breakdown: the basis spans the solutions */
+         if (nk == 0 || iter >= max_iter)
+         {
+            cycle_done = 1;
+         }
+      }
+
+      /* solve the triangular systems, Y in the first nc rows of rs */
+      for (j = 0; j < na; j++)
+      {
+         for (k = nc-1; k >= 0; k--)
+         {
+            t = rs[j*ldh+k];
+            for (i = k+1; i < nc; i++)
+            {
+               t -= hh[i*ldh+k] * rs[j*ldh+i];
+            }
+            rs[j*ldh+k] = t / hh[k*ldh+k];
+         }
+      }
+
+      /* X <- X + M V Y, then the true residuals */
+      for (j = 0; j < na; j++)
+      {
+         (*(bgmres_functions->ClearVector))(w[j]);
+         for (k = 0; k < nc; k++)
+         {
+            (*(bgmres_functions->Axpy))(rs[j*ldh+k], p[k], w[j]);
+         }
+      }
+      hypre_BGMRESPrecondBlock(bgmres_functions, precond_data, A, na, w, r);
+      for (j = 0; j < na; j++)
+      {
+         (*(bgmres_functions->Axpy))(1.0, r[j], xa[j]);
+         (*(bgmres_functions->CopyVector))(b[active[j]], r[j]);
+      }
+      hypre_BGMRESMatvecBlock(bgmres_functions, matvec_data, -1.0, A, na, xa, 1.0, r);
+      hypre_KrylovMultiInnerProd(bgmres_functions->MultiInnerProd, bgmres_functions->InnerProd,
+                                 na, r, r, local, result, &request);
+      hypre_MPI_Wait(&request, &status);
+
+      /* deflate the converged systems */
+      l = 0;
+      for (j = 0; j < na; j++)
+      {
+         i = active[j];
+         r_norm[i] = sqrt(result[j]);
+         rel_norm[i] = (b_norm[i] > 0.0) ? r_norm[i]/b_norm[i] : r_norm[i];
+         if (r_norm[i] > epsilon[i])
+         {
+            vtmp = r[l]; r[l] = r[j]; r[j] = vtmp;
+            active[l] = i;
+            xa[l] = xa[j];
+            l++;
+         }
+      }
+      /* report discrepancy between real/BGMRES residuals and restart */
+      if (est_conv && l > 0 && print_level > 0 && my_id == 0)
+      {
+         hypre_printf("false convergence, %d systems not converged\n", l);
+      }
+      na = l;
+
+      max_rel_norm = 0.0;
+      for (j = 0; j < m; j++)
+      {
+         max_rel_norm = hypre_max(max_rel_norm, rel_norm[j]);
+      }
+   }
+
+   if (na == 0)
+   {
+      (bgmres_data -> converged) = 1;
+   }
+   else if (iter >= max_iter)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   if (print_level > 1 && my_id == 0)
+   {
+      hypre_printf("\n\n");
+      hypre_printf("Final max. relative residual norm: %e\n\n", max_rel_norm);
+   }
+
+   (bgmres_data -> num_iterations)    = iter;
+   (bgmres_data -> rel_residual_norm) = max_rel_norm;
+
+   hypre_TFreeF(b_norm,bgmres_functions);
+   hypre_TFreeF(r_norm,bgmres_functions);
+   hypre_TFreeF(local,bgmres_functions);
+   hypre_TFreeF(result,bgmres_functions);
+   hypre_TFreeF(dot_x,bgmres_functions);
+   hypre_TFreeF(dot_y,bgmres_functions);
+   hypre_TFreeF(epsilon,bgmres_functions);
+   hypre_TFreeF(rel_norm,bgmres_functions);
+   hypre_TFreeF(ref_norm2,bgmres_functions);
+   hypre_TFreeF(active,bgmres_functions);
+   hypre_TFreeF(keep,bgmres_functions);
+   hypre_TFreeF(scale,bgmres_functions);
+   hypre_TFreeF(xa,bgmres_functions);
+   hypre_TFreeF(Rq,bgmres_functions);
+   hypre_TFreeF(G,bgmres_functions);
+   hypre_TFreeF(Rp,bgmres_functions);
+   hypre_TFreeF(hh,bgmres_functions);
+   hypre_TFreeF(rs,bgmres_functions);
+   hypre_TFreeF(rot_i,bgmres_functions);
+   hypre_TFreeF(rot_k,bgmres_functions);
+   hypre_TFreeF(cs,bgmres_functions);
+   hypre_TFreeF(sn,bgmres_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESSetKDim, hypre_BGMRESGetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESSetKDim( void   *bgmres_vdata,
+                     HYPRE_Int   k_dim )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+
+   if (k_dim < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (bgmres_data -> k_dim) = k_dim;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BGMRESGetKDim( void   *bgmres_vdata,
+                     HYPRE_Int * k_dim )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   *k_dim = (bgmres_data -> k_dim);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESSetTol, hypre_BGMRESGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESSetTol( void   *bgmres_vdata,
+                    HYPRE_Real  tol       )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   (bgmres_data -> tol) = tol;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BGMRESGetTol( void   *bgmres_vdata,
+                    HYPRE_Real  * tol      )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   *tol = (bgmres_data -> tol);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESSetAbsoluteTol, hypre_BGMRESGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESSetAbsoluteTol( void   *bgmres_vdata,
+                            HYPRE_Real  a_tol       )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   (bgmres_data -> a_tol) = a_tol;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BGMRESGetAbsoluteTol( void   *bgmres_vdata,
+                            HYPRE_Real  * a_tol      )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   *a_tol = (bgmres_data -> a_tol);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESSetMaxIter, hypre_BGMRESGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESSetMaxIter( void *bgmres_vdata,
+                        HYPRE_Int   max_iter  )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   (bgmres_data -> max_iter) = max_iter;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BGMRESGetMaxIter( void *bgmres_vdata,
+                        HYPRE_Int * max_iter  )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   *max_iter = (bgmres_data -> max_iter);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESSetPrecond( void  *bgmres_vdata,
+                        HYPRE_Int  (*precond)(void*,void*,void*,void*),
+                        HYPRE_Int  (*precond_setup)(void*,void*,void*,void*),
+                        void  *precond_data )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   hypre_BGMRESFunctions *bgmres_functions = bgmres_data->functions;
+   (bgmres_functions -> precond)        = precond;
+   (bgmres_functions -> precond_setup)  = precond_setup;
+   (bgmres_functions -> precond_block)  = NULL;
+   (bgmres_data -> precond_data)   = precond_data;
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESSetPrecondBlock
+ *
+ * Optional block version of the preconditioner set by hypre_BGMRESSetPrecond,
+ * applied to k vectors at once.  Setting the preconditioner resets it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESSetPrecondBlock( void  *bgmres_vdata,
+                             HYPRE_Int  (*precond_block)(void*,void*,HYPRE_Int,void**,void**) )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   hypre_BGMRESFunctions *bgmres_functions = bgmres_data->functions;
+   (bgmres_functions -> precond_block)  = precond_block;
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESGetPrecond( void         *bgmres_vdata,
+                        HYPRE_Solver *precond_data_ptr )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   *precond_data_ptr = (HYPRE_Solver)(bgmres_data -> precond_data);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESSetPrintLevel, hypre_BGMRESGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESSetPrintLevel( void *bgmres_vdata,
+                           HYPRE_Int   level)
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   (bgmres_data -> print_level) = level;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BGMRESGetPrintLevel( void *bgmres_vdata,
+                           HYPRE_Int * level)
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   *level = (bgmres_data -> print_level);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESSetLogging, hypre_BGMRESGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESSetLogging( void *bgmres_vdata,
+                        HYPRE_Int   level)
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   (bgmres_data -> logging) = level;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BGMRESGetLogging( void *bgmres_vdata,
+                        HYPRE_Int * level)
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   *level = (bgmres_data -> logging);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESGetNumIterations( void *bgmres_vdata,
+                              HYPRE_Int  *num_iterations )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   *num_iterations = (bgmres_data -> num_iterations);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESGetConverged( void *bgmres_vdata,
+                          HYPRE_Int  *converged )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   *converged = (bgmres_data -> converged);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BGMRESGetFinalRelativeResidualNorm( void   *bgmres_vdata,
+                                          HYPRE_Real *relative_residual_norm )
+{
+   hypre_BGMRESData *bgmres_data = (hypre_BGMRESData *)bgmres_vdata;
+   *relative_residual_norm = (bgmres_data -> rel_residual_norm);
+   return hypre_error_flag;
+}
@@ -0,0 +1,170 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * BGMRES bgmres
+ *
+ *****************************************************************************/
+
+#ifndef hypre_KRYLOV_BGMRES_HEADER
+#define hypre_KRYLOV_BGMRES_HEADER
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Generic BGMRES Interface
+ *
+ * Restarted block GMRES for several right-hand sides with the same matrix.
+ * The block Arnoldi process applies the preconditioned matrix to all vectors
+ * of the newest basis block, orthogonalizes them with two passes of block
+ * classical Gram-Schmidt and a Cholesky QR, so that one block step costs a
+ * fixed number of global reductions.  Dependent basis vectors are dropped,
+ * and systems that have converged are removed at each restart (deflation).
+ *
+ * @memo A generic block GMRES linear solver interface for multiple right-hand sides
+ **/
+/*@{*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * hypre_BGMRESData and hypre_BGMRESFunctions
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name BGMRES structs
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * The {\tt hypre\_BGMRESFunctions} object ...
+ **/
+
+typedef struct
+{
+   void *       (*CAlloc)        ( size_t count, size_t elt_size );
+   HYPRE_Int    (*Free)          ( void *ptr );
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs );
+   void *       (*CreateVector)  ( void *vector );
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors );
+   HYPRE_Int    (*DestroyVector) ( void *vector );
+   void *       (*MatvecCreate)  ( void *A, void *x );
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Int    (*MatvecBlock)   ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   HYPRE_Int k, void **x, HYPRE_Complex beta, void **y );
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request );
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+   HYPRE_Int    (*ClearVector)   ( void *x );
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+
+   HYPRE_Int    (*precond)       ();
+   HYPRE_Int    (*precond_setup) ();
+   HYPRE_Int    (*precond_block) ();
+
+} hypre_BGMRESFunctions;
+
+/**
+ * The {\tt hypre\_BGMRESData} object ...
+ **/
+
+typedef struct
+{
+   HYPRE_Int      k_dim;
+   HYPRE_Int      num_rhs;
+   HYPRE_Int      max_iter;
+   HYPRE_Int      converged;
+   HYPRE_Real   tol;
+   HYPRE_Real   a_tol;
+   HYPRE_Real   rel_residual_norm;
+
+   void  *A;
+   void  **r;
+   void  **w;
+   void  **p;
+
+   void    *matvec_data;
+   void    *precond_data;
+
+   hypre_BGMRESFunctions * functions;
+
+   /* log info (always logged) */
+   HYPRE_Int      num_iterations;
+
+   HYPRE_Int     print_level; /* printing when print_level>0 */
+   HYPRE_Int     logging;  /* extra computations for logging when logging>0 */
+   HYPRE_Real  *norms;
+   char    *log_file_name;
+
+} hypre_BGMRESData;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name generic BGMRES Solver
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+hypre_BGMRESFunctions *
+hypre_BGMRESFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecBlock)   ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   HYPRE_Int k, void **x, HYPRE_Complex beta, void **y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+   );
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+void *
+hypre_BGMRESCreate( hypre_BGMRESFunctions *bgmres_functions );
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,992 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * BPCG bpcg
+ *
+ * Block preconditioned conjugate gradient for several right-hand sides.  The
+ * unconverged systems share one Krylov space; the search directions are kept
+ * A-orthonormal, so that linearly dependent directions can be dropped without
+ * breakdown, and converged systems are removed from the block.
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGFunctionsCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_BPCGFunctions *
+hypre_BPCGFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecBlock)   ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   HYPRE_Int k, void **x, HYPRE_Complex beta, void **y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+   )
+{
+   hypre_BPCGFunctions * bpcg_functions;
+   bpcg_functions = (hypre_BPCGFunctions *)
+    CAlloc( 1, sizeof(hypre_BPCGFunctions), HYPRE_MEMORY_HOST );
+
+   bpcg_functions->CAlloc            = CAlloc;
+   bpcg_functions->Free              = Free;
+   bpcg_functions->CommInfo          = CommInfo;
+   bpcg_functions->CreateVector      = CreateVector;
+   bpcg_functions->CreateVectorArray = CreateVectorArray;
+   bpcg_functions->DestroyVector     = DestroyVector;
+   bpcg_functions->MatvecCreate      = MatvecCreate;
+   bpcg_functions->Matvec            = Matvec;
+   bpcg_functions->MatvecBlock       = MatvecBlock;
+   bpcg_functions->MatvecDestroy     = MatvecDestroy;
+   bpcg_functions->InnerProd         = InnerProd;
+   bpcg_functions->MultiInnerProd    = MultiInnerProd;
+   bpcg_functions->CopyVector        = CopyVector;
+   bpcg_functions->ClearVector       = ClearVector;
+   bpcg_functions->ScaleVector       = ScaleVector;
+   bpcg_functions->Axpy              = Axpy;
+   /* default preconditioner must be set here but can be changed later... */
+   bpcg_functions->precond_setup     = PrecondSetup;
+   bpcg_functions->precond           = Precond;
+   bpcg_functions->precond_block     = NULL;
+
+   return bpcg_functions;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_BPCGCreate( hypre_BPCGFunctions *bpcg_functions )
+{
+   hypre_BPCGData *bpcg_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   bpcg_data = hypre_CTAllocF(hypre_BPCGData, 1, bpcg_functions, HYPRE_MEMORY_HOST);
+   bpcg_data->functions = bpcg_functions;
+
+   /* set defaults */
+   (bpcg_data -> num_rhs)        = 0;
+   (bpcg_data -> tol)            = 1.0e-06; /* relative residual tol */
+   (bpcg_data -> a_tol)          = 0.0; /* abs. residual tol */
+   (bpcg_data -> max_iter)       = 1000;
+   (bpcg_data -> converged)      = 0;
+   (bpcg_data -> precond_data)   = NULL;
+   (bpcg_data -> print_level)    = 0;
+   (bpcg_data -> logging)        = 0;
+   (bpcg_data -> r)              = NULL;
+   (bpcg_data -> z)              = NULL;
+   (bpcg_data -> p)              = NULL;
+   (bpcg_data -> q)              = NULL;
+   (bpcg_data -> matvec_data)    = NULL;
+   (bpcg_data -> norms)          = NULL;
+   (bpcg_data -> log_file_name)  = NULL;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return (void *) bpcg_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGDestroyVectorArray
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BPCGDestroyVectorArray( hypre_BPCGFunctions  *bpcg_functions,
+                              HYPRE_Int             n,
+                              void                **v )
+{
+   HYPRE_Int i;
+
+   if (v != NULL)
+   {
+      for (i = 0; i < n; i++)
+      {
+         if (v[i] != NULL)
+            (*(bpcg_functions->DestroyVector))(v[i]);
+      }
+      hypre_TFreeF( v, bpcg_functions );
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGDestroy( void *bpcg_vdata )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+   if (bpcg_data)
+   {
+      hypre_BPCGFunctions *bpcg_functions = bpcg_data->functions;
+      HYPRE_Int            num_rhs        = (bpcg_data -> num_rhs);
+
+      if ( (bpcg_data -> norms) != NULL )
+         hypre_TFreeF( bpcg_data -> norms, bpcg_functions );
+
+      if ( (bpcg_data -> matvec_data) != NULL )
+         (*(bpcg_functions->MatvecDestroy))(bpcg_data -> matvec_data);
+
+      hypre_BPCGDestroyVectorArray(bpcg_functions, num_rhs, bpcg_data -> r);
+      hypre_BPCGDestroyVectorArray(bpcg_functions, num_rhs, bpcg_data -> z);
+      hypre_BPCGDestroyVectorArray(bpcg_functions, num_rhs, bpcg_data -> p);
+      hypre_BPCGDestroyVectorArray(bpcg_functions, num_rhs, bpcg_data -> q);
+
+      hypre_TFreeF( bpcg_data, bpcg_functions );
+      hypre_TFreeF( bpcg_functions, bpcg_functions );
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGSetup
+ *
+ * The work vectors are allocated for num_rhs right-hand sides; a later solve
+ * may use at most as many.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGSetup( void       *bpcg_vdata,
+                 void       *A,
+                 HYPRE_Int   num_rhs,
+                 void      **b,
+                 void      **x )
+{
+   hypre_BPCGData *bpcg_data     = (hypre_BPCGData *)bpcg_vdata;
+   hypre_BPCGFunctions *bpcg_functions = bpcg_data->functions;
+
+   HYPRE_Int max_iter         = (bpcg_data -> max_iter);
+   HYPRE_Int (*precond_setup)(void*,void*,void*,void*) = (bpcg_functions->precond_setup);
+   void       *precond_data   = (bpcg_data -> precond_data);
+
+   if (num_rhs < 1)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (bpcg_data -> A) = A;
+
+   /*--------------------------------------------------
+    * The arguments for NewVector are important to
+    * maintain consistency between the setup and
+    * compute phases of matvec and the preconditioner.
+    *--------------------------------------------------*/
+
+   if ((bpcg_data -> num_rhs) != num_rhs)
+   {
+      hypre_BPCGDestroyVectorArray(bpcg_functions, bpcg_data -> num_rhs, bpcg_data -> r);
+      hypre_BPCGDestroyVectorArray(bpcg_functions, bpcg_data -> num_rhs, bpcg_data -> z);
+      hypre_BPCGDestroyVectorArray(bpcg_functions, bpcg_data -> num_rhs, bpcg_data -> p);
+      hypre_BPCGDestroyVectorArray(bpcg_functions, bpcg_data -> num_rhs, bpcg_data -> q);
+      (bpcg_data -> r) = NULL;
+      (bpcg_data -> z) = NULL;
+      (bpcg_data -> p) = NULL;
+      (bpcg_data -> q) = NULL;
+      (bpcg_data -> num_rhs) = num_rhs;
+   }
+
+   if ((bpcg_data -> r) == NULL)
+      (bpcg_data -> r) = (void**)(*(bpcg_functions->CreateVectorArray))(num_rhs, b[0]);
+   if ((bpcg_data -> z) == NULL)
+      (bpcg_data -> z) = (void**)(*(bpcg_functions->CreateVectorArray))(num_rhs, x[0]);
+   if ((bpcg_data -> p) == NULL)
+      (bpcg_data -> p) = (void**)(*(bpcg_functions->CreateVectorArray))(num_rhs, x[0]);
+   if ((bpcg_data -> q) == NULL)
+      (bpcg_data -> q) = (void**)(*(bpcg_functions->CreateVectorArray))(num_rhs, b[0]);
+
+   if ((bpcg_data -> matvec_data) == NULL)
+      (bpcg_data -> matvec_data) = (*(bpcg_functions->MatvecCreate))(A, x[0]);
+
+   precond_setup(precond_data, A, b[0], x[0]);
+
+   /*-----------------------------------------------------
+    * Allocate space for log info
+    *-----------------------------------------------------*/
+
+   if ( (bpcg_data->logging)>0 || (bpcg_data->print_level) > 0 )
+   {
+      if ((bpcg_data -> norms) == NULL)
+         (bpcg_data -> norms) = hypre_CTAllocF(HYPRE_Real, max_iter + 1,bpcg_functions, HYPRE_MEMORY_HOST);
+   }
+   if ( (bpcg_data->print_level) > 0 )
+   {
+      if ((bpcg_data -> log_file_name) == NULL)
+         (bpcg_data -> log_file_name) = (char*)"bpcg.out.log";
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGMatvecBlock
+ *
+ * y[j] = alpha A x[j] + beta y[j], j < k, with the block matvec if there is
+ * one, and one column at a time otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BPCGMatvecBlock( hypre_BPCGFunctions  *bpcg_functions,
+                       void                 *matvec_data,
+                       HYPRE_Complex         alpha,
+                       void                 *A,
+                       HYPRE_Int             k,
+                       void                **x,
+                       HYPRE_Complex         beta,
+                       void                **y )
+{
+   HYPRE_Int j;
+
+   if (bpcg_functions->MatvecBlock)
+   {
+      return (*(bpcg_functions->MatvecBlock))(matvec_data, alpha, A, k, x, beta, y);
+   }
+
+   for (j = 0; j < k; j++)
+   {
+      (*(bpcg_functions->Matvec))(matvec_data, alpha, A, x[j], beta, y[j]);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGPrecondBlock
+ *
+ * x[j] = M b[j], j < k, starting from zero initial guesses, with the block
+ * preconditioner if there is one, and one column at a time otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BPCGPrecondBlock( hypre_BPCGFunctions  *bpcg_functions,
+                        void                 *precond_data,
+                        void                 *A,
+                        HYPRE_Int             k,
+                        void                **b,
+                        void                **x )
+{
+   HYPRE_Int (*precond)(void*,void*,void*,void*) = (bpcg_functions -> precond);
+   HYPRE_Int (*precond_block)(void*,void*,HYPRE_Int,void**,void**) = (bpcg_functions -> precond_block);
+   HYPRE_Int j;
+
+   for (j = 0; j < k; j++)
+   {
+      (*(bpcg_functions->ClearVector))(x[j]);
+   }
+
+   if (precond_block)
+   {
+      return precond_block(precond_data, A, k, b, x);
+   }
+
+   for (j = 0; j < k; j++)
+   {
+      precond(precond_data, A, b[j], x[j]);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGOrthonormalize
+ *
+ * Makes the np search directions p A-orthonormal.  G (np x np, row-major,
+ * upper triangle used) is P^T A P and q = A p.  A Cholesky factorization of G,
+ * scaled to unit diagonal, skips the columns whose pivot falls below drop_tol;
+ * these directions depend linearly on the previous ones and are dropped.  The
+ * kept directions are moved to the front of p and q (their original indices
+ * are returned in keep), and P and Q are overwritten by P R^{-1} and Q R^{-1},
+ * with R the upper triangular factor (stored with leading dimension np).
+ * Returns the number of kept directions.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BPCGOrthonormalize( hypre_BPCGFunctions  *bpcg_functions,
+                          HYPRE_Int             np,
+                          void                **p,
+                          void                **q,
+                          HYPRE_Real           *G,
+                          HYPRE_Real           *R,
+                          HYPRE_Int            *keep,
+                          HYPRE_Real           *scale )
+{
+   HYPRE_Int   i, j, k, l, nk, kj;
+   HYPRE_Real  d, t;
+   void       *tmp;
+
+   HYPRE_Real  drop_tol = 1.0e-10;
+
+   nk = 0;
+   for (j = 0; j < np; j++)
+   {
+      if (!(G[j*np+j] > 0.0))
+      {
+         continue;
+      }
+      scale[j] = 1.0 / sqrt(G[j*np+j]);
+
+      d = 1.0;
+      for (k = 0; k < nk; k++)
+      {
+         kj = keep[k];
+         t = G[kj*np+j] * scale[kj] * scale[j];
+         for (l = 0; l < k; l++)
+         {
+            t -= R[l*np+k] * R[l*np+nk];
+         }
+         R[k*np+nk] = t / R[k*np+k];
+         d -= R[k*np+nk] * R[k*np+nk];
+      }
+      if (d <= drop_tol)
+      {
+         continue;
+      }
+      R[nk*np+nk] = sqrt(d);
+      keep[nk++] = j;
+   }
+
+   /* undo the scaling: R <- R D^{-1} */
+   for (i = 0; i < nk; i++)
+   {
+      for (j = i; j < nk; j++)
+      {
+         R[i*np+j] /= scale[keep[j]];
+      }
+   }
+
+   /* move the kept directions to the front; keep is increasing */
+   for (k = 0; k < nk; k++)
+   {
+      tmp = p[k]; p[k] = p[keep[k]]; p[keep[k]] = tmp;
+      tmp = q[k]; q[k] = q[keep[k]]; q[keep[k]] = tmp;
+   }
+
+   /* P <- P R^{-1}, Q <- Q R^{-1} */
+   for (j = 0; j < nk; j++)
+   {
+      for (k = 0; k < j; k++)
+      {
+         (*(bpcg_functions->Axpy))(-R[k*np+j], p[k], p[j]);
+         (*(bpcg_functions->Axpy))(-R[k*np+j], q[k], q[j]);
+      }
+      (*(bpcg_functions->ScaleVector))(1.0/R[j*np+j], p[j]);
+      (*(bpcg_functions->ScaleVector))(1.0/R[j*np+j], q[j]);
+   }
+
+   return nk;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGSolve
+ *
+ * Breakdown-free block PCG with deflation.  With na active (unconverged)
+ * systems, the residuals R and the search directions P are kept as blocks of
+ * at most na vectors.  Each iteration
+ *
+ *    Q = A P,  P <- P R^{-1}, Q <- Q R^{-1}   (P^T A P = R^T R)
+ *    X <- X + P (P^T R),  R <- R - Q (P^T R)
+ *    drop converged columns,  Z = M R
+ *    P <- Z - P (Q^T Z)
+ *
+ * costs one block matvec, one block preconditioner application and three
+ * global reductions, independently of the number of right-hand sides.  The
+ * convergence test is on the 2-norm of each residual:
+ * |r_j| <= max(a_tol, r_tol |b_j|).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGSolve( void       *bpcg_vdata,
+                 void       *A,
+                 HYPRE_Int   num_rhs,
+                 void      **b,
+                 void      **x )
+{
+   hypre_BPCGData      *bpcg_data      = (hypre_BPCGData *)bpcg_vdata;
+   hypre_BPCGFunctions *bpcg_functions = bpcg_data->functions;
+   HYPRE_Int     max_iter          = (bpcg_data -> max_iter);
+   HYPRE_Real    r_tol             = (bpcg_data -> tol);
+   HYPRE_Real    a_tol             = (bpcg_data -> a_tol);
+   void         *matvec_data       = (bpcg_data -> matvec_data);
+
+   void        **r                 = (bpcg_data -> r);
+   void        **z                 = (bpcg_data -> z);
+   void        **p                 = (bpcg_data -> p);
+   void        **q                 = (bpcg_data -> q);
+
+   void       *precond_data       = (bpcg_data -> precond_data);
+
+   HYPRE_Int print_level = (bpcg_data -> print_level);
+   HYPRE_Int logging     = (bpcg_data -> logging);
+
+   HYPRE_Real     *norms          = (bpcg_data -> norms);
+
+   hypre_MPI_Request  request;
+   hypre_MPI_Status   status;
+
+   HYPRE_Int   i, j, k, l, n, m, na, np, nk, iter;
+   HYPRE_Int   my_id, num_procs;
+   HYPRE_Int  *active, *keep;
+   void      **xa, **dot_x, **dot_y, **tmp;
+   void       *vtmp;
+   HYPRE_Real *b_norm, *r_norm, *epsilon, *rel_norm;
+   HYPRE_Real *G, *R, *C, *scale, *local, *result;
+   HYPRE_Real  t, max_rel_norm;
+
+   HYPRE_Real ieee_check = 0.;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (bpcg_data -> converged) = 0;
+
+   m = num_rhs;
+   if (m < 1 || m > (bpcg_data -> num_rhs))
+   {
+      hypre_error_in_arg(3);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   (*(bpcg_functions->CommInfo))(A,&my_id,&num_procs);
+   if ( logging>0 || print_level>0 )
+   {
+      norms = (bpcg_data -> norms);
+   }
+
+   /* room for the largest reduction: P^T A P and P^T R */
+   n = m*(m+1)/2 + m*m;
+
+   b_norm   = hypre_CTAllocF(HYPRE_Real, m, bpcg_functions, HYPRE_MEMORY_HOST);
+   r_norm   = hypre_CTAllocF(HYPRE_Real, m, bpcg_functions, HYPRE_MEMORY_HOST);
+   local    = hypre_CTAllocF(HYPRE_Real, n, bpcg_functions, HYPRE_MEMORY_HOST);
+   result   = hypre_CTAllocF(HYPRE_Real, n, bpcg_functions, HYPRE_MEMORY_HOST);
+   dot_x    = hypre_CTAllocF(void *, n, bpcg_functions, HYPRE_MEMORY_HOST);
+   dot_y    = hypre_CTAllocF(void *, n, bpcg_functions, HYPRE_MEMORY_HOST);
+
+   /* compute initial residuals and the norms of b and r in one reduction */
+   for (j = 0; j < m; j++)
+   {
+      (*(bpcg_functions->CopyVector))(b[j], r[j]);
+   }
+   hypre_BPCGMatvecBlock(bpcg_functions, matvec_data, -1.0, A, m, x, 1.0, r);
+   for (j = 0; j < m; j++)
+   {
+      dot_x[j]   = b[j];
+      dot_y[j]   = b[j];
+      dot_x[m+j] = r[j];
+      dot_y[m+j] = r[j];
+   }
+   hypre_KrylovMultiInnerProd(bpcg_functions->MultiInnerProd, bpcg_functions->InnerProd,
+                              2*m, dot_x, dot_y, local, result, &request);
+   hypre_MPI_Wait(&request, &status);
+
+   t = 0.0;
+   for (j = 0; j < m; j++)
+   {
+      b_norm[j] = sqrt(result[j]);
+      r_norm[j] = sqrt(result[m+j]);
+      t += result[j] + result[m+j];
+   }
+
+   /* Since it is does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input. */
+   if (t != 0.) ieee_check = t/t; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      /* ...INFs or NaNs in input can make ieee_check a NaN.  This test
+         for ieee_check self-equality works on all IEEE-compliant compilers/
+         machines, c.f. page 8 of "Lecture Notes on the Status of IEEE 754"
+         by W. Kahan, May 31, 1996.  Currently (July 2002) this paper may be
+         found at http://HTTP.CS.Berkeley.EDU/~wkahan/ieee754status/IEEE754.PDF */
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_BPCGSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A, b or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+
+      hypre_TFreeF(b_norm,bpcg_functions);
+      hypre_TFreeF(r_norm,bpcg_functions);
+      hypre_TFreeF(local,bpcg_functions);
+      hypre_TFreeF(result,bpcg_functions);
+      hypre_TFreeF(dot_x,bpcg_functions);
+      hypre_TFreeF(dot_y,bpcg_functions);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   epsilon  = hypre_CTAllocF(HYPRE_Real, m, bpcg_functions, HYPRE_MEMORY_HOST);
+   rel_norm = hypre_CTAllocF(HYPRE_Real, m, bpcg_functions, HYPRE_MEMORY_HOST);
+   active   = hypre_CTAllocF(HYPRE_Int, m, bpcg_functions, HYPRE_MEMORY_HOST);
+   keep     = hypre_CTAllocF(HYPRE_Int, m, bpcg_functions, HYPRE_MEMORY_HOST);
+   scale    = hypre_CTAllocF(HYPRE_Real, m, bpcg_functions, HYPRE_MEMORY_HOST);
+   xa       = hypre_CTAllocF(void *, m, bpcg_functions, HYPRE_MEMORY_HOST);
+   G        = hypre_CTAllocF(HYPRE_Real, m*m, bpcg_functions, HYPRE_MEMORY_HOST);
+   R        = hypre_CTAllocF(HYPRE_Real, m*m, bpcg_functions, HYPRE_MEMORY_HOST);
+   C        = hypre_CTAllocF(HYPRE_Real, m*m, bpcg_functions, HYPRE_MEMORY_HOST);
+
+   /* convergence criteria: |r_j| <= max( a_tol, r_tol * |b_j| ), or
+      relative to |r_j| at the start if b_j = 0 */
+   na = 0;
+   max_rel_norm = 0.0;
+   for (j = 0; j < m; j++)
+   {
+      t = (b_norm[j] > 0.0) ? b_norm[j] : r_norm[j];
+      epsilon[j]  = hypre_max(a_tol, r_tol*t);
+      rel_norm[j] = (t > 0.0) ? r_norm[j]/t : r_norm[j];
+      max_rel_norm = hypre_max(max_rel_norm, rel_norm[j]);
+      b_norm[j]   = t;
+      if (r_norm[j] > epsilon[j])
+      {
+         /* keep the residuals of the active systems in front */
+         vtmp = r[na]; r[na] = r[j]; r[j] = vtmp;
+         active[na] = j;
+         xa[na] = x[j];
+         na++;
+      }
+   }
+
+   if ( logging>0 || print_level > 0)
+   {
+      norms[0] = max_rel_norm;
+      if ( print_level>1 && my_id == 0 )
+      {
+         hypre_printf("Number of right-hand sides: %d\n", m);
+         hypre_printf("Initial max. relative residual norm: %e\n", max_rel_norm);
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters   active   max.rel.res.norm   conv.rate\n");
+         hypre_printf("-----   ------   ----------------   ---------\n");
+      }
+   }
+
+   /* initial search directions P = Z = M R */
+   hypre_BPCGPrecondBlock(bpcg_functions, precond_data, A, na, r, z);
+   for (i = 0; i < na; i++)
+   {
+      (*(bpcg_functions->CopyVector))(z[i], p[i]);
+   }
+   np = na;
+
+   iter = 0;
+   while (na > 0 && iter < max_iter)
+   {
+      /* Q = A P */
+      hypre_BPCGMatvecBlock(bpcg_functions, matvec_data, 1.0, A, np, p, 0.0, q);
+
+      /* G = P^T Q (upper triangle) and C = P^T R in one reduction */
+      n = 0;
+      for (i = 0; i < np; i++)
+      {
+         for (j = i; j < np; j++)
+         {
+            dot_x[n] = p[i];
+            dot_y[n] = q[j];
+            n++;
+         }
+         for (j = 0; j < na; j++)
+         {
+            dot_x[n] = p[i];
+            dot_y[n] = r[j];
+            n++;
+         }
+      }
+      hypre_KrylovMultiInnerProd(bpcg_functions->MultiInnerProd, bpcg_functions->InnerProd,
+                                 n, dot_x, dot_y, local, result, &request);
+      hypre_MPI_Wait(&request, &status);
+
+      n = 0;
+      for (i = 0; i < np; i++)
+      {
+         for (j = i; j < np; j++)
+         {
+            G[i*np+j] = result[n++];
+         }
+         for (j = 0; j < na; j++)
+         {
+            C[i*na+j] = result[n++];
+         }
+      }
+
+      nk = hypre_BPCGOrthonormalize(bpcg_functions, np, p, q, G, R, keep, scale);
+      if (nk == 0)
+      {
+         /* no search direction left: A or M is not positive definite */
+         if (print_level > 0 && my_id == 0)
+         {
+            hypre_printf("hypre_BPCGSolve: breakdown, no independent search directions\n");
+         }
+         hypre_error(HYPRE_ERROR_CONV);
+         break;
+      }
+
+      /* step lengths alpha = R^{-T} C(keep,:), stored in G (nk x na) */
+      for (j = 0; j < na; j++)
+      {
+         for (k = 0; k < nk; k++)
+         {
+            t = C[keep[k]*na+j];
+            for (l = 0; l < k; l++)
+            {
+               t -= R[l*np+k] * G[l*na+j];
+            }
+            G[k*na+j] = t / R[k*np+k];
+         }
+      }
+
+      /* X <- X + P alpha, R <- R - Q alpha */
+      for (j = 0; j < na; j++)
+      {
+         for (k = 0; k < nk; k++)
+         {
+            (*(bpcg_functions->Axpy))( G[k*na+j], p[k], xa[j]);
+            (*(bpcg_functions->Axpy))(-G[k*na+j], q[k], r[j]);
+         }
+      }
+      iter++;
+
+      /* residual norms, then deflate the converged systems */
+      hypre_KrylovMultiInnerProd(bpcg_functions->MultiInnerProd, bpcg_functions->InnerProd,
+                                 na, r, r, local, result, &request);
+      hypre_MPI_Wait(&request, &status);
+
+      l = 0;
+      for (j = 0; j < na; j++)
+      {
+         i = active[j];
+         r_norm[i] = sqrt(result[j]);
+         rel_norm[i] = (b_norm[i] > 0.0) ? r_norm[i]/b_norm[i] : r_norm[i];
+         if (r_norm[i] > epsilon[i])
+         {
+            vtmp = r[l]; r[l] = r[j]; r[j] = vtmp;
+            active[l] = i;
+            xa[l] = xa[j];
+            l++;
+         }
+      }
+      na = l;
+
+      t = max_rel_norm;
+      max_rel_norm = 0.0;
+      for (j = 0; j < m; j++)
+      {
+         max_rel_norm = hypre_max(max_rel_norm, rel_norm[j]);
+      }
+      if ( logging>0 || print_level>0 )
+      {
+         norms[iter] = max_rel_norm;
+         if ( print_level>1 && my_id == 0 )
+         {
+            hypre_printf("% 5d   % 6d   %e       %f\n", iter, na,
+                         max_rel_norm, (t > 0.0) ? max_rel_norm/t : 0.0);
+         }
+      }
+
+      if (na == 0)
+      {
+         break;
+      }
+
+      /* Z = M R */
+      hypre_BPCGPrecondBlock(bpcg_functions, precond_data, A, na, r, z);
+
+      /* beta = Q^T Z, P <- Z - P beta */
+      n = 0;
+      for (k = 0; k < nk; k++)
+      {
+         for (j = 0; j < na; j++)
+         {
+            dot_x[n] = q[k];
+            dot_y[n] = z[j];
+            n++;
+         }
+      }
+      hypre_KrylovMultiInnerProd(bpcg_functions->MultiInnerProd, bpcg_functions->InnerProd,
+                                 n, dot_x, dot_y, local, result, &request);
+      hypre_MPI_Wait(&request, &status);
+
+      for (j = 0; j < na; j++)
+      {
+         for (k = 0; k < nk; k++)
+         {
+            (*(bpcg_functions->Axpy))(-result[k*na+j], p[k], z[j]);
+         }
+      }
+      tmp = p; p = z; z = tmp;
+      np = na;
+   }
+
+   if (na == 0)
+   {
+      (bpcg_data -> converged) = 1;
+   }
+   else if (iter >= max_iter)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   if (print_level > 1 && my_id == 0)
+   {
+      hypre_printf("\n\n");
+   }
+
+   (bpcg_data -> num_iterations)    = iter;
+   (bpcg_data -> rel_residual_norm) = max_rel_norm;
+
+   hypre_TFreeF(b_norm,bpcg_functions);
+   hypre_TFreeF(r_norm,bpcg_functions);
+   hypre_TFreeF(epsilon,bpcg_functions);
+   hypre_TFreeF(rel_norm,bpcg_functions);
+   hypre_TFreeF(active,bpcg_functions);
+   hypre_TFreeF(keep,bpcg_functions);
+   hypre_TFreeF(scale,bpcg_functions);
+   hypre_TFreeF(xa,bpcg_functions);
+   hypre_TFreeF(G,bpcg_functions);
+   hypre_TFreeF(R,bpcg_functions);
+   hypre_TFreeF(C,bpcg_functions);
+   hypre_TFreeF(local,bpcg_functions);
+   hypre_TFreeF(result,bpcg_functions);
+   hypre_TFreeF(dot_x,bpcg_functions);
+   hypre_TFreeF(dot_y,bpcg_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGSetTol, hypre_BPCGGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGSetTol( void   *bpcg_vdata,
+                  HYPRE_Real  tol       )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   (bpcg_data -> tol) = tol;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BPCGGetTol( void   *bpcg_vdata,
+                  HYPRE_Real  * tol      )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   *tol = (bpcg_data -> tol);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGSetAbsoluteTol, hypre_BPCGGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGSetAbsoluteTol( void   *bpcg_vdata,
+                          HYPRE_Real  a_tol       )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   (bpcg_data -> a_tol) = a_tol;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BPCGGetAbsoluteTol( void   *bpcg_vdata,
+                          HYPRE_Real  * a_tol      )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   *a_tol = (bpcg_data -> a_tol);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGSetMaxIter, hypre_BPCGGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGSetMaxIter( void *bpcg_vdata,
+                      HYPRE_Int   max_iter  )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   (bpcg_data -> max_iter) = max_iter;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BPCGGetMaxIter( void *bpcg_vdata,
+                      HYPRE_Int * max_iter  )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   *max_iter = (bpcg_data -> max_iter);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGSetPrecond( void  *bpcg_vdata,
+                      HYPRE_Int  (*precond)(void*,void*,void*,void*),
+                      HYPRE_Int  (*precond_setup)(void*,void*,void*,void*),
+                      void  *precond_data )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   hypre_BPCGFunctions *bpcg_functions = bpcg_data->functions;
+   (bpcg_functions -> precond)        = precond;
+   (bpcg_functions -> precond_setup)  = precond_setup;
+   (bpcg_functions -> precond_block)  = NULL;
+   (bpcg_data -> precond_data)   = precond_data;
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGSetPrecondBlock
+ *
+ * Optional block version of the preconditioner set by hypre_BPCGSetPrecond,
+ * applied to k vectors at once.  Setting the preconditioner resets it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGSetPrecondBlock( void  *bpcg_vdata,
+                           HYPRE_Int  (*precond_block)(void*,void*,HYPRE_Int,void**,void**) )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   hypre_BPCGFunctions *bpcg_functions = bpcg_data->functions;
+   (bpcg_functions -> precond_block)  = precond_block;
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGGetPrecond( void         *bpcg_vdata,
+                      HYPRE_Solver *precond_data_ptr )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   *precond_data_ptr = (HYPRE_Solver)(bpcg_data -> precond_data);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGSetPrintLevel, hypre_BPCGGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGSetPrintLevel( void *bpcg_vdata,
+                         HYPRE_Int   level)
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   (bpcg_data -> print_level) = level;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BPCGGetPrintLevel( void *bpcg_vdata,
+                         HYPRE_Int * level)
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   *level = (bpcg_data -> print_level);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGSetLogging, hypre_BPCGGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGSetLogging( void *bpcg_vdata,
+                      HYPRE_Int   level)
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   (bpcg_data -> logging) = level;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BPCGGetLogging( void *bpcg_vdata,
+                      HYPRE_Int * level)
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   *level = (bpcg_data -> logging);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGGetNumIterations( void *bpcg_vdata,
+                            HYPRE_Int  *num_iterations )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   *num_iterations = (bpcg_data -> num_iterations);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGGetConverged( void *bpcg_vdata,
+                        HYPRE_Int  *converged )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   *converged = (bpcg_data -> converged);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BPCGGetFinalRelativeResidualNorm( void   *bpcg_vdata,
+                                        HYPRE_Real *relative_residual_norm )
+{
+   hypre_BPCGData *bpcg_data = (hypre_BPCGData *)bpcg_vdata;
+   *relative_residual_norm = (bpcg_data -> rel_residual_norm);
+   return hypre_error_flag;
+}
@@ -0,0 +1,170 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * BPCG bpcg
+ *
+ *****************************************************************************/
+
+#ifndef hypre_KRYLOV_BPCG_HEADER
+#define hypre_KRYLOV_BPCG_HEADER
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Generic BPCG Interface
+ *
+ * Block preconditioned conjugate gradient for several right-hand sides with
+ * the same matrix.  All unconverged systems share one Krylov space: each
+ * iteration applies the matrix and the preconditioner to a block of search
+ * directions and computes all inner products of the block in a single global
+ * reduction.  Converged columns are removed from the block (deflation), and
+ * linearly dependent search directions are dropped.
+ *
+ * @memo A generic block PCG linear solver interface for multiple right-hand sides
+ **/
+/*@{*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * hypre_BPCGData and hypre_BPCGFunctions
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name BPCG structs
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * The {\tt hypre\_BPCGFunctions} object ...
+ **/
+
+typedef struct
+{
+   void *       (*CAlloc)        ( size_t count, size_t elt_size );
+   HYPRE_Int    (*Free)          ( void *ptr );
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs );
+   void *       (*CreateVector)  ( void *vector );
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors );
+   HYPRE_Int    (*DestroyVector) ( void *vector );
+   void *       (*MatvecCreate)  ( void *A, void *x );
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Int    (*MatvecBlock)   ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   HYPRE_Int k, void **x, HYPRE_Complex beta, void **y );
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request );
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+   HYPRE_Int    (*ClearVector)   ( void *x );
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+
+   HYPRE_Int    (*precond)       ();
+   HYPRE_Int    (*precond_setup) ();
+   HYPRE_Int    (*precond_block) ();
+
+} hypre_BPCGFunctions;
+
+/**
+ * The {\tt hypre\_BPCGData} object ...
+ **/
+
+typedef struct
+{
+   HYPRE_Int      num_rhs;
+   HYPRE_Int      max_iter;
+   HYPRE_Int      converged;
+   HYPRE_Real   tol;
+   HYPRE_Real   a_tol;
+   HYPRE_Real   rel_residual_norm;
+
+   void  *A;
+   void  **r;
+   void  **z;
+   void  **p;
+   void  **q;
+
+   void    *matvec_data;
+   void    *precond_data;
+
+   hypre_BPCGFunctions * functions;
+
+   /* log info (always logged) */
+   HYPRE_Int      num_iterations;
+
+   HYPRE_Int     print_level; /* printing when print_level>0 */
+   HYPRE_Int     logging;  /* extra computations for logging when logging>0 */
+   HYPRE_Real  *norms;
+   char    *log_file_name;
+
+} hypre_BPCGData;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name generic BPCG Solver
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+hypre_BPCGFunctions *
+hypre_BPCGFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecBlock)   ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   HYPRE_Int k, void **x, HYPRE_Complex beta, void **y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+   );
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+void *
+hypre_BPCGCreate( hypre_BPCGFunctions *bpcg_functions );
+
+#ifdef __cplusplus
+}
+#endif
+#endif
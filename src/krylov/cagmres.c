@@ -0,0 +1,1579 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * CAGMRES cagmres
+ *
+ * Communication-avoiding (s-step) GMRES with right preconditioning.  Each
+ * block of s iterations generates the vectors
+ *
+ *    v_0 = q_{c-1},  v_{j+1} = (A M - theta_j) v_j
+ *
+ * with back-to-back preconditioned matvecs (theta_j = 0 for the monomial
+ * basis, Leja-ordered Ritz values for the Newton basis), orthogonalizes them
+ * against the current basis with block classical Gram-Schmidt (two passes),
+ * and orthonormalizes the block itself with a Cholesky QR (two passes).  The
+ * Hessenberg columns of the block are recovered from the change-of-basis
+ * matrix and the triangular factors, so that one block costs four global
+ * reductions instead of O(s k).
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESFunctionsCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_CAGMRESFunctions *
+hypre_CAGMRESFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+   )
+{
+   hypre_CAGMRESFunctions * cagmres_functions;
+   cagmres_functions = (hypre_CAGMRESFunctions *)
+    CAlloc( 1, sizeof(hypre_CAGMRESFunctions), HYPRE_MEMORY_HOST );
+
+   cagmres_functions->CAlloc            = CAlloc;
+   cagmres_functions->Free              = Free;
+   cagmres_functions->CommInfo          = CommInfo;
+   cagmres_functions->CreateVector      = CreateVector;
+   cagmres_functions->CreateVectorArray = CreateVectorArray;
+   cagmres_functions->DestroyVector     = DestroyVector;
+   cagmres_functions->MatvecCreate      = MatvecCreate;
+   cagmres_functions->Matvec            = Matvec;
+   cagmres_functions->MatvecDestroy     = MatvecDestroy;
+   cagmres_functions->InnerProd         = InnerProd;
+   cagmres_functions->MultiInnerProd    = MultiInnerProd;
+   cagmres_functions->CopyVector        = CopyVector;
+   cagmres_functions->ClearVector       = ClearVector;
+   cagmres_functions->ScaleVector       = ScaleVector;
+   cagmres_functions->Axpy              = Axpy;
+   /* default preconditioner must be set here but can be changed later... */
+   cagmres_functions->precond_setup     = PrecondSetup;
+   cagmres_functions->precond           = Precond;
+
+   return cagmres_functions;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_CAGMRESCreate( hypre_CAGMRESFunctions *cagmres_functions )
+{
+   hypre_CAGMRESData *cagmres_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   cagmres_data = hypre_CTAllocF(hypre_CAGMRESData, 1, cagmres_functions, HYPRE_MEMORY_HOST);
+   cagmres_data->functions = cagmres_functions;
+
+   /* set defaults */
+   (cagmres_data -> k_dim)          = 20;
+   (cagmres_data -> s_step)         = 4;
+   (cagmres_data -> basis)          = 1; /* Newton basis */
+   (cagmres_data -> tol)            = 1.0e-06; /* relative residual tol */
+   (cagmres_data -> a_tol)          = 0.0; /* abs. residual tol */
+   (cagmres_data -> min_iter)       = 0;
+   (cagmres_data -> max_iter)       = 1000;
+   (cagmres_data -> skip_real_r_check) = 0;
+   (cagmres_data -> converged)      = 0;
+   (cagmres_data -> precond_data)   = NULL;
+   (cagmres_data -> print_level)    = 0;
+   (cagmres_data -> logging)        = 0;
+   (cagmres_data -> p)              = NULL;
+   (cagmres_data -> r)              = NULL;
+   (cagmres_data -> w)              = NULL;
+   (cagmres_data -> matvec_data)    = NULL;
+   (cagmres_data -> norms)          = NULL;
+   (cagmres_data -> log_file_name)  = NULL;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return (void *) cagmres_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESDestroy( void *cagmres_vdata )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   HYPRE_Int i;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+   if (cagmres_data)
+   {
+      hypre_CAGMRESFunctions *cagmres_functions = cagmres_data->functions;
+      if ( (cagmres_data -> norms) != NULL )
+         hypre_TFreeF( cagmres_data -> norms, cagmres_functions );
+
+      if ( (cagmres_data -> matvec_data) != NULL )
+         (*(cagmres_functions->MatvecDestroy))(cagmres_data -> matvec_data);
+
+      if ( (cagmres_data -> r) != NULL )
+         (*(cagmres_functions->DestroyVector))(cagmres_data -> r);
+      if ( (cagmres_data -> w) != NULL )
+         (*(cagmres_functions->DestroyVector))(cagmres_data -> w);
+
+      if ( (cagmres_data -> p) != NULL )
+      {
+         for (i = 0; i < (cagmres_data -> k_dim+1); i++)
+         {
+            if ( (cagmres_data -> p)[i] != NULL )
+               (*(cagmres_functions->DestroyVector))( (cagmres_data -> p) [i]);
+         }
+         hypre_TFreeF( cagmres_data->p, cagmres_functions );
+      }
+      hypre_TFreeF( cagmres_data, cagmres_functions );
+      hypre_TFreeF( cagmres_functions, cagmres_functions );
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_CAGMRESGetResidual( void *cagmres_vdata, void **residual )
+{
+   hypre_CAGMRESData  *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *residual = cagmres_data->r;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetup( void *cagmres_vdata,
+                    void *A,
+                    void *b,
+                    void *x         )
+{
+   hypre_CAGMRESData *cagmres_data     = (hypre_CAGMRESData *)cagmres_vdata;
+   hypre_CAGMRESFunctions *cagmres_functions = cagmres_data->functions;
+
+   HYPRE_Int k_dim            = (cagmres_data -> k_dim);
+   HYPRE_Int max_iter         = (cagmres_data -> max_iter);
+   HYPRE_Int (*precond_setup)(void*,void*,void*,void*) = (cagmres_functions->precond_setup);
+   void       *precond_data   = (cagmres_data -> precond_data);
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (cagmres_data -> A) = A;
+
+   /*--------------------------------------------------
+    * The arguments for NewVector are important to
+    * maintain consistency between the setup and
+    * compute phases of matvec and the preconditioner.
+    *--------------------------------------------------*/
+
+   if ((cagmres_data -> p) == NULL)
+      (cagmres_data -> p) = (void**)(*(cagmres_functions->CreateVectorArray))(k_dim+1,x);
+   if ((cagmres_data -> r) == NULL)
+      (cagmres_data -> r) = (*(cagmres_functions->CreateVector))(b);
+   if ((cagmres_data -> w) == NULL)
+      (cagmres_data -> w) = (*(cagmres_functions->CreateVector))(b);
+
+   if ((cagmres_data -> matvec_data) == NULL)
+      (cagmres_data -> matvec_data) = (*(cagmres_functions->MatvecCreate))(A, x);
+
+   precond_setup(precond_data, A, b, x);
+
+   /*-----------------------------------------------------
+    * Allocate space for log info
+    *-----------------------------------------------------*/
+
+   if ( (cagmres_data->logging)>0 || (cagmres_data->print_level) > 0 )
+   {
+      if ((cagmres_data -> norms) == NULL)
+         (cagmres_data -> norms) = hypre_CTAllocF(HYPRE_Real, max_iter + 1,cagmres_functions, HYPRE_MEMORY_HOST);
+   }
+   if ( (cagmres_data->print_level) > 0 )
+   {
+      if ((cagmres_data -> log_file_name) == NULL)
+         (cagmres_data -> log_file_name) = (char*)"cagmres.out.log";
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESBlockQR
+ *
+ * Orthonormalizes the s vectors v in place and returns the upper triangular
+ * factor in R (s x s, row-major), so that v_in = v_out R.  Two passes of
+ * Cholesky QR are used, each costing one global reduction for the Gram
+ * matrix; the Gram matrix is scaled to unit diagonal before the factorization
+ * so that the basis scaling does not affect the pivot test.  If a pivot
+ * breaks down, the remaining work is done with modified Gram-Schmidt, which
+ * also detects rank deficiency.  The return value is the number of valid
+ * orthonormal columns; columns of R beyond it are zero.
+ *
+ * The work arrays G and Rp have length s*s, dot_x, dot_y, local and result
+ * have length at least s*(s+1)/2.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CAGMRESBlockQR( hypre_CAGMRESFunctions  *cagmres_functions,
+                      HYPRE_Int                s,
+                      void                   **v,
+                      HYPRE_Real              *R,
+                      HYPRE_Real              *G,
+                      HYPRE_Real              *Rp,
+                      void                   **dot_x,
+                      void                   **dot_y,
+                      HYPRE_Real              *local,
+                      HYPRE_Real              *result )
+{
+   hypre_MPI_Request  request;
+   hypre_MPI_Status   status;
+   HYPRE_Int          i, j, k, n, pass, s_eff;
+   HYPRE_Real         d, t, nrm;
+
+   for (i = 0; i < s*s; i++)
+   {
+      R[i] = 0.0;
+   }
+   for (i = 0; i < s; i++)
+   {
+      R[i*s+i] = 1.0;
+   }
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      /* Gram matrix, upper triangle */
+      n = 0;
+      for (i = 0; i < s; i++)
+      {
+         for (j = i; j < s; j++)
+         {
+            dot_x[n] = v[i];
+            dot_y[n] = v[j];
+            n++;
+         }
+      }
+      hypre_KrylovMultiInnerProd(cagmres_functions->MultiInnerProd, cagmres_functions->InnerProd,
+                                 n, dot_x, dot_y,
+                                 local, result, &request);
+      hypre_MPI_Wait(&request, &status);
+
+      n = 0;
+      for (i = 0; i < s; i++)
+      {
+         for (j = i; j < s; j++)
+         {
+            G[i*s+j] = result[n++];
+         }
+      }
+
+      /* Cholesky factorization G = Rp^T Rp of D G D, D = diag(G)^{-1/2} */
+      for (i = 0; i < s; i++)
+      {
+         if (!(G[i*s+i] > 0.0))
+         {
+            break;
+         }
+         local[i] = 1.0 / sqrt(G[i*s+i]);
+      }
+      if (i < s)
+      {
+         break;
+      }
+      for (j = 0; j < s; j++)
+      {
+         d = 1.0;
+         for (k = 0; k < j; k++)
+         {
+            d -= Rp[k*s+j] * Rp[k*s+j];
+         }
+         if (d <= 1.0e-14)
+         {
+            break;
+         }
+         Rp[j*s+j] = sqrt(d);
+         for (i = j+1; i < s; i++)
+         {
+            t = G[j*s+i] * local[j] * local[i];
+            for (k = 0; k < j; k++)
+            {
+               t -= Rp[k*s+j] * Rp[k*s+i];
+            }
+            Rp[j*s+i] = t / Rp[j*s+j];
+         }
+      }
+      if (j < s)
+      {
+         break;
+      }
+      /* undo the scaling: Rp <- Rp D^{-1} */
+      for (i = 0; i < s; i++)
+      {
+         for (j = i; j < s; j++)
+         {
+            Rp[i*s+j] /= local[j];
+         }
+      }
+
+      /* v <- v Rp^{-1} */
+      for (j = 0; j < s; j++)
+      {
+         for (k = 0; k < j; k++)
+         {
+            (*(cagmres_functions->Axpy))(-Rp[k*s+j], v[k], v[j]);
+         }
+         (*(cagmres_functions->ScaleVector))(1.0/Rp[j*s+j], v[j]);
+      }
+
+      /* R <- Rp R */
+      for (i = 0; i < s; i++)
+      {
+         for (j = s-1; j >= i; j--)
+         {
+            t = 0.0;
+            for (k = i; k <= j; k++)
+            {
+               t += Rp[i*s+k] * R[k*s+j];
+            }
+            R[i*s+j] = t;
+         }
+      }
+   }
+
+   if (pass == 2)
+   {
+      return s;
+   }
+
+   /* Cholesky breakdown: modified Gram-Schmidt on the current block */
+   for (i = 0; i < s*s; i++)
+   {
+      Rp[i] = 0.0;
+   }
+   s_eff = s;
+   for (j = 0; j < s; j++)
+   {
+      nrm = sqrt((*(cagmres_functions->InnerProd))(v[j],v[j]));
+      for (k = 0; k < j; k++)
+      {
+         Rp[k*s+j] = (*(cagmres_functions->InnerProd))(v[k],v[j]);
+         (*(cagmres_functions->Axpy))(-Rp[k*s+j], v[k], v[j]);
+      }
+      t = sqrt((*(cagmres_functions->InnerProd))(v[j],v[j]));
+      if (t <= 1.0e-12 * nrm || t == 0.0)
+      {
+         s_eff = j;
+         break;
+      }
+      Rp[j*s+j] = t;
+      (*(cagmres_functions->ScaleVector))(1.0/t, v[j]);
+   }
+
+   /* R <- Rp R on the leading s_eff columns */
+   for (i = 0; i < s; i++)
+   {
+      for (j = s-1; j >= 0; j--)
+      {
+         t = 0.0;
+         if (j >= i && j < s_eff)
+         {
+            for (k = i; k <= j; k++)
+            {
+               t += Rp[i*s+k] * R[k*s+j];
+            }
+         }
+         R[i*s+j] = t;
+      }
+   }
+
+   return s_eff;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESHessenbergEigenvalues
+ *
+ * Computes the eigenvalues (wr[i], wi[i]) of the n x n upper Hessenberg
+ * matrix a (row-major, overwritten) with the Francis double-shift QR
+ * algorithm.  Complex conjugate pairs are returned in consecutive entries.
+ * Returns 1 if the iteration does not converge.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CAGMRES_H(i,j) a[((i)-1)*n + (j)-1]
+#define hypre_CAGMRES_SIGN(x,y) ((y) >= 0.0 ? fabs(x) : -fabs(x))
+
+static HYPRE_Int
+hypre_CAGMRESHessenbergEigenvalues( HYPRE_Int   n,
+                                    HYPRE_Real *a,
+                                    HYPRE_Real *wr,
+                                    HYPRE_Real *wi )
+{
+   HYPRE_Int  nn, m, l, k, j, its, i, mmin;
+   HYPRE_Real z = 0.0, y, x, w, v, u, t, s, r = 0.0, q = 0.0, p = 0.0, anorm;
+
+   /* 1-based indices as in the EISPACK hqr routine */
+   anorm = 0.0;
+   for (i = 1; i <= n; i++)
+   {
+      for (j = hypre_max(i-1,1); j <= n; j++)
+      {
+         anorm += fabs(hypre_CAGMRES_H(i,j));
+      }
+   }
+   nn = n;
+   t = 0.0;
+   while (nn >= 1)
+   {
+      its = 0;
+      do
+      {
+         for (l = nn; l >= 2; l--)
+         {
+            s = fabs(hypre_CAGMRES_H(l-1,l-1)) + fabs(hypre_CAGMRES_H(l,l));
+            if (s == 0.0) s = anorm;
+            if ((HYPRE_Real)(fabs(hypre_CAGMRES_H(l,l-1)) + s) == s)
+            {
+               hypre_CAGMRES_H(l,l-1) = 0.0;
+               break;
+            }
+         }
+         x = hypre_CAGMRES_H(nn,nn);
+         if (l == nn)
+         {
+            /* one root found */
+            wr[nn-1] = x + t;
+            wi[nn-1] = 0.0;
+            nn--;
+         }
+         else
+         {
+            y = hypre_CAGMRES_H(nn-1,nn-1);
+            w = hypre_CAGMRES_H(nn,nn-1) * hypre_CAGMRES_H(nn-1,nn);
+            if (l == (nn-1))
+            {
+               /* two roots found */
+               p = 0.5 * (y - x);
+               q = p*p + w;
+               z = sqrt(fabs(q));
+               x += t;
+               if (q >= 0.0)
+               {
+                  z = p + hypre_CAGMRES_SIGN(z,p);
+                  wr[nn-2] = wr[nn-1] = x + z;
+                  if (z != 0.0) wr[nn-1] = x - w/z;
+                  wi[nn-2] = wi[nn-1] = 0.0;
+               }
+               else
+               {
+                  wr[nn-2] = wr[nn-1] = x + p;
+                  wi[nn-1] = z;
+                  wi[nn-2] = -z;
+               }
+               nn -= 2;
+            }
+            else
+            {
+               if (its == 30)
+               {
+                  return 1;
+               }
+               if (its == 10 || its == 20)
+               {
+                  /* exceptional shift */
+                  t += x;
+                  for (i = 1; i <= nn; i++)
+                  {
+                     hypre_CAGMRES_H(i,i) -= x;
+                  }
+                  s = fabs(hypre_CAGMRES_H(nn,nn-1)) + fabs(hypre_CAGMRES_H(nn-1,nn-2));
+                  y = x = 0.75 * s;
+                  w = -0.4375 * s * s;
+               }
+               ++its;
+               for (m = nn-2; m >= l; m--)
+               {
+                  z = hypre_CAGMRES_H(m,m);
+                  r = x - z;
+                  s = y - z;
+                  p = (r*s - w)/hypre_CAGMRES_H(m+1,m) + hypre_CAGMRES_H(m,m+1);
+                  q = hypre_CAGMRES_H(m+1,m+1) - z - r - s;
+                  r = hypre_CAGMRES_H(m+2,m+1);
+                  s = fabs(p) + fabs(q) + fabs(r);
+                  p /= s;
+                  q /= s;
+                  r /= s;
+                  if (m == l) break;
+                  u = fabs(hypre_CAGMRES_H(m,m-1)) * (fabs(q) + fabs(r));
+                  v = fabs(p) * (fabs(hypre_CAGMRES_H(m-1,m-1)) + fabs(z) +
+                                 fabs(hypre_CAGMRES_H(m+1,m+1)));
+                  if ((HYPRE_Real)(u + v) == v) break;
+               }
+               for (i = m+2; i <= nn; i++)
+               {
+                  hypre_CAGMRES_H(i,i-2) = 0.0;
+                  if (i != (m+2)) hypre_CAGMRES_H(i,i-3) = 0.0;
+               }
+               for (k = m; k <= nn-1; k++)
+               {
+                  if (k != m)
+                  {
+                     p = hypre_CAGMRES_H(k,k-1);
+                     q = hypre_CAGMRES_H(k+1,k-1);
+                     r = 0.0;
+                     if (k != (nn-1)) r = hypre_CAGMRES_H(k+2,k-1);
+                     if ((x = fabs(p) + fabs(q) + fabs(r)) != 0.0)
+                     {
+                        p /= x;
+                        q /= x;
+                        r /= x;
+                     }
+                  }
+                  if ((s = hypre_CAGMRES_SIGN(sqrt(p*p + q*q + r*r),p)) != 0.0)
+                  {
+                     if (k == m)
+                     {
+                        if (l != m)
+                           hypre_CAGMRES_H(k,k-1) = -hypre_CAGMRES_H(k,k-1);
+                     }
+                     else
+                     {
+                        hypre_CAGMRES_H(k,k-1) = -s * x;
+                     }
+                     p += s;
+                     x = p / s;
+                     y = q / s;
+                     z = r / s;
+                     q /= p;
+                     r /= p;
+                     for (j = k; j <= nn; j++)
+                     {
+                        p = hypre_CAGMRES_H(k,j) + q * hypre_CAGMRES_H(k+1,j);
+                        if (k != (nn-1))
+                        {
+                           p += r * hypre_CAGMRES_H(k+2,j);
+                           hypre_CAGMRES_H(k+2,j) -= p * z;
+                        }
+                        hypre_CAGMRES_H(k+1,j) -= p * y;
+                        hypre_CAGMRES_H(k,j) -= p * x;
+                     }
+                     mmin = nn < k+3 ? nn : k+3;
+                     for (i = l; i <= mmin; i++)
+                     {
+                        p = x * hypre_CAGMRES_H(i,k) + y * hypre_CAGMRES_H(i,k+1);
+                        if (k != (nn-1))
+                        {
+                           p += z * hypre_CAGMRES_H(i,k+2);
+                           hypre_CAGMRES_H(i,k+2) -= p * r;
+                        }
+                        hypre_CAGMRES_H(i,k+1) -= p * q;
+                        hypre_CAGMRES_H(i,k) -= p;
+                     }
+                  }
+               }
+            }
+         }
+      } while (l < nn-1);
+   }
+
+   return 0;
+}
+
+#undef hypre_CAGMRES_H
+#undef hypre_CAGMRES_SIGN
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESNewtonShifts
+ *
+ * Computes the Newton basis shifts from the leading n x n block of the
+ * (unrotated) Hessenberg matrix hh, stored by columns with leading dimension
+ * ldh.  The Ritz values are put in modified Leja order: each shift maximizes
+ * the product of its distances to the previous ones, and complex conjugate
+ * pairs are kept together as (re, +im), (re, -im) so that the basis can be
+ * generated in real arithmetic.  Returns 1 (and leaves the shifts untouched)
+ * if the eigenvalue iteration fails.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CAGMRESNewtonShifts( hypre_CAGMRESFunctions  *cagmres_functions,
+                           HYPRE_Int                n,
+                           HYPRE_Real              *hh,
+                           HYPRE_Int                ldh,
+                           HYPRE_Real              *shift_re,
+                           HYPRE_Real              *shift_im )
+{
+   HYPRE_Real *a, *wr, *wi;
+   HYPRE_Int  *used;
+   HYPRE_Int   i, j, k, m, best, ierr;
+   HYPRE_Real  val, best_val = 0.0, d;
+
+   a    = hypre_CTAllocF(HYPRE_Real, n*n, cagmres_functions, HYPRE_MEMORY_HOST);
+   wr   = hypre_CTAllocF(HYPRE_Real, n, cagmres_functions, HYPRE_MEMORY_HOST);
+   wi   = hypre_CTAllocF(HYPRE_Real, n, cagmres_functions, HYPRE_MEMORY_HOST);
+   used = hypre_CTAllocF(HYPRE_Int, n, cagmres_functions, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < n; i++)
+   {
+      for (j = hypre_max(i-1,0); j < n; j++)
+      {
+         a[i*n+j] = hh[j*ldh+i];
+      }
+   }
+
+   ierr = hypre_CAGMRESHessenbergEigenvalues(n, a, wr, wi);
+
+   k = 0;
+   while (!ierr && k < n)
+   {
+      /* only the member with wi >= 0 of a conjugate pair is a candidate */
+      best = -1;
+      for (j = 0; j < n; j++)
+      {
+         if (used[j] || wi[j] < 0.0)
+         {
+            continue;
+         }
+         if (k == 0)
+         {
+            val = sqrt(wr[j]*wr[j] + wi[j]*wi[j]);
+         }
+         else
+         {
+            val = 0.0;
+            for (m = 0; m < k; m++)
+            {
+               d = sqrt( (wr[j]-shift_re[m])*(wr[j]-shift_re[m]) +
+                         (wi[j]-shift_im[m])*(wi[j]-shift_im[m]) );
+               val += log(hypre_max(d, 1.0e-300));
+            }
+         }
+         if (best < 0 || val > best_val)
+         {
+            best = j;
+            best_val = val;
+         }
+      }
+      if (best < 0)
+      {
+         ierr = 1;
+         break;
+      }
+
+      used[best] = 1;
+      shift_re[k] = wr[best];
+      shift_im[k] = wi[best];
+      k++;
+      if (wi[best] > 0.0)
+      {
+         for (j = 0; j < n; j++)
+         {
+            if (!used[j] && wr[j] == wr[best] && wi[j] == -wi[best])
+            {
+               break;
+            }
+         }
+         if (j < n)
+         {
+            used[j] = 1;
+            shift_re[k] = wr[j];
+            shift_im[k] = wi[j];
+            k++;
+         }
+         else
+         {
+            shift_im[k-1] = 0.0;
+         }
+      }
+   }
+
+   if (ierr)
+   {
+      for (k = 0; k < n; k++)
+      {
+         shift_re[k] = 0.0;
+         shift_im[k] = 0.0;
+      }
+   }
+
+   hypre_TFreeF(a, cagmres_functions);
+   hypre_TFreeF(wr, cagmres_functions);
+   hypre_TFreeF(wi, cagmres_functions);
+   hypre_TFreeF(used, cagmres_functions);
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSolve
+ *
+ * Notation for one block, with c = i+1 orthonormal vectors q_0,...,q_{c-1}
+ * in p[0],...,p[c-1] and s new vectors v_1,...,v_s in p[c],...,p[c+s-1]:
+ *
+ *    A M [v_0,...,v_{s-1}] = [v_0,...,v_s] B,  v_0 = q_{c-1},
+ *    [v_0,...,v_s] = [q_0,...,q_{c+s-1}] R,
+ *
+ * where B is the (s+1) x s change-of-basis matrix of the shifts and R is
+ * assembled from the projection coefficients C and the block factor R_w.
+ * With A M Q_{c-1} = Q_c H_old this gives the new Hessenberg columns
+ *
+ *    H_new = (R B - H_old T) R_s^{-1},
+ *
+ * with T the first c-1 rows and R_s the trailing s x s block of R(:,0:s-1).
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSolve(void  *cagmres_vdata,
+                   void  *A,
+                   void  *b,
+                   void  *x)
+{
+   hypre_CAGMRESData      *cagmres_data      = (hypre_CAGMRESData *)cagmres_vdata;
+   hypre_CAGMRESFunctions *cagmres_functions = cagmres_data->functions;
+   HYPRE_Int     k_dim             = (cagmres_data -> k_dim);
+   HYPRE_Int     s_step            = (cagmres_data -> s_step);
+   HYPRE_Int     basis             = (cagmres_data -> basis);
+   HYPRE_Int     min_iter          = (cagmres_data -> min_iter);
+   HYPRE_Int     max_iter          = (cagmres_data -> max_iter);
+   HYPRE_Int     skip_real_r_check = (cagmres_data -> skip_real_r_check);
+   HYPRE_Real    r_tol             = (cagmres_data -> tol);
+   HYPRE_Real    a_tol             = (cagmres_data -> a_tol);
+   void         *matvec_data       = (cagmres_data -> matvec_data);
+
+   void         *r                 = (cagmres_data -> r);
+   void         *w                 = (cagmres_data -> w);
+
+   void        **p                 = (cagmres_data -> p);
+
+   HYPRE_Int (*precond)(void*,void*,void*,void*) = (cagmres_functions -> precond);
+   HYPRE_Int  *precond_data       = (HYPRE_Int*)(cagmres_data -> precond_data);
+
+   HYPRE_Int print_level = (cagmres_data -> print_level);
+   HYPRE_Int logging     = (cagmres_data -> logging);
+
+   HYPRE_Real     *norms          = (cagmres_data -> norms);
+
+   hypre_MPI_Request  request;
+   hypre_MPI_Status   status;
+
+   HYPRE_Int  i, j, k, l, n, col, pass, c, s, s_cur, s_eff, ncols;
+   HYPRE_Int  iter, cycle_done, have_shifts, ldh;
+   HYPRE_Int  my_id, num_procs;
+   HYPRE_Real *rs, *hh, *rh, *cs, *sn;
+   HYPRE_Real *Cb, *Rw, *G, *Rp, *Yb, *shift_re, *shift_im;
+   HYPRE_Real *local, *result;
+   void      **dot_x, **dot_y;
+   HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm;
+   HYPRE_Real rkj, real_r_norm_old;
+
+   HYPRE_Real epsmac = 1.e-16;
+   HYPRE_Real ieee_check = 0.;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (cagmres_data -> converged) = 0;
+
+   (*(cagmres_functions->CommInfo))(A,&my_id,&num_procs);
+   if ( logging>0 || print_level>0 )
+   {
+      norms = (cagmres_data -> norms);
+   }
+
+   s = hypre_min(s_step, k_dim);
+   ldh = k_dim+1;
+   n = (k_dim+1)*s + (s*(s+1))/2;
+
+   (*(cagmres_functions->CopyVector))(b,p[0]);
+
+   /* compute initial residual */
+   (*(cagmres_functions->Matvec))(matvec_data,-1.0, A, x, 1.0, p[0]);
+
+   b_norm = sqrt((*(cagmres_functions->InnerProd))(b,b));
+
+   /* Since it is does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input. */
+   if (b_norm != 0.) ieee_check = b_norm/b_norm; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      /* ...INFs or NaNs in input can make ieee_check a NaN.  This test
+         for ieee_check self-equality works on all IEEE-compliant compilers/
+         machines, c.f. page 8 of "Lecture Notes on the Status of IEEE 754"
+         by W. Kahan, May 31, 1996.  Currently (July 2002) this paper may be
+         found at http://HTTP.CS.Berkeley.EDU/~wkahan/ieee754status/IEEE754.PDF */
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_CAGMRESSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied b.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   r_norm = sqrt((*(cagmres_functions->InnerProd))(p[0],p[0]));
+   real_r_norm_old = r_norm;
+
+   /* Since it is does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input. */
+   if (r_norm != 0.) ieee_check = r_norm/r_norm; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      /* ...INFs or NaNs in input can make ieee_check a NaN.  This test
+         for ieee_check self-equality works on all IEEE-compliant compilers/
+         machines, c.f. page 8 of "Lecture Notes on the Status of IEEE 754"
+         by W. Kahan, May 31, 1996.  Currently (July 2002) this paper may be
+         found at http://HTTP.CS.Berkeley.EDU/~wkahan/ieee754status/IEEE754.PDF */
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_CAGMRESSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /* initialize work arrays */
+   rs = hypre_CTAllocF(HYPRE_Real, k_dim+1, cagmres_functions, HYPRE_MEMORY_HOST);
+   cs = hypre_CTAllocF(HYPRE_Real, k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   sn = hypre_CTAllocF(HYPRE_Real, k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   /* Hessenberg matrix by columns, unrotated (hh) and rotated (rh) */
+   hh = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   rh = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   Cb = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*s, cagmres_functions, HYPRE_MEMORY_HOST);
+   Yb = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*s, cagmres_functions, HYPRE_MEMORY_HOST);
+   Rw = hypre_CTAllocF(HYPRE_Real, s*s, cagmres_functions, HYPRE_MEMORY_HOST);
+   Rp = hypre_CTAllocF(HYPRE_Real, s*s, cagmres_functions, HYPRE_MEMORY_HOST);
+   G  = hypre_CTAllocF(HYPRE_Real, s*s, cagmres_functions, HYPRE_MEMORY_HOST);
+   shift_re = hypre_CTAllocF(HYPRE_Real, s, cagmres_functions, HYPRE_MEMORY_HOST);
+   shift_im = hypre_CTAllocF(HYPRE_Real, s, cagmres_functions, HYPRE_MEMORY_HOST);
+   local  = hypre_CTAllocF(HYPRE_Real, n, cagmres_functions, HYPRE_MEMORY_HOST);
+   result = hypre_CTAllocF(HYPRE_Real, n, cagmres_functions, HYPRE_MEMORY_HOST);
+   dot_x  = hypre_CTAllocF(void *, n, cagmres_functions, HYPRE_MEMORY_HOST);
+   dot_y  = hypre_CTAllocF(void *, n, cagmres_functions, HYPRE_MEMORY_HOST);
+
+   /* the first block uses the monomial basis */
+   have_shifts = 0;
+
+   if ( logging>0 || print_level > 0)
+   {
+      norms[0] = r_norm;
+      if ( print_level>1 && my_id == 0 )
+      {
+         hypre_printf("L2 norm of b: %e\n", b_norm);
+         if (b_norm == 0.0)
+            hypre_printf("Rel_resid_norm actually contains the residual norm\n");
+         hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+      }
+   }
+   iter = 0;
+
+   if (b_norm > 0.0)
+   {
+      /* convergence criterion |r_i|/|b| <= accuracy if |b| > 0 */
+      den_norm = b_norm;
+   }
+   else
+   {
+      /* convergence criterion |r_i|/|r0| <= accuracy if |b| = 0 */
+      den_norm = r_norm;
+   };
+
+   /* convergence criteria: |r_i| <= max( a_tol, r_tol * den_norm)
+      den_norm = |r_0| or |b|
+      note: default for a_tol is 0.0, so relative residual criteria is used unless
+      user specifies a_tol, or sets r_tol = 0.0, which means absolute
+      tol only is checked  */
+
+   epsilon = hypre_max(a_tol,r_tol*den_norm);
+
+   /* so now our stop criteria is |r_i| <= epsilon */
+
+   if ( print_level>1 && my_id == 0 )
+   {
+      if (b_norm > 0.0)
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+         hypre_printf("-----    ------------    ---------- ------------\n");
+
+      }
+      else
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate\n");
+         hypre_printf("-----    ------------    ----------\n");
+      };
+   }
+
+   /* p[0] holds the true residual at the start of every restart cycle */
+   while (iter < max_iter)
+   {
+      if (r_norm == 0.0 || (r_norm <= epsilon && iter >= min_iter))
+      {
+         if ( print_level>1 && my_id == 0)
+         {
+            hypre_printf("\n\n");
+            hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+         }
+         (cagmres_data -> converged) = 1;
+         break;
+      }
+
+      rs[0] = r_norm;
+      t = 1.0 / r_norm;
+      (*(cagmres_functions->ScaleVector))(t,p[0]);
+      i = 0;
+      cycle_done = 0;
+
+      /***RESTART CYCLE (right-preconditioning) ***/
+      while (!cycle_done && i < k_dim && iter < max_iter)
+      {
+         c = i+1;
+         s_cur = hypre_min(s, k_dim-i);
+
+         /*-----------------------------------------------------------------
+          * Basis generation: s_cur preconditioned matvecs, no reductions
+          *-----------------------------------------------------------------*/
+
+         for (j = 0; j < s_cur; j++)
+         {
+            (*(cagmres_functions->ClearVector))(r);
+            precond(precond_data, A, p[c-1+j], r);
+            (*(cagmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[c+j]);
+            if (have_shifts)
+            {
+               if (shift_re[j] != 0.0)
+               {
+                  (*(cagmres_functions->Axpy))(-shift_re[j], p[c-1+j], p[c+j]);
+               }
+               if (shift_im[j] < 0.0)
+               {
+                  (*(cagmres_functions->Axpy))(shift_im[j]*shift_im[j], p[c-2+j], p[c+j]);
+               }
+            }
+         }
+
+         /*-----------------------------------------------------------------
+          * Block classical Gram-Schmidt against q_0,...,q_{c-1}, two passes
+          *-----------------------------------------------------------------*/
+
+         for (k = 0; k < c*s_cur; k++)
+         {
+            Cb[k] = 0.0;
+         }
+         for (pass = 0; pass < 2; pass++)
+         {
+            for (k = 0; k < c; k++)
+            {
+               for (j = 0; j < s_cur; j++)
+               {
+                  dot_x[k*s_cur+j] = p[k];
+                  dot_y[k*s_cur+j] = p[c+j];
+               }
+            }
+            hypre_KrylovMultiInnerProd(cagmres_functions->MultiInnerProd, cagmres_functions->InnerProd,
+                                       c*s_cur, dot_x, dot_y,
+                                       local, result, &request);
+            hypre_MPI_Wait(&request, &status);
+            for (k = 0; k < c; k++)
+            {
+               for (j = 0; j < s_cur; j++)
+               {
+                  Cb[k*s_cur+j] += result[k*s_cur+j];
+                  (*(cagmres_functions->Axpy))(-result[k*s_cur+j], p[k], p[c+j]);
+               }
+            }
+         }
+
+         /*-----------------------------------------------------------------
+          * Orthonormalize the block: p[c..c+s_cur-1] = W R_w
+          *-----------------------------------------------------------------*/
+
+         s_eff = hypre_CAGMRESBlockQR(cagmres_functions, s_cur, &p[c], Rw, G, Rp,
+                                      dot_x, dot_y, local, result);
+
+         /* on a breakdown of the first vector, one column is still defined */
+         ncols = hypre_max(s_eff, 1);
+
+         /*-----------------------------------------------------------------
+          * New Hessenberg columns c-1,...,c+ncols-2:
+          * Yb = R B - H_old T (rows 0..c+ncols-1), then Yb <- Yb R_s^{-1}
+          *
+          * R(k,0) = e_{c-1}, R(k,j+1) = C(k,j) for k < c, R_w(k-c,j) else
+          *-----------------------------------------------------------------*/
+
+#define hypre_CAGMRES_R(k,j) \
+   ( (j) == 0 ? ((k) == c-1 ? 1.0 : 0.0) : \
+     ((k) < c ? Cb[(k)*s_cur+(j)-1] : Rw[((k)-c)*s_cur+(j)-1]) )
+
+         for (j = 0; j < ncols; j++)
+         {
+            for (k = 0; k < c+ncols; k++)
+            {
+               /* (R B)(k,j) */
+               t = hypre_CAGMRES_R(k,j+1);
+               if (have_shifts)
+               {
+                  t += shift_re[j] * hypre_CAGMRES_R(k,j);
+                  if (shift_im[j] < 0.0)
+                  {
+                     t -= shift_im[j] * shift_im[j] * hypre_CAGMRES_R(k,j-1);
+                  }
+               }
+               /* (H_old T)(k,j) */
+               if (k < c && j > 0)
+               {
+                  for (l = hypre_max(k-1,0); l < c-1; l++)
+                  {
+                     t -= hh[l*ldh+k] * Cb[l*s_cur+j-1];
+                  }
+               }
+               Yb[k*s+j] = t;
+            }
+         }
+         for (j = 0; j < ncols; j++)
+         {
+            for (k = 0; k < c+ncols; k++)
+            {
+               t = Yb[k*s+j];
+               for (l = 0; l < j; l++)
+               {
+                  rkj = hypre_CAGMRES_R(c-1+l,j);
+                  t -= Yb[k*s+l] * rkj;
+               }
+               Yb[k*s+j] = t / hypre_CAGMRES_R(c-1+j,j);
+            }
+         }
+
+#undef hypre_CAGMRES_R
+
+         for (j = 0; j < ncols; j++)
+         {
+            col = c-1+j;
+            for (k = 0; k <= col+1; k++)
+            {
+               hh[col*ldh+k] = Yb[k*s+j];
+            }
+         }
+         if (s_eff == 0)
+         {
+            /* A M q_{c-1} lies in the current space */
+            hh[(c-1)*ldh+c] = 0.0;
+         }
+
+         /* Newton shifts from the Ritz values of the first full block */
+         if (basis == 1 && !have_shifts && c == 1 && s_eff == s && s > 1)
+         {
+            if (!hypre_CAGMRESNewtonShifts(cagmres_functions, s, hh, ldh,
+                                           shift_re, shift_im))
+            {
+               have_shifts = 1;
+            }
+         }
+
+         /*-----------------------------------------------------------------
+          * Givens rotations and residual norm, one column at a time
+          *-----------------------------------------------------------------*/
+
+         for (j = 0; j < ncols; j++)
+         {
+            col = c-1+j;
+            for (k = 0; k <= col+1; k++)
+            {
+               rh[col*ldh+k] = hh[col*ldh+k];
+            }
+            i++;
+            iter++;
+            for (k = 1; k < i; k++)
+            {
+               t = rh[col*ldh+k-1];
+               rh[col*ldh+k-1] = sn[k-1]*rh[col*ldh+k] + cs[k-1]*t;
+               rh[col*ldh+k] = -sn[k-1]*t + cs[k-1]*rh[col*ldh+k];
+            }
+            t = rh[col*ldh+i]*rh[col*ldh+i];
+            t += rh[col*ldh+i-1]*rh[col*ldh+i-1];
+            gamma = sqrt(t);
+            if (gamma == 0.0) gamma = epsmac;
+            cs[i-1] = rh[col*ldh+i-1]/gamma;
+            sn[i-1] = rh[col*ldh+i]/gamma;
+            rs[i] = -sn[i-1]*rs[i-1];
+            rs[i-1] = cs[i-1]*rs[i-1];
+            rh[col*ldh+i-1] = sn[i-1]*rh[col*ldh+i] + cs[i-1]*rh[col*ldh+i-1];
+            r_norm = fabs(rs[i]);
+            if ( logging>0 || print_level>0 )
+            {
+               norms[iter] = r_norm;
+               if ( print_level>1 && my_id == 0 )
+               {
+                  if (b_norm > 0.0)
+                     hypre_printf("% 5d    %e    %f   %e\n", iter,
+                        norms[iter],norms[iter]/norms[iter-1],
+                        norms[iter]/b_norm);
+                  else
+                     hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                        norms[iter]/norms[iter-1]);
+               }
+            }
+            /* should we exit the restart cycle? (conv. check) */
+            if ((r_norm <= epsilon && iter >= min_iter) || iter >= max_iter)
+            {
+               cycle_done = 1;
+               break;
+            }
+         }
+
+         /* restart after a rank-deficient block */
+         if (s_eff < s_cur)
+         {
+            cycle_done = 1;
+         }
+      } /*** end of restart cycle ***/
+
+      /* now compute solution, first solve upper triangular system */
+      rs[i-1] = rs[i-1]/rh[(i-1)*ldh+i-1];
+      for (k = i-2; k >= 0; k--)
+      {
+         t = 0.0;
+         for (j = k+1; j < i; j++)
+         {
+            t -= rh[j*ldh+k]*rs[j];
+         }
+         t+= rs[k];
+         rs[k] = t/rh[k*ldh+k];
+      }
+
+      (*(cagmres_functions->CopyVector))(p[i-1],w);
+      (*(cagmres_functions->ScaleVector))(rs[i-1],w);
+      for (j = i-2; j >=0; j--)
+         (*(cagmres_functions->Axpy))(rs[j], p[j], w);
+
+      (*(cagmres_functions->ClearVector))(r);
+      /* find correction (in r) */
+      precond(precond_data, A, w, r);
+
+      /* update current solution x (in x) */
+      (*(cagmres_functions->Axpy))(1.0,r,x);
+
+      if (skip_real_r_check && r_norm <= epsilon && iter >= min_iter)
+      {
+         (cagmres_data -> converged) = 1;
+         break;
+      }
+
+      /* the next cycle restarts from the true residual */
+      (*(cagmres_functions->CopyVector))(b,p[0]);
+      (*(cagmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,p[0]);
+      (*(cagmres_functions->CopyVector))(p[0],r);
+      t = r_norm;
+      r_norm = sqrt( (*(cagmres_functions->InnerProd))(p[0],p[0]) );
+
+      if (t <= epsilon && iter >= min_iter && r_norm > epsilon)
+      {
+         /* exit if the real residual norm has not decreased */
+         if (r_norm >= real_r_norm_old)
+         {
+            if (print_level > 1 && my_id == 0)
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            break;
+         }
+         /* report discrepancy between real/CAGMRES residuals and restart */
+         if ( print_level>0 && my_id == 0)
+            hypre_printf("false convergence, L2 norm of residual: %e\n", r_norm);
+      }
+      real_r_norm_old = r_norm;
+
+      if (iter >= max_iter && r_norm <= epsilon && iter >= min_iter)
+      {
+         (cagmres_data -> converged) = 1;
+      }
+   } /* END of iteration while loop */
+
+   (cagmres_data -> num_iterations) = iter;
+   if (b_norm > 0.0)
+      (cagmres_data -> rel_residual_norm) = r_norm/b_norm;
+   if (b_norm == 0.0)
+      (cagmres_data -> rel_residual_norm) = r_norm;
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0) hypre_error(HYPRE_ERROR_CONV);
+
+   hypre_TFreeF(rs,cagmres_functions);
+   hypre_TFreeF(cs,cagmres_functions);
+   hypre_TFreeF(sn,cagmres_functions);
+   hypre_TFreeF(hh,cagmres_functions);
+   hypre_TFreeF(rh,cagmres_functions);
+   hypre_TFreeF(Cb,cagmres_functions);
+   hypre_TFreeF(Yb,cagmres_functions);
+   hypre_TFreeF(Rw,cagmres_functions);
+   hypre_TFreeF(Rp,cagmres_functions);
+   hypre_TFreeF(G,cagmres_functions);
+   hypre_TFreeF(shift_re,cagmres_functions);
+   hypre_TFreeF(shift_im,cagmres_functions);
+   hypre_TFreeF(local,cagmres_functions);
+   hypre_TFreeF(result,cagmres_functions);
+   hypre_TFreeF(dot_x,cagmres_functions);
+   hypre_TFreeF(dot_y,cagmres_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetKDim, hypre_CAGMRESGetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetKDim( void   *cagmres_vdata,
+                      HYPRE_Int   k_dim )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   if (k_dim < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (cagmres_data -> k_dim) = k_dim;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetKDim( void   *cagmres_vdata,
+                      HYPRE_Int * k_dim )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *k_dim = (cagmres_data -> k_dim);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetSStep, hypre_CAGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetSStep( void   *cagmres_vdata,
+                       HYPRE_Int   s_step )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   if (s_step < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (cagmres_data -> s_step) = s_step;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetSStep( void   *cagmres_vdata,
+                       HYPRE_Int * s_step )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *s_step = (cagmres_data -> s_step);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetBasis, hypre_CAGMRESGetBasis
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetBasis( void   *cagmres_vdata,
+                       HYPRE_Int   basis )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   if (basis < 0 || basis > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (cagmres_data -> basis) = basis;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetBasis( void   *cagmres_vdata,
+                       HYPRE_Int * basis )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *basis = (cagmres_data -> basis);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetTol, hypre_CAGMRESGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetTol( void   *cagmres_vdata,
+                     HYPRE_Real  tol       )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   (cagmres_data -> tol) = tol;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetTol( void   *cagmres_vdata,
+                     HYPRE_Real  * tol      )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *tol = (cagmres_data -> tol);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetAbsoluteTol, hypre_CAGMRESGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetAbsoluteTol( void   *cagmres_vdata,
+                             HYPRE_Real  a_tol       )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   (cagmres_data -> a_tol) = a_tol;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetAbsoluteTol( void   *cagmres_vdata,
+                             HYPRE_Real  * a_tol      )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *a_tol = (cagmres_data -> a_tol);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetMinIter, hypre_CAGMRESGetMinIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetMinIter( void *cagmres_vdata,
+                         HYPRE_Int   min_iter  )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   (cagmres_data -> min_iter) = min_iter;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetMinIter( void *cagmres_vdata,
+                         HYPRE_Int * min_iter  )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *min_iter = (cagmres_data -> min_iter);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetMaxIter, hypre_CAGMRESGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetMaxIter( void *cagmres_vdata,
+                         HYPRE_Int   max_iter  )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   (cagmres_data -> max_iter) = max_iter;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetMaxIter( void *cagmres_vdata,
+                         HYPRE_Int * max_iter  )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *max_iter = (cagmres_data -> max_iter);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetSkipRealResidualCheck, hypre_CAGMRESGetSkipRealResidualCheck
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetSkipRealResidualCheck( void *cagmres_vdata,
+                                       HYPRE_Int skip_real_r_check )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   (cagmres_data -> skip_real_r_check) = skip_real_r_check;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetSkipRealResidualCheck( void *cagmres_vdata,
+                                       HYPRE_Int *skip_real_r_check)
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *skip_real_r_check = (cagmres_data -> skip_real_r_check);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetPrecond( void  *cagmres_vdata,
+                         HYPRE_Int  (*precond)(void*,void*,void*,void*),
+                         HYPRE_Int  (*precond_setup)(void*,void*,void*,void*),
+                         void  *precond_data )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   hypre_CAGMRESFunctions *cagmres_functions = cagmres_data->functions;
+   (cagmres_functions -> precond)        = precond;
+   (cagmres_functions -> precond_setup)  = precond_setup;
+   (cagmres_data -> precond_data)   = precond_data;
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESGetPrecond( void         *cagmres_vdata,
+                         HYPRE_Solver *precond_data_ptr )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *precond_data_ptr = (HYPRE_Solver)(cagmres_data -> precond_data);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetPrintLevel, hypre_CAGMRESGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetPrintLevel( void *cagmres_vdata,
+                            HYPRE_Int   level)
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   (cagmres_data -> print_level) = level;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetPrintLevel( void *cagmres_vdata,
+                            HYPRE_Int * level)
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *level = (cagmres_data -> print_level);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetLogging, hypre_CAGMRESGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetLogging( void *cagmres_vdata,
+                         HYPRE_Int   level)
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   (cagmres_data -> logging) = level;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetLogging( void *cagmres_vdata,
+                         HYPRE_Int * level)
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *level = (cagmres_data -> logging);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESGetNumIterations( void *cagmres_vdata,
+                               HYPRE_Int  *num_iterations )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *num_iterations = (cagmres_data -> num_iterations);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESGetConverged( void *cagmres_vdata,
+                           HYPRE_Int  *converged )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *converged = (cagmres_data -> converged);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESGetFinalRelativeResidualNorm( void   *cagmres_vdata,
+                                           HYPRE_Real *relative_residual_norm )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *relative_residual_norm = (cagmres_data -> rel_residual_norm);
+   return hypre_error_flag;
+}
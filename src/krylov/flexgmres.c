@@ -32,6 +32,8 @@ hypre_FlexGMRESFunctionsCreate(
                                    void *x, HYPRE_Complex beta, void *y ),
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
    HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
    HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
    HYPRE_Int    (*ClearVector)   ( void *x ),
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -54,6 +56,7 @@ hypre_FlexGMRESFunctionsCreate(
    fgmres_functions->Matvec = Matvec;
    fgmres_functions->MatvecDestroy = MatvecDestroy;
    fgmres_functions->InnerProd = InnerProd;
+   fgmres_functions->MultiInnerProd = MultiInnerProd;
    fgmres_functions->CopyVector = CopyVector;
    fgmres_functions->ClearVector = ClearVector;
    fgmres_functions->ScaleVector = ScaleVector;
@@ -90,6 +93,7 @@ hypre_FlexGMRESCreate( hypre_FlexGMRESFunctions *fgmres_functions )
    (fgmres_data -> min_iter)       = 0;
    (fgmres_data -> max_iter)       = 1000;
    (fgmres_data -> rel_change)     = 0;
+   (fgmres_data -> cgs)            = 0; /* modified Gram-Schmidt */
    (fgmres_data -> stop_crit)      = 0; /* rel. residual norm */
    (fgmres_data -> converged)      = 0;
    (fgmres_data -> precond_data)   = NULL;
@@ -267,6 +271,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    HYPRE_Int 		     k_dim        = (fgmres_data -> k_dim);
    HYPRE_Int               min_iter     = (fgmres_data -> min_iter);
    HYPRE_Int 		     max_iter     = (fgmres_data -> max_iter);
+   HYPRE_Int 		     cgs          = (fgmres_data -> cgs);
    HYPRE_Real 	     r_tol        = (fgmres_data -> tol);
    HYPRE_Real 	     cf_tol       = (fgmres_data -> cf_tol);
    HYPRE_Real        a_tol        = (fgmres_data -> a_tol);
@@ -292,6 +297,8 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    HYPRE_Int        break_value = 0;
    HYPRE_Int	      i, j, k;
    HYPRE_Real *rs, **hh, *c, *s;
+   void      **dot_y = NULL;
+   HYPRE_Real *dot_local = NULL, *dot_result = NULL;
    HYPRE_Int        iter;
    HYPRE_Int        my_id, num_procs;
    HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm;
@@ -338,6 +345,12 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    {
       hh[i] = hypre_CTAllocF(HYPRE_Real,k_dim,fgmres_functions, HYPRE_MEMORY_HOST);
    }
+   if (cgs > 0)
+   {
+      dot_y = hypre_CTAllocF(void*,k_dim+1,fgmres_functions, HYPRE_MEMORY_HOST);
+      dot_local = hypre_CTAllocF(HYPRE_Real,k_dim+1,fgmres_functions, HYPRE_MEMORY_HOST);
+      dot_result = hypre_CTAllocF(HYPRE_Real,k_dim+1,fgmres_functions, HYPRE_MEMORY_HOST);
+   }
 
    (*(fgmres_functions->CopyVector))(b,p[0]);
 
@@ -468,6 +481,9 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
               hypre_TFreeF(hh[i],fgmres_functions);
            }
 
+           hypre_TFreeF(dot_y,fgmres_functions);
+           hypre_TFreeF(dot_local,fgmres_functions);
+           hypre_TFreeF(dot_result,fgmres_functions);
            hypre_TFreeF(hh,fgmres_functions);
            HYPRE_ANNOTATE_FUNC_END;
 
@@ -522,13 +538,10 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
            (*(fgmres_functions->Matvec))(matvec_data, 1.0, A, pre_vecs[i-1], 0.0, p[i]);
 
 
-           /* modified Gram_Schmidt */
-           for (j=0; j < i; j++)
-           {
-              hh[j][i-1] = (*(fgmres_functions->InnerProd))(p[j],p[i]);
-              (*(fgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
-           }
-           t = sqrt((*(fgmres_functions->InnerProd))(p[i],p[i]));
+           /* Gram-Schmidt, see hypre_KrylovOrthogonalize */
+           t = hypre_KrylovOrthogonalize(fgmres_functions->MultiInnerProd, fgmres_functions->InnerProd,
+                                         fgmres_functions->Axpy, cgs, i, p, hh,
+                                         dot_y, dot_local, dot_result);
            hh[i][i-1] = t;
            if (t != 0.0)
            {
@@ -703,6 +716,9 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    {
    	hypre_TFreeF(hh[i],fgmres_functions);
    }
+   hypre_TFreeF(dot_y,fgmres_functions);
+   hypre_TFreeF(dot_local,fgmres_functions);
+   hypre_TFreeF(dot_result,fgmres_functions);
    hypre_TFreeF(hh,fgmres_functions);
 
    HYPRE_ANNOTATE_FUNC_END;
@@ -878,6 +894,38 @@ hypre_FlexGMRESGetMaxIter( void *fgmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FlexGMRESSetCGS, hypre_FlexGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FlexGMRESSetCGS( void      *fgmres_vdata,
+                       HYPRE_Int  cgs )
+{
+   hypre_FlexGMRESData *fgmres_data = (hypre_FlexGMRESData *)fgmres_vdata;
+
+   if (cgs < 0 || cgs > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (fgmres_data -> cgs) = cgs;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_FlexGMRESGetCGS( void      *fgmres_vdata,
+                       HYPRE_Int *cgs )
+{
+   hypre_FlexGMRESData *fgmres_data = (hypre_FlexGMRESData *)fgmres_vdata;
+
+   *cgs = (fgmres_data -> cgs);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  * hypre_FlexGMRESSetStopCrit, hypre_FlexGMRESGetStopCrit
@@ -32,6 +32,8 @@ hypre_GMRESFunctionsCreate(
                                    void *x, HYPRE_Complex beta, void *y ),
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
    HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
    HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
    HYPRE_Int    (*ClearVector)   ( void *x ),
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -54,6 +56,7 @@ hypre_GMRESFunctionsCreate(
    gmres_functions->Matvec = Matvec;
    gmres_functions->MatvecDestroy = MatvecDestroy;
    gmres_functions->InnerProd = InnerProd;
+   gmres_functions->MultiInnerProd = MultiInnerProd;
    gmres_functions->CopyVector = CopyVector;
    gmres_functions->ClearVector = ClearVector;
    gmres_functions->ScaleVector = ScaleVector;
@@ -87,6 +90,7 @@ hypre_GMRESCreate( hypre_GMRESFunctions *gmres_functions )
    (gmres_data -> min_iter)       = 0;
    (gmres_data -> max_iter)       = 1000;
    (gmres_data -> rel_change)     = 0;
+   (gmres_data -> cgs)            = 0; /* modified Gram-Schmidt */
    (gmres_data -> skip_real_r_check) = 0;
    (gmres_data -> stop_crit)      = 0; /* rel. residual norm  - this is obsolete!*/
    (gmres_data -> converged)      = 0;
@@ -258,6 +262,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    HYPRE_Int             min_iter           = (gmres_data -> min_iter);
    HYPRE_Int             max_iter           = (gmres_data -> max_iter);
    HYPRE_Int             rel_change         = (gmres_data -> rel_change);
+   HYPRE_Int             cgs                = (gmres_data -> cgs);
    HYPRE_Int             skip_real_r_check  = (gmres_data -> skip_real_r_check);
    HYPRE_Int 		 hybrid             = (gmres_data -> hybrid);
    HYPRE_Real            r_tol              = (gmres_data -> tol);
@@ -285,6 +290,8 @@ hypre_GMRESSolve(void  *gmres_vdata,
    HYPRE_Int        break_value = 0;
    HYPRE_Int        i, j, k;
    HYPRE_Real *rs, **hh, *c, *s, *rs_2;
+   void      **dot_y = NULL;
+   HYPRE_Real *dot_local = NULL, *dot_result = NULL;
    HYPRE_Int        iter;
    HYPRE_Int        my_id, num_procs;
    HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm, x_norm;
@@ -334,6 +341,12 @@ hypre_GMRESSolve(void  *gmres_vdata,
    {
       hh[i] = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
    }
+   if (cgs > 0)
+   {
+      dot_y = hypre_CTAllocF(void*,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+      dot_local = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+      dot_result = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+   }
 
    (*(gmres_functions->CopyVector))(b,p[0]);
 
@@ -469,6 +482,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
          hypre_TFreeF(rs,gmres_functions);
          if (rel_change)  hypre_TFreeF(rs_2,gmres_functions);
          for (i=0; i < k_dim+1; i++) hypre_TFreeF(hh[i],gmres_functions);
+         hypre_TFreeF(dot_y,gmres_functions);
+         hypre_TFreeF(dot_local,gmres_functions);
+         hypre_TFreeF(dot_result,gmres_functions);
          hypre_TFreeF(hh,gmres_functions);
          HYPRE_ANNOTATE_FUNC_END;
 
@@ -516,13 +532,10 @@ hypre_GMRESSolve(void  *gmres_vdata,
          (*(gmres_functions->ClearVector))(r);
          precond(precond_data, A, p[i-1], r);
          (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
-         /* modified Gram_Schmidt */
-         for (j=0; j < i; j++)
-         {
-            hh[j][i-1] = (*(gmres_functions->InnerProd))(p[j],p[i]);
-            (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
-         }
-         t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
+         /* Gram-Schmidt, see hypre_KrylovOrthogonalize */
+         t = hypre_KrylovOrthogonalize(gmres_functions->MultiInnerProd, gmres_functions->InnerProd,
+                                       gmres_functions->Axpy, cgs, i, p, hh,
+                                       dot_y, dot_local, dot_result);
          hh[i][i-1] = t;
          if (t != 0.0)
          {
@@ -890,6 +903,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
       hypre_TFreeF(hh[i],gmres_functions);
    }
 
+   hypre_TFreeF(dot_y,gmres_functions);
+   hypre_TFreeF(dot_local,gmres_functions);
+   hypre_TFreeF(dot_result,gmres_functions);
    hypre_TFreeF(hh, gmres_functions);
 
    HYPRE_ANNOTATE_FUNC_END;
@@ -1092,6 +1108,38 @@ hypre_GMRESGetRelChange( void      *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSetCGS, hypre_GMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSetCGS( void      *gmres_vdata,
+                   HYPRE_Int  cgs )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   if (cgs < 0 || cgs > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (gmres_data -> cgs) = cgs;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GMRESGetCGS( void      *gmres_vdata,
+                   HYPRE_Int *cgs )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   *cgs = (gmres_data -> cgs);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSetSkipRealResidualCheck, hypre_GMRESGetSkipRealResidualCheck
  *--------------------------------------------------------------------------*/
@@ -407,6 +407,8 @@ extern "C" {
         void *x, HYPRE_Complex beta, void *y );
     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+    HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+        HYPRE_Real *result, hypre_MPI_Request *request );
     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
@@ -431,6 +433,7 @@ extern "C" {
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
     HYPRE_Int      hybrid;
+    HYPRE_Int      cgs; /* 0: MGS, 1: CGS, 2: CGS2 */
     HYPRE_Real   tol;
     HYPRE_Real   cf_tol;
     HYPRE_Real   a_tol;
@@ -490,6 +493,8 @@ extern "C" {
             void *x, HYPRE_Complex beta, void *y ),
           HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
           HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+          HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+            HYPRE_Real *result, hypre_MPI_Request *request ),
           HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
           HYPRE_Int    (*ClearVector)   ( void *x ),
           HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -685,6 +690,495 @@ extern "C" {
 
 
 
+  /******************************************************************************
+   *
+   * CAGMRES cagmres
+   *
+   *****************************************************************************/
+
+#ifndef hypre_KRYLOV_CAGMRES_HEADER
+#define hypre_KRYLOV_CAGMRES_HEADER
+
+  /*--------------------------------------------------------------------------
+   *--------------------------------------------------------------------------*/
+
+  /**
+   * @name Generic CAGMRES Interface
+   *
+   * Communication-avoiding (s-step) GMRES.  Each outer step generates s basis
+   * vectors with back-to-back preconditioned matvecs, using a monomial or Newton
+   * basis, and orthogonalizes them as a block: block classical Gram-Schmidt
+   * against the previous basis followed by a Cholesky QR of the new block.
+   * This needs a fixed number of global reductions per s iterations.
+   *
+   * @memo A generic communication-avoiding GMRES linear solver interface
+   **/
+  /*@{*/
+
+  /*--------------------------------------------------------------------------
+   *--------------------------------------------------------------------------*/
+
+  /*--------------------------------------------------------------------------
+   * hypre_CAGMRESData and hypre_CAGMRESFunctions
+   *--------------------------------------------------------------------------*/
+
+  /**
+   * @name CAGMRES structs
+   *
+   * Description...
+   **/
+  /*@{*/
+
+  /**
+   * The {\tt hypre\_CAGMRESFunctions} object ...
+   **/
+
+  typedef struct
+  {
+     void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
+     HYPRE_Int    (*Free)          ( void *ptr );
+     HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                     HYPRE_Int   *num_procs );
+     void *       (*CreateVector)  ( void *vector );
+     void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors );
+     HYPRE_Int    (*DestroyVector) ( void *vector );
+     void *       (*MatvecCreate)  ( void *A, void *x );
+     HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     void *x, HYPRE_Complex beta, void *y );
+     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+     HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                     HYPRE_Real *result, hypre_MPI_Request *request );
+     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+     HYPRE_Int    (*ClearVector)   ( void *x );
+     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
+     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+
+     HYPRE_Int    (*precond)       ();
+     HYPRE_Int    (*precond_setup) ();
+
+  } hypre_CAGMRESFunctions;
+
+  /**
+   * The {\tt hypre\_CAGMRESData} object ...
+   **/
+
+  typedef struct
+  {
+     HYPRE_Int      k_dim;
+     HYPRE_Int      s_step;
+     HYPRE_Int      basis;     /* 0: monomial, 1: Newton */
+     HYPRE_Int      min_iter;
+     HYPRE_Int      max_iter;
+     HYPRE_Int      skip_real_r_check;
+     HYPRE_Int      converged;
+     HYPRE_Real   tol;
+     HYPRE_Real   a_tol;
+     HYPRE_Real   rel_residual_norm;
+
+     void  *A;
+     void  *r;
+     void  *w;
+     void  **p;
+
+     void    *matvec_data;
+     void    *precond_data;
+
+     hypre_CAGMRESFunctions * functions;
+
+     /* log info (always logged) */
+     HYPRE_Int      num_iterations;
+
+     HYPRE_Int     print_level; /* printing when print_level>0 */
+     HYPRE_Int     logging;  /* extra computations for logging when logging>0 */
+     HYPRE_Real  *norms;
+     char    *log_file_name;
+
+  } hypre_CAGMRESData;
+
+#ifdef __cplusplus
+  extern "C" {
+#endif
+
+  /**
+   * @name generic CAGMRES Solver
+   *
+   * Description...
+   **/
+  /*@{*/
+
+  /**
+   * Description...
+   *
+   * @param param [IN] ...
+   **/
+
+  hypre_CAGMRESFunctions *
+  hypre_CAGMRESFunctionsCreate(
+     void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+     HYPRE_Int    (*Free)          ( void *ptr ),
+     HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                     HYPRE_Int   *num_procs ),
+     void *       (*CreateVector)  ( void *vector ),
+     void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+     HYPRE_Int    (*DestroyVector) ( void *vector ),
+     void *       (*MatvecCreate)  ( void *A, void *x ),
+     HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     void *x, HYPRE_Complex beta, void *y ),
+     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+     HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+     HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                     HYPRE_Real *result, hypre_MPI_Request *request ),
+     HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+     HYPRE_Int    (*ClearVector)   ( void *x ),
+     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+     HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+     HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+     );
+
+  /**
+   * Description...
+   *
+   * @param param [IN] ...
+   **/
+
+  void *
+  hypre_CAGMRESCreate( hypre_CAGMRESFunctions *cagmres_functions );
+
+#ifdef __cplusplus
+  }
+#endif
+#endif
+
+  /******************************************************************************
+   *
+   * BPCG bpcg
+   *
+   *****************************************************************************/
+
+#ifndef hypre_KRYLOV_BPCG_HEADER
+#define hypre_KRYLOV_BPCG_HEADER
+
+  /*--------------------------------------------------------------------------
+   *--------------------------------------------------------------------------*/
+
+  /**
+   * @name Generic BPCG Interface
+   *
+   * Block preconditioned conjugate gradient for several right-hand sides with
+   * the same matrix.  All unconverged systems share one Krylov space: each
+   * iteration applies the matrix and the preconditioner to a block of search
+   * directions and computes all inner products of the block in a single global
+   * reduction.  Converged columns are removed from the block (deflation), and
+   * linearly dependent search directions are dropped.
+   *
+   * @memo A generic block PCG linear solver interface for multiple right-hand sides
+   **/
+  /*@{*/
+
+  /*--------------------------------------------------------------------------
+   *--------------------------------------------------------------------------*/
+
+  /*--------------------------------------------------------------------------
+   * hypre_BPCGData and hypre_BPCGFunctions
+   *--------------------------------------------------------------------------*/
+
+  /**
+   * @name BPCG structs
+   *
+   * Description...
+   **/
+  /*@{*/
+
+  /**
+   * The {\tt hypre\_BPCGFunctions} object ...
+   **/
+
+  typedef struct
+  {
+     void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
+     HYPRE_Int    (*Free)          ( void *ptr );
+     HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                     HYPRE_Int   *num_procs );
+     void *       (*CreateVector)  ( void *vector );
+     void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors );
+     HYPRE_Int    (*DestroyVector) ( void *vector );
+     void *       (*MatvecCreate)  ( void *A, void *x );
+     HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     void *x, HYPRE_Complex beta, void *y );
+     HYPRE_Int    (*MatvecBlock)   ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     HYPRE_Int k, void **x, HYPRE_Complex beta, void **y );
+     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+     HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                     HYPRE_Real *result, hypre_MPI_Request *request );
+     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+     HYPRE_Int    (*ClearVector)   ( void *x );
+     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
+     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+
+     HYPRE_Int    (*precond)       ();
+     HYPRE_Int    (*precond_setup) ();
+     HYPRE_Int    (*precond_block) ();
+
+  } hypre_BPCGFunctions;
+
+  /**
+   * The {\tt hypre\_BPCGData} object ...
+   **/
+
+  typedef struct
+  {
+     HYPRE_Int      num_rhs;
+     HYPRE_Int      max_iter;
+     HYPRE_Int      converged;
+     HYPRE_Real   tol;
+     HYPRE_Real   a_tol;
+     HYPRE_Real   rel_residual_norm;
+
+     void  *A;
+     void  **r;
+     void  **z;
+     void  **p;
+     void  **q;
+
+     void    *matvec_data;
+     void    *precond_data;
+
+     hypre_BPCGFunctions * functions;
+
+     /* log info (always logged) */
+     HYPRE_Int      num_iterations;
+
+     HYPRE_Int     print_level; /* printing when print_level>0 */
+     HYPRE_Int     logging;  /* extra computations for logging when logging>0 */
+     HYPRE_Real  *norms;
+     char    *log_file_name;
+
+  } hypre_BPCGData;
+
+#ifdef __cplusplus
+  extern "C" {
+#endif
+
+  /**
+   * @name generic BPCG Solver
+   *
+   * Description...
+   **/
+  /*@{*/
+
+  /**
+   * Description...
+   *
+   * @param param [IN] ...
+   **/
+
+  hypre_BPCGFunctions *
+  hypre_BPCGFunctionsCreate(
+     void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+     HYPRE_Int    (*Free)          ( void *ptr ),
+     HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                     HYPRE_Int   *num_procs ),
+     void *       (*CreateVector)  ( void *vector ),
+     void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+     HYPRE_Int    (*DestroyVector) ( void *vector ),
+     void *       (*MatvecCreate)  ( void *A, void *x ),
+     HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     void *x, HYPRE_Complex beta, void *y ),
+     HYPRE_Int    (*MatvecBlock)   ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     HYPRE_Int k, void **x, HYPRE_Complex beta, void **y ),
+     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+     HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+     HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                     HYPRE_Real *result, hypre_MPI_Request *request ),
+     HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+     HYPRE_Int    (*ClearVector)   ( void *x ),
+     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+     HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+     HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+     );
+
+  /**
+   * Description...
+   *
+   * @param param [IN] ...
+   **/
+
+  void *
+  hypre_BPCGCreate( hypre_BPCGFunctions *bpcg_functions );
+
+#ifdef __cplusplus
+  }
+#endif
+#endif
+
+  /******************************************************************************
+   *
+   * BGMRES bgmres
+   *
+   *****************************************************************************/
+
+#ifndef hypre_KRYLOV_BGMRES_HEADER
+#define hypre_KRYLOV_BGMRES_HEADER
+
+  /*--------------------------------------------------------------------------
+   *--------------------------------------------------------------------------*/
+
+  /**
+   * @name Generic BGMRES Interface
+   *
+   * Restarted block GMRES for several right-hand sides with the same matrix.
+   * The block Arnoldi process applies the preconditioned matrix to all vectors
+   * of the newest basis block, orthogonalizes them with two passes of block
+   * classical Gram-Schmidt and a Cholesky QR, so that one block step costs a
+   * fixed number of global reductions.  Dependent basis vectors are dropped,
+   * and systems that have converged are removed at each restart (deflation).
+   *
+   * @memo A generic block GMRES linear solver interface for multiple right-hand sides
+   **/
+  /*@{*/
+
+  /*--------------------------------------------------------------------------
+   *--------------------------------------------------------------------------*/
+
+  /*--------------------------------------------------------------------------
+   * hypre_BGMRESData and hypre_BGMRESFunctions
+   *--------------------------------------------------------------------------*/
+
+  /**
+   * @name BGMRES structs
+   *
+   * Description...
+   **/
+  /*@{*/
+
+  /**
+   * The {\tt hypre\_BGMRESFunctions} object ...
+   **/
+
+  typedef struct
+  {
+     void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
+     HYPRE_Int    (*Free)          ( void *ptr );
+     HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                     HYPRE_Int   *num_procs );
+     void *       (*CreateVector)  ( void *vector );
+     void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors );
+     HYPRE_Int    (*DestroyVector) ( void *vector );
+     void *       (*MatvecCreate)  ( void *A, void *x );
+     HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     void *x, HYPRE_Complex beta, void *y );
+     HYPRE_Int    (*MatvecBlock)   ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     HYPRE_Int k, void **x, HYPRE_Complex beta, void **y );
+     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+     HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                     HYPRE_Real *result, hypre_MPI_Request *request );
+     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+     HYPRE_Int    (*ClearVector)   ( void *x );
+     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
+     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+
+     HYPRE_Int    (*precond)       ();
+     HYPRE_Int    (*precond_setup) ();
+     HYPRE_Int    (*precond_block) ();
+
+  } hypre_BGMRESFunctions;
+
+  /**
+   * The {\tt hypre\_BGMRESData} object ...
+   **/
+
+  typedef struct
+  {
+     HYPRE_Int      k_dim;
+     HYPRE_Int      num_rhs;
+     HYPRE_Int      max_iter;
+     HYPRE_Int      converged;
+     HYPRE_Real   tol;
+     HYPRE_Real   a_tol;
+     HYPRE_Real   rel_residual_norm;
+
+     void  *A;
+     void  **r;
+     void  **w;
+     void  **p;
+
+     void    *matvec_data;
+     void    *precond_data;
+
+     hypre_BGMRESFunctions * functions;
+
+     /* log info (always logged) */
+     HYPRE_Int      num_iterations;
+
+     HYPRE_Int     print_level; /* printing when print_level>0 */
+     HYPRE_Int     logging;  /* extra computations for logging when logging>0 */
+     HYPRE_Real  *norms;
+     char    *log_file_name;
+
+  } hypre_BGMRESData;
+
+#ifdef __cplusplus
+  extern "C" {
+#endif
+
+  /**
+   * @name generic BGMRES Solver
+   *
+   * Description...
+   **/
+  /*@{*/
+
+  /**
+   * Description...
+   *
+   * @param param [IN] ...
+   **/
+
+  hypre_BGMRESFunctions *
+  hypre_BGMRESFunctionsCreate(
+     void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+     HYPRE_Int    (*Free)          ( void *ptr ),
+     HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                     HYPRE_Int   *num_procs ),
+     void *       (*CreateVector)  ( void *vector ),
+     void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+     HYPRE_Int    (*DestroyVector) ( void *vector ),
+     void *       (*MatvecCreate)  ( void *A, void *x ),
+     HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     void *x, HYPRE_Complex beta, void *y ),
+     HYPRE_Int    (*MatvecBlock)   ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     HYPRE_Int k, void **x, HYPRE_Complex beta, void **y ),
+     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+     HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+     HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                     HYPRE_Real *result, hypre_MPI_Request *request ),
+     HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+     HYPRE_Int    (*ClearVector)   ( void *x ),
+     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+     HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+     HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+     );
+
+  /**
+   * Description...
+   *
+   * @param param [IN] ...
+   **/
+
+  void *
+  hypre_BGMRESCreate( hypre_BGMRESFunctions *bgmres_functions );
+
+#ifdef __cplusplus
+  }
+#endif
+#endif
+
   /******************************************************************************
    *
    * LGMRES lgmres
@@ -737,6 +1231,8 @@ extern "C" {
         void *x, HYPRE_Complex beta, void *y );
     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+    HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+        HYPRE_Real *result, hypre_MPI_Request *request );
     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
@@ -759,6 +1255,7 @@ extern "C" {
     HYPRE_Int      rel_change;
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
+    HYPRE_Int      cgs; /* 0: MGS, 1: CGS, 2: CGS2 */
     HYPRE_Real   tol;
     HYPRE_Real   cf_tol;
     HYPRE_Real   a_tol;
@@ -824,6 +1321,8 @@ extern "C" {
             void *x, HYPRE_Complex beta, void *y ),
           HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
           HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+          HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+            HYPRE_Real *result, hypre_MPI_Request *request ),
           HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
           HYPRE_Int    (*ClearVector)   ( void *x ),
           HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -898,6 +1397,8 @@ extern "C" {
         void *x, HYPRE_Complex beta, void *y );
     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+    HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+        HYPRE_Real *result, hypre_MPI_Request *request );
     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
@@ -922,6 +1423,7 @@ extern "C" {
     HYPRE_Int      rel_change;
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
+    HYPRE_Int      cgs; /* 0: MGS, 1: CGS, 2: CGS2 */
     HYPRE_Real   tol;
     HYPRE_Real   cf_tol;
     HYPRE_Real   a_tol;
@@ -981,6 +1483,8 @@ extern "C" {
             void *x, HYPRE_Complex beta, void *y ),
           HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
           HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+          HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+            HYPRE_Real *result, hypre_MPI_Request *request ),
           HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
           HYPRE_Int    (*ClearVector)   ( void *x ),
           HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -1057,6 +1561,8 @@ extern "C" {
         void *x, HYPRE_Complex beta, void *y );
     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+    HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+        HYPRE_Real *result, hypre_MPI_Request *request );
     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
@@ -1100,6 +1606,12 @@ extern "C" {
      every "recompute_residual_p" iterations.  This can be expensive and degrade the
      convergence. Use it only if you have seen a problem with the regular residual
      computation.
+     - variant selects the CG recurrence: 0 is the standard algorithm, 1 is the
+     Chronopoulos-Gear single-reduction CG and 2 is the Ghysels-Vanroose pipelined CG.
+     Variants 1 and 2 combine all inner products of an iteration into one global
+     reduction (overlapped with the preconditioner and matvec for variant 2). They
+     fall back to variant 0 when rel_change, recompute_residual(_p), rtol or cf_tol
+     is in use.
      */
 
   typedef struct
@@ -1117,12 +1629,14 @@ extern "C" {
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
     HYPRE_Int      hybrid;
+    HYPRE_Int      variant;
 
     void    *A;
     void    *p;
     void    *s;
     void    *r; /* ...contains the residual.  This is currently kept permanently.
                    If that is ever changed, it still must be kept if logging>1 */
+    void   **variant_vectors; /* work vectors of the single-reduction variants */
 
     HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
     void    *matvec_data;
@@ -1174,6 +1688,8 @@ extern "C" {
             void *x, HYPRE_Complex beta, void *y ),
           HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
           HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+          HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+            HYPRE_Real *result, hypre_MPI_Request *request ),
           HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
           HYPRE_Int    (*ClearVector)   ( void *x ),
           HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -1253,6 +1769,8 @@ extern "C" {
   HYPRE_Int hypre_GMRESGetMaxIter ( void *gmres_vdata , HYPRE_Int *max_iter );
   HYPRE_Int hypre_GMRESSetRelChange ( void *gmres_vdata , HYPRE_Int rel_change );
   HYPRE_Int hypre_GMRESGetRelChange ( void *gmres_vdata , HYPRE_Int *rel_change );
+  HYPRE_Int hypre_GMRESSetCGS ( void *gmres_vdata , HYPRE_Int cgs );
+  HYPRE_Int hypre_GMRESGetCGS ( void *gmres_vdata , HYPRE_Int *cgs );
   HYPRE_Int hypre_GMRESSetSkipRealResidualCheck ( void *gmres_vdata , HYPRE_Int skip_real_r_check );
   HYPRE_Int hypre_GMRESGetSkipRealResidualCheck ( void *gmres_vdata , HYPRE_Int *skip_real_r_check );
   HYPRE_Int hypre_GMRESSetStopCrit ( void *gmres_vdata , HYPRE_Int stop_crit );
@@ -1305,6 +1823,84 @@ extern "C" {
   HYPRE_Int hypre_COGMRESGetFinalRelativeResidualNorm ( void *gmres_vdata , HYPRE_Real *relative_residual_norm );
   HYPRE_Int hypre_COGMRESSetModifyPC ( void *fgmres_vdata , HYPRE_Int (*modify_pc )(void *precond_data, HYPRE_Int iteration, HYPRE_Real rel_residual_norm));
 
+  /* cagmres.c */
+  void *hypre_CAGMRESCreate ( hypre_CAGMRESFunctions *cagmres_functions );
+  HYPRE_Int hypre_CAGMRESDestroy ( void *cagmres_vdata );
+  HYPRE_Int hypre_CAGMRESGetResidual ( void *cagmres_vdata , void **residual );
+  HYPRE_Int hypre_CAGMRESSetup ( void *cagmres_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_CAGMRESSolve ( void *cagmres_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_CAGMRESSetKDim ( void *cagmres_vdata , HYPRE_Int k_dim );
+  HYPRE_Int hypre_CAGMRESGetKDim ( void *cagmres_vdata , HYPRE_Int *k_dim );
+  HYPRE_Int hypre_CAGMRESSetSStep ( void *cagmres_vdata , HYPRE_Int s_step );
+  HYPRE_Int hypre_CAGMRESGetSStep ( void *cagmres_vdata , HYPRE_Int *s_step );
+  HYPRE_Int hypre_CAGMRESSetBasis ( void *cagmres_vdata , HYPRE_Int basis );
+  HYPRE_Int hypre_CAGMRESGetBasis ( void *cagmres_vdata , HYPRE_Int *basis );
+  HYPRE_Int hypre_CAGMRESSetTol ( void *cagmres_vdata , HYPRE_Real tol );
+  HYPRE_Int hypre_CAGMRESGetTol ( void *cagmres_vdata , HYPRE_Real *tol );
+  HYPRE_Int hypre_CAGMRESSetAbsoluteTol ( void *cagmres_vdata , HYPRE_Real a_tol );
+  HYPRE_Int hypre_CAGMRESGetAbsoluteTol ( void *cagmres_vdata , HYPRE_Real *a_tol );
+  HYPRE_Int hypre_CAGMRESSetMinIter ( void *cagmres_vdata , HYPRE_Int min_iter );
+  HYPRE_Int hypre_CAGMRESGetMinIter ( void *cagmres_vdata , HYPRE_Int *min_iter );
+  HYPRE_Int hypre_CAGMRESSetMaxIter ( void *cagmres_vdata , HYPRE_Int max_iter );
+  HYPRE_Int hypre_CAGMRESGetMaxIter ( void *cagmres_vdata , HYPRE_Int *max_iter );
+  HYPRE_Int hypre_CAGMRESSetSkipRealResidualCheck ( void *cagmres_vdata , HYPRE_Int skip_real_r_check );
+  HYPRE_Int hypre_CAGMRESGetSkipRealResidualCheck ( void *cagmres_vdata , HYPRE_Int *skip_real_r_check );
+  HYPRE_Int hypre_CAGMRESSetPrecond ( void *cagmres_vdata , HYPRE_Int (*precond )(void*,void*,void*,void*), HYPRE_Int (*precond_setup )(void*,void*,void*,void*), void *precond_data );
+  HYPRE_Int hypre_CAGMRESGetPrecond ( void *cagmres_vdata , HYPRE_Solver *precond_data_ptr );
+  HYPRE_Int hypre_CAGMRESSetPrintLevel ( void *cagmres_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_CAGMRESGetPrintLevel ( void *cagmres_vdata , HYPRE_Int *level );
+  HYPRE_Int hypre_CAGMRESSetLogging ( void *cagmres_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_CAGMRESGetLogging ( void *cagmres_vdata , HYPRE_Int *level );
+  HYPRE_Int hypre_CAGMRESGetNumIterations ( void *cagmres_vdata , HYPRE_Int *num_iterations );
+  HYPRE_Int hypre_CAGMRESGetConverged ( void *cagmres_vdata , HYPRE_Int *converged );
+  HYPRE_Int hypre_CAGMRESGetFinalRelativeResidualNorm ( void *cagmres_vdata , HYPRE_Real *relative_residual_norm );
+
+  /* bpcg.c */
+  void *hypre_BPCGCreate ( hypre_BPCGFunctions *bpcg_functions );
+  HYPRE_Int hypre_BPCGDestroy ( void *bpcg_vdata );
+  HYPRE_Int hypre_BPCGSetup ( void *bpcg_vdata , void *A , HYPRE_Int num_rhs , void **b , void **x );
+  HYPRE_Int hypre_BPCGSolve ( void *bpcg_vdata , void *A , HYPRE_Int num_rhs , void **b , void **x );
+  HYPRE_Int hypre_BPCGSetTol ( void *bpcg_vdata , HYPRE_Real tol );
+  HYPRE_Int hypre_BPCGGetTol ( void *bpcg_vdata , HYPRE_Real *tol );
+  HYPRE_Int hypre_BPCGSetAbsoluteTol ( void *bpcg_vdata , HYPRE_Real a_tol );
+  HYPRE_Int hypre_BPCGGetAbsoluteTol ( void *bpcg_vdata , HYPRE_Real *a_tol );
+  HYPRE_Int hypre_BPCGSetMaxIter ( void *bpcg_vdata , HYPRE_Int max_iter );
+  HYPRE_Int hypre_BPCGGetMaxIter ( void *bpcg_vdata , HYPRE_Int *max_iter );
+  HYPRE_Int hypre_BPCGSetPrecond ( void *bpcg_vdata , HYPRE_Int (*precond )(void*,void*,void*,void*), HYPRE_Int (*precond_setup )(void*,void*,void*,void*), void *precond_data );
+  HYPRE_Int hypre_BPCGSetPrecondBlock ( void *bpcg_vdata , HYPRE_Int (*precond_block )(void*,void*,HYPRE_Int,void**,void**) );
+  HYPRE_Int hypre_BPCGGetPrecond ( void *bpcg_vdata , HYPRE_Solver *precond_data_ptr );
+  HYPRE_Int hypre_BPCGSetPrintLevel ( void *bpcg_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_BPCGGetPrintLevel ( void *bpcg_vdata , HYPRE_Int *level );
+  HYPRE_Int hypre_BPCGSetLogging ( void *bpcg_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_BPCGGetLogging ( void *bpcg_vdata , HYPRE_Int *level );
+  HYPRE_Int hypre_BPCGGetNumIterations ( void *bpcg_vdata , HYPRE_Int *num_iterations );
+  HYPRE_Int hypre_BPCGGetConverged ( void *bpcg_vdata , HYPRE_Int *converged );
+  HYPRE_Int hypre_BPCGGetFinalRelativeResidualNorm ( void *bpcg_vdata , HYPRE_Real *relative_residual_norm );
+
+  /* bgmres.c */
+  void *hypre_BGMRESCreate ( hypre_BGMRESFunctions *bgmres_functions );
+  HYPRE_Int hypre_BGMRESDestroy ( void *bgmres_vdata );
+  HYPRE_Int hypre_BGMRESSetup ( void *bgmres_vdata , void *A , HYPRE_Int num_rhs , void **b , void **x );
+  HYPRE_Int hypre_BGMRESSolve ( void *bgmres_vdata , void *A , HYPRE_Int num_rhs , void **b , void **x );
+  HYPRE_Int hypre_BGMRESSetKDim ( void *bgmres_vdata , HYPRE_Int k_dim );
+  HYPRE_Int hypre_BGMRESGetKDim ( void *bgmres_vdata , HYPRE_Int *k_dim );
+  HYPRE_Int hypre_BGMRESSetTol ( void *bgmres_vdata , HYPRE_Real tol );
+  HYPRE_Int hypre_BGMRESGetTol ( void *bgmres_vdata , HYPRE_Real *tol );
+  HYPRE_Int hypre_BGMRESSetAbsoluteTol ( void *bgmres_vdata , HYPRE_Real a_tol );
+  HYPRE_Int hypre_BGMRESGetAbsoluteTol ( void *bgmres_vdata , HYPRE_Real *a_tol );
+  HYPRE_Int hypre_BGMRESSetMaxIter ( void *bgmres_vdata , HYPRE_Int max_iter );
+  HYPRE_Int hypre_BGMRESGetMaxIter ( void *bgmres_vdata , HYPRE_Int *max_iter );
+  HYPRE_Int hypre_BGMRESSetPrecond ( void *bgmres_vdata , HYPRE_Int (*precond )(void*,void*,void*,void*), HYPRE_Int (*precond_setup )(void*,void*,void*,void*), void *precond_data );
+  HYPRE_Int hypre_BGMRESSetPrecondBlock ( void *bgmres_vdata , HYPRE_Int (*precond_block )(void*,void*,HYPRE_Int,void**,void**) );
+  HYPRE_Int hypre_BGMRESGetPrecond ( void *bgmres_vdata , HYPRE_Solver *precond_data_ptr );
+  HYPRE_Int hypre_BGMRESSetPrintLevel ( void *bgmres_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_BGMRESGetPrintLevel ( void *bgmres_vdata , HYPRE_Int *level );
+  HYPRE_Int hypre_BGMRESSetLogging ( void *bgmres_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_BGMRESGetLogging ( void *bgmres_vdata , HYPRE_Int *level );
+  HYPRE_Int hypre_BGMRESGetNumIterations ( void *bgmres_vdata , HYPRE_Int *num_iterations );
+  HYPRE_Int hypre_BGMRESGetConverged ( void *bgmres_vdata , HYPRE_Int *converged );
+  HYPRE_Int hypre_BGMRESGetFinalRelativeResidualNorm ( void *bgmres_vdata , HYPRE_Real *relative_residual_norm );
+
 
 
   /* flexgmres.c */
@@ -1325,6 +1921,8 @@ extern "C" {
   HYPRE_Int hypre_FlexGMRESGetMinIter ( void *fgmres_vdata , HYPRE_Int *min_iter );
   HYPRE_Int hypre_FlexGMRESSetMaxIter ( void *fgmres_vdata , HYPRE_Int max_iter );
   HYPRE_Int hypre_FlexGMRESGetMaxIter ( void *fgmres_vdata , HYPRE_Int *max_iter );
+  HYPRE_Int hypre_FlexGMRESSetCGS ( void *fgmres_vdata , HYPRE_Int cgs );
+  HYPRE_Int hypre_FlexGMRESGetCGS ( void *fgmres_vdata , HYPRE_Int *cgs );
   HYPRE_Int hypre_FlexGMRESSetStopCrit ( void *fgmres_vdata , HYPRE_Int stop_crit );
   HYPRE_Int hypre_FlexGMRESGetStopCrit ( void *fgmres_vdata , HYPRE_Int *stop_crit );
   HYPRE_Int hypre_FlexGMRESSetPrecond ( void *fgmres_vdata , HYPRE_Int (*precond )(void*,void*,void*,void*), HYPRE_Int (*precond_setup )(void*,void*,void*,void*), void *precond_data );
@@ -1359,6 +1957,8 @@ extern "C" {
   HYPRE_Int hypre_LGMRESGetMinIter ( void *lgmres_vdata , HYPRE_Int *min_iter );
   HYPRE_Int hypre_LGMRESSetMaxIter ( void *lgmres_vdata , HYPRE_Int max_iter );
   HYPRE_Int hypre_LGMRESGetMaxIter ( void *lgmres_vdata , HYPRE_Int *max_iter );
+  HYPRE_Int hypre_LGMRESSetCGS ( void *lgmres_vdata , HYPRE_Int cgs );
+  HYPRE_Int hypre_LGMRESGetCGS ( void *lgmres_vdata , HYPRE_Int *cgs );
   HYPRE_Int hypre_LGMRESSetStopCrit ( void *lgmres_vdata , HYPRE_Int stop_crit );
   HYPRE_Int hypre_LGMRESGetStopCrit ( void *lgmres_vdata , HYPRE_Int *stop_crit );
   HYPRE_Int hypre_LGMRESSetPrecond ( void *lgmres_vdata , HYPRE_Int (*precond )(void*,void*,void*,void*), HYPRE_Int (*precond_setup )(void*,void*,void*,void*), void *precond_data );
@@ -1422,6 +2022,8 @@ extern "C" {
   HYPRE_Int HYPRE_GMRESGetStopCrit ( HYPRE_Solver solver , HYPRE_Int *stop_crit );
   HYPRE_Int HYPRE_GMRESSetRelChange ( HYPRE_Solver solver , HYPRE_Int rel_change );
   HYPRE_Int HYPRE_GMRESGetRelChange ( HYPRE_Solver solver , HYPRE_Int *rel_change );
+  HYPRE_Int HYPRE_GMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
+  HYPRE_Int HYPRE_GMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
   HYPRE_Int HYPRE_GMRESSetSkipRealResidualCheck ( HYPRE_Solver solver , HYPRE_Int skip_real_r_check );
   HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck ( HYPRE_Solver solver , HYPRE_Int *skip_real_r_check );
   HYPRE_Int HYPRE_GMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
@@ -1469,6 +2071,76 @@ extern "C" {
   HYPRE_Int HYPRE_COGMRESGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
   HYPRE_Int HYPRE_COGMRESGetResidual ( HYPRE_Solver solver , void *residual );
 
+  /* HYPRE_cagmres.c */
+  HYPRE_Int HYPRE_CAGMRESSetup ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
+  HYPRE_Int HYPRE_CAGMRESSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
+  HYPRE_Int HYPRE_CAGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+  HYPRE_Int HYPRE_CAGMRESGetKDim ( HYPRE_Solver solver , HYPRE_Int *k_dim );
+  HYPRE_Int HYPRE_CAGMRESSetSStep ( HYPRE_Solver solver , HYPRE_Int s_step );
+  HYPRE_Int HYPRE_CAGMRESGetSStep ( HYPRE_Solver solver , HYPRE_Int *s_step );
+  HYPRE_Int HYPRE_CAGMRESSetBasis ( HYPRE_Solver solver , HYPRE_Int basis );
+  HYPRE_Int HYPRE_CAGMRESGetBasis ( HYPRE_Solver solver , HYPRE_Int *basis );
+  HYPRE_Int HYPRE_CAGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
+  HYPRE_Int HYPRE_CAGMRESGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
+  HYPRE_Int HYPRE_CAGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
+  HYPRE_Int HYPRE_CAGMRESGetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real *a_tol );
+  HYPRE_Int HYPRE_CAGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
+  HYPRE_Int HYPRE_CAGMRESGetMinIter ( HYPRE_Solver solver , HYPRE_Int *min_iter );
+  HYPRE_Int HYPRE_CAGMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+  HYPRE_Int HYPRE_CAGMRESGetMaxIter ( HYPRE_Solver solver , HYPRE_Int *max_iter );
+  HYPRE_Int HYPRE_CAGMRESSetSkipRealResidualCheck ( HYPRE_Solver solver , HYPRE_Int skip_real_r_check );
+  HYPRE_Int HYPRE_CAGMRESGetSkipRealResidualCheck ( HYPRE_Solver solver , HYPRE_Int *skip_real_r_check );
+  HYPRE_Int HYPRE_CAGMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
+  HYPRE_Int HYPRE_CAGMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
+  HYPRE_Int HYPRE_CAGMRESSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
+  HYPRE_Int HYPRE_CAGMRESGetPrintLevel ( HYPRE_Solver solver , HYPRE_Int *level );
+  HYPRE_Int HYPRE_CAGMRESSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
+  HYPRE_Int HYPRE_CAGMRESGetLogging ( HYPRE_Solver solver , HYPRE_Int *level );
+  HYPRE_Int HYPRE_CAGMRESGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+  HYPRE_Int HYPRE_CAGMRESGetConverged ( HYPRE_Solver solver , HYPRE_Int *converged );
+  HYPRE_Int HYPRE_CAGMRESGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
+  HYPRE_Int HYPRE_CAGMRESGetResidual ( HYPRE_Solver solver , void *residual );
+
+  /* HYPRE_bpcg.c */
+  HYPRE_Int HYPRE_BPCGSetup ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Int num_rhs , HYPRE_Vector *b , HYPRE_Vector *x );
+  HYPRE_Int HYPRE_BPCGSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Int num_rhs , HYPRE_Vector *b , HYPRE_Vector *x );
+  HYPRE_Int HYPRE_BPCGSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
+  HYPRE_Int HYPRE_BPCGGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
+  HYPRE_Int HYPRE_BPCGSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
+  HYPRE_Int HYPRE_BPCGGetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real *a_tol );
+  HYPRE_Int HYPRE_BPCGSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+  HYPRE_Int HYPRE_BPCGGetMaxIter ( HYPRE_Solver solver , HYPRE_Int *max_iter );
+  HYPRE_Int HYPRE_BPCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
+  HYPRE_Int HYPRE_BPCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
+  HYPRE_Int HYPRE_BPCGSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
+  HYPRE_Int HYPRE_BPCGGetPrintLevel ( HYPRE_Solver solver , HYPRE_Int *level );
+  HYPRE_Int HYPRE_BPCGSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
+  HYPRE_Int HYPRE_BPCGGetLogging ( HYPRE_Solver solver , HYPRE_Int *level );
+  HYPRE_Int HYPRE_BPCGGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+  HYPRE_Int HYPRE_BPCGGetConverged ( HYPRE_Solver solver , HYPRE_Int *converged );
+  HYPRE_Int HYPRE_BPCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
+
+  /* HYPRE_bgmres.c */
+  HYPRE_Int HYPRE_BGMRESSetup ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Int num_rhs , HYPRE_Vector *b , HYPRE_Vector *x );
+  HYPRE_Int HYPRE_BGMRESSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Int num_rhs , HYPRE_Vector *b , HYPRE_Vector *x );
+  HYPRE_Int HYPRE_BGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+  HYPRE_Int HYPRE_BGMRESGetKDim ( HYPRE_Solver solver , HYPRE_Int *k_dim );
+  HYPRE_Int HYPRE_BGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
+  HYPRE_Int HYPRE_BGMRESGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
+  HYPRE_Int HYPRE_BGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
+  HYPRE_Int HYPRE_BGMRESGetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real *a_tol );
+  HYPRE_Int HYPRE_BGMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+  HYPRE_Int HYPRE_BGMRESGetMaxIter ( HYPRE_Solver solver , HYPRE_Int *max_iter );
+  HYPRE_Int HYPRE_BGMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
+  HYPRE_Int HYPRE_BGMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
+  HYPRE_Int HYPRE_BGMRESSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
+  HYPRE_Int HYPRE_BGMRESGetPrintLevel ( HYPRE_Solver solver , HYPRE_Int *level );
+  HYPRE_Int HYPRE_BGMRESSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
+  HYPRE_Int HYPRE_BGMRESGetLogging ( HYPRE_Solver solver , HYPRE_Int *level );
+  HYPRE_Int HYPRE_BGMRESGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+  HYPRE_Int HYPRE_BGMRESGetConverged ( HYPRE_Solver solver , HYPRE_Int *converged );
+  HYPRE_Int HYPRE_BGMRESGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
+
   /* HYPRE_flexgmres.c */
   HYPRE_Int HYPRE_FlexGMRESSetup ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
   HYPRE_Int HYPRE_FlexGMRESSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
@@ -1484,6 +2156,8 @@ extern "C" {
   HYPRE_Int HYPRE_FlexGMRESGetMinIter ( HYPRE_Solver solver , HYPRE_Int *min_iter );
   HYPRE_Int HYPRE_FlexGMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
   HYPRE_Int HYPRE_FlexGMRESGetMaxIter ( HYPRE_Solver solver , HYPRE_Int *max_iter );
+  HYPRE_Int HYPRE_FlexGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
+  HYPRE_Int HYPRE_FlexGMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
   HYPRE_Int HYPRE_FlexGMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
   HYPRE_Int HYPRE_FlexGMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
   HYPRE_Int HYPRE_FlexGMRESSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1513,6 +2187,8 @@ extern "C" {
   HYPRE_Int HYPRE_LGMRESGetMinIter ( HYPRE_Solver solver , HYPRE_Int *min_iter );
   HYPRE_Int HYPRE_LGMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
   HYPRE_Int HYPRE_LGMRESGetMaxIter ( HYPRE_Solver solver , HYPRE_Int *max_iter );
+  HYPRE_Int HYPRE_LGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
+  HYPRE_Int HYPRE_LGMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
   HYPRE_Int HYPRE_LGMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
   HYPRE_Int HYPRE_LGMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
   HYPRE_Int HYPRE_LGMRESSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1549,6 +2225,8 @@ extern "C" {
   HYPRE_Int HYPRE_PCGGetRecomputeResidual ( HYPRE_Solver solver , HYPRE_Int *recompute_residual );
   HYPRE_Int HYPRE_PCGSetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int recompute_residual_p );
   HYPRE_Int HYPRE_PCGGetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int HYPRE_PCGSetVariant ( HYPRE_Solver solver , HYPRE_Int variant );
+  HYPRE_Int HYPRE_PCGGetVariant ( HYPRE_Solver solver , HYPRE_Int *variant );
   HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
   HYPRE_Int HYPRE_PCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
   HYPRE_Int HYPRE_PCGSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1564,8 +2242,11 @@ extern "C" {
   void *hypre_PCGCreate ( hypre_PCGFunctions *pcg_functions );
   HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
   HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata , void **residual );
+  HYPRE_Int hypre_PCGCreateVariantVectors ( void *pcg_vdata , void *x );
+  HYPRE_Int hypre_PCGDestroyVariantVectors ( void *pcg_vdata );
   HYPRE_Int hypre_PCGSetup ( void *pcg_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_PCGSolve ( void *pcg_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_PCGSolveFused ( void *pcg_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_PCGSetTol ( void *pcg_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_PCGGetTol ( void *pcg_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_PCGSetAbsoluteTol ( void *pcg_vdata , HYPRE_Real a_tol );
@@ -1586,6 +2267,8 @@ extern "C" {
   HYPRE_Int hypre_PCGGetRecomputeResidual ( void *pcg_vdata , HYPRE_Int *recompute_residual );
   HYPRE_Int hypre_PCGSetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int recompute_residual_p );
   HYPRE_Int hypre_PCGGetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int hypre_PCGSetVariant ( void *pcg_vdata , HYPRE_Int variant );
+  HYPRE_Int hypre_PCGGetVariant ( void *pcg_vdata , HYPRE_Int *variant );
   HYPRE_Int hypre_PCGSetStopCrit ( void *pcg_vdata , HYPRE_Int stop_crit );
   HYPRE_Int hypre_PCGGetStopCrit ( void *pcg_vdata , HYPRE_Int *stop_crit );
   HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata , HYPRE_Solver *precond_data_ptr );
@@ -1600,6 +2283,9 @@ extern "C" {
   HYPRE_Int hypre_PCGPrintLogging ( void *pcg_vdata , HYPRE_Int myid );
   HYPRE_Int hypre_PCGGetFinalRelativeResidualNorm ( void *pcg_vdata , HYPRE_Real *relative_residual_norm );
 
+  HYPRE_Int hypre_KrylovMultiInnerProd ( HYPRE_Int (*MultiInnerProd )(HYPRE_Int k, void **x, void **y, HYPRE_Real *local, HYPRE_Real *result, hypre_MPI_Request *request), HYPRE_Real (*InnerProd )(void *x, void *y), HYPRE_Int k , void **x , void **y , HYPRE_Real *local , HYPRE_Real *result , hypre_MPI_Request *request );
+  HYPRE_Real hypre_KrylovOrthogonalize ( HYPRE_Int (*MultiInnerProd )(HYPRE_Int k, void **x, void **y, HYPRE_Real *local, HYPRE_Real *result, hypre_MPI_Request *request), HYPRE_Real (*InnerProd )(void *x, void *y), HYPRE_Int (*Axpy )(HYPRE_Complex alpha, void *x, void *y), HYPRE_Int cgs , HYPRE_Int i , void **p , HYPRE_Real **hh , void **dot_y , HYPRE_Real *local , HYPRE_Real *result );
+
 #ifdef __cplusplus
   }
 #endif
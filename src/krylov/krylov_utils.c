@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Routines shared by the Krylov solvers
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_KrylovMultiInnerProd
+ *
+ * Starts the k inner products <x[j],y[j]> as one global reduction; the results
+ * are available after hypre_MPI_Wait on request.  Without a MultiInnerProd
+ * function, the inner products are computed one at a time with InnerProd.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_KrylovMultiInnerProd( HYPRE_Int        (*MultiInnerProd)( HYPRE_Int k, void **x, void **y,
+                                                                HYPRE_Real *local,
+                                                                HYPRE_Real *result,
+                                                                hypre_MPI_Request *request ),
+                            HYPRE_Real       (*InnerProd)( void *x, void *y ),
+                            HYPRE_Int          k,
+                            void             **x,
+                            void             **y,
+                            HYPRE_Real        *local,
+                            HYPRE_Real        *result,
+                            hypre_MPI_Request *request )
+{
+   HYPRE_Int j;
+
+   if (MultiInnerProd)
+   {
+      return (*MultiInnerProd)(k, x, y, local, result, request);
+   }
+
+   for (j = 0; j < k; j++)
+   {
+      result[j] = (*InnerProd)(x[j], y[j]);
+   }
+   *request = hypre_MPI_REQUEST_NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_KrylovOrthogonalize
+ *
+ * Orthogonalizes p[i] against p[0],...,p[i-1], stores the coefficients in
+ * column i-1 of hh, and returns the norm of the resulting vector.  Used by
+ * the Arnoldi process of GMRES, FlexGMRES and LGMRES.
+ *
+ * cgs = 0: modified Gram-Schmidt, i+1 global reductions.
+ * cgs = 1: classical Gram-Schmidt, one reduction for the projection and one
+ *          for the norm.
+ * cgs = 2: classical Gram-Schmidt with one reorthogonalization pass, two
+ *          global reductions.  The norm comes from ||p[i]||^2 - sum_j c_j^2
+ *          in the second reduction, which is accurate because the first pass
+ *          already removed the projection; it is recomputed explicitly if
+ *          the difference cancels more than two digits.
+ *
+ * The work arrays dot_y, local and result have length at least i+1.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_KrylovOrthogonalize( HYPRE_Int  (*MultiInnerProd)( HYPRE_Int k, void **x, void **y,
+                                                         HYPRE_Real *local,
+                                                         HYPRE_Real *result,
+                                                         hypre_MPI_Request *request ),
+                           HYPRE_Real (*InnerProd)( void *x, void *y ),
+                           HYPRE_Int  (*Axpy)( HYPRE_Complex alpha, void *x, void *y ),
+                           HYPRE_Int    cgs,
+                           HYPRE_Int    i,
+                           void       **p,
+                           HYPRE_Real **hh,
+                           void       **dot_y,
+                           HYPRE_Real  *local,
+                           HYPRE_Real  *result )
+{
+   hypre_MPI_Request  request;
+   hypre_MPI_Status   status;
+   HYPRE_Int          j, pass, num_dots;
+   HYPRE_Real         h_norm2 = 0.0, t;
+
+   if (cgs == 0)
+   {
+      for (j = 0; j < i; j++)
+      {
+         hh[j][i-1] = (*InnerProd)(p[j],p[i]);
+         (*Axpy)(-hh[j][i-1],p[j],p[i]);
+      }
+      return sqrt((*InnerProd)(p[i],p[i]));
+   }
+
+   for (j = 0; j <= i; j++)
+   {
+      dot_y[j] = p[i];
+   }
+   for (j = 0; j < i; j++)
+   {
+      hh[j][i-1] = 0.0;
+   }
+
+   /* the norm of p[i] is added to the reduction of the second pass */
+   for (pass = 0; pass < cgs; pass++)
+   {
+      num_dots = (pass == 1) ? i+1 : i;
+      hypre_KrylovMultiInnerProd(MultiInnerProd, InnerProd, num_dots, p, dot_y,
+                                 local, result, &request);
+      hypre_MPI_Wait(&request, &status);
+
+      h_norm2 = 0.0;
+      for (j = 0; j < i; j++)
+      {
+         hh[j][i-1] += result[j];
+         h_norm2 += result[j] * result[j];
+         (*Axpy)(-result[j],p[j],p[i]);
+      }
+   }
+
+   if (cgs == 1)
+   {
+      return sqrt((*InnerProd)(p[i],p[i]));
+   }
+
+   t = result[i] - h_norm2;
+   if (t <= 1.0e-2 * result[i])
+   {
+      t = (*InnerProd)(p[i],p[i]);
+   }
+
+   return sqrt(t);
+}
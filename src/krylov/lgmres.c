@@ -32,6 +32,8 @@ hypre_LGMRESFunctionsCreate(
                                    void *x, HYPRE_Complex beta, void *y ),
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
    HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
    HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
    HYPRE_Int    (*ClearVector)   ( void *x ),
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -54,6 +56,7 @@ hypre_LGMRESFunctionsCreate(
    lgmres_functions->Matvec = Matvec;
    lgmres_functions->MatvecDestroy = MatvecDestroy;
    lgmres_functions->InnerProd = InnerProd;
+   lgmres_functions->MultiInnerProd = MultiInnerProd;
    lgmres_functions->CopyVector = CopyVector;
    lgmres_functions->ClearVector = ClearVector;
    lgmres_functions->ScaleVector = ScaleVector;
@@ -87,6 +90,7 @@ hypre_LGMRESCreate( hypre_LGMRESFunctions *lgmres_functions )
    (lgmres_data -> min_iter)       = 0;
    (lgmres_data -> max_iter)       = 1000;
    (lgmres_data -> rel_change)     = 0;
+   (lgmres_data -> cgs)            = 0; /* modified Gram-Schmidt */
    (lgmres_data -> stop_crit)      = 0; /* rel. residual norm */
    (lgmres_data -> converged)      = 0;
    (lgmres_data -> precond_data)   = NULL;
@@ -294,6 +298,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    HYPRE_Int 		     k_dim        = (lgmres_data -> k_dim);
    HYPRE_Int               min_iter     = (lgmres_data -> min_iter);
    HYPRE_Int 		     max_iter     = (lgmres_data -> max_iter);
+   HYPRE_Int 		     cgs          = (lgmres_data -> cgs);
    HYPRE_Real 	     r_tol        = (lgmres_data -> tol);
    HYPRE_Real 	     cf_tol       = (lgmres_data -> cf_tol);
    HYPRE_Real        a_tol        = (lgmres_data -> a_tol);
@@ -327,6 +332,8 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    HYPRE_Int        break_value = 0;
    HYPRE_Int	      i, j, k;
    HYPRE_Real *rs, **hh, *c, *s;
+   void      **dot_y = NULL;
+   HYPRE_Real *dot_local = NULL, *dot_result = NULL;
    HYPRE_Int        iter;
    HYPRE_Int        my_id, num_procs;
    HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm;
@@ -369,6 +376,12 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    {
    	hh[i] = hypre_CTAllocF(HYPRE_Real,k_dim+aug_dim,lgmres_functions, HYPRE_MEMORY_HOST);
    }
+   if (cgs > 0)
+   {
+      dot_y = hypre_CTAllocF(void*,k_dim+aug_dim+1,lgmres_functions, HYPRE_MEMORY_HOST);
+      dot_local = hypre_CTAllocF(HYPRE_Real,k_dim+aug_dim+1,lgmres_functions, HYPRE_MEMORY_HOST);
+      dot_result = hypre_CTAllocF(HYPRE_Real,k_dim+aug_dim+1,lgmres_functions, HYPRE_MEMORY_HOST);
+   }
 
    (*(lgmres_functions->CopyVector))(b,p[0]);
 
@@ -506,6 +519,9 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
               hypre_TFreeF(hh[i],lgmres_functions);
            }
 
+           hypre_TFreeF(dot_y,lgmres_functions);
+           hypre_TFreeF(dot_local,lgmres_functions);
+           hypre_TFreeF(dot_result,lgmres_functions);
            hypre_TFreeF(hh,lgmres_functions);
            HYPRE_ANNOTATE_FUNC_END;
 
@@ -585,13 +601,10 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
            }
            /*---*/
 
-           /* modified Gram_Schmidt */
-           for (j=0; j < i; j++)
-           {
-              hh[j][i-1] = (*(lgmres_functions->InnerProd))(p[j],p[i]);
-              (*(lgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
-           }
-           t = sqrt((*(lgmres_functions->InnerProd))(p[i],p[i]));
+           /* Gram-Schmidt, see hypre_KrylovOrthogonalize */
+           t = hypre_KrylovOrthogonalize(lgmres_functions->MultiInnerProd, lgmres_functions->InnerProd,
+                                         lgmres_functions->Axpy, cgs, i, p, hh,
+                                         dot_y, dot_local, dot_result);
            hh[i][i-1] = t;
            if (t != 0.0)
            {
@@ -860,6 +873,9 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    {
       hypre_TFreeF(hh[i],lgmres_functions);
    }
+   hypre_TFreeF(dot_y,lgmres_functions);
+   hypre_TFreeF(dot_local,lgmres_functions);
+   hypre_TFreeF(dot_result,lgmres_functions);
    hypre_TFreeF(hh,lgmres_functions);
 
    HYPRE_ANNOTATE_FUNC_END;
@@ -1073,6 +1089,38 @@ hypre_LGMRESGetMaxIter( void *lgmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_LGMRESSetCGS, hypre_LGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LGMRESSetCGS( void      *lgmres_vdata,
+                    HYPRE_Int  cgs )
+{
+   hypre_LGMRESData *lgmres_data = (hypre_LGMRESData *)lgmres_vdata;
+
+   if (cgs < 0 || cgs > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (lgmres_data -> cgs) = cgs;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_LGMRESGetCGS( void      *lgmres_vdata,
+                    HYPRE_Int *cgs )
+{
+   hypre_LGMRESData *lgmres_data = (hypre_LGMRESData *)lgmres_vdata;
+
+   *cgs = (lgmres_data -> cgs);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  * hypre_LGMRESSetStopCrit, hypre_LGMRESGetStopCrit
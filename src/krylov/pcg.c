@@ -40,6 +40,8 @@ hypre_PCGFunctionsCreate(
                                    void *x, HYPRE_Complex beta, void *y ),
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
    HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*MultiInnerProd)( HYPRE_Int k, void **x, void **y, HYPRE_Real *local,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
    HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
    HYPRE_Int    (*ClearVector)   ( void *x ),
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -61,6 +63,7 @@ hypre_PCGFunctionsCreate(
    pcg_functions->Matvec = Matvec;
    pcg_functions->MatvecDestroy = MatvecDestroy;
    pcg_functions->InnerProd = InnerProd;
+   pcg_functions->MultiInnerProd = MultiInnerProd;
    pcg_functions->CopyVector = CopyVector;
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
@@ -101,6 +104,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
+   (pcg_data -> variant)      = 0;
    (pcg_data -> owns_matvec_data ) = 1;
    (pcg_data -> matvec_data)  = NULL;
    (pcg_data -> precond_data) = NULL;
@@ -111,6 +115,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> variant_vectors) = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -161,6 +166,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      hypre_PCGDestroyVariantVectors(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -183,6 +189,52 @@ HYPRE_Int hypre_PCGGetResidual( void *pcg_vdata, void **residual )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGCreateVariantVectors, hypre_PCGDestroyVariantVectors
+ *
+ * Work vectors u, w, m, n, q, z of the single-reduction variants (the
+ * Chronopoulos-Gear variant only uses u and w).
+ *--------------------------------------------------------------------------*/
+
+#define hypre_PCG_NUM_VARIANT_VECTORS 6
+
+HYPRE_Int
+hypre_PCGCreateVariantVectors( void *pcg_vdata,
+                               void *x )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int           j;
+
+   (pcg_data -> variant_vectors) = hypre_CTAllocF(void *, hypre_PCG_NUM_VARIANT_VECTORS,
+                                                  pcg_functions, HYPRE_MEMORY_HOST);
+   for (j = 0; j < hypre_PCG_NUM_VARIANT_VECTORS; j++)
+   {
+      (pcg_data -> variant_vectors)[j] = (*(pcg_functions->CreateVector))(x);
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGDestroyVariantVectors( void *pcg_vdata )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int           j;
+
+   if ( (pcg_data -> variant_vectors) != NULL )
+   {
+      for (j = 0; j < hypre_PCG_NUM_VARIANT_VECTORS; j++)
+      {
+         (*(pcg_functions->DestroyVector))((pcg_data -> variant_vectors)[j]);
+      }
+      hypre_TFreeF( pcg_data -> variant_vectors, pcg_functions );
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetup
  *--------------------------------------------------------------------------*/
@@ -221,6 +273,10 @@ hypre_PCGSetup( void *pcg_vdata,
       (*(pcg_functions->DestroyVector))(pcg_data -> r);
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   hypre_PCGDestroyVariantVectors(pcg_data);
+   if ( (pcg_data -> variant) > 0 )
+      hypre_PCGCreateVariantVectors(pcg_data, x);
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
    (pcg_data -> matvec_data) = (*(pcg_functions->MatvecCreate))(A, x);
@@ -322,6 +378,13 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
 
+   /* single-reduction variants (only the basic stopping tests) */
+   if ( (pcg_data -> variant) > 0 && !rel_change && !recompute_residual &&
+        !recompute_residual_p && rtol == 0.0 && cf_tol <= 0.0 )
+   {
+      return hypre_PCGSolveFused(pcg_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (pcg_data -> converged) = 0;
@@ -762,6 +825,412 @@ hypre_PCGSolve( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGUpdateDirection
+ *
+ * v = a + beta*v, or v = a on the first iteration.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGUpdateDirection( hypre_PCGFunctions *pcg_functions,
+                          HYPRE_Int           first,
+                          HYPRE_Real          beta,
+                          void               *a,
+                          void               *v )
+{
+   if (first)
+   {
+      (*(pcg_functions->CopyVector))(a, v);
+   }
+   else
+   {
+      (*(pcg_functions->ScaleVector))(beta, v);
+      (*(pcg_functions->Axpy))(1.0, a, v);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGFusedResidual
+ *
+ * Computes r = b - A*x, u = C*r and w = A*u from scratch (and m = C*w and
+ * n = A*m for the pipelined variant), together with the fused inner products
+ * of dot_x and dot_y.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGFusedResidual( hypre_PCGData *pcg_data,
+                        void          *A,
+                        void          *b,
+                        void          *x,
+                        HYPRE_Int      num_dots,
+                        void         **dot_x,
+                        void         **dot_y,
+                        HYPRE_Real    *dot_local,
+                        HYPRE_Real    *dots )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   void           *r            = (pcg_data -> r);
+   void           *u            = (pcg_data -> variant_vectors)[0];
+   void           *w            = (pcg_data -> variant_vectors)[1];
+   void           *m            = (pcg_data -> variant_vectors)[2];
+   void           *n            = (pcg_data -> variant_vectors)[3];
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+
+   hypre_MPI_Request request;
+   hypre_MPI_Status  status;
+
+   /* r = b - Ax */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+
+   /* u = C*r, w = A*u */
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   hypre_KrylovMultiInnerProd(pcg_functions->MultiInnerProd, pcg_functions->InnerProd,
+                              num_dots, dot_x, dot_y,
+                              dot_local, dots, &request);
+   if ((pcg_data -> variant) == 2)
+   {
+      /* m = C*w, n = A*m */
+      (*(pcg_functions->ClearVector))(m);
+      precond(precond_data, A, w, m);
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+   }
+   hypre_MPI_Wait(&request, &status);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolveFused
+ *--------------------------------------------------------------------------
+ *
+ * Single-reduction variants of hypre_PCGSolve.  Both carry the recurrences
+ * s = A*p, u = C*r and w = A*u, so that
+ *
+ *       gamma = <r,u>,  delta = <w,u>  (and <r,r> for the two-norm test)
+ *
+ * are the only inner products of an iteration and are reduced together.  The
+ * step length follows from alpha = gamma / (delta - beta*gamma/alpha_old).
+ *
+ * variant 1 (Chronopoulos-Gear): one blocking fused reduction per iteration.
+ * variant 2 (Ghysels-Vanroose):  the fused reduction is non-blocking and
+ *    overlaps m = C*w and n = A*m; this needs the extra recurrences q = C*s
+ *    and z = A*q, and assumes a fixed (linear) preconditioner.
+ *
+ * The convergence test is the same as in hypre_PCGSolve.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolveFused( void *pcg_vdata,
+                     void *A,
+                     void *b,
+                     void *x         )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Real      atolf        = (pcg_data -> atolf);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   HYPRE_Int       variant      = (pcg_data -> variant);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   void           *u, *w, *m, *n, *q, *z;
+   void           *dot_x[3], *dot_y[3];
+   HYPRE_Real      dot_local[3], dots[3];
+   HYPRE_Int       num_dots = two_norm ? 3 : 2;
+   hypre_MPI_Request request;
+   hypre_MPI_Status  status;
+
+   HYPRE_Real      alpha, alpha_old = 0.0;
+   HYPRE_Real      beta, denom;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta;
+   HYPRE_Real      bi_prod, eps;
+   HYPRE_Real      i_prod, i_prod_0;
+   HYPRE_Real      ieee_check = 0.;
+
+   HYPRE_Int       first = 1;
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
+
+   /* the variant may have been set after hypre_PCGSetup */
+   if ( (pcg_data -> variant_vectors) == NULL )
+   {
+      hypre_PCGCreateVariantVectors(pcg_data, x);
+   }
+   u = (pcg_data -> variant_vectors)[0];
+   w = (pcg_data -> variant_vectors)[1];
+   m = (pcg_data -> variant_vectors)[2];
+   n = (pcg_data -> variant_vectors)[3];
+   q = (pcg_data -> variant_vectors)[4];
+   z = (pcg_data -> variant_vectors)[5];
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+      if (print_level > 1 && my_id == 0)
+          hypre_printf("<b,b>: %e\n",bi_prod);
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      bi_prod = (*(pcg_functions->InnerProd))(p, b);
+      if (print_level > 1 && my_id == 0)
+          hypre_printf("<C*b,b>: %e\n",bi_prod);
+   };
+
+   if (bi_prod != 0.) ieee_check = bi_prod/bi_prod; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+        hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+        hypre_printf("ERROR -- hypre_PCGSolve: INFs and/or NaNs detected in input.\n");
+        hypre_printf("User probably placed non-numerics in supplied b.\n");
+        hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+        hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   eps = r_tol*r_tol;
+   if ( bi_prod > 0.0 )
+   {
+      if ( stop_crit && atolf<=0 )  /* pure absolute tolerance */
+      {
+         eps = eps / bi_prod;
+      }
+      else if ( atolf>0 )  /* mixed relative and absolute tolerance */
+      {
+         bi_prod += atolf;
+      }
+      else
+      {
+         eps = hypre_max(r_tol*r_tol, a_tol*a_tol/bi_prod);
+      }
+   }
+   else    /* bi_prod==0.0: the rhs vector b is zero */
+   {
+      /* Set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging>0 || print_level>0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[i] = 0.0;
+      }
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   };
+
+   /* gamma = <r,u>, delta = <w,u> and <r,r> are reduced together */
+   dot_x[0] = r;  dot_y[0] = u;
+   dot_x[1] = w;  dot_y[1] = u;
+   dot_x[2] = r;  dot_y[2] = r;
+
+   hypre_PCGFusedResidual(pcg_data, A, b, x, num_dots, dot_x, dot_y, dot_local, dots);
+
+   gamma = dots[0];
+   delta = dots[1];
+
+   if (gamma != 0.) ieee_check = gamma/gamma; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+        hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+        hypre_printf("ERROR -- hypre_PCGSolve: INFs and/or NaNs detected in input.\n");
+        hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+        hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+        hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /* Set initial residual norm */
+   i_prod_0 = two_norm ? dots[2] : gamma;
+   i_prod   = i_prod_0;
+   if ( logging>0 || print_level>0 ) norms[0] = sqrt(i_prod_0);
+
+   if ( print_level > 1 && my_id==0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   while ((i+1) <= max_iter)
+   {
+      i++;
+
+      /* alpha = gamma / <A*p,p> */
+      beta  = first ? 0.0 : gamma / gamma_old;
+      denom = first ? delta : delta - beta * gamma / alpha_old;
+      alpha = (denom != 0.0) ? gamma / denom : 0.0;
+
+      if ( !(alpha > HYPRE_REAL_MIN) && variant == 2 && !first )
+      {
+         /* The pipelined recurrences have lost accuracy (this happens with
+            preconditioners that are not exactly linear); restart them from
+            the true residual. */
+         hypre_PCGFusedResidual(pcg_data, A, b, x, num_dots, dot_x, dot_y, dot_local, dots);
+         gamma = dots[0];
+         delta = dots[1];
+         first = 1;
+         beta  = 0.0;
+         denom = delta;
+         alpha = (denom != 0.0) ? gamma / denom : 0.0;
+      }
+      if ( denom==0.0 )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero sdotp value in PCG");
+         break;
+      }
+      if (! (alpha > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal alpha value in PCG");
+         break;
+      }
+
+      /* p = u + beta*p, s = w + beta*s */
+      hypre_PCGUpdateDirection(pcg_functions, first, beta, u, p);
+      hypre_PCGUpdateDirection(pcg_functions, first, beta, w, s);
+
+      /* x = x + alpha*p, r = r - alpha*s */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+
+      if (variant == 2)
+      {
+         /* q = m + beta*q, z = n + beta*z */
+         hypre_PCGUpdateDirection(pcg_functions, first, beta, m, q);
+         hypre_PCGUpdateDirection(pcg_functions, first, beta, n, z);
+
+         /* u = u - alpha*q, w = w - alpha*z */
+         (*(pcg_functions->Axpy))(-alpha, q, u);
+         (*(pcg_functions->Axpy))(-alpha, z, w);
+      }
+      else
+      {
+         /* u = C*r, w = A*u */
+         (*(pcg_functions->ClearVector))(u);
+         precond(precond_data, A, r, u);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+      }
+
+      hypre_KrylovMultiInnerProd(pcg_functions->MultiInnerProd, pcg_functions->InnerProd,
+                                 num_dots, dot_x, dot_y,
+                                 dot_local, dots, &request);
+      if (variant == 2)
+      {
+         /* m = C*w, n = A*m */
+         (*(pcg_functions->ClearVector))(m);
+         precond(precond_data, A, w, m);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+      }
+      hypre_MPI_Wait(&request, &status);
+
+      first     = 0;
+      gamma_old = gamma;
+      alpha_old = alpha;
+      gamma     = dots[0];
+      delta     = dots[1];
+
+      /* set i_prod for convergence test */
+      i_prod = two_norm ? dots[2] : gamma;
+
+      /* print norm info */
+      if ( logging>0 || print_level>0 )
+      {
+         norms[i]     = sqrt(i_prod);
+         rel_norms[i] = bi_prod ? sqrt(i_prod/bi_prod) : 0;
+      }
+      if ( print_level > 1 && my_id==0 )
+      {
+         hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                      norms[i]/norms[i-1], rel_norms[i] );
+      }
+
+      /* check for convergence */
+      if (i_prod / bi_prod < eps)
+      {
+         (pcg_data -> converged) = 1;
+         break;
+      }
+
+      if (! (gamma > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+
+         break;
+      }
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id==0 )
+      hypre_printf("\n\n");
+
+   if (i >= max_iter && (i_prod/bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations)    = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod/bi_prod);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetTol, hypre_PCGGetTol
  *--------------------------------------------------------------------------*/
@@ -1028,6 +1497,38 @@ hypre_PCGGetRecomputeResidualP( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetVariant, hypre_PCGGetVariant
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetVariant( void *pcg_vdata,
+                     HYPRE_Int   variant  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   if (variant < 0 || variant > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (pcg_data -> variant) = variant;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetVariant( void *pcg_vdata,
+                     HYPRE_Int * variant  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *variant = (pcg_data -> variant);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetStopCrit, hypre_PCGGetStopCrit
  *--------------------------------------------------------------------------*/
@@ -36,6 +36,9 @@ HYPRE_BoomerAMGDestroy( HYPRE_Solver solver )
 
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetup
+ *
+ * Setup runs in a host scratch scope: temporaries allocated with
+ * hypre_TAllocScratch are dropped in one shot when it returns.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -44,10 +47,39 @@ HYPRE_BoomerAMGSetup( HYPRE_Solver solver,
                       HYPRE_ParVector b,
                       HYPRE_ParVector x      )
 {
-   return( hypre_BoomerAMGSetup( (void *) solver,
-                                 (hypre_ParCSRMatrix *) A,
-                                 (hypre_ParVector *) b,
-                                 (hypre_ParVector *) x ) );
+   hypre_HostScratchBegin();
+
+   hypre_BoomerAMGSetup( (void *) solver,
+                         (hypre_ParCSRMatrix *) A,
+                         (hypre_ParVector *) b,
+                         (hypre_ParVector *) x );
+
+   hypre_HostScratchEnd();
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetupUpdate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetupUpdate( HYPRE_Solver       solver,
+                            HYPRE_ParCSRMatrix A )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HostScratchBegin();
+
+   hypre_BoomerAMGSetupUpdate( (void *) solver, (hypre_ParCSRMatrix *) A );
+
+   hypre_HostScratchEnd();
+
+   return hypre_error_flag;
 }
 
 /*--------------------------------------------------------------------------
@@ -1927,6 +1959,28 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecision
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMixedPrecision (HYPRE_Solver solver,
+                                  HYPRE_Int    mixed_precision)
+{
+   return (hypre_BoomerAMGSetMixedPrecision ( (void *) solver, mixed_precision ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetReuseRAP
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetReuseRAP (HYPRE_Solver solver,
+                            HYPRE_Int    reuse_rap)
+{
+   return (hypre_BoomerAMGSetReuseRAP ( (void *) solver, reuse_rap ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
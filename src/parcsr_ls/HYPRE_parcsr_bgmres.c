@@ -0,0 +1,220 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESCreate( MPI_Comm      comm,
+                          HYPRE_Solver *solver )
+{
+   hypre_BGMRESFunctions * bgmres_functions;
+
+   if (!solver)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   bgmres_functions =
+      hypre_BGMRESFunctionsCreate(
+         hypre_ParKrylovCAlloc, hypre_ParKrylovFree, hypre_ParKrylovCommInfo,
+         hypre_ParKrylovCreateVector,
+         hypre_ParKrylovCreateVectorArray,
+         hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecBlockCreate,
+         hypre_ParKrylovMatvec, hypre_ParKrylovMatvecBlock,
+         hypre_ParKrylovMatvecBlockDestroy,
+         hypre_ParKrylovInnerProd, hypre_ParKrylovMultiInnerProd,
+         hypre_ParKrylovCopyVector, hypre_ParKrylovClearVector,
+         hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
+         hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   *solver = ( (HYPRE_Solver) hypre_BGMRESCreate( bgmres_functions ) );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESDestroy( HYPRE_Solver solver )
+{
+   return( hypre_BGMRESDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESSetup( HYPRE_Solver        solver,
+                         HYPRE_ParCSRMatrix  A,
+                         HYPRE_Int           num_rhs,
+                         HYPRE_ParVector    *b,
+                         HYPRE_ParVector    *x )
+{
+   return( HYPRE_BGMRESSetup( solver,
+                              (HYPRE_Matrix) A,
+                              num_rhs,
+                              (HYPRE_Vector *) b,
+                              (HYPRE_Vector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESSolve( HYPRE_Solver        solver,
+                         HYPRE_ParCSRMatrix  A,
+                         HYPRE_Int           num_rhs,
+                         HYPRE_ParVector    *b,
+                         HYPRE_ParVector    *x )
+{
+   return( HYPRE_BGMRESSolve( solver,
+                              (HYPRE_Matrix) A,
+                              num_rhs,
+                              (HYPRE_Vector *) b,
+                              (HYPRE_Vector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESSetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESSetKDim( HYPRE_Solver solver,
+                           HYPRE_Int    k_dim )
+{
+   return( HYPRE_BGMRESSetKDim( solver, k_dim ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESSetTol( HYPRE_Solver solver,
+                          HYPRE_Real   tol )
+{
+   return( HYPRE_BGMRESSetTol( solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESSetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESSetAbsoluteTol( HYPRE_Solver solver,
+                                  HYPRE_Real   a_tol )
+{
+   return( HYPRE_BGMRESSetAbsoluteTol( solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESSetMaxIter( HYPRE_Solver solver,
+                              HYPRE_Int    max_iter )
+{
+   return( HYPRE_BGMRESSetMaxIter( solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESSetPrecond( HYPRE_Solver            solver,
+                              HYPRE_PtrToParSolverFcn precond,
+                              HYPRE_PtrToParSolverFcn precond_setup,
+                              HYPRE_Solver            precond_solver )
+{
+   HYPRE_BGMRESSetPrecond( solver,
+                           (HYPRE_PtrToSolverFcn) precond,
+                           (HYPRE_PtrToSolverFcn) precond_setup,
+                           precond_solver );
+
+   /* BoomerAMG cycles on all vectors of the block at once */
+   if (precond == HYPRE_BoomerAMGSolve)
+   {
+      hypre_BGMRESSetPrecondBlock( (void *) solver, hypre_ParKrylovBoomerAMGSolveBlock );
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESGetPrecond( HYPRE_Solver  solver,
+                              HYPRE_Solver *precond_data_ptr )
+{
+   return( HYPRE_BGMRESGetPrecond( solver, precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESSetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESSetLogging( HYPRE_Solver solver,
+                              HYPRE_Int    logging )
+{
+   return( HYPRE_BGMRESSetLogging( solver, logging ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESSetPrintLevel( HYPRE_Solver solver,
+                                 HYPRE_Int    print_level )
+{
+   return( HYPRE_BGMRESSetPrintLevel( solver, print_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESGetNumIterations( HYPRE_Solver  solver,
+                                    HYPRE_Int    *num_iterations )
+{
+   return( HYPRE_BGMRESGetNumIterations( solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESGetConverged( HYPRE_Solver  solver,
+                                HYPRE_Int    *converged )
+{
+   return( HYPRE_BGMRESGetConverged( solver, converged ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBGMRESGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBGMRESGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                                HYPRE_Real   *norm )
+{
+   return( HYPRE_BGMRESGetFinalRelativeResidualNorm( solver, norm ) );
+}
@@ -0,0 +1,209 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGCreate( MPI_Comm      comm,
+                        HYPRE_Solver *solver )
+{
+   hypre_BPCGFunctions * bpcg_functions;
+
+   if (!solver)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   bpcg_functions =
+      hypre_BPCGFunctionsCreate(
+         hypre_ParKrylovCAlloc, hypre_ParKrylovFree, hypre_ParKrylovCommInfo,
+         hypre_ParKrylovCreateVector,
+         hypre_ParKrylovCreateVectorArray,
+         hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecBlockCreate,
+         hypre_ParKrylovMatvec, hypre_ParKrylovMatvecBlock,
+         hypre_ParKrylovMatvecBlockDestroy,
+         hypre_ParKrylovInnerProd, hypre_ParKrylovMultiInnerProd,
+         hypre_ParKrylovCopyVector, hypre_ParKrylovClearVector,
+         hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
+         hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   *solver = ( (HYPRE_Solver) hypre_BPCGCreate( bpcg_functions ) );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGDestroy( HYPRE_Solver solver )
+{
+   return( hypre_BPCGDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGSetup( HYPRE_Solver        solver,
+                       HYPRE_ParCSRMatrix  A,
+                       HYPRE_Int           num_rhs,
+                       HYPRE_ParVector    *b,
+                       HYPRE_ParVector    *x )
+{
+   return( HYPRE_BPCGSetup( solver,
+                            (HYPRE_Matrix) A,
+                            num_rhs,
+                            (HYPRE_Vector *) b,
+                            (HYPRE_Vector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGSolve( HYPRE_Solver        solver,
+                       HYPRE_ParCSRMatrix  A,
+                       HYPRE_Int           num_rhs,
+                       HYPRE_ParVector    *b,
+                       HYPRE_ParVector    *x )
+{
+   return( HYPRE_BPCGSolve( solver,
+                            (HYPRE_Matrix) A,
+                            num_rhs,
+                            (HYPRE_Vector *) b,
+                            (HYPRE_Vector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGSetTol( HYPRE_Solver solver,
+                        HYPRE_Real   tol )
+{
+   return( HYPRE_BPCGSetTol( solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGSetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGSetAbsoluteTol( HYPRE_Solver solver,
+                                HYPRE_Real   a_tol )
+{
+   return( HYPRE_BPCGSetAbsoluteTol( solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGSetMaxIter( HYPRE_Solver solver,
+                            HYPRE_Int    max_iter )
+{
+   return( HYPRE_BPCGSetMaxIter( solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGSetPrecond( HYPRE_Solver            solver,
+                            HYPRE_PtrToParSolverFcn precond,
+                            HYPRE_PtrToParSolverFcn precond_setup,
+                            HYPRE_Solver            precond_solver )
+{
+   HYPRE_BPCGSetPrecond( solver,
+                         (HYPRE_PtrToSolverFcn) precond,
+                         (HYPRE_PtrToSolverFcn) precond_setup,
+                         precond_solver );
+
+   /* BoomerAMG cycles on all vectors of the block at once */
+   if (precond == HYPRE_BoomerAMGSolve)
+   {
+      hypre_BPCGSetPrecondBlock( (void *) solver, hypre_ParKrylovBoomerAMGSolveBlock );
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGGetPrecond( HYPRE_Solver  solver,
+                            HYPRE_Solver *precond_data_ptr )
+{
+   return( HYPRE_BPCGGetPrecond( solver, precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGSetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGSetLogging( HYPRE_Solver solver,
+                            HYPRE_Int    logging )
+{
+   return( HYPRE_BPCGSetLogging( solver, logging ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGSetPrintLevel( HYPRE_Solver solver,
+                               HYPRE_Int    print_level )
+{
+   return( HYPRE_BPCGSetPrintLevel( solver, print_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGGetNumIterations( HYPRE_Solver  solver,
+                                  HYPRE_Int    *num_iterations )
+{
+   return( HYPRE_BPCGGetNumIterations( solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGGetConverged( HYPRE_Solver  solver,
+                              HYPRE_Int    *converged )
+{
+   return( HYPRE_BPCGGetConverged( solver, converged ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBPCGGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                              HYPRE_Real   *norm )
+{
+   return( HYPRE_BPCGGetFinalRelativeResidualNorm( solver, norm ) );
+}
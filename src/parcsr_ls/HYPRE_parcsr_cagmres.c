@@ -0,0 +1,239 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
+{
+   hypre_CAGMRESFunctions * cagmres_functions;
+
+   if (!solver)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   cagmres_functions =
+      hypre_CAGMRESFunctionsCreate(
+         hypre_ParKrylovCAlloc, hypre_ParKrylovFree, hypre_ParKrylovCommInfo,
+         hypre_ParKrylovCreateVector,
+         hypre_ParKrylovCreateVectorArray,
+         hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
+         hypre_ParKrylovMatvec, hypre_ParKrylovMatvecDestroy,
+         hypre_ParKrylovInnerProd, hypre_ParKrylovMultiInnerProd,
+         hypre_ParKrylovCopyVector, hypre_ParKrylovClearVector,
+         hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
+         hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   *solver = ( (HYPRE_Solver) hypre_CAGMRESCreate( cagmres_functions ) );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESDestroy( HYPRE_Solver solver )
+{
+   return( hypre_CAGMRESDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetup( HYPRE_Solver solver,
+                          HYPRE_ParCSRMatrix A,
+                          HYPRE_ParVector b,
+                          HYPRE_ParVector x      )
+{
+   return( HYPRE_CAGMRESSetup( solver,
+                               (HYPRE_Matrix) A,
+                               (HYPRE_Vector) b,
+                               (HYPRE_Vector) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSolve( HYPRE_Solver solver,
+                          HYPRE_ParCSRMatrix A,
+                          HYPRE_ParVector b,
+                          HYPRE_ParVector x      )
+{
+   return( HYPRE_CAGMRESSolve( solver,
+                               (HYPRE_Matrix) A,
+                               (HYPRE_Vector) b,
+                               (HYPRE_Vector) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetKDim( HYPRE_Solver solver,
+                            HYPRE_Int    k_dim )
+{
+   return( HYPRE_CAGMRESSetKDim( solver, k_dim ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetSStep( HYPRE_Solver solver,
+                             HYPRE_Int    s_step )
+{
+   return( HYPRE_CAGMRESSetSStep( solver, s_step ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetBasis
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetBasis( HYPRE_Solver solver,
+                             HYPRE_Int    basis )
+{
+   return( HYPRE_CAGMRESSetBasis( solver, basis ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetTol( HYPRE_Solver solver,
+                           HYPRE_Real   tol )
+{
+   return( HYPRE_CAGMRESSetTol( solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetAbsoluteTol( HYPRE_Solver solver,
+                                   HYPRE_Real   a_tol )
+{
+   return( HYPRE_CAGMRESSetAbsoluteTol( solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetMinIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetMinIter( HYPRE_Solver solver,
+                               HYPRE_Int    min_iter )
+{
+   return( HYPRE_CAGMRESSetMinIter( solver, min_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetMaxIter( HYPRE_Solver solver,
+                               HYPRE_Int    max_iter )
+{
+   return( HYPRE_CAGMRESSetMaxIter( solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetPrecond( HYPRE_Solver             solver,
+                               HYPRE_PtrToParSolverFcn  precond,
+                               HYPRE_PtrToParSolverFcn  precond_setup,
+                               HYPRE_Solver             precond_solver )
+{
+   return( HYPRE_CAGMRESSetPrecond( solver,
+                                    (HYPRE_PtrToSolverFcn) precond,
+                                    (HYPRE_PtrToSolverFcn) precond_setup,
+                                    precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESGetPrecond( HYPRE_Solver  solver,
+                               HYPRE_Solver *precond_data_ptr )
+{
+   return( HYPRE_CAGMRESGetPrecond( solver, precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetLogging( HYPRE_Solver solver,
+                               HYPRE_Int    logging )
+{
+   return( HYPRE_CAGMRESSetLogging( solver, logging ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESSetPrintLevel( HYPRE_Solver solver,
+                                  HYPRE_Int    print_level )
+{
+   return( HYPRE_CAGMRESSetPrintLevel( solver, print_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESGetNumIterations( HYPRE_Solver  solver,
+                                     HYPRE_Int    *num_iterations )
+{
+   return( HYPRE_CAGMRESGetNumIterations( solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                                 HYPRE_Real   *norm   )
+{
+   return( HYPRE_CAGMRESGetFinalRelativeResidualNorm( solver, norm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCAGMRESGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCAGMRESGetResidual( HYPRE_Solver     solver,
+                                HYPRE_ParVector *residual )
+{
+   return( HYPRE_CAGMRESGetResidual( solver, (void *) residual ) );
+}
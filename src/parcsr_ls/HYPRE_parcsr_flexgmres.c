@@ -28,7 +28,8 @@ HYPRE_ParCSRFlexGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovCreateVectorArray,
          hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
          hypre_ParKrylovMatvec, hypre_ParKrylovMatvecDestroy,
-         hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
+         hypre_ParKrylovInnerProd,
+         hypre_ParKrylovMultiInnerProd, hypre_ParKrylovCopyVector,
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
@@ -90,6 +91,17 @@ HYPRE_ParCSRFlexGMRESSetKDim( HYPRE_Solver solver,
    return( HYPRE_FlexGMRESSetKDim( solver, k_dim ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRFlexGMRESSetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRFlexGMRESSetCGS( HYPRE_Solver solver,
+                             HYPRE_Int    cgs )
+{
+   return( HYPRE_FlexGMRESSetCGS( solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRFlexGMRESSetTol
  *--------------------------------------------------------------------------*/
@@ -28,7 +28,8 @@ HYPRE_ParCSRGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovCreateVectorArray,
          hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
          hypre_ParKrylovMatvec, hypre_ParKrylovMatvecDestroy,
-         hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
+         hypre_ParKrylovInnerProd,
+         hypre_ParKrylovMultiInnerProd, hypre_ParKrylovCopyVector,
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
@@ -90,6 +91,17 @@ HYPRE_ParCSRGMRESSetKDim( HYPRE_Solver solver,
    return( HYPRE_GMRESSetKDim( solver, k_dim ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGMRESSetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGMRESSetCGS( HYPRE_Solver solver,
+                         HYPRE_Int    cgs )
+{
+   return( HYPRE_GMRESSetCGS( solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRGMRESSetTol
  *--------------------------------------------------------------------------*/
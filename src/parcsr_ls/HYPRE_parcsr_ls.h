@@ -102,6 +102,25 @@ HYPRE_Int HYPRE_BoomerAMGSetup(HYPRE_Solver       solver,
                                HYPRE_ParVector    b,
                                HYPRE_ParVector    x);
 
+/**
+ * Update the BoomerAMG solver or preconditioner for new values of the
+ * matrix, keeping the coarse grids and interpolation operators of the last
+ * \e Setup. The coarse-grid operators, the l1 norms and Chebyshev data of
+ * the relaxations, ILU smoothers and the coarsest-level Gaussian elimination
+ * are recomputed; relaxation weights are kept. A must have the sparsity
+ * pattern of the matrix passed to the last \e Setup. This is much cheaper
+ * than a new setup, in particular after \e SetReuseRAP, for slowly changing
+ * operators. Hierarchies built with additive cycles, non-Galerkin or
+ * non-transposed restriction, complex smoothers other than ILU, CG
+ * relaxation or a redundant coarse solve cannot be updated and return an
+ * error.
+ *
+ * @param solver [IN] object previously set up.
+ * @param A [IN] ParCSR matrix with the new values.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetupUpdate(HYPRE_Solver       solver,
+                                     HYPRE_ParCSRMatrix A);
+
 /**
  * Solve the system or apply AMG as a preconditioner.
  * If used as a preconditioner, this function should be passed
@@ -1204,6 +1223,31 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                       HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If set to 1, the interpolation and restriction operators and
+ * the coarse grid operators below the finest level are stored in single
+ * precision at the end of the setup, while vectors and all arithmetic stay
+ * in double precision. This roughly halves the memory traffic of the
+ * coarse levels of a V-cycle used as a preconditioner. Coarse operators are
+ * only converted where the smoother is one of the relaxation types
+ * 0, 3, 4, 6, 7, 8, 13, 14, 16, 18 (and 9, 99, 199 on the coarsest level),
+ * and only on the host. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision(HYPRE_Solver solver,
+                                           HYPRE_Int    mixed_precision);
+
+/**
+ * (Optional) If set to 1, the setup keeps the symbolic part of each
+ * Galerkin product P^T A P (sparsity patterns, communication packages and
+ * the row-wise product plan), so that the coarse operators can later be
+ * recomputed from new values of the fine matrix without any symbolic work.
+ * Plans are only kept for standard Galerkin products on the host. They are
+ * used by \e SetupUpdate, which otherwise builds them at its first call.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetReuseRAP(HYPRE_Solver solver,
+                                     HYPRE_Int    reuse_rap);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2437,6 +2481,14 @@ HYPRE_Int HYPRE_ParCSRPCGSetStopCrit(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRPCGSetTwoNorm(HYPRE_Solver solver,
                                     HYPRE_Int    two_norm);
 
+/**
+ * (Optional) Select the CG recurrence: 0 (default) is standard PCG, 1 is
+ * Chronopoulos-Gear single-reduction CG and 2 is Ghysels-Vanroose pipelined CG.
+ * See HYPRE_PCGSetVariant.
+ **/
+HYPRE_Int HYPRE_ParCSRPCGSetVariant(HYPRE_Solver solver,
+                                    HYPRE_Int    variant);
+
 HYPRE_Int HYPRE_ParCSRPCGSetRelChange(HYPRE_Solver solver,
                                       HYPRE_Int    rel_change);
 
@@ -2531,6 +2583,14 @@ HYPRE_Int HYPRE_ParCSRGMRESSolve(HYPRE_Solver       solver,
 HYPRE_Int HYPRE_ParCSRGMRESSetKDim(HYPRE_Solver solver,
                                    HYPRE_Int    k_dim);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant: 0 (default) is modified
+ * Gram-Schmidt, 1 is classical Gram-Schmidt and 2 is classical Gram-Schmidt
+ * with reorthogonalization.  See HYPRE_GMRESSetCGS.
+ **/
+HYPRE_Int HYPRE_ParCSRGMRESSetCGS(HYPRE_Solver solver,
+                                  HYPRE_Int    cgs);
+
 HYPRE_Int HYPRE_ParCSRGMRESSetTol(HYPRE_Solver solver,
                                   HYPRE_Real   tol);
 
@@ -2655,6 +2715,247 @@ HYPRE_Int HYPRE_ParCSRCOGMRESGetResidual(HYPRE_Solver     solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name ParCSR CAGMRES Solver
+ *
+ * Communication-avoiding (s-step) GMRES; see the generic CAGMRES interface in
+ * \ref KrylovSolvers.  The s basis vectors of a block are generated with
+ * back-to-back preconditioned ParCSR matvecs and orthogonalized with four
+ * global reductions per block.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESCreate(MPI_Comm      comm,
+                                    HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESDestroy(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetup(HYPRE_Solver       solver,
+                                   HYPRE_ParCSRMatrix A,
+                                   HYPRE_ParVector    b,
+                                   HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSolve(HYPRE_Solver       solver,
+                                   HYPRE_ParCSRMatrix A,
+                                   HYPRE_ParVector    b,
+                                   HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetKDim(HYPRE_Solver solver,
+                                     HYPRE_Int    k_dim);
+
+/**
+ * (Optional) Set the number of basis vectors generated per block (default
+ * is 4).
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESSetSStep(HYPRE_Solver solver,
+                                      HYPRE_Int    s_step);
+
+/**
+ * (Optional) Set the basis of the s-step blocks.  0: monomial, 1: Newton
+ * (default).
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESSetBasis(HYPRE_Solver solver,
+                                      HYPRE_Int    basis);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetTol(HYPRE_Solver solver,
+                                    HYPRE_Real   tol);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetAbsoluteTol(HYPRE_Solver solver,
+                                            HYPRE_Real   a_tol);
+
+/*
+ * RE-VISIT
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESSetMinIter(HYPRE_Solver solver,
+                                        HYPRE_Int    min_iter);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetMaxIter(HYPRE_Solver solver,
+                                        HYPRE_Int    max_iter);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetPrecond(HYPRE_Solver             solver,
+                                        HYPRE_PtrToParSolverFcn  precond,
+                                        HYPRE_PtrToParSolverFcn  precond_setup,
+                                        HYPRE_Solver             precond_solver);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESGetPrecond(HYPRE_Solver  solver,
+                                        HYPRE_Solver *precond_data);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetLogging(HYPRE_Solver solver,
+                                        HYPRE_Int    logging);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetPrintLevel(HYPRE_Solver solver,
+                                           HYPRE_Int    print_level);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESGetNumIterations(HYPRE_Solver  solver,
+                                              HYPRE_Int    *num_iterations);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                          HYPRE_Real   *norm);
+
+/**
+ * Returns the residual.
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESGetResidual(HYPRE_Solver     solver,
+                                         HYPRE_ParVector *residual);
+
+/**@}*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name ParCSR BPCG Solver
+ *
+ * Block preconditioned conjugate gradient for several right-hand sides; see
+ * the generic BPCG interface in \ref KrylovSolvers.  The \e num_rhs vectors
+ * in \e b and \e x must share a partitioning.  The matrix is applied to the
+ * whole block with one multivector matvec, and so is BoomerAMG when it is the
+ * preconditioner; other preconditioners are applied one vector at a time.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRBPCGCreate(MPI_Comm      comm,
+                                 HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRBPCGDestroy(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRBPCGSetup(HYPRE_Solver        solver,
+                                HYPRE_ParCSRMatrix  A,
+                                HYPRE_Int           num_rhs,
+                                HYPRE_ParVector    *b,
+                                HYPRE_ParVector    *x);
+
+HYPRE_Int HYPRE_ParCSRBPCGSolve(HYPRE_Solver        solver,
+                                HYPRE_ParCSRMatrix  A,
+                                HYPRE_Int           num_rhs,
+                                HYPRE_ParVector    *b,
+                                HYPRE_ParVector    *x);
+
+HYPRE_Int HYPRE_ParCSRBPCGSetTol(HYPRE_Solver solver,
+                                 HYPRE_Real   tol);
+
+HYPRE_Int HYPRE_ParCSRBPCGSetAbsoluteTol(HYPRE_Solver solver,
+                                         HYPRE_Real   a_tol);
+
+HYPRE_Int HYPRE_ParCSRBPCGSetMaxIter(HYPRE_Solver solver,
+                                     HYPRE_Int    max_iter);
+
+HYPRE_Int HYPRE_ParCSRBPCGSetPrecond(HYPRE_Solver            solver,
+                                     HYPRE_PtrToParSolverFcn precond,
+                                     HYPRE_PtrToParSolverFcn precond_setup,
+                                     HYPRE_Solver            precond_solver);
+
+HYPRE_Int HYPRE_ParCSRBPCGGetPrecond(HYPRE_Solver  solver,
+                                     HYPRE_Solver *precond_data);
+
+HYPRE_Int HYPRE_ParCSRBPCGSetLogging(HYPRE_Solver solver,
+                                     HYPRE_Int    logging);
+
+HYPRE_Int HYPRE_ParCSRBPCGSetPrintLevel(HYPRE_Solver solver,
+                                        HYPRE_Int    print_level);
+
+HYPRE_Int HYPRE_ParCSRBPCGGetNumIterations(HYPRE_Solver  solver,
+                                           HYPRE_Int    *num_iterations);
+
+HYPRE_Int HYPRE_ParCSRBPCGGetConverged(HYPRE_Solver  solver,
+                                       HYPRE_Int    *converged);
+
+HYPRE_Int HYPRE_ParCSRBPCGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                       HYPRE_Real   *norm);
+
+/**@}*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name ParCSR BGMRES Solver
+ *
+ * Restarted block GMRES for several right-hand sides; see the generic BGMRES
+ * interface in \ref KrylovSolvers.  The \e num_rhs vectors in \e b and
+ * \e x must share a partitioning.  As for BPCG, the matrix and BoomerAMG
+ * are applied to the whole block at once.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRBGMRESCreate(MPI_Comm      comm,
+                                   HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRBGMRESDestroy(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRBGMRESSetup(HYPRE_Solver        solver,
+                                  HYPRE_ParCSRMatrix  A,
+                                  HYPRE_Int           num_rhs,
+                                  HYPRE_ParVector    *b,
+                                  HYPRE_ParVector    *x);
+
+HYPRE_Int HYPRE_ParCSRBGMRESSolve(HYPRE_Solver        solver,
+                                  HYPRE_ParCSRMatrix  A,
+                                  HYPRE_Int           num_rhs,
+                                  HYPRE_ParVector    *b,
+                                  HYPRE_ParVector    *x);
+
+HYPRE_Int HYPRE_ParCSRBGMRESSetKDim(HYPRE_Solver solver,
+                                    HYPRE_Int    k_dim);
+
+HYPRE_Int HYPRE_ParCSRBGMRESSetTol(HYPRE_Solver solver,
+                                   HYPRE_Real   tol);
+
+HYPRE_Int HYPRE_ParCSRBGMRESSetAbsoluteTol(HYPRE_Solver solver,
+                                           HYPRE_Real   a_tol);
+
+HYPRE_Int HYPRE_ParCSRBGMRESSetMaxIter(HYPRE_Solver solver,
+                                       HYPRE_Int    max_iter);
+
+HYPRE_Int HYPRE_ParCSRBGMRESSetPrecond(HYPRE_Solver            solver,
+                                       HYPRE_PtrToParSolverFcn precond,
+                                       HYPRE_PtrToParSolverFcn precond_setup,
+                                       HYPRE_Solver            precond_solver);
+
+HYPRE_Int HYPRE_ParCSRBGMRESGetPrecond(HYPRE_Solver  solver,
+                                       HYPRE_Solver *precond_data);
+
+HYPRE_Int HYPRE_ParCSRBGMRESSetLogging(HYPRE_Solver solver,
+                                       HYPRE_Int    logging);
+
+HYPRE_Int HYPRE_ParCSRBGMRESSetPrintLevel(HYPRE_Solver solver,
+                                          HYPRE_Int    print_level);
+
+HYPRE_Int HYPRE_ParCSRBGMRESGetNumIterations(HYPRE_Solver  solver,
+                                             HYPRE_Int    *num_iterations);
+
+HYPRE_Int HYPRE_ParCSRBGMRESGetConverged(HYPRE_Solver  solver,
+                                         HYPRE_Int    *converged);
+
+HYPRE_Int HYPRE_ParCSRBGMRESGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                         HYPRE_Real   *norm);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -2691,6 +2992,14 @@ HYPRE_Int HYPRE_ParCSRFlexGMRESSolve(HYPRE_Solver       solver,
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetKDim(HYPRE_Solver solver,
                                        HYPRE_Int    k_dim);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant: 0 (default) is modified
+ * Gram-Schmidt, 1 is classical Gram-Schmidt and 2 is classical Gram-Schmidt
+ * with reorthogonalization.  See HYPRE_GMRESSetCGS.
+ **/
+HYPRE_Int HYPRE_ParCSRFlexGMRESSetCGS(HYPRE_Solver solver,
+                                      HYPRE_Int    cgs);
+
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetTol(HYPRE_Solver solver,
                                       HYPRE_Real   tol);
 
@@ -2772,6 +3081,14 @@ HYPRE_Int HYPRE_ParCSRLGMRESSolve(HYPRE_Solver       solver,
 HYPRE_Int HYPRE_ParCSRLGMRESSetKDim(HYPRE_Solver solver,
                                     HYPRE_Int    k_dim);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant: 0 (default) is modified
+ * Gram-Schmidt, 1 is classical Gram-Schmidt and 2 is classical Gram-Schmidt
+ * with reorthogonalization.  See HYPRE_GMRESSetCGS.
+ **/
+HYPRE_Int HYPRE_ParCSRLGMRESSetCGS(HYPRE_Solver solver,
+                                   HYPRE_Int    cgs);
+
 HYPRE_Int HYPRE_ParCSRLGMRESSetAugDim(HYPRE_Solver solver,
                                       HYPRE_Int    aug_dim);
 
@@ -27,7 +27,8 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovCreateVector,
          hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
          hypre_ParKrylovMatvec, hypre_ParKrylovMatvecDestroy,
-         hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
+         hypre_ParKrylovInnerProd,
+         hypre_ParKrylovMultiInnerProd, hypre_ParKrylovCopyVector,
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
@@ -132,6 +133,17 @@ HYPRE_ParCSRPCGSetTwoNorm( HYPRE_Solver solver,
    return( HYPRE_PCGSetTwoNorm( solver, two_norm ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPCGSetVariant
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPCGSetVariant( HYPRE_Solver solver,
+                           HYPRE_Int    variant )
+{
+   return( HYPRE_PCGSetVariant( solver, variant ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRPCGSetRelChange
  *--------------------------------------------------------------------------*/
@@ -1880,7 +1880,8 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
                   hypre_ParKrylovMatvec,
                   hypre_ParKrylovMatvecDestroy,
-                  hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
+                  hypre_ParKrylovInnerProd,
+                  hypre_ParKrylovMultiInnerProd, hypre_ParKrylovCopyVector,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
@@ -1947,7 +1948,8 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
                   hypre_ParKrylovMatvec,
                   hypre_ParKrylovMatvecDestroy,
-                  hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
+                  hypre_ParKrylovInnerProd,
+                  hypre_ParKrylovMultiInnerProd, hypre_ParKrylovCopyVector,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
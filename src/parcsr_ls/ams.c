@@ -263,6 +263,8 @@ HYPRE_Int hypre_ParCSRMatrixFixZeroRows(hypre_ParCSRMatrix *A)
    /* a row will be considered zero if its l1 norm is less than eps */
    HYPRE_Real eps = 0.0; /* DBL_EPSILON * 1e+4; */
 
+   hypre_ParCSRMatrixSellDestroy(A);
+
    for (i = 0; i < num_rows; i++)
    {
       l1_norm = 0.0;
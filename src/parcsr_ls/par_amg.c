@@ -389,6 +389,11 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRtemp(amg_data)  = NULL;
    hypre_ParAMGDataPtemp(amg_data)  = NULL;
    hypre_ParAMGDataZtemp(amg_data)  = NULL;
+   hypre_ParAMGDataMVNumVectors(amg_data) = 0;
+   hypre_ParAMGDataMVNumLevels(amg_data)  = 0;
+   hypre_ParAMGDataFArrayMV(amg_data) = NULL;
+   hypre_ParAMGDataUArrayMV(amg_data) = NULL;
+   hypre_ParAMGDataVtempMV(amg_data)  = NULL;
    hypre_ParAMGDataFArray(amg_data) = NULL;
    hypre_ParAMGDataUArray(amg_data) = NULL;
    hypre_ParAMGDataDofFunc(amg_data) = NULL;
@@ -500,6 +505,8 @@ hypre_BoomerAMGDestroy( void *data )
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
+   hypre_BoomerAMGDestroyRAPPlans(amg_data);
+
 #ifdef HYPRE_USING_DSUPERLU
 //   if (hypre_ParAMGDataDSLUThreshold(amg_data) > 0)
    if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
@@ -664,6 +671,7 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataCFMarkerArray(amg_data)[0], HYPRE_MEMORY_HOST);
    }
    hypre_ParVectorDestroy(hypre_ParAMGDataVtemp(amg_data));
+   hypre_BoomerAMGMultiVectorDestroy(amg_data);
    hypre_TFree(hypre_ParAMGDataFArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataUArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataAArray(amg_data), HYPRE_MEMORY_HOST);
@@ -4554,6 +4562,38 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
   return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetMixedPrecision( void       *data,
+                                  HYPRE_Int   mixed_precision)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataMixedPrecision(amg_data) = mixed_precision;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetReuseRAP( void       *data,
+                            HYPRE_Int   reuse_rap)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataReuseRAP(amg_data) = reuse_rap;
+  return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
@@ -169,6 +169,13 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* row-major multivectors for solving with several vectors at once */
+   HYPRE_Int          mv_num_vectors;
+   HYPRE_Int          mv_num_levels;
+   hypre_ParVector  **F_array_mv;
+   hypre_ParVector  **U_array_mv;
+   hypre_ParVector   *Vtemp_mv;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int          num_samples; /* number of sample vectors */
@@ -241,6 +248,13 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* store coarse operators and transfer operators in single precision */
+   HYPRE_Int mixed_precision;
+
+   /* keep the plans of the Galerkin products for numeric-only re-setups */
+   HYPRE_Int             reuse_rap;
+   hypre_ParCSRRAPPlan **rap_plan_array;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -413,6 +427,13 @@ typedef struct
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
 
+/* multivector solve data */
+#define hypre_ParAMGDataMVNumVectors(amg_data) ((amg_data)->mv_num_vectors)
+#define hypre_ParAMGDataMVNumLevels(amg_data) ((amg_data)->mv_num_levels)
+#define hypre_ParAMGDataFArrayMV(amg_data) ((amg_data)->F_array_mv)
+#define hypre_ParAMGDataUArrayMV(amg_data) ((amg_data)->U_array_mv)
+#define hypre_ParAMGDataVtempMV(amg_data) ((amg_data)->Vtemp_mv)
+
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
 #define hypre_ParAMGDataNumSamples(amg_data) ((amg_data)->num_samples)
@@ -490,6 +511,9 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataReuseRAP(amg_data) ((amg_data)->reuse_rap)
+#define hypre_ParAMGDataRAPPlanArray(amg_data) ((amg_data)->rap_plan_array)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -0,0 +1,442 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Numeric-only re-setup of BoomerAMG hierarchies
+ *
+ * hypre_BoomerAMGSetupUpdate keeps the coarsening, the interpolation
+ * operators and the sparsity patterns of a previous hypre_BoomerAMGSetup and
+ * only recomputes what depends on the values of the fine matrix: the values
+ * of the coarse operators, the l1 norms and Chebyshev data of the
+ * relaxations, the ILU smoothers and the coarsest-level Gaussian elimination.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGDestroyRAPPlans
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGDestroyRAPPlans( void *data )
+{
+   hypre_ParAMGData     *amg_data       = (hypre_ParAMGData*) data;
+   hypre_ParCSRRAPPlan **rap_plan_array = hypre_ParAMGDataRAPPlanArray(amg_data);
+   HYPRE_Int             num_levels     = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int             level;
+
+   if (rap_plan_array)
+   {
+      for (level = 0; level < num_levels - 1; level++)
+      {
+         hypre_ParCSRRAPPlanDestroy(rap_plan_array[level]);
+      }
+      hypre_TFree(rap_plan_array, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPPlanArray(amg_data) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRecomputeCoarseOperators
+ *
+ * Recomputes the values of the coarse operators A_array[1..num_levels-1]
+ * from the current values of A_array[0], keeping interpolation and the
+ * sparsity patterns of the coarse operators. Needs a setup done with
+ * hypre_BoomerAMGSetReuseRAP, which kept one plan per Galerkin product.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRecomputeCoarseOperators( void *data )
+{
+   hypre_ParAMGData     *amg_data       = (hypre_ParAMGData*) data;
+   hypre_ParCSRRAPPlan **rap_plan_array = hypre_ParAMGDataRAPPlanArray(amg_data);
+   hypre_ParCSRMatrix  **A_array        = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int             num_levels     = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix   *A_H;
+   HYPRE_Int             level;
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if (!rap_plan_array || !rap_plan_array[level])
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "No reusable coarse operator for this level; use a full setup\n");
+         return hypre_error_flag;
+      }
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      A_H = A_array[level + 1];
+
+      hypre_ParCSRRAPPlanCompute(rap_plan_array[level], A_array[level], A_H);
+      if (hypre_error_flag)
+      {
+         return hypre_error_flag;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGLevelIsGalerkin
+ *
+ * Whether the setup built A_array[level+1] as the Galerkin product
+ * P^T A_array[level] P (same tests as hypre_BoomerAMGSetup).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGLevelIsGalerkin( hypre_ParAMGData *amg_data,
+                                HYPRE_Int         level )
+{
+   HYPRE_Int   nongalerk_num_tol = hypre_ParAMGDataNonGalerkNumTol(amg_data);
+   HYPRE_Real *nongalerk_tol     = hypre_ParAMGDataNonGalerkTol(amg_data);
+   HYPRE_Real *nongal_tol_array  = hypre_ParAMGDataNonGalTolArray(amg_data);
+   HYPRE_Real  nongalerk_tol_l   = 0.0;
+   HYPRE_Int   l;
+
+   if (hypre_ParAMGDataRestriction(amg_data))
+   {
+      return 0;
+   }
+
+   /* the non-Galerkin tolerance of a level carries over to the next ones */
+   for (l = 0; l <= level; l++)
+   {
+      if (l < nongalerk_num_tol)
+      {
+         nongalerk_tol_l = nongalerk_tol[l];
+      }
+      if (nongal_tol_array)
+      {
+         nongalerk_tol_l = nongal_tol_array[l];
+      }
+   }
+
+   return (nongalerk_tol_l <= 0.0);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMakeDoublePrecision
+ *
+ * Gives a matrix stored in single precision back a (zeroed) array of values
+ * in HYPRE_Complex, so that it can be recomputed.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGMakeDoublePrecision( hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrix *blocks[2];
+   HYPRE_Int        i;
+
+   blocks[0] = hypre_ParCSRMatrixDiag(A);
+   blocks[1] = hypre_ParCSRMatrixOffd(A);
+
+   for (i = 0; i < 2; i++)
+   {
+      if (hypre_CSRMatrixDataSp(blocks[i]))
+      {
+         hypre_TFree(hypre_CSRMatrixDataSp(blocks[i]), HYPRE_MEMORY_HOST);
+         hypre_CSRMatrixData(blocks[i]) =
+            hypre_CTAlloc(HYPRE_Complex, hypre_CSRMatrixNumNonzeros(blocks[i]), HYPRE_MEMORY_HOST);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGL1NormOption
+ *
+ * Option of hypre_ParCSRComputeL1Norms used by hypre_BoomerAMGSetup for the
+ * relaxation of a level, and whether it was restricted by the CF marker.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGL1NormOption( hypre_ParAMGData *amg_data,
+                             HYPRE_Int         level,
+                             HYPRE_Int        *use_cf_ptr )
+{
+   HYPRE_Int *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int  num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int  relax_order     = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Int  coarsest        = (level == num_levels - 1);
+   HYPRE_Int  rt1 = grid_relax_type[1], rt2 = grid_relax_type[2], rt3 = grid_relax_type[3];
+
+   *use_cf_ptr = 0;
+
+   /* later choices of the setup override earlier ones */
+   if (rt1 == 7 || rt2 == 7 || (coarsest && rt3 == 7))
+   {
+      return 5;
+   }
+
+   *use_cf_ptr = relax_order && !coarsest;
+   if ((!coarsest && (rt1 == 18 || rt2 == 18)) || (coarsest && rt3 == 18))
+   {
+      return 1;
+   }
+
+   return 4;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupUpdateSmoothers
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGSetupUpdateSmoothers( hypre_ParAMGData *amg_data )
+{
+   hypre_ParCSRMatrix **A_array           = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParVector    **F_array           = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector    **U_array           = hypre_ParAMGDataUArray(amg_data);
+   HYPRE_Int          **CF_marker_array   = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int            num_levels        = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           *grid_relax_type   = hypre_ParAMGDataGridRelaxType(amg_data);
+   hypre_Vector       **l1_norms          = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Real         **cheby_coefs       = hypre_ParAMGDataChebyCoefs(amg_data);
+   HYPRE_Real         **cheby_ds          = hypre_ParAMGDataChebyDS(amg_data);
+   HYPRE_Solver        *smoother          = hypre_ParAMGDataSmoother(amg_data);
+   HYPRE_Int            smooth_type       = hypre_ParAMGDataSmoothType(amg_data);
+   HYPRE_Int            smooth_num_levels = hypre_ParAMGDataSmoothNumLevels(amg_data);
+   HYPRE_Int            j;
+
+   for (j = 0; j < num_levels; j++)
+   {
+      if (l1_norms && l1_norms[j])
+      {
+         HYPRE_Real *l1_norm_data = NULL;
+         HYPRE_Int   use_cf;
+         HYPRE_Int   option = hypre_BoomerAMGL1NormOption(amg_data, j, &use_cf);
+
+         hypre_ParCSRComputeL1Norms(A_array[j], option, use_cf ? CF_marker_array[j] : NULL,
+                                    &l1_norm_data);
+         hypre_SeqVectorDestroy(l1_norms[j]);
+         l1_norms[j] = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[j]));
+         hypre_VectorData(l1_norms[j]) = l1_norm_data;
+         hypre_SeqVectorInitialize_v2(l1_norms[j], hypre_ParCSRMatrixMemoryLocation(A_array[j]));
+      }
+
+      if (cheby_coefs && cheby_coefs[j])
+      {
+         HYPRE_Int   scale          = hypre_ParAMGDataChebyScale(amg_data);
+         HYPRE_Int   variant        = hypre_ParAMGDataChebyVariant(amg_data);
+         HYPRE_Int   cheby_order    = hypre_ParAMGDataChebyOrder(amg_data);
+         HYPRE_Int   cheby_eig_est  = hypre_ParAMGDataChebyEigEst(amg_data);
+         HYPRE_Real  cheby_fraction = hypre_ParAMGDataChebyFraction(amg_data);
+         HYPRE_Real  max_eig, min_eig = 0;
+
+         if (cheby_eig_est)
+         {
+            hypre_ParCSRMaxEigEstimateCG(A_array[j], scale, cheby_eig_est, &max_eig, &min_eig);
+         }
+         else
+         {
+            hypre_ParCSRMaxEigEstimate(A_array[j], scale, &max_eig);
+         }
+         hypre_ParAMGDataMaxEigEst(amg_data)[j] = max_eig;
+         hypre_ParAMGDataMinEigEst(amg_data)[j] = min_eig;
+
+         hypre_TFree(cheby_coefs[j], HYPRE_MEMORY_HOST);
+         hypre_TFree(cheby_ds[j], HYPRE_MEMORY_HOST);
+         hypre_ParCSRRelax_Cheby_Setup(A_array[j], max_eig, min_eig, cheby_fraction, cheby_order,
+                                       scale, variant, &cheby_coefs[j], &cheby_ds[j]);
+      }
+
+      if ((smooth_type == 5 || smooth_type == 15) && smooth_num_levels > j)
+      {
+         HYPRE_ILUDestroy(smoother[j]);
+         HYPRE_ILUCreate(&smoother[j]);
+         HYPRE_ILUSetType(smoother[j], hypre_ParAMGDataILUType(amg_data));
+         HYPRE_ILUSetLocalReordering(smoother[j], hypre_ParAMGDataILULocalReordering(amg_data));
+         HYPRE_ILUSetMaxIter(smoother[j], hypre_ParAMGDataILUMaxIter(amg_data));
+         HYPRE_ILUSetTol(smoother[j], 0.);
+         HYPRE_ILUSetDropThreshold(smoother[j], hypre_ParAMGDataILUDroptol(amg_data));
+         HYPRE_ILUSetLogging(smoother[j], 0);
+         HYPRE_ILUSetPrintLevel(smoother[j], 0);
+         HYPRE_ILUSetLevelOfFill(smoother[j], hypre_ParAMGDataILULevel(amg_data));
+         HYPRE_ILUSetMaxNnzPerRow(smoother[j], hypre_ParAMGDataILUMaxRowNnz(amg_data));
+         HYPRE_ILUSetup(smoother[j],
+                        (HYPRE_ParCSRMatrix) A_array[j],
+                        (HYPRE_ParVector) F_array[j],
+                        (HYPRE_ParVector) U_array[j]);
+      }
+   }
+
+   /* Gaussian elimination on the coarsest level */
+   if ( hypre_ParAMGDataGSSetup(amg_data) &&
+        (grid_relax_type[3] == 9 || grid_relax_type[3] == 99 || grid_relax_type[3] == 199) )
+   {
+      MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
+
+      hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataAMat(amg_data)     = NULL;
+      hypre_ParAMGDataAInv(amg_data)     = NULL;
+      hypre_ParAMGDataBVec(amg_data)     = NULL;
+      hypre_ParAMGDataCommInfo(amg_data) = NULL;
+      if (new_comm != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&new_comm);
+         hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
+      }
+
+      hypre_GaussElimSetup(amg_data, num_levels - 1, grid_relax_type[3]);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupUpdate
+ *
+ * Value-only re-setup for a matrix A with the sparsity pattern (and offd
+ * column map) of the matrix of the last hypre_BoomerAMGSetup. Coarse grids,
+ * interpolation, relaxation weights and the sparsity patterns of the coarse
+ * operators are kept. Plans of the Galerkin products that the setup did not
+ * keep (see hypre_BoomerAMGSetReuseRAP) are built here from the current P.
+ * Hierarchies that need more than that (additive cycles, non-Galerkin or
+ * non-P^T restriction, Schwarz, Euclid, ParaSails, Pilut or CG smoothers,
+ * redundant coarse solves) are refused; they need a full setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupUpdate( void               *amg_vdata,
+                            hypre_ParCSRMatrix *A )
+{
+   hypre_ParAMGData     *amg_data          = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix  **A_array           = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array           = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRRAPPlan **rap_plan_array    = hypre_ParAMGDataRAPPlanArray(amg_data);
+   HYPRE_Int             num_levels        = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            *grid_relax_type   = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int             smooth_type       = hypre_ParAMGDataSmoothType(amg_data);
+   HYPRE_Int             smooth_num_levels = hypre_ParAMGDataSmoothNumLevels(amg_data);
+   HYPRE_Int            *is_single         = NULL;
+   HYPRE_Int             level;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (!A_array || num_levels < 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "BoomerAMG setup update needs a previous setup\n");
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   if ( num_levels > 1 &&
+        hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A)) !=
+        hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(P_array[0])) )
+   {
+      hypre_error_in_arg(2);
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Refuse everything that is not recomputed here, before touching data
+    *-----------------------------------------------------------------------*/
+
+   if ( hypre_ParAMGDataBlockMode(amg_data) ||
+        hypre_ParAMGDataCoarseSolver(amg_data) ||
+#ifdef HYPRE_USING_DSUPERLU
+        hypre_ParAMGDataDSLUSolver(amg_data) ||
+#endif
+        (hypre_ParAMGDataAdditive(amg_data) > -1 && hypre_ParAMGDataAdditive(amg_data) < num_levels) ||
+        (hypre_ParAMGDataMultAdditive(amg_data) > -1 && hypre_ParAMGDataMultAdditive(amg_data) < num_levels) ||
+        (hypre_ParAMGDataSimple(amg_data) > -1 && hypre_ParAMGDataSimple(amg_data) < num_levels) ||
+        (smooth_num_levels > 0 && smooth_type != 5 && smooth_type != 15) ||
+        grid_relax_type[1] == 15 || grid_relax_type[2] == 15 || grid_relax_type[3] == 15 )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "This AMG hierarchy needs a full setup\n");
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "BoomerAMG setup update is only available on the host\n");
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if ( !(rap_plan_array && rap_plan_array[level]) &&
+           (!hypre_BoomerAMGLevelIsGalerkin(amg_data, level) ||
+            hypre_CSRMatrixDataSp(hypre_ParCSRMatrixDiag(P_array[level]))) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Coarse operators cannot be recomputed; use a full setup or SetReuseRAP\n");
+         HYPRE_ANNOTATE_FUNC_END;
+         return hypre_error_flag;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * New fine matrix and coarse operators
+    *-----------------------------------------------------------------------*/
+
+   A_array[0] = A;
+
+   /* the values of A may have been changed in place since its SELL-C-sigma
+      shadow was built */
+   hypre_ParCSRMatrixSellDestroy(A);
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+
+   if (num_levels > 1 && !rap_plan_array)
+   {
+      rap_plan_array = hypre_CTAlloc(hypre_ParCSRRAPPlan*, num_levels - 1, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPPlanArray(amg_data) = rap_plan_array;
+   }
+
+   is_single = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+   for (level = 1; level < num_levels; level++)
+   {
+      is_single[level] = (hypre_CSRMatrixDataSp(hypre_ParCSRMatrixDiag(A_array[level])) != NULL);
+      hypre_BoomerAMGMakeDoublePrecision(A_array[level]);
+
+      if (!rap_plan_array[level - 1])
+      {
+         rap_plan_array[level - 1] = hypre_ParCSRRAPPlanCreate(A_array[level - 1], P_array[level - 1],
+                                                               A_array[level]);
+      }
+   }
+
+   hypre_BoomerAMGRecomputeCoarseOperators(amg_data);
+
+   /*-----------------------------------------------------------------------
+    * Smoother data, then back to single precision where it was used
+    *-----------------------------------------------------------------------*/
+
+   if (!hypre_error_flag)
+   {
+      hypre_BoomerAMGSetupUpdateSmoothers(amg_data);
+   }
+
+   for (level = 1; level < num_levels; level++)
+   {
+      if (is_single[level])
+      {
+         hypre_ParCSRMatrixConvertToSinglePrecision(A_array[level]);
+      }
+   }
+   hypre_TFree(is_single, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -102,6 +102,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_ParCSRMatrix  *P1;
    hypre_ParCSRMatrix  *P2;
    hypre_ParCSRMatrix  *Pnew = NULL;
+   hypre_ParCSRRAPPlan **rap_plan_array = NULL;
+   HYPRE_Int            rap_reusable;
    HYPRE_Real          *SmoothVecs = NULL;
    hypre_Vector       **l1_norms = NULL;
    HYPRE_Real         **cheby_ds = NULL;
@@ -266,6 +268,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    if (num_procs == 1) seq_threshold = 0;
    if (setup_type == 0) return hypre_error_flag;
 
+   /* plans of a previous setup belong to its hierarchy */
+   hypre_BoomerAMGDestroyRAPPlans(amg_data);
+
    S = NULL;
 
    A_array = hypre_ParAMGDataAArray(amg_data);
@@ -455,6 +460,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
          hypre_ParAMGDataZtemp(amg_data) = NULL;
       }
+      hypre_BoomerAMGMultiVectorDestroy(amg_data);
 
       if (hypre_ParAMGDataACoarse(amg_data))
       {
@@ -606,6 +612,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       P_array = hypre_CTAlloc(hypre_ParCSRMatrix*, max_levels-1, HYPRE_MEMORY_HOST);
    if (P_block_array == NULL && max_levels > 1)
       P_block_array = hypre_CTAlloc(hypre_ParCSRBlockMatrix*, max_levels-1, HYPRE_MEMORY_HOST);
+   if (hypre_ParAMGDataReuseRAP(amg_data) && max_levels > 1)
+      rap_plan_array = hypre_CTAlloc(hypre_ParCSRRAPPlan*, max_levels-1, HYPRE_MEMORY_HOST);
 
    /* RL: if retri_type != 0, R != P^T, allocate R matrices */
    if (restri_type)
@@ -694,6 +702,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_ParAMGDataDofFuncArray(amg_data) = dof_func_array;
    hypre_ParAMGDataAArray(amg_data) = A_array;
    hypre_ParAMGDataPArray(amg_data) = P_array;
+   hypre_ParAMGDataRAPPlanArray(amg_data) = rap_plan_array;
 
    /* RL: if R != P^T */
    if (restri_type)
@@ -955,6 +964,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Get the Strength Matrix ****/
 
+         HYPRE_ANNOTATE_REGION_BEGIN("strength");
+
          if (hypre_ParAMGDataGSMG(amg_data) == 0)
          {
             if (nodal) /* if we are solving systems and
@@ -1019,6 +1030,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                             num_functions, dof_func_array[level], &S);
          }
 
+         HYPRE_ANNOTATE_REGION_END("strength");
+         HYPRE_ANNOTATE_REGION_BEGIN("coarsening");
+
          /* Allocate CF_marker for the current level */
          CF_marker_array[level] = hypre_CTAlloc(HYPRE_Int, local_num_vars, HYPRE_MEMORY_HOST);
          CF_marker = CF_marker_array[level];
@@ -1446,6 +1460,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   Sabs = NULL;
                }
 
+               HYPRE_ANNOTATE_REGION_END("coarsening");
+               HYPRE_ANNOTATE_MGLEVEL_END(level);
+
                break;
             }
 
@@ -1470,11 +1487,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   Sabs = NULL;
                }
 
+               HYPRE_ANNOTATE_REGION_END("coarsening");
+               HYPRE_ANNOTATE_MGLEVEL_END(level);
+
                break;
             }
          }
 
          /*****xxxxxxxxxxxxx changes for min_coarse_size  end */
+         HYPRE_ANNOTATE_REGION_END("coarsening");
+         HYPRE_ANNOTATE_REGION_BEGIN("interpolation");
+
          if (level < agg_num_levels)
          {
             if (nodal == 0)
@@ -2188,6 +2211,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             hypre_ParVectorDestroy(U_array[level]);
          }
 
+         HYPRE_ANNOTATE_REGION_END("interpolation");
+         HYPRE_ANNOTATE_MGLEVEL_END(level);
+
          break;
       }
       if (level < agg_num_levels && coarse_size < min_coarse_size)
@@ -2204,6 +2230,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          coarse_size = fine_size;
 
+         HYPRE_ANNOTATE_REGION_END("interpolation");
+         HYPRE_ANNOTATE_MGLEVEL_END(level);
+
          break;
       }
 
@@ -2578,12 +2607,18 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          fflush(NULL);
       }
 
+      HYPRE_ANNOTATE_REGION_END("interpolation");
+
       /*-------------------------------------------------------------
        * Build coarse-grid operator, A_array[level+1] by R*A*P
        *--------------------------------------------------------------*/
 
+      HYPRE_ANNOTATE_REGION_BEGIN("RAP");
+
       if (debug_flag==1) wall_time = time_getWallclockSeconds();
 
+      rap_reusable = 0;
+
       if (block_mode)
       {
 
@@ -2698,10 +2733,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
             /* Delete AP */
             hypre_ParCSRMatrixDestroy(Q);
+            rap_reusable = 1;
          }
          else
          {
             /* Compute standard Galerkin coarse-grid product */
+            rap_reusable = 1;
             if (hypre_ParAMGDataModularizedMatMat(amg_data))
             {
                A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
@@ -2717,6 +2754,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             {
                hypre_ParCSRMatrixDestroy(P);
                P_array[level] = Pnew;
+               rap_reusable = 0;
             }
          }
       }
@@ -2729,6 +2767,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          fflush(NULL);
       }
 
+      HYPRE_ANNOTATE_REGION_END("RAP");
       HYPRE_ANNOTATE_MGLEVEL_END(level);
       ++level;
       HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
@@ -2750,6 +2789,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             hypre_ParCSRMatrixSetDNumNonzeros(A_H);
          }
          A_array[level] = A_H;
+
+         /* keep the symbolic part of P^T A P for numeric-only re-setups */
+         if (rap_plan_array && rap_reusable &&
+             hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A_H)) == hypre_MEMORY_HOST)
+         {
+            rap_plan_array[level-1] = hypre_ParCSRRAPPlanCreate(A_array[level-1], P_array[level-1], A_H);
+         }
       }
 
       size = ((HYPRE_Real) fine_size )*.75;
@@ -2771,6 +2817,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
+   HYPRE_ANNOTATE_REGION_BEGIN("coarse solve setup");
+
    /* redundant coarse grid solve */
    if ((seq_threshold >= coarse_threshold) &&
        (coarse_size > (HYPRE_BigInt) coarse_threshold) &&
@@ -2846,6 +2894,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    }
 
+   HYPRE_ANNOTATE_REGION_END("coarse solve setup");
+
    /*-----------------------------------------------------------------------
     * enter all the stuff created, A[level], P[level], CF_marker[level],
     * for levels 1 through coarsest, into amg_data data structure
@@ -2863,6 +2913,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
     * Setup of special smoothers when needed
     *-----------------------------------------------------------------------*/
 
+   HYPRE_ANNOTATE_REGION_BEGIN("smoother setup");
+
    if (addlvl > -1 ||
        grid_relax_type[1] ==  7 || grid_relax_type[2] ==  7 || grid_relax_type[3] ==  7 ||
        grid_relax_type[1] ==  8 || grid_relax_type[2] ==  8 || grid_relax_type[3] ==  8 ||
@@ -3188,6 +3240,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    } /* end of levels loop */
 
+   HYPRE_ANNOTATE_REGION_END("smoother setup");
+
    if ( amg_logging > 1 ) {
 
       Residual_array = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[0]),
@@ -3394,6 +3448,73 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 }
 #endif
 
+   /*-----------------------------------------------------------------------
+    * Mixed precision: store P, R and the coarse A in single precision.
+    * A coarse A is converted only if all smoothers applied to it work on
+    * single precision values; the finest A is left to the outer solver.
+    *-----------------------------------------------------------------------*/
+
+#if !defined(HYPRE_COMPLEX)
+   if ( hypre_ParAMGDataMixedPrecision(amg_data) && !block_mode && addlvl == num_levels &&
+        hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) == hypre_MEMORY_HOST )
+   {
+      hypre_ParCSRMatrix **RT_array = hypre_ParAMGDataRArray(amg_data);
+      HYPRE_Int            sp_relax[2];
+
+      for (j = 1; j < 3; j++)
+      {
+         switch (grid_relax_type[j])
+         {
+            case 0: case 3: case 4: case 6: case 7: case 8:
+            case 13: case 14: case 16: case 18:
+               sp_relax[j - 1] = 1;
+               break;
+            default:
+               sp_relax[j - 1] = 0;
+         }
+      }
+
+      for (level = 0; level < num_levels - 1; level++)
+      {
+         hypre_ParCSRMatrixConvertToSinglePrecision(P_array[level]);
+         if (RT_array[level] != P_array[level])
+         {
+            hypre_ParCSRMatrixConvertToSinglePrecision(RT_array[level]);
+         }
+      }
+
+      for (level = hypre_max(smooth_num_levels, 1); level < num_levels; level++)
+      {
+         HYPRE_Int convert;
+
+         if (level < num_levels - 1)
+         {
+            convert = sp_relax[0] && sp_relax[1];
+         }
+         else
+         {
+            switch (grid_relax_type[3])
+            {
+               case 0: case 3: case 4: case 6: case 7: case 8:
+               case 13: case 14: case 16: case 18:
+                  convert = 1;
+                  break;
+               case 9: case 99: case 199:
+                  convert = hypre_ParAMGDataGSSetup(amg_data);
+                  break;
+               default:
+                  convert = 0;
+            }
+         }
+
+         if (convert)
+         {
+            hypre_ParCSRMatrixConvertToSinglePrecision(A_array[level]);
+         }
+      }
+   }
+#endif
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return(hypre_error_flag);
@@ -14,6 +14,371 @@
 #include "_hypre_parcsr_ls.h"
 #include "par_amg.h"
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorDestroy
+ *
+ * Frees the level multivectors cached by hypre_BoomerAMGSolveMultiVector.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMultiVectorDestroy( void *amg_vdata )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int         j;
+
+   if (hypre_ParAMGDataFArrayMV(amg_data))
+   {
+      for (j = 0; j < hypre_ParAMGDataMVNumLevels(amg_data); j++)
+      {
+         hypre_ParVectorDestroy(hypre_ParAMGDataFArrayMV(amg_data)[j]);
+         hypre_ParVectorDestroy(hypre_ParAMGDataUArrayMV(amg_data)[j]);
+      }
+      hypre_TFree(hypre_ParAMGDataFArrayMV(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataUArrayMV(amg_data), HYPRE_MEMORY_HOST);
+   }
+   hypre_ParVectorDestroy(hypre_ParAMGDataVtempMV(amg_data));
+
+   hypre_ParAMGDataFArrayMV(amg_data)     = NULL;
+   hypre_ParAMGDataUArrayMV(amg_data)     = NULL;
+   hypre_ParAMGDataVtempMV(amg_data)      = NULL;
+   hypre_ParAMGDataMVNumVectors(amg_data) = 0;
+   hypre_ParAMGDataMVNumLevels(amg_data)  = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorCreate
+ *
+ * Creates a multivector with row-major (interleaved) storage and the
+ * partitioning of x.
+ *--------------------------------------------------------------------*/
+
+static hypre_ParVector *
+hypre_BoomerAMGMultiVectorCreate( hypre_ParVector *x,
+                                  HYPRE_Int        num_vectors )
+{
+   hypre_ParVector *y;
+
+   y = hypre_ParMultiVectorCreate(hypre_ParVectorComm(x),
+                                  hypre_ParVectorGlobalSize(x),
+                                  hypre_ParVectorPartitioning(x),
+                                  num_vectors);
+   hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(y)) = 1;
+   hypre_ParVectorInitialize_v2(y, HYPRE_MEMORY_HOST);
+   hypre_ParVectorSetPartitioningOwner(y, 0);
+
+   return y;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorCopy
+ *
+ * y = x for (multi)vectors that may use different storage methods.
+ * Copies vector v_x of x into vector v_y of y if num_vectors is 1.
+ *--------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGMultiVectorCopy( hypre_ParVector *x,
+                                HYPRE_Int        v_x,
+                                hypre_ParVector *y,
+                                HYPRE_Int        v_y,
+                                HYPRE_Int        num_vectors )
+{
+   hypre_Vector  *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector  *y_local = hypre_ParVectorLocalVector(y);
+   HYPRE_Complex *x_data  = hypre_VectorData(x_local) + v_x * hypre_VectorVectorStride(x_local);
+   HYPRE_Complex *y_data  = hypre_VectorData(y_local) + v_y * hypre_VectorVectorStride(y_local);
+   HYPRE_Int      vs_x    = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      is_x    = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      vs_y    = hypre_VectorVectorStride(y_local);
+   HYPRE_Int      is_y    = hypre_VectorIndexStride(y_local);
+   HYPRE_Int      size    = hypre_VectorSize(x_local);
+   HYPRE_Int      i, v;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,v) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      for (v = 0; v < num_vectors; v++)
+      {
+         y_data[v*vs_y + i*is_y] = x_data[v*vs_x + i*is_x];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorSupported
+ *
+ * Returns 1 if the cycle can run on several vectors at once, i.e., for
+ * standard multiplicative cycles on the host that only use the Jacobi
+ * and hybrid Gauss-Seidel smoothers supported by
+ * hypre_BoomerAMGRelaxMultiVector and Gaussian elimination.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiVectorSupported( hypre_ParAMGData   *amg_data,
+                                     hypre_ParCSRMatrix *A )
+{
+   HYPRE_Int  num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int  additive        = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int  mult_additive   = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int  simple          = hypre_ParAMGDataSimple(amg_data);
+   HYPRE_Int  relax_type, j;
+
+   if ( hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+        hypre_ParAMGDataBlockMode(amg_data) ||
+        hypre_ParAMGDataMixedPrecision(amg_data) ||
+        hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+        hypre_ParAMGDataParticipate(amg_data) ||
+        (additive      >= 0 && additive      < num_levels) ||
+        (mult_additive >= 0 && mult_additive < num_levels) ||
+        (simple        >= 0 && simple        < num_levels) )
+   {
+      return 0;
+   }
+
+#ifdef HYPRE_USING_DSUPERLU
+   if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
+   {
+      return 0;
+   }
+#endif
+
+   for (j = 1; j < 4; j++)
+   {
+      if (num_levels == 1)
+      {
+         relax_type = hypre_ParAMGDataUserRelaxType(amg_data);
+         relax_type = relax_type == -1 ? 6 : relax_type;
+      }
+      else
+      {
+         relax_type = grid_relax_type[j];
+      }
+
+      switch (relax_type)
+      {
+         case 0: case 3: case 4: case 6: case 7: case 8: case 13: case 14: case 18:
+            break;
+
+         case 9: case 99: case 199:
+            if (j == 3 && num_levels > 1)
+            {
+               break;
+            }
+            return 0;
+
+         default:
+            return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVectorSetup
+ *
+ * (Re)creates the coarse level multivectors and the multivector Vtemp if
+ * the number of vectors or levels changed.
+ *--------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGMultiVectorSetup( hypre_ParAMGData *amg_data,
+                                 HYPRE_Int         num_vectors )
+{
+   HYPRE_Int          num_levels  = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParVector  **F_array     = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector  **U_array     = hypre_ParAMGDataUArray(amg_data);
+   hypre_ParVector   *Vtemp       = hypre_ParAMGDataVtemp(amg_data);
+   HYPRE_Int          j;
+
+   if ( hypre_ParAMGDataMVNumVectors(amg_data) == num_vectors &&
+        hypre_ParAMGDataMVNumLevels(amg_data)  == num_levels )
+   {
+      return;
+   }
+
+   hypre_BoomerAMGMultiVectorDestroy(amg_data);
+
+   hypre_ParAMGDataFArrayMV(amg_data) = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataUArrayMV(amg_data) = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   for (j = 1; j < num_levels; j++)
+   {
+      hypre_ParAMGDataFArrayMV(amg_data)[j] = hypre_BoomerAMGMultiVectorCreate(F_array[j], num_vectors);
+      hypre_ParAMGDataUArrayMV(amg_data)[j] = hypre_BoomerAMGMultiVectorCreate(U_array[j], num_vectors);
+   }
+   hypre_ParAMGDataVtempMV(amg_data)     = hypre_BoomerAMGMultiVectorCreate(Vtemp, num_vectors);
+   hypre_ParAMGDataMVNumVectors(amg_data) = num_vectors;
+   hypre_ParAMGDataMVNumLevels(amg_data)  = num_levels;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveMultiVector
+ *
+ * Solves for all num_vectors vectors of the multivectors f and u at once.
+ * The cycle runs on row-major level multivectors, so every matvec,
+ * smoothing sweep and halo exchange serves all vectors. Convergence is
+ * tested on the Frobenius norm of the residual of all vectors. Setups
+ * not supported by the multivector cycle solve one vector at a time.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGSolveMultiVector( void               *amg_vdata,
+                                 hypre_ParCSRMatrix *A,
+                                 hypre_ParVector    *f,
+                                 hypre_ParVector    *u )
+{
+   hypre_ParAMGData  *amg_data    = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int          num_levels  = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int          num_vectors = hypre_ParVectorNumVectors(f);
+   hypre_ParVector  **F_array     = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector  **U_array     = hypre_ParAMGDataUArray(amg_data);
+   hypre_ParVector   *Vtemp       = hypre_ParAMGDataVtemp(amg_data);
+   hypre_ParVector  **F_array_mv, **U_array_mv;
+   hypre_ParVector   *f_v, *u_v;
+   HYPRE_Int          f_row_major, u_row_major;
+   HYPRE_Int          j;
+
+   f_row_major = hypre_VectorIndexStride(hypre_ParVectorLocalVector(f)) == num_vectors;
+   u_row_major = hypre_VectorIndexStride(hypre_ParVectorLocalVector(u)) == num_vectors;
+
+   if (!hypre_BoomerAMGMultiVectorSupported(amg_data, A))
+   {
+      f_v = hypre_ParVectorCreate(hypre_ParVectorComm(f), hypre_ParVectorGlobalSize(f),
+                                  hypre_ParVectorPartitioning(f));
+      hypre_ParVectorInitialize_v2(f_v, hypre_ParVectorMemoryLocation(f));
+      hypre_ParVectorSetPartitioningOwner(f_v, 0);
+      u_v = hypre_ParVectorCreate(hypre_ParVectorComm(u), hypre_ParVectorGlobalSize(u),
+                                  hypre_ParVectorPartitioning(u));
+      hypre_ParVectorInitialize_v2(u_v, hypre_ParVectorMemoryLocation(u));
+      hypre_ParVectorSetPartitioningOwner(u_v, 0);
+
+      for (j = 0; j < num_vectors; j++)
+      {
+         hypre_BoomerAMGMultiVectorCopy(f, j, f_v, 0, 1);
+         hypre_BoomerAMGMultiVectorCopy(u, j, u_v, 0, 1);
+         hypre_BoomerAMGSolve(amg_vdata, A, f_v, u_v);
+         hypre_BoomerAMGMultiVectorCopy(u_v, 0, u, j, 1);
+      }
+
+      F_array[0] = f;
+      U_array[0] = u;
+      hypre_ParVectorDestroy(f_v);
+      hypre_ParVectorDestroy(u_v);
+
+      return hypre_error_flag;
+   }
+
+   hypre_BoomerAMGMultiVectorSetup(amg_data, num_vectors);
+
+   /* the fine level works on f and u directly if they are row-major */
+   if (!f_row_major && !hypre_ParAMGDataFArrayMV(amg_data)[0])
+   {
+      hypre_ParAMGDataFArrayMV(amg_data)[0] = hypre_BoomerAMGMultiVectorCreate(f, num_vectors);
+   }
+   if (!u_row_major && !hypre_ParAMGDataUArrayMV(amg_data)[0])
+   {
+      hypre_ParAMGDataUArrayMV(amg_data)[0] = hypre_BoomerAMGMultiVectorCreate(u, num_vectors);
+   }
+
+   F_array_mv = hypre_TAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   U_array_mv = hypre_TAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   for (j = 1; j < num_levels; j++)
+   {
+      F_array_mv[j] = hypre_ParAMGDataFArrayMV(amg_data)[j];
+      U_array_mv[j] = hypre_ParAMGDataUArrayMV(amg_data)[j];
+   }
+   F_array_mv[0] = f_row_major ? f : hypre_ParAMGDataFArrayMV(amg_data)[0];
+   U_array_mv[0] = u_row_major ? u : hypre_ParAMGDataUArrayMV(amg_data)[0];
+
+   if (!f_row_major)
+   {
+      hypre_BoomerAMGMultiVectorCopy(f, 0, F_array_mv[0], 0, num_vectors);
+   }
+   if (!u_row_major)
+   {
+      hypre_BoomerAMGMultiVectorCopy(u, 0, U_array_mv[0], 0, num_vectors);
+   }
+
+   /* run the solve on the multivectors */
+   hypre_ParAMGDataFArray(amg_data) = F_array_mv;
+   hypre_ParAMGDataUArray(amg_data) = U_array_mv;
+   hypre_ParAMGDataVtemp(amg_data)  = hypre_ParAMGDataVtempMV(amg_data);
+
+   hypre_BoomerAMGSolve(amg_vdata, A, F_array_mv[0], U_array_mv[0]);
+
+   hypre_ParAMGDataFArray(amg_data) = F_array;
+   hypre_ParAMGDataUArray(amg_data) = U_array;
+   hypre_ParAMGDataVtemp(amg_data)  = Vtemp;
+   F_array[0] = f;
+   U_array[0] = u;
+
+   if (!u_row_major)
+   {
+      hypre_BoomerAMGMultiVectorCopy(U_array_mv[0], 0, u, 0, num_vectors);
+   }
+
+   hypre_TFree(F_array_mv, HYPRE_MEMORY_HOST);
+   hypre_TFree(U_array_mv, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveBlock
+ *
+ * Solves for the k single vectors f[j] and u[j] with one multivector
+ * solve.  The vectors are packed into the fine level multivectors, which
+ * are kept between calls, so that block Krylov methods can use BoomerAMG
+ * as a preconditioner without copying into a multivector of their own.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSolveBlock( void               *amg_vdata,
+                           hypre_ParCSRMatrix *A,
+                           HYPRE_Int           k,
+                           hypre_ParVector   **f,
+                           hypre_ParVector   **u )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParVector   *f_mv, *u_mv;
+   HYPRE_Int          j;
+
+   if ( k < 2 ||
+        hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(f[0])) != hypre_MEMORY_HOST ||
+        !hypre_BoomerAMGMultiVectorSupported(amg_data, A) )
+   {
+      for (j = 0; j < k; j++)
+      {
+         hypre_BoomerAMGSolve(amg_vdata, A, f[j], u[j]);
+      }
+
+      return hypre_error_flag;
+   }
+
+   hypre_BoomerAMGMultiVectorSetup(amg_data, k);
+   if (!hypre_ParAMGDataFArrayMV(amg_data)[0])
+   {
+      hypre_ParAMGDataFArrayMV(amg_data)[0] = hypre_BoomerAMGMultiVectorCreate(f[0], k);
+      hypre_ParAMGDataUArrayMV(amg_data)[0] = hypre_BoomerAMGMultiVectorCreate(u[0], k);
+   }
+   f_mv = hypre_ParAMGDataFArrayMV(amg_data)[0];
+   u_mv = hypre_ParAMGDataUArrayMV(amg_data)[0];
+
+   hypre_ParMultiVectorPack(k, f, f_mv);
+   hypre_ParMultiVectorPack(k, u, u_mv);
+
+   hypre_BoomerAMGSolve(amg_vdata, A, f_mv, u_mv);
+
+   hypre_ParMultiVectorUnpack(u_mv, k, u);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------
  * hypre_BoomerAMGSolve
  *--------------------------------------------------------------------*/
@@ -80,6 +445,14 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    hypre_ParVector  *Vtemp;
    hypre_ParVector  *Residual;
 
+   /* several vectors: cycle on the level multivectors unless Vtemp
+    * already is one, i.e., unless called from hypre_BoomerAMGSolveMultiVector */
+   if ( hypre_ParVectorNumVectors(f) > 1 &&
+        hypre_ParVectorNumVectors(hypre_ParAMGDataVtemp(amg_data)) != hypre_ParVectorNumVectors(f) )
+   {
+      return hypre_BoomerAMGSolveMultiVector(amg_vdata, A, f, u);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm,&my_id);
@@ -120,6 +493,12 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
         */
    Vtemp = hypre_ParAMGDataVtemp(amg_data);
 
+   /* the residual of several vectors is computed in the multivector Vtemp */
+   if ( hypre_ParVectorNumVectors(f) > 1 )
+   {
+      Residual = Vtemp;
+   }
+
    /*-----------------------------------------------------------------------
     *    Write the solver parameters
     *-----------------------------------------------------------------------*/
@@ -2133,8 +2133,8 @@ CF_marker, CF_marker_offd: initialize CF_marker
 
    num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-   int_buf_data = hypre_CTAlloc(HYPRE_Int,  hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends), HYPRE_MEMORY_HOST);
-   buf_data     = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends), HYPRE_MEMORY_HOST);
+   int_buf_data = hypre_CTAllocScratch(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
+   buf_data     = hypre_CTAllocScratch(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
    num_cols_offd = hypre_CSRMatrixNumCols(S_offd);
 
@@ -2156,11 +2156,11 @@ CF_marker, CF_marker_offd: initialize CF_marker
     * between 0 and 1.
     *----------------------------------------------------------*/
 
-   measure_array = hypre_CTAlloc(HYPRE_Real, num_variables + num_cols_offd, HYPRE_MEMORY_HOST);
+   measure_array = hypre_CTAllocScratch(HYPRE_Real, num_variables + num_cols_offd);
 
    /* first calculate the local part of the sums for the external nodes */
 #ifdef HYPRE_USING_OPENMP
-   HYPRE_Int *measure_array_temp = hypre_CTAlloc(HYPRE_Int,  num_variables + num_cols_offd, HYPRE_MEMORY_HOST);
+   HYPRE_Int *measure_array_temp = hypre_CTAllocScratch(HYPRE_Int, num_variables + num_cols_offd);
 
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
    for (i = 0; i < S_offd_i[num_variables]; i++)
@@ -2252,7 +2252,7 @@ CF_marker, CF_marker_offd: initialize CF_marker
    /* first the off-diagonal part of the graph array */
    if (num_cols_offd)
    {
-      graph_array_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+      graph_array_offd = hypre_CTAllocScratch(HYPRE_Int, num_cols_offd);
    }
    else
    {
@@ -2267,7 +2267,7 @@ CF_marker, CF_marker_offd: initialize CF_marker
    graph_offd_size = num_cols_offd;
 
    /* now the local part of the graph array, and the local CF_marker array */
-   graph_array = hypre_CTAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+   graph_array = hypre_CTAllocScratch(HYPRE_Int, num_variables);
 
    /* Allocate CF_marker if not done before */
    if (*CF_marker_ptr == NULL)
@@ -2338,7 +2338,7 @@ CF_marker, CF_marker_offd: initialize CF_marker
    /* now the off-diagonal part of CF_marker */
    if (num_cols_offd)
    {
-      CF_marker_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+      CF_marker_offd = hypre_CTAllocScratch(HYPRE_Int, num_cols_offd);
    }
    else
    {
@@ -2378,11 +2378,11 @@ CF_marker, CF_marker_offd: initialize CF_marker
    }
 
    /* graph_array2 */
-   HYPRE_Int *graph_array2 = hypre_CTAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+   HYPRE_Int *graph_array2 = hypre_CTAllocScratch(HYPRE_Int, num_variables);
    HYPRE_Int *graph_array_offd2 = NULL;
    if (num_cols_offd)
    {
-      graph_array_offd2 = hypre_CTAlloc(HYPRE_Int,  num_cols_offd, HYPRE_MEMORY_HOST);
+      graph_array_offd2 = hypre_CTAllocScratch(HYPRE_Int, num_cols_offd);
    }
 
    /*******************************************************************************
@@ -345,6 +345,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          l1_norms_level = NULL;
       }
 
+      HYPRE_ANNOTATE_REGION_BEGIN(cycle_param == 3 ? "coarse solve" : "relax");
+
       if (cycle_param == 3 && seq_cg)
       {
          hypre_seqAMGCycle(amg_data, level, F_array, U_array);
@@ -560,6 +562,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
                if (Solve_err_flag != 0)
                {
+                  HYPRE_ANNOTATE_REGION_END(cycle_param == 3 ? "coarse solve" : "relax");
                   HYPRE_ANNOTATE_MGLEVEL_END(level);
                   HYPRE_ANNOTATE_FUNC_END;
 
@@ -591,6 +594,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          }
       }
 
+      HYPRE_ANNOTATE_REGION_END(cycle_param == 3 ? "coarse solve" : "relax");
+
       /*------------------------------------------------------------------
        * Decrement the control counter and determine which grid to visit next
        *-----------------------------------------------------------------*/
@@ -610,6 +615,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          fine_grid = level;
          coarse_grid = level + 1;
 
+         HYPRE_ANNOTATE_REGION_BEGIN("restrict");
+
          hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
 
          alpha = -1.0;
@@ -651,6 +658,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             }
          }
 
+         HYPRE_ANNOTATE_REGION_END("restrict");
          HYPRE_ANNOTATE_MGLEVEL_END(level);
 
          ++level;
@@ -678,6 +686,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          coarse_grid = level;
          alpha = 1.0;
          beta = 1.0;
+
+         HYPRE_ANNOTATE_REGION_BEGIN("interpolate");
          if (block_mode)
          {
             hypre_ParCSRBlockMatrixMatvec(alpha, P_block_array[fine_grid],
@@ -693,6 +703,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             /* printf("Proc %d: level %d, n %d, Interpolation done\n", my_id, level, local_size); */
          }
 
+         HYPRE_ANNOTATE_REGION_END("interpolate");
          HYPRE_ANNOTATE_MGLEVEL_END(level);
 
          --level;
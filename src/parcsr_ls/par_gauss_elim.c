@@ -197,9 +197,69 @@ HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
    return hypre_error_flag;
 }
 
+/* Solves for every vector of the multivectors F_array[level] and
+ * U_array[level], one at a time, with hypre_GaussElimSolve */
+static HYPRE_Int
+hypre_GaussElimSolveMultiVector (hypre_ParAMGData *amg_data, HYPRE_Int level, HYPRE_Int relax_type)
+{
+   hypre_ParVector *f = hypre_ParAMGDataFArray(amg_data)[level];
+   hypre_ParVector *u = hypre_ParAMGDataUArray(amg_data)[level];
+   hypre_Vector    *f_local = hypre_ParVectorLocalVector(f);
+   hypre_Vector    *u_local = hypre_ParVectorLocalVector(u);
+   HYPRE_Int        num_vectors = hypre_VectorNumVectors(f_local);
+   HYPRE_Int        n = hypre_VectorSize(f_local);
+   hypre_ParVector *f_v, *u_v;
+   HYPRE_Complex   *f_v_data, *u_v_data;
+   HYPRE_Int        i, v;
+
+   f_v = hypre_ParVectorCreate(hypre_ParVectorComm(f), hypre_ParVectorGlobalSize(f),
+                               hypre_ParVectorPartitioning(f));
+   hypre_ParVectorInitialize_v2(f_v, HYPRE_MEMORY_HOST);
+   hypre_ParVectorSetPartitioningOwner(f_v, 0);
+   u_v = hypre_ParVectorCreate(hypre_ParVectorComm(f), hypre_ParVectorGlobalSize(f),
+                               hypre_ParVectorPartitioning(f));
+   hypre_ParVectorInitialize_v2(u_v, HYPRE_MEMORY_HOST);
+   hypre_ParVectorSetPartitioningOwner(u_v, 0);
+   f_v_data = hypre_VectorData(hypre_ParVectorLocalVector(f_v));
+   u_v_data = hypre_VectorData(hypre_ParVectorLocalVector(u_v));
+
+   hypre_ParAMGDataFArray(amg_data)[level] = f_v;
+   hypre_ParAMGDataUArray(amg_data)[level] = u_v;
+
+   for (v = 0; v < num_vectors; v++)
+   {
+      for (i = 0; i < n; i++)
+      {
+         f_v_data[i] = hypre_VectorData(f_local)[v*hypre_VectorVectorStride(f_local) +
+                                                 i*hypre_VectorIndexStride(f_local)];
+      }
+
+      hypre_GaussElimSolve(amg_data, level, relax_type);
+
+      for (i = 0; i < n; i++)
+      {
+         hypre_VectorData(u_local)[v*hypre_VectorVectorStride(u_local) +
+                                   i*hypre_VectorIndexStride(u_local)] = u_v_data[i];
+      }
+   }
+
+   hypre_ParAMGDataFArray(amg_data)[level] = f;
+   hypre_ParAMGDataUArray(amg_data)[level] = u;
+
+   hypre_ParVectorDestroy(f_v);
+   hypre_ParVectorDestroy(u_v);
+
+   return hypre_error_flag;
+}
+
 /* relax_type = 9, 99, 199, see par_relax.c for 19 and 98 */
 HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYPRE_Int relax_type)
 {
+   if (hypre_ParVectorNumVectors(hypre_ParAMGDataFArray(amg_data)[level]) > 1)
+   {
+      return hypre_GaussElimSolveMultiVector(amg_data, level, relax_type);
+   }
+
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_GS_ELIM_SOLVE] -= hypre_MPI_Wtime();
 #endif
@@ -4173,6 +4173,7 @@ hypre_CSRMatrixScale(hypre_CSRMatrix *A, HYPRE_Real scalar)
 {
    HYPRE_Real  *data = hypre_CSRMatrixData(A);
    HYPRE_Int   i,k;
+   hypre_CSRMatrixSellDestroy(A);
    k = hypre_CSRMatrixNumNonzeros(A);
    for(i = 0 ; i < k ; i ++)
    {
@@ -4337,6 +4338,7 @@ hypre_CSRMatrixDropInplace(hypre_CSRMatrix *A, HYPRE_Real droptol, HYPRE_Int max
          new_i[i+1] = ctrA;
       }
    }/* end of main loop */
+   hypre_CSRMatrixSellDestroy(A);
    /* destory data if A own them */
    if(hypre_CSRMatrixOwnsData(A))
    {
@@ -553,6 +553,7 @@ hypre_ILUSetup( void               *ilu_vdata,
                   hypre_ParILUCusparseSchurGMRESMatvec, //parCSR A -> ilu_data
                   hypre_ParILUCusparseSchurGMRESMatvecDestroy, //parCSR A -- inactive
                   hypre_ParKrylovInnerProd,
+                  hypre_ParKrylovMultiInnerProd,
                   hypre_ParKrylovCopyVector,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector,
@@ -833,6 +834,7 @@ hypre_ILUSetup( void               *ilu_vdata,
                   hypre_ParILURAPSchurGMRESMatvec, //parCSR A -> ilu_data
                   hypre_ParILURAPSchurGMRESMatvecDestroy, //parCSR A -- inactive
                   hypre_ParKrylovInnerProd,
+                  hypre_ParKrylovMultiInnerProd,
                   hypre_ParKrylovCopyVector,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector,
@@ -958,6 +960,7 @@ hypre_ILUSetup( void               *ilu_vdata,
                      hypre_ParILURAPSchurGMRESMatvecH, //parCSR A -> ilu_data
                      hypre_ParILURAPSchurGMRESMatvecDestroyH, //parCSR A -- inactive
                      hypre_ParKrylovInnerProd,
+                     hypre_ParKrylovMultiInnerProd,
                      hypre_ParKrylovCopyVector,
                      hypre_ParKrylovClearVector,
                      hypre_ParKrylovScaleVector,
@@ -137,6 +137,150 @@ hypre_ParKrylovMatvec( void   *matvec_data,
                                        (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMultiVectorCreate
+ *
+ * Creates a row-major multivector of k vectors with the partitioning of x.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParVector *
+hypre_ParKrylovMultiVectorCreate( hypre_ParVector *x,
+                                  HYPRE_Int        k )
+{
+   hypre_ParVector *x_mv;
+
+   x_mv = hypre_ParMultiVectorCreate(hypre_ParVectorComm(x),
+                                     hypre_ParVectorGlobalSize(x),
+                                     hypre_ParVectorPartitioning(x),
+                                     k);
+   hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(x_mv)) = 1;
+   hypre_ParVectorInitialize_v2(x_mv, HYPRE_MEMORY_HOST);
+   hypre_ParVectorSetPartitioningOwner(x_mv, 0);
+
+   return x_mv;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMatvecBlockCreate
+ *
+ * Matvec data for hypre_ParKrylovMatvecBlock: the row-major multivectors
+ * that blocks of vectors are packed into, kept between calls.  It can also
+ * be passed to hypre_ParKrylovMatvec, which ignores it.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParVector *x_mv;
+   hypre_ParVector *y_mv;
+
+} hypre_ParKrylovMatvecBlockData;
+
+void *
+hypre_ParKrylovMatvecBlockCreate( void   *A,
+                                  void   *x )
+{
+   hypre_ParKrylovMatvecBlockData *matvec_data;
+
+   matvec_data = hypre_CTAlloc(hypre_ParKrylovMatvecBlockData, 1, HYPRE_MEMORY_HOST);
+
+   return ( (void *) matvec_data );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMatvecBlock
+ *
+ * y[j] = alpha A x[j] + beta y[j] for k vectors with one multivector matvec,
+ * which reads A and exchanges the halo once for all vectors.  Vectors in
+ * device memory are done one at a time.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMatvecBlock( void           *matvec_vdata,
+                            HYPRE_Complex   alpha,
+                            void           *A,
+                            HYPRE_Int       k,
+                            void          **x,
+                            HYPRE_Complex   beta,
+                            void          **y )
+{
+   hypre_ParKrylovMatvecBlockData *matvec_data = (hypre_ParKrylovMatvecBlockData *) matvec_vdata;
+   hypre_ParVector **x_v = (hypre_ParVector **) x;
+   hypre_ParVector **y_v = (hypre_ParVector **) y;
+   hypre_ParVector  *x_mv, *y_mv;
+   HYPRE_Int         j;
+
+   if (k < 2 || matvec_data == NULL ||
+       hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(x_v[0])) != hypre_MEMORY_HOST)
+   {
+      for (j = 0; j < k; j++)
+      {
+         hypre_ParCSRMatrixMatvec(alpha, (hypre_ParCSRMatrix *) A, x_v[j], beta, y_v[j]);
+      }
+
+      return hypre_error_flag;
+   }
+
+   if ((matvec_data -> x_mv) == NULL || hypre_ParVectorNumVectors(matvec_data -> x_mv) != k)
+   {
+      hypre_ParVectorDestroy(matvec_data -> x_mv);
+      hypre_ParVectorDestroy(matvec_data -> y_mv);
+      (matvec_data -> x_mv) = hypre_ParKrylovMultiVectorCreate(x_v[0], k);
+      (matvec_data -> y_mv) = hypre_ParKrylovMultiVectorCreate(y_v[0], k);
+   }
+   x_mv = (matvec_data -> x_mv);
+   y_mv = (matvec_data -> y_mv);
+
+   hypre_ParMultiVectorPack(k, x_v, x_mv);
+   if (beta != 0.0)
+   {
+      hypre_ParMultiVectorPack(k, y_v, y_mv);
+   }
+
+   hypre_ParCSRMatrixMatvec(alpha, (hypre_ParCSRMatrix *) A, x_mv, beta, y_mv);
+
+   hypre_ParMultiVectorUnpack(y_mv, k, y_v);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMatvecBlockDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMatvecBlockDestroy( void *matvec_vdata )
+{
+   hypre_ParKrylovMatvecBlockData *matvec_data = (hypre_ParKrylovMatvecBlockData *) matvec_vdata;
+
+   if (matvec_data)
+   {
+      hypre_ParVectorDestroy(matvec_data -> x_mv);
+      hypre_ParVectorDestroy(matvec_data -> y_mv);
+      hypre_TFree(matvec_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovBoomerAMGSolveBlock
+ *
+ * Block preconditioner for BoomerAMG: x[j] = M b[j] for k vectors with one
+ * multivector cycle (see hypre_BoomerAMGSolveBlock).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovBoomerAMGSolveBlock( void       *vdata,
+                                    void       *A,
+                                    HYPRE_Int   k,
+                                    void      **b,
+                                    void      **x )
+{
+   return ( hypre_BoomerAMGSolveBlock(vdata, (hypre_ParCSRMatrix *) A, k,
+                                      (hypre_ParVector **) b,
+                                      (hypre_ParVector **) x) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMatvecT
  *--------------------------------------------------------------------------*/
@@ -178,6 +322,36 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMultiInnerProd
+ *
+ * Starts the inner products <x[j],y[j]>, j < k, as one non-blocking global
+ * reduction into result.  The local buffer must stay untouched until the
+ * request completes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMultiInnerProd( HYPRE_Int          k,
+                               void             **x,
+                               void             **y,
+                               HYPRE_Real        *local,
+                               HYPRE_Real        *result,
+                               hypre_MPI_Request *request )
+{
+   MPI_Comm   comm = hypre_ParVectorComm((hypre_ParVector *) x[0]);
+   HYPRE_Int  j;
+
+   for (j = 0; j < k; j++)
+   {
+      local[j] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector((hypre_ParVector *) x[j]),
+                                          hypre_ParVectorLocalVector((hypre_ParVector *) y[j]));
+   }
+
+   hypre_MPI_Iallreduce(local, result, k, HYPRE_MPI_REAL, hypre_MPI_SUM, comm, request);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
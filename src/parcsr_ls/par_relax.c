@@ -14,7 +14,19 @@
 #include "_hypre_parcsr_ls.h"
 #include "Common.h"
 #include "_hypre_lapack.h"
+
+#define hypre_RELAX_DATA       HYPRE_Complex
+#define hypre_RELAX_FUNC(name) name
+#include "par_relax.h"
+#undef hypre_RELAX_DATA
+#undef hypre_RELAX_FUNC
+
+/* kernels for matrices stored in single precision (mixed-precision AMG) */
+#define hypre_RELAX_DATA       hypre_float
+#define hypre_RELAX_FUNC(name) name##Sp
 #include "par_relax.h"
+#undef hypre_RELAX_DATA
+#undef hypre_RELAX_FUNC
 
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGRelax
@@ -73,6 +85,12 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
     *     relax_type = 199-> Direct solve, Gaussian elimination
     *-------------------------------------------------------------------------------------*/
 
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      return hypre_BoomerAMGRelaxMultiVector(A, f, cf_marker, relax_type, relax_points, relax_weight, omega,
+                                             l1_norms, u, Vtemp);
+   }
+
    switch (relax_type)
    {
       case 0: /* Weighted Jacobi */
@@ -153,6 +171,251 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    return relax_error;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVector
+ *
+ * Relaxes all vectors of the multivectors f and u at once, which must use
+ * row-major (interleaved) storage, with one halo exchange for all vectors.
+ * Supports the Jacobi (0, 7, 18) and the hybrid Gauss-Seidel (3, 4, 6, 8,
+ * 13, 14) relaxation types on the host.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMultiVector( hypre_ParCSRMatrix *A,
+                                 hypre_ParVector    *f,
+                                 HYPRE_Int          *cf_marker,
+                                 HYPRE_Int           relax_type,
+                                 HYPRE_Int           relax_points,
+                                 HYPRE_Real          relax_weight,
+                                 HYPRE_Real          omega,
+                                 HYPRE_Real         *l1_norms,
+                                 hypre_ParVector    *u,
+                                 hypre_ParVector    *Vtemp )
+{
+   MPI_Comm             comm           = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag         = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data    = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i       = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j       = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd         = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i       = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data    = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j       = hypre_CSRMatrixJ(A_offd);
+   hypre_float         *A_diag_data_sp = hypre_CSRMatrixDataSp(A_diag);
+   hypre_float         *A_offd_data_sp = hypre_CSRMatrixDataSp(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg       = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_rows       = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd  = hypre_CSRMatrixNumCols(A_offd);
+   hypre_Vector        *u_local        = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex       *u_data         = hypre_VectorData(u_local);
+   HYPRE_Complex       *f_data         = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex       *Vtemp_data     = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Int            num_vectors    = hypre_VectorNumVectors(u_local);
+   HYPRE_Complex       *v_ext_data     = NULL;
+   HYPRE_Complex       *v_buf_data     = NULL;
+
+   HYPRE_Int  jacobi, gs_order = 1, num_sweeps = 1, skip_diag, non_scale;
+   HYPRE_Int  num_procs, num_threads, num_sends, send_size, i;
+   HYPRE_Real prod, one_minus_omega;
+
+   hypre_ParCSRCommHandle *comm_handle;
+
+   if ( hypre_VectorIndexStride(u_local) != num_vectors ||
+        hypre_VectorIndexStride(hypre_ParVectorLocalVector(f)) != num_vectors ||
+        hypre_ParVectorNumVectors(Vtemp) != num_vectors ||
+        hypre_VectorIndexStride(hypre_ParVectorLocalVector(Vtemp)) != num_vectors )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Multivector relaxation requires row-major multivectors\n");
+      return hypre_error_flag;
+   }
+
+   switch (relax_type)
+   {
+      case 0: /* weighted Jacobi */
+         jacobi    = 1;
+         l1_norms  = NULL;
+         skip_diag = 1;
+         break;
+
+      case 7: /* Jacobi, relaxes all points */
+         relax_points = 0;
+         /* fall through */
+      case 18: /* weighted l1 Jacobi */
+         jacobi    = 1;
+         skip_diag = 0;
+         break;
+
+      case 3: /* hybrid G-S, forward */
+      case 4: /* hybrid G-S, backward */
+      case 6: /* hybrid symm. G-S */
+         jacobi     = 0;
+         l1_norms   = NULL;
+         skip_diag  = 1;
+         gs_order   = relax_type == 4 ? -1 : 1;
+         num_sweeps = relax_type == 6 ? 2 : 1;
+         break;
+
+      case 8:  /* hybrid l1 symm. G-S */
+      case 13: /* hybrid l1 G-S, forward */
+      case 14: /* hybrid l1 G-S, backward */
+         jacobi     = 0;
+         skip_diag  = relax_weight == 1.0 && omega == 1.0 ? 0 : 1;
+         gs_order   = relax_type == 14 ? -1 : 1;
+         num_sweeps = relax_type == 8 ? 2 : 1;
+         break;
+
+      default:
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Relaxation type does not support multivectors\n");
+         return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*-----------------------------------------------------------------
+    * Exchange the halo of all vectors at once
+    *-----------------------------------------------------------------*/
+   if (num_procs > 1)
+   {
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      send_size  = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      v_buf_data = hypre_TAlloc(HYPRE_Complex, send_size * num_vectors, HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd * num_vectors, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < send_size; i++)
+      {
+         HYPRE_Complex *u_i = u_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * num_vectors;
+         HYPRE_Int      v;
+
+         for (v = 0; v < num_vectors; v++)
+         {
+            v_buf_data[i * num_vectors + v] = u_i[v];
+         }
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+      comm_handle = hypre_ParCSRCommHandleCreateMultiVector(1, comm_pkg, num_vectors,
+                                                            HYPRE_MEMORY_HOST, v_buf_data,
+                                                            HYPRE_MEMORY_HOST, v_ext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   num_threads     = hypre_NumThreads();
+   non_scale       = relax_weight == 1.0 && omega == 1.0;
+   prod            = 1.0 - relax_weight * omega;
+   one_minus_omega = 1.0 - omega;
+
+   /*-----------------------------------------------------------------
+    * Copy current approximation into temporary vector.
+    *-----------------------------------------------------------------*/
+   if (jacobi || num_threads > 1 || !non_scale)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows * num_vectors; i++)
+      {
+         Vtemp_data[i] = u_data[i];
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Relax all points.
+    *-----------------------------------------------------------------*/
+   if (jacobi)
+   {
+      if (A_diag_data_sp)
+      {
+         hypre_WeightedJacobiMultiVectorSp(A_diag_i, A_diag_j, A_diag_data_sp,
+                                           A_offd_i, A_offd_j, A_offd_data_sp,
+                                           f_data, cf_marker, relax_points, relax_weight, l1_norms,
+                                           u_data, Vtemp_data, v_ext_data, num_rows, num_vectors, skip_diag);
+      }
+      else
+      {
+         hypre_WeightedJacobiMultiVector(A_diag_i, A_diag_j, A_diag_data,
+                                         A_offd_i, A_offd_j, A_offd_data,
+                                         f_data, cf_marker, relax_points, relax_weight, l1_norms,
+                                         u_data, Vtemp_data, v_ext_data, num_rows, num_vectors, skip_diag);
+      }
+   }
+   else
+   {
+      HYPRE_Complex *res = hypre_TAlloc(HYPRE_Complex, 3 * num_vectors * num_threads, HYPRE_MEMORY_HOST);
+      HYPRE_Int      j;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < num_threads; j++)
+      {
+         HYPRE_Int ns, ne, sweep;
+         hypre_partition1D(num_rows, num_threads, j, &ns, &ne);
+
+         for (sweep = 0; sweep < num_sweeps; sweep++)
+         {
+            const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+            const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
+            const HYPRE_Int iend   = iorder > 0 ? ne : ns - 1;
+
+            if (A_diag_data_sp)
+            {
+               hypre_HybridGaussSeidelMultiVectorSp(A_diag_i, A_diag_j, A_diag_data_sp,
+                                                    A_offd_i, A_offd_j, A_offd_data_sp,
+                                                    f_data, cf_marker, relax_points, relax_weight, omega,
+                                                    one_minus_omega, prod, non_scale, l1_norms,
+                                                    u_data, Vtemp_data, v_ext_data, res + 3 * num_vectors * j,
+                                                    num_vectors, ns, ne, ibegin, iend, iorder, skip_diag);
+            }
+            else
+            {
+               hypre_HybridGaussSeidelMultiVector(A_diag_i, A_diag_j, A_diag_data,
+                                                  A_offd_i, A_offd_j, A_offd_data,
+                                                  f_data, cf_marker, relax_points, relax_weight, omega,
+                                                  one_minus_omega, prod, non_scale, l1_norms,
+                                                  u_data, Vtemp_data, v_ext_data, res + 3 * num_vectors * j,
+                                                  num_vectors, ns, ne, ibegin, iend, iorder, skip_diag);
+            }
+         }
+      }
+
+      hypre_TFree(res, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+   return 0;
+}
+
 HYPRE_Int
 hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
                                          hypre_ParVector    *f,
@@ -185,11 +448,7 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    HYPRE_Complex       *v_ext_data    = NULL;
    HYPRE_Complex       *v_buf_data    = NULL;
 
-   HYPRE_Complex        zero             = 0.0;
-   HYPRE_Real           one_minus_weight = 1.0 - relax_weight;
-   HYPRE_Complex        res;
-
-   HYPRE_Int num_procs, my_id, i, j, ii, jj, index, num_sends, start;
+   HYPRE_Int num_procs, my_id, i, j, index, num_sends, start;
    hypre_ParCSRCommHandle *comm_handle;
 
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -234,42 +493,18 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    /*-----------------------------------------------------------------
     * Relax all points.
     *-----------------------------------------------------------------*/
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,ii,jj,res) HYPRE_SMP_SCHEDULE
-#endif
-   for (i = 0; i < num_rows; i++)
+   if (hypre_CSRMatrixDataSp(A_diag))
    {
-      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
-
-      /*-----------------------------------------------------------
-       * If i is of the right type ( C or F or All ) and diagonal is
-       * nonzero, relax point i; otherwise, skip it.
-       * Relax only C or F points as determined by relax_points.
-       *-----------------------------------------------------------*/
-      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
-      {
-         res = f_data[i];
-         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
-         {
-            ii = A_diag_j[jj];
-            res -= A_diag_data[jj] * Vtemp_data[ii];
-         }
-         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
-         {
-            ii = A_offd_j[jj];
-            res -= A_offd_data[jj] * v_ext_data[ii];
-         }
-
-         if (Skip_diag)
-         {
-            u_data[i] *= one_minus_weight;
-            u_data[i] += relax_weight * res / di;
-         }
-         else
-         {
-            u_data[i] += relax_weight * res / di;
-         }
-      }
+      hypre_WeightedJacobiSp(A_diag_i, A_diag_j, hypre_CSRMatrixDataSp(A_diag),
+                             A_offd_i, A_offd_j, hypre_CSRMatrixDataSp(A_offd),
+                             f_data, cf_marker, relax_points, relax_weight, l1_norms,
+                             u_data, Vtemp_data, v_ext_data, num_rows, Skip_diag);
+   }
+   else
+   {
+      hypre_WeightedJacobi(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                           f_data, cf_marker, relax_points, relax_weight, l1_norms,
+                           u_data, Vtemp_data, v_ext_data, num_rows, Skip_diag);
    }
 
    if (num_procs > 1)
@@ -648,6 +883,8 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    HYPRE_Complex       *v_ext_data    = NULL;
    HYPRE_Complex       *v_buf_data    = NULL;
    HYPRE_Int           *proc_ordering = NULL;
+   hypre_float         *A_diag_data_sp = hypre_CSRMatrixDataSp(A_diag);
+   hypre_float         *A_offd_data_sp = hypre_CSRMatrixDataSp(A_offd);
 
    const HYPRE_Real     one_minus_omega  = 1.0 - omega;
    HYPRE_Int            num_procs, my_id, num_threads, j, num_sends;
@@ -658,6 +895,12 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    hypre_MPI_Comm_rank(comm, &my_id);
    num_threads = forced_seq ? 1 : hypre_NumThreads();
 
+   if (Topo_order && A_diag_data_sp)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Topological ordering is not available for single precision matrices\n");
+      return hypre_error_flag;
+   }
+
    /* GS order: forward or backward */
    const HYPRE_Int gs_order = GS_order > 0 ? 1 : -1;
    /* for symmetric GS, a forward followed by a backward */
@@ -788,12 +1031,24 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
             const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
             const HYPRE_Int iend = iorder > 0 ? ne : ns - 1;
 
-            if (non_scale)
+            if (non_scale && A_diag_data_sp)
+            {
+               hypre_HybridGaussSeidelNSThreadsSp(A_diag_i, A_diag_j, A_diag_data_sp, A_offd_i, A_offd_j, A_offd_data_sp,
+                                                  f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                                  ns, ne, ibegin, iend, iorder, Skip_diag);
+            }
+            else if (non_scale)
             {
                hypre_HybridGaussSeidelNSThreads(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
                                                 f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
                                                 ns, ne, ibegin, iend, iorder, Skip_diag);
             }
+            else if (A_diag_data_sp)
+            {
+               hypre_HybridGaussSeidelThreadsSp(A_diag_i, A_diag_j, A_diag_data_sp, A_offd_i, A_offd_j, A_offd_data_sp,
+                                                f_data, cf_marker, relax_points, relax_weight, omega, one_minus_omega,
+                                                prod, l1_norms, u_data, Vtemp_data, v_ext_data, ns, ne, ibegin, iend, iorder, Skip_diag);
+            }
             else
             {
                hypre_HybridGaussSeidelThreads(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
@@ -820,12 +1075,24 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
          }
          else
          {
-            if (non_scale)
+            if (non_scale && A_diag_data_sp)
+            {
+               hypre_HybridGaussSeidelNSSp(A_diag_i, A_diag_j, A_diag_data_sp, A_offd_i, A_offd_j, A_offd_data_sp,
+                                           f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                           ibegin, iend, iorder, Skip_diag);
+            }
+            else if (non_scale)
             {
                hypre_HybridGaussSeidelNS(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
                                          f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
                                          ibegin, iend, iorder, Skip_diag);
             }
+            else if (A_diag_data_sp)
+            {
+               hypre_HybridGaussSeidelSp(A_diag_i, A_diag_j, A_diag_data_sp, A_offd_i, A_offd_j, A_offd_data_sp,
+                                         f_data, cf_marker, relax_points, relax_weight, omega, one_minus_omega,
+                                         prod, l1_norms, u_data, Vtemp_data, v_ext_data, ibegin, iend, iorder, Skip_diag);
+            }
             else
             {
                hypre_HybridGaussSeidel(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
@@ -5,28 +5,37 @@
  * SPDX-License-Identifier: (Apache-2.0 OR MIT)
  ******************************************************************************/
 
-#ifndef HYPRE_PAR_RELAX_HEADER
-#define HYPRE_PAR_RELAX_HEADER
+/******************************************************************************
+ *
+ * Relaxation kernels, included by par_relax.c once per storage type of the
+ * matrix values. The includer defines
+ *
+ *   hypre_RELAX_DATA       type of the values of A_diag and A_offd
+ *   hypre_RELAX_FUNC(name) name of the instantiated kernel
+ *
+ * so there is intentionally no include guard.
+ *
+ *****************************************************************************/
 
 /* Non-Scale version */
 static inline void
-hypre_HybridGaussSeidelNS( HYPRE_Int     *A_diag_i,
-                           HYPRE_Int     *A_diag_j,
-                           HYPRE_Complex *A_diag_data,
-                           HYPRE_Int     *A_offd_i,
-                           HYPRE_Int     *A_offd_j,
-                           HYPRE_Complex *A_offd_data,
-                           HYPRE_Complex *f_data,
-                           HYPRE_Int     *cf_marker,
-                           HYPRE_Int      relax_points,
-                           HYPRE_Complex *l1_norms,
-                           HYPRE_Complex *u_data,
-                           HYPRE_Complex *v_tmp_data,
-                           HYPRE_Complex *v_ext_data,
-                           HYPRE_Int      ibegin,
-                           HYPRE_Int      iend,
-                           HYPRE_Int      iorder,
-                           HYPRE_Int      Skip_diag )
+hypre_RELAX_FUNC(hypre_HybridGaussSeidelNS)( HYPRE_Int        *A_diag_i,
+                                             HYPRE_Int        *A_diag_j,
+                                             hypre_RELAX_DATA *A_diag_data,
+                                             HYPRE_Int        *A_offd_i,
+                                             HYPRE_Int        *A_offd_j,
+                                             hypre_RELAX_DATA *A_offd_data,
+                                             HYPRE_Complex    *f_data,
+                                             HYPRE_Int        *cf_marker,
+                                             HYPRE_Int         relax_points,
+                                             HYPRE_Complex    *l1_norms,
+                                             HYPRE_Complex    *u_data,
+                                             HYPRE_Complex    *v_tmp_data,
+                                             HYPRE_Complex    *v_ext_data,
+                                             HYPRE_Int         ibegin,
+                                             HYPRE_Int         iend,
+                                             HYPRE_Int         iorder,
+                                             HYPRE_Int         Skip_diag )
 {
    HYPRE_Int i;
    const HYPRE_Complex zero = 0.0;
@@ -104,25 +113,25 @@ hypre_HybridGaussSeidelNS( HYPRE_Int     *A_diag_i,
 
 /* Non-Scale Threaded version */
 static inline void
-hypre_HybridGaussSeidelNSThreads( HYPRE_Int     *A_diag_i,
-                                  HYPRE_Int     *A_diag_j,
-                                  HYPRE_Complex *A_diag_data,
-                                  HYPRE_Int     *A_offd_i,
-                                  HYPRE_Int     *A_offd_j,
-                                  HYPRE_Complex *A_offd_data,
-                                  HYPRE_Complex *f_data,
-                                  HYPRE_Int     *cf_marker,
-                                  HYPRE_Int      relax_points,
-                                  HYPRE_Complex *l1_norms,
-                                  HYPRE_Complex *u_data,
-                                  HYPRE_Complex *v_tmp_data,
-                                  HYPRE_Complex *v_ext_data,
-                                  HYPRE_Int      ns,
-                                  HYPRE_Int      ne,
-                                  HYPRE_Int      ibegin,
-                                  HYPRE_Int      iend,
-                                  HYPRE_Int      iorder,
-                                  HYPRE_Int      Skip_diag )
+hypre_RELAX_FUNC(hypre_HybridGaussSeidelNSThreads)( HYPRE_Int        *A_diag_i,
+                                                    HYPRE_Int        *A_diag_j,
+                                                    hypre_RELAX_DATA *A_diag_data,
+                                                    HYPRE_Int        *A_offd_i,
+                                                    HYPRE_Int        *A_offd_j,
+                                                    hypre_RELAX_DATA *A_offd_data,
+                                                    HYPRE_Complex    *f_data,
+                                                    HYPRE_Int        *cf_marker,
+                                                    HYPRE_Int         relax_points,
+                                                    HYPRE_Complex    *l1_norms,
+                                                    HYPRE_Complex    *u_data,
+                                                    HYPRE_Complex    *v_tmp_data,
+                                                    HYPRE_Complex    *v_ext_data,
+                                                    HYPRE_Int         ns,
+                                                    HYPRE_Int         ne,
+                                                    HYPRE_Int         ibegin,
+                                                    HYPRE_Int         iend,
+                                                    HYPRE_Int         iorder,
+                                                    HYPRE_Int         Skip_diag )
 {
    HYPRE_Int i;
    const HYPRE_Complex zero = 0.0;
@@ -220,27 +229,27 @@ hypre_HybridGaussSeidelNSThreads( HYPRE_Int     *A_diag_i,
 
 /* Scaled version */
 static inline void
-hypre_HybridGaussSeidel( HYPRE_Int     *A_diag_i,
-                         HYPRE_Int     *A_diag_j,
-                         HYPRE_Complex *A_diag_data,
-                         HYPRE_Int     *A_offd_i,
-                         HYPRE_Int     *A_offd_j,
-                         HYPRE_Complex *A_offd_data,
-                         HYPRE_Complex *f_data,
-                         HYPRE_Int     *cf_marker,
-                         HYPRE_Int      relax_points,
-                         HYPRE_Real     relax_weight,
-                         HYPRE_Real     omega,
-                         HYPRE_Real     one_minus_omega,
-                         HYPRE_Real     prod,
-                         HYPRE_Complex *l1_norms,
-                         HYPRE_Complex *u_data,
-                         HYPRE_Complex *v_tmp_data,
-                         HYPRE_Complex *v_ext_data,
-                         HYPRE_Int      ibegin,
-                         HYPRE_Int      iend,
-                         HYPRE_Int      iorder,
-                         HYPRE_Int      Skip_diag )
+hypre_RELAX_FUNC(hypre_HybridGaussSeidel)( HYPRE_Int        *A_diag_i,
+                                           HYPRE_Int        *A_diag_j,
+                                           hypre_RELAX_DATA *A_diag_data,
+                                           HYPRE_Int        *A_offd_i,
+                                           HYPRE_Int        *A_offd_j,
+                                           hypre_RELAX_DATA *A_offd_data,
+                                           HYPRE_Complex    *f_data,
+                                           HYPRE_Int        *cf_marker,
+                                           HYPRE_Int         relax_points,
+                                           HYPRE_Real        relax_weight,
+                                           HYPRE_Real        omega,
+                                           HYPRE_Real        one_minus_omega,
+                                           HYPRE_Real        prod,
+                                           HYPRE_Complex    *l1_norms,
+                                           HYPRE_Complex    *u_data,
+                                           HYPRE_Complex    *v_tmp_data,
+                                           HYPRE_Complex    *v_ext_data,
+                                           HYPRE_Int         ibegin,
+                                           HYPRE_Int         iend,
+                                           HYPRE_Int         iorder,
+                                           HYPRE_Int         Skip_diag )
 {
    HYPRE_Int i;
    const HYPRE_Complex zero = 0.0;
@@ -327,29 +336,29 @@ hypre_HybridGaussSeidel( HYPRE_Int     *A_diag_i,
 
 /* Scaled Threaded version */
 static inline void
-hypre_HybridGaussSeidelThreads( HYPRE_Int     *A_diag_i,
-                                HYPRE_Int     *A_diag_j,
-                                HYPRE_Complex *A_diag_data,
-                                HYPRE_Int     *A_offd_i,
-                                HYPRE_Int     *A_offd_j,
-                                HYPRE_Complex *A_offd_data,
-                                HYPRE_Complex *f_data,
-                                HYPRE_Int     *cf_marker,
-                                HYPRE_Int      relax_points,
-                                HYPRE_Real     relax_weight,
-                                HYPRE_Real     omega,
-                                HYPRE_Real     one_minus_omega,
-                                HYPRE_Real     prod,
-                                HYPRE_Complex *l1_norms,
-                                HYPRE_Complex *u_data,
-                                HYPRE_Complex *v_tmp_data,
-                                HYPRE_Complex *v_ext_data,
-                                HYPRE_Int      ns,
-                                HYPRE_Int      ne,
-                                HYPRE_Int      ibegin,
-                                HYPRE_Int      iend,
-                                HYPRE_Int      iorder,
-                                HYPRE_Int      Skip_diag )
+hypre_RELAX_FUNC(hypre_HybridGaussSeidelThreads)( HYPRE_Int        *A_diag_i,
+                                                  HYPRE_Int        *A_diag_j,
+                                                  hypre_RELAX_DATA *A_diag_data,
+                                                  HYPRE_Int        *A_offd_i,
+                                                  HYPRE_Int        *A_offd_j,
+                                                  hypre_RELAX_DATA *A_offd_data,
+                                                  HYPRE_Complex    *f_data,
+                                                  HYPRE_Int        *cf_marker,
+                                                  HYPRE_Int         relax_points,
+                                                  HYPRE_Real        relax_weight,
+                                                  HYPRE_Real        omega,
+                                                  HYPRE_Real        one_minus_omega,
+                                                  HYPRE_Real        prod,
+                                                  HYPRE_Complex    *l1_norms,
+                                                  HYPRE_Complex    *u_data,
+                                                  HYPRE_Complex    *v_tmp_data,
+                                                  HYPRE_Complex    *v_ext_data,
+                                                  HYPRE_Int         ns,
+                                                  HYPRE_Int         ne,
+                                                  HYPRE_Int         ibegin,
+                                                  HYPRE_Int         iend,
+                                                  HYPRE_Int         iorder,
+                                                  HYPRE_Int         Skip_diag )
 {
    HYPRE_Int i;
    const HYPRE_Complex zero = 0.0;
@@ -450,22 +459,22 @@ hypre_HybridGaussSeidelThreads( HYPRE_Int     *A_diag_i,
 
 /* Ordered Version */
 static inline void
-hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
-                                  HYPRE_Int     *A_diag_j,
-                                  HYPRE_Complex *A_diag_data,
-                                  HYPRE_Int     *A_offd_i,
-                                  HYPRE_Int     *A_offd_j,
-                                  HYPRE_Complex *A_offd_data,
-                                  HYPRE_Complex *f_data,
-                                  HYPRE_Int     *cf_marker,
-                                  HYPRE_Int      relax_points,
-                                  HYPRE_Complex *u_data,
-                                  HYPRE_Complex *v_tmp_data,
-                                  HYPRE_Complex *v_ext_data,
-                                  HYPRE_Int      ibegin,
-                                  HYPRE_Int      iend,
-                                  HYPRE_Int      iorder,
-                                  HYPRE_Int     *proc_ordering )
+hypre_RELAX_FUNC(hypre_HybridGaussSeidelOrderedNS)( HYPRE_Int        *A_diag_i,
+                                                    HYPRE_Int        *A_diag_j,
+                                                    hypre_RELAX_DATA *A_diag_data,
+                                                    HYPRE_Int        *A_offd_i,
+                                                    HYPRE_Int        *A_offd_j,
+                                                    hypre_RELAX_DATA *A_offd_data,
+                                                    HYPRE_Complex    *f_data,
+                                                    HYPRE_Int        *cf_marker,
+                                                    HYPRE_Int         relax_points,
+                                                    HYPRE_Complex    *u_data,
+                                                    HYPRE_Complex    *v_tmp_data,
+                                                    HYPRE_Complex    *v_ext_data,
+                                                    HYPRE_Int         ibegin,
+                                                    HYPRE_Int         iend,
+                                                    HYPRE_Int         iorder,
+                                                    HYPRE_Int        *proc_ordering )
 {
    HYPRE_Int j;
    const HYPRE_Complex zero = 0.0;
@@ -500,5 +509,267 @@ hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
    } /* for ( i = ...) */
 }
 
-#endif /* #ifndef HYPRE_PAR_RELAX_HEADER */
+/* Weighted Jacobi version */
+static inline void
+hypre_RELAX_FUNC(hypre_WeightedJacobi)( HYPRE_Int        *A_diag_i,
+                                        HYPRE_Int        *A_diag_j,
+                                        hypre_RELAX_DATA *A_diag_data,
+                                        HYPRE_Int        *A_offd_i,
+                                        HYPRE_Int        *A_offd_j,
+                                        hypre_RELAX_DATA *A_offd_data,
+                                        HYPRE_Complex    *f_data,
+                                        HYPRE_Int        *cf_marker,
+                                        HYPRE_Int         relax_points,
+                                        HYPRE_Real        relax_weight,
+                                        HYPRE_Real       *l1_norms,
+                                        HYPRE_Complex    *u_data,
+                                        HYPRE_Complex    *v_tmp_data,
+                                        HYPRE_Complex    *v_ext_data,
+                                        HYPRE_Int         num_rows,
+                                        HYPRE_Int         Skip_diag )
+{
+   HYPRE_Int i, ii, jj;
+   HYPRE_Complex res;
+   const HYPRE_Complex zero = 0.0;
+   const HYPRE_Real one_minus_weight = 1.0 - relax_weight;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,jj,res) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      /*-----------------------------------------------------------
+       * If i is of the right type ( C or F or All ) and diagonal is
+       * nonzero, relax point i; otherwise, skip it.
+       * Relax only C or F points as determined by relax_points.
+       *-----------------------------------------------------------*/
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         res = f_data[i];
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            res -= A_diag_data[jj] * v_tmp_data[ii];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * v_ext_data[ii];
+         }
+
+         if (Skip_diag)
+         {
+            u_data[i] *= one_minus_weight;
+            u_data[i] += relax_weight * res / di;
+         }
+         else
+         {
+            u_data[i] += relax_weight * res / di;
+         }
+      }
+   }
+}
+
+/* Multivector hybrid G-S version. u, f, v_tmp and v_ext hold num_vectors
+ * vectors in row-major (interleaved) storage and res is scratch space for
+ * 3*num_vectors values. Columns outside [ns, ne) use v_tmp (threaded case).
+ * Covers the scaled and the non-scaled (non_scale != 0) variants. */
+static inline void
+hypre_RELAX_FUNC(hypre_HybridGaussSeidelMultiVector)( HYPRE_Int        *A_diag_i,
+                                                      HYPRE_Int        *A_diag_j,
+                                                      hypre_RELAX_DATA *A_diag_data,
+                                                      HYPRE_Int        *A_offd_i,
+                                                      HYPRE_Int        *A_offd_j,
+                                                      hypre_RELAX_DATA *A_offd_data,
+                                                      HYPRE_Complex    *f_data,
+                                                      HYPRE_Int        *cf_marker,
+                                                      HYPRE_Int         relax_points,
+                                                      HYPRE_Real        relax_weight,
+                                                      HYPRE_Real        omega,
+                                                      HYPRE_Real        one_minus_omega,
+                                                      HYPRE_Real        prod,
+                                                      HYPRE_Int         non_scale,
+                                                      HYPRE_Complex    *l1_norms,
+                                                      HYPRE_Complex    *u_data,
+                                                      HYPRE_Complex    *v_tmp_data,
+                                                      HYPRE_Complex    *v_ext_data,
+                                                      HYPRE_Complex    *res,
+                                                      HYPRE_Int         num_vectors,
+                                                      HYPRE_Int         ns,
+                                                      HYPRE_Int         ne,
+                                                      HYPRE_Int         ibegin,
+                                                      HYPRE_Int         iend,
+                                                      HYPRE_Int         iorder,
+                                                      HYPRE_Int         Skip_diag )
+{
+   HYPRE_Int i, jj, v;
+   HYPRE_Complex *res0 = res + num_vectors;
+   HYPRE_Complex *res2 = res + 2*num_vectors;
+   const HYPRE_Complex zero = 0.0;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : (HYPRE_Complex) A_diag_data[A_diag_i[i]];
 
+      /*-----------------------------------------------------------
+       * Relax only C or F points as determined by relax_points.
+       * If i is of the right type ( C or F or All) and diagonal is
+       * nonzero, relax point i; otherwise, skip it.
+       *-----------------------------------------------------------*/
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         HYPRE_Complex *u_i = u_data + i*num_vectors;
+         HYPRE_Complex *f_i = f_data + i*num_vectors;
+
+         for (v = 0; v < num_vectors; v++)
+         {
+            res[v]  = f_i[v];
+            res0[v] = 0.0;
+            res2[v] = 0.0;
+         }
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+         {
+            const HYPRE_Int     ii = A_diag_j[jj];
+            const HYPRE_Complex a  = A_diag_data[jj];
+
+            if (ii >= ns && ii < ne)
+            {
+               const HYPRE_Complex *u_ii = u_data + ii*num_vectors;
+               for (v = 0; v < num_vectors; v++)
+               {
+                  res0[v] -= a * u_ii[v];
+               }
+               if (!non_scale)
+               {
+                  const HYPRE_Complex *v_ii = v_tmp_data + ii*num_vectors;
+                  for (v = 0; v < num_vectors; v++)
+                  {
+                     res2[v] += a * v_ii[v];
+                  }
+               }
+            }
+            else
+            {
+               const HYPRE_Complex *v_ii = v_tmp_data + ii*num_vectors;
+               for (v = 0; v < num_vectors; v++)
+               {
+                  res[v] -= a * v_ii[v];
+               }
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            const HYPRE_Complex  a    = A_offd_data[jj];
+            const HYPRE_Complex *v_ii = v_ext_data + A_offd_j[jj]*num_vectors;
+            for (v = 0; v < num_vectors; v++)
+            {
+               res[v] -= a * v_ii[v];
+            }
+         }
+
+         if (non_scale)
+         {
+            for (v = 0; v < num_vectors; v++)
+            {
+               if (Skip_diag)
+               {
+                  u_i[v] = (res[v] + res0[v]) / di;
+               }
+               else
+               {
+                  u_i[v] += (res[v] + res0[v]) / di;
+               }
+            }
+         }
+         else
+         {
+            for (v = 0; v < num_vectors; v++)
+            {
+               if (Skip_diag)
+               {
+                  u_i[v] *= prod;
+               }
+               u_i[v] += relax_weight * (omega * res[v] + res0[v] + one_minus_omega * res2[v]) / di;
+            }
+         }
+      }
+   } /* for ( i = ...) */
+}
+
+/* Multivector weighted Jacobi version, row-major (interleaved) storage.
+ * v_tmp holds a copy of u, so the new iterate is accumulated in u directly */
+static inline void
+hypre_RELAX_FUNC(hypre_WeightedJacobiMultiVector)( HYPRE_Int        *A_diag_i,
+                                                   HYPRE_Int        *A_diag_j,
+                                                   hypre_RELAX_DATA *A_diag_data,
+                                                   HYPRE_Int        *A_offd_i,
+                                                   HYPRE_Int        *A_offd_j,
+                                                   hypre_RELAX_DATA *A_offd_data,
+                                                   HYPRE_Complex    *f_data,
+                                                   HYPRE_Int        *cf_marker,
+                                                   HYPRE_Int         relax_points,
+                                                   HYPRE_Real        relax_weight,
+                                                   HYPRE_Real       *l1_norms,
+                                                   HYPRE_Complex    *u_data,
+                                                   HYPRE_Complex    *v_tmp_data,
+                                                   HYPRE_Complex    *v_ext_data,
+                                                   HYPRE_Int         num_rows,
+                                                   HYPRE_Int         num_vectors,
+                                                   HYPRE_Int         Skip_diag )
+{
+   HYPRE_Int i;
+   const HYPRE_Complex zero = 0.0;
+   const HYPRE_Real one_minus_weight = Skip_diag ? 1.0 - relax_weight : 1.0;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : (HYPRE_Complex) A_diag_data[A_diag_i[i]];
+
+      /*-----------------------------------------------------------
+       * If i is of the right type ( C or F or All ) and diagonal is
+       * nonzero, relax point i; otherwise, skip it.
+       * Relax only C or F points as determined by relax_points.
+       *-----------------------------------------------------------*/
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         HYPRE_Complex *u_i = u_data + i*num_vectors;
+         HYPRE_Complex *f_i = f_data + i*num_vectors;
+         HYPRE_Complex *t_i = v_tmp_data + i*num_vectors;
+         HYPRE_Int      jj, v;
+
+         for (v = 0; v < num_vectors; v++)
+         {
+            u_i[v] = f_i[v];
+         }
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+         {
+            const HYPRE_Complex  a    = A_diag_data[jj];
+            const HYPRE_Complex *v_ii = v_tmp_data + A_diag_j[jj]*num_vectors;
+            for (v = 0; v < num_vectors; v++)
+            {
+               u_i[v] -= a * v_ii[v];
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            const HYPRE_Complex  a    = A_offd_data[jj];
+            const HYPRE_Complex *v_ii = v_ext_data + A_offd_j[jj]*num_vectors;
+            for (v = 0; v < num_vectors; v++)
+            {
+               u_i[v] -= a * v_ii[v];
+            }
+         }
+         for (v = 0; v < num_vectors; v++)
+         {
+            u_i[v] = one_minus_weight * t_i[v] + relax_weight * u_i[v] / di;
+         }
+      }
+   }
+}
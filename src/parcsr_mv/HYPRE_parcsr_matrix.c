@@ -93,6 +93,37 @@ HYPRE_ParCSRMatrixPrint( HYPRE_ParCSRMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixReadBinary( MPI_Comm            comm,
+                              const char         *file_name,
+                              HYPRE_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   *matrix = (HYPRE_ParCSRMatrix) hypre_ParCSRMatrixReadBinary( comm, file_name );
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixPrintBinary( HYPRE_ParCSRMatrix  matrix,
+                               const char         *file_name )
+{
+   hypre_ParCSRMatrixPrintBinary( (hypre_ParCSRMatrix *) matrix,
+                                  file_name );
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRMatrixGetComm
  *--------------------------------------------------------------------------*/
@@ -389,6 +420,58 @@ HYPRE_ParCSRMatrixMatvec( HYPRE_Complex      alpha,
                (hypre_ParVector *) x, beta, (hypre_ParVector *) y) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixSetSpMVUseSell
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixSetSpMVUseSell( HYPRE_ParCSRMatrix matrix,
+                                  HYPRE_Int          use_sell )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_ParCSRMatrixSetSpMVUseSell( (hypre_ParCSRMatrix *) matrix,
+                                              use_sell ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRSetMatvecSplit
+ *
+ * Global switch for the interior/boundary split of the host ParCSR matvec
+ * (0: off, 1: on).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRSetMatvecSplit( HYPRE_Int split )
+{
+   hypre_HandleMatvecSplit(hypre_handle()) = split;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRSetCommTransport
+ *
+ * Global switch for the transport of ParCSR halo exchanges (0: nonblocking
+ * point-to-point, 1: persistent requests, 2: MPI-3 neighborhood collectives).
+ * Transport 2 needs MPI-3 and applies to matrix comm_pkgs created after it
+ * is selected, because building the graph communicators is collective;
+ * exchanges on older comm_pkgs, and all exchanges without MPI-3, use
+ * point-to-point messages.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRSetCommTransport( HYPRE_Int transport )
+{
+   hypre_HandleCommTransport(hypre_handle()) = transport;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRMatrixMatvecT
  *--------------------------------------------------------------------------*/
@@ -28,7 +28,6 @@ extern "C" {
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -39,14 +38,13 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
  *--------------------------------------------------------------------------*/
 struct _hypre_ParCSRCommPkg;
 
-typedef struct
+typedef struct _hypre_ParCSRCommHandle
 {
    struct _hypre_ParCSRCommPkg *comm_pkg;
    HYPRE_MemoryLocation  send_memory_location;
@@ -59,6 +57,11 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+
+   /* persistent handles: non-zero between Start and Wait */
+   HYPRE_Int             active;
+   /* set when this handle only wraps a started persistent handle */
+   struct _hypre_ParCSRCommHandle *persistent_comm_handle;
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
@@ -81,9 +84,30 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_MPI_Datatype          *send_mpi_types;
    hypre_MPI_Datatype          *recv_mpi_types;
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
+
+   /* transport state (see HYPRE_ParCSRSetCommTransport). It is only cached
+    * on comm_pkgs that are created collectively and released with
+    * hypre_MatvecCommPkgDestroy, flagged by `cache_transport'. The neighbor
+    * communicators are distributed graphs recv_procs -> me -> send_procs
+    * (forward jobs) and its reverse (transpose jobs) */
+   HYPRE_Int                    cache_transport;
+   HYPRE_Int                    has_neighbor_comm;
+   hypre_MPI_Comm               neighbor_comm;
+   hypre_MPI_Comm               neighbor_comm_T;
+   hypre_int                   *neighbor_send_counts;
+   hypre_int                   *neighbor_send_displs;
+   hypre_int                   *neighbor_recv_counts;
+   hypre_int                   *neighbor_recv_displs;
+
+   /* interior (no offd coupling) and boundary rows of the matrix owning this
+    * comm_pkg, used by the split host matvec. `split_offd_i' is the offd row
+    * pointer the split was computed from */
+   HYPRE_Int                    num_interior_rows;
+   HYPRE_Int                   *interior_rows;
+   HYPRE_Int                    num_boundary_rows;
+   HYPRE_Int                   *boundary_rows;
+   HYPRE_Int                   *split_offd_i;
 
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
 #if defined(HYPRE_USING_GPU)
@@ -116,6 +140,19 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNumInteriorRows(comm_pkg)     (comm_pkg -> num_interior_rows)
+#define hypre_ParCSRCommPkgInteriorRows(comm_pkg)        (comm_pkg -> interior_rows)
+#define hypre_ParCSRCommPkgNumBoundaryRows(comm_pkg)     (comm_pkg -> num_boundary_rows)
+#define hypre_ParCSRCommPkgBoundaryRows(comm_pkg)        (comm_pkg -> boundary_rows)
+#define hypre_ParCSRCommPkgSplitOffdI(comm_pkg)          (comm_pkg -> split_offd_i)
+#define hypre_ParCSRCommPkgCacheTransport(comm_pkg)      (comm_pkg -> cache_transport)
+#define hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)     (comm_pkg -> has_neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg)        (comm_pkg -> neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborCommT(comm_pkg)       (comm_pkg -> neighbor_comm_T)
+#define hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg)  (comm_pkg -> neighbor_send_counts)
+#define hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg)  (comm_pkg -> neighbor_send_displs)
+#define hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg)  (comm_pkg -> neighbor_recv_counts)
+#define hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg)  (comm_pkg -> neighbor_recv_displs)
 
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -155,6 +192,8 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandleActive(comm_handle)                 (comm_handle -> active)
+#define hypre_ParCSRCommHandlePersistentCommHandle(comm_handle)   (comm_handle -> persistent_comm_handle)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 /******************************************************************************
@@ -426,6 +465,41 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Reusable plan of the Galerkin product C = P^T A P
+ *
+ * Holds everything of the product that depends only on the sparsity
+ * pattern of A and on P, so that new values of A (same pattern) give new
+ * values of C without any symbolic work. The columns of AP, P_ext and
+ * RAP_int are numbered in one local space: the coarse columns owned by
+ * this process first, then the offd columns of AP (col_map_offd_AP).
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            num_cols_diag;     /* local coarse columns */
+   HYPRE_Int            num_cols_offd_AP;
+   HYPRE_BigInt        *col_map_offd_AP;
+   hypre_CSRMatrix     *P_loc;             /* local rows of P */
+   hypre_CSRMatrix     *P_ext;             /* rows of P matching the offd columns of A */
+   hypre_CSRMatrix     *AP;                /* local rows of A*P */
+   hypre_CSRMatrix     *PT_diag;
+   hypre_CSRMatrix     *PT_offd;
+   hypre_CSRMatrix     *RAP_int;           /* P_offd^T*AP, rows owned by other processes */
+   HYPRE_Int           *AP_to_C;           /* column of AP -> column of C, -1 if absent */
+   hypre_ParCSRCommPkg *comm_pkg_int;      /* sends the values of RAP_int to their owners */
+   HYPRE_Int            num_recv;
+   HYPRE_Int           *recv_pos;          /* position in C of the received values, -1 if absent */
+   HYPRE_Complex       *recv_data;
+
+   /* sizes of A and C the plan was built for */
+   HYPRE_Int            A_diag_nnz;
+   HYPRE_Int            A_offd_nnz;
+   HYPRE_Int            C_diag_nnz;
+   HYPRE_Int            C_offd_nnz;
+
+} hypre_ParCSRRAPPlan;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -750,6 +824,12 @@ HYPRE_Int hypre_GetAssumedPartitionProcFromRow ( MPI_Comm comm , HYPRE_BigInt ro
 HYPRE_Int hypre_GetAssumedPartitionRowRange ( MPI_Comm comm , HYPRE_Int proc_id , HYPRE_BigInt global_first_row , HYPRE_BigInt global_num_rows , HYPRE_BigInt *row_start , HYPRE_BigInt *row_end );
 HYPRE_Int hypre_ParVectorCreateAssumedPartition ( hypre_ParVector *vector );
 
+/* par_csr_binary_io.c */
+HYPRE_Int hypre_ParCSRMatrixPrintBinary ( hypre_ParCSRMatrix *matrix , const char *file_name );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixReadBinary ( MPI_Comm comm , const char *file_name );
+HYPRE_Int hypre_ParVectorPrintBinary ( hypre_ParVector *vector , const char *file_name );
+hypre_ParVector *hypre_ParVectorReadBinary ( MPI_Comm comm , const char *file_name );
+
 /* par_csr_bool_matop.c */
 hypre_ParCSRBooleanMatrix *hypre_ParBooleanMatmul ( hypre_ParCSRBooleanMatrix *A , hypre_ParCSRBooleanMatrix *B );
 hypre_CSRBooleanMatrix *hypre_ParCSRBooleanMatrixExtractBExt ( hypre_ParCSRBooleanMatrix *B , hypre_ParCSRBooleanMatrix *A );
@@ -787,6 +867,7 @@ HYPRE_Int hypre_BooleanGenerateDiagAndOffd ( hypre_CSRBooleanMatrix *A , hypre_P
 /* par_csr_communication.c */
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , void *send_data , void *recv_data );
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_MemoryLocation send_memory_location, void *send_data_in, HYPRE_MemoryLocation recv_memory_location, void *recv_data_in );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreateMultiVector ( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_vectors, HYPRE_MemoryLocation send_memory_location, void *send_data_in, HYPRE_MemoryLocation recv_memory_location, void *recv_data_in );
 HYPRE_Int hypre_ParCSRCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
 void hypre_ParCSRCommPkgCreate_core ( MPI_Comm comm , HYPRE_BigInt *col_map_offd , HYPRE_BigInt first_col_diag , HYPRE_BigInt *col_starts , HYPRE_Int num_cols_diag , HYPRE_Int num_cols_offd , HYPRE_Int *p_num_recvs , HYPRE_Int **p_recv_procs , HYPRE_Int **p_recv_vec_starts , HYPRE_Int *p_num_sends , HYPRE_Int **p_send_procs , HYPRE_Int **p_send_map_starts , HYPRE_Int **p_send_map_elmts );
 HYPRE_Int
@@ -825,13 +906,13 @@ HYPRE_Int hypre_ParCSRMatrixGetRowDevice( hypre_ParCSRMatrix *mat, HYPRE_BigInt
 HYPRE_Int hypre_ParCSRDiagScale( HYPRE_ParCSRMatrix HA, HYPRE_ParVector Hy, HYPRE_ParVector Hx );
 HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE_Complex tol, HYPRE_Int abs, HYPRE_Int option);
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg);
 void hypre_ParCSRPersistentCommHandleDestroy(hypre_ParCSRPersistentCommHandle *comm_handle);
 void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *comm_handle, HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle, HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
+HYPRE_Int hypre_ParCSRCommPkgCreateNeighborComm( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgDestroyNeighborComm( hypre_ParCSRCommPkg *comm_pkg );
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len, HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
 hypre_CSRMatrix* hypre_ParcsrGetExternalRowsWait(void *vrequest);
@@ -864,6 +945,9 @@ HYPRE_Int hypre_ParCSRMatrixSetNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_data );
+HYPRE_Int hypre_ParCSRMatrixSetSpMVUseSell ( hypre_ParCSRMatrix *matrix , HYPRE_Int use_sell );
+HYPRE_Int hypre_ParCSRMatrixSellDestroy ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixConvertToSinglePrecision ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetRowStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_row_starts );
 HYPRE_Int hypre_ParCSRMatrixSetColStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_col_starts );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm , const char *file_name );
@@ -888,6 +972,7 @@ HYPRE_Int hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation
 HYPRE_Int hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A, HYPRE_Real tol, HYPRE_Int type);
 
 /* par_csr_matvec.c */
+HYPRE_Int hypre_ParCSRMatrixMatvecSplitSetup ( hypre_ParCSRMatrix *A );
 // y = alpha*A*x + beta*b
 HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *b, hypre_ParVector *y );
 // y = alpha*A*x + beta*y
@@ -909,6 +994,11 @@ hypre_ParCSRMatrix *hypre_ParCSRMatrixRAP( hypre_ParCSRMatrix *R, hypre_ParCSRMa
 hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTDevice( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
 hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
 
+/* par_csr_triplemat_reuse.c */
+hypre_ParCSRRAPPlan *hypre_ParCSRRAPPlanCreate ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRRAPPlanCompute ( hypre_ParCSRRAPPlan *plan , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRRAPPlanDestroy ( hypre_ParCSRRAPPlan *plan );
+
 /* par_make_system.c */
 HYPRE_ParCSR_System_Problem *HYPRE_Generate2DSystem ( HYPRE_ParCSRMatrix H_L1 , HYPRE_ParCSRMatrix H_L2 , HYPRE_ParVector H_b1 , HYPRE_ParVector H_b2 , HYPRE_ParVector H_x1 , HYPRE_ParVector H_x2 , HYPRE_Complex *M_vals );
 HYPRE_Int HYPRE_Destroy2DSystem ( HYPRE_ParCSR_System_Problem *sys_prob );
@@ -927,6 +1017,8 @@ HYPRE_Int hypre_ParVectorPrint ( hypre_ParVector *vector , const char *file_name
 HYPRE_Int hypre_ParVectorSetConstantValues ( hypre_ParVector *v , HYPRE_Complex value );
 HYPRE_Int hypre_ParVectorSetRandomValues ( hypre_ParVector *v , HYPRE_Int seed );
 HYPRE_Int hypre_ParVectorCopy ( hypre_ParVector *x , hypre_ParVector *y );
+HYPRE_Int hypre_ParMultiVectorPack ( HYPRE_Int k , hypre_ParVector **x , hypre_ParVector *x_mv );
+HYPRE_Int hypre_ParMultiVectorUnpack ( hypre_ParVector *x_mv , HYPRE_Int k , hypre_ParVector **x );
 hypre_ParVector *hypre_ParVectorCloneShallow ( hypre_ParVector *x );
 hypre_ParVector *hypre_ParVectorCloneDeep_v2( hypre_ParVector *x, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParVectorMigrate(hypre_ParVector *x, HYPRE_MemoryLocation memory_location);
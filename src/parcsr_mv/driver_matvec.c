@@ -35,6 +35,8 @@ main( HYPRE_Int   argc,
    HYPRE_Complex 	*data, *data2;
    HYPRE_BigInt		*row_starts, *col_starts;
    char		file_name[80];
+   HYPRE_Int            transport, num_iter = 100;
+   HYPRE_Real           t_matvec, t_matvecT, t_max[2], norm_y, norm_x2;
    /* Initialize MPI */
    hypre_MPI_Init(&argc, &argv);
 
@@ -128,6 +130,46 @@ main( HYPRE_Int   argc,
 
    hypre_ParVectorPrint(x2, "transp"); 
 
+   /* compare the halo exchange transports on this matrix */
+   for (transport = 0; transport < 3; transport++)
+   {
+      HYPRE_ParCSRSetCommTransport(transport);
+
+      /* the comm_pkg caches transport state, so rebuild it */
+      hypre_MatvecCommPkgDestroy(hypre_ParCSRMatrixCommPkg(par_matrix));
+      hypre_ParCSRMatrixCommPkg(par_matrix) = NULL;
+      hypre_MatvecCommPkgCreate(par_matrix);
+
+      hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+      t_matvec = hypre_MPI_Wtime();
+      for (i = 0; i < num_iter; i++)
+      {
+         hypre_ParCSRMatrixMatvec(1.0, par_matrix, x, 0.0, y);
+      }
+      t_matvec = hypre_MPI_Wtime() - t_matvec;
+
+      hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+      t_matvecT = hypre_MPI_Wtime();
+      for (i = 0; i < num_iter; i++)
+      {
+         hypre_ParCSRMatrixMatvecT(1.0, par_matrix, y2, 0.0, x2);
+      }
+      t_matvecT = hypre_MPI_Wtime() - t_matvecT;
+
+      hypre_MPI_Allreduce(&t_matvec, &t_max[0], 1, HYPRE_MPI_REAL, hypre_MPI_MAX,
+                          hypre_MPI_COMM_WORLD);
+      hypre_MPI_Allreduce(&t_matvecT, &t_max[1], 1, HYPRE_MPI_REAL, hypre_MPI_MAX,
+                          hypre_MPI_COMM_WORLD);
+      norm_y  = sqrt(hypre_ParVectorInnerProd(y, y));
+      norm_x2 = sqrt(hypre_ParVectorInnerProd(x2, x2));
+      if (my_id == 0)
+      {
+         hypre_printf(" transport %d: %d matvecs %e s (|y| %e), %d matvecTs %e s (|x2| %e)\n",
+                      transport, num_iter, t_max[0], norm_y, num_iter, t_max[1], norm_x2);
+      }
+   }
+   HYPRE_ParCSRSetCommTransport(0);
+
    hypre_ParCSRMatrixDestroy(par_matrix);
    hypre_ParVectorDestroy(x);
    hypre_ParVectorDestroy(x2);
@@ -0,0 +1,780 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Binary file format for ParCSR matrices and vectors.
+ *
+ * A file holds one object, in native byte order, as a sequence of sections
+ * that all start at 8-byte aligned offsets computed from the header alone:
+ *
+ *   header       hypre_BINARY_HEADER_SIZE 64-bit integers (see below)
+ *   part index   row starts of the num_parts writing processes and, for
+ *                matrices, their column and nonzero starts; each is an array
+ *                of num_parts+1 64-bit integers
+ *   matrix data  row pointer   global_num_rows+1 64-bit offsets
+ *                columns       global_nnz 64-bit global column indices
+ *                values        global_nnz HYPRE_Complex
+ *   vector data  values        global_size HYPRE_Complex
+ *
+ * Since the layout is flat, any range of rows can be located without reading
+ * the rest of the file, and the file can be memory mapped as is. Files are
+ * written and read collectively with MPI-IO. A reader with as many processes
+ * as the writer gets the writer's partitioning, any other reader a uniform
+ * one.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+typedef long long int hypre_BinaryInt;
+
+#define hypre_BINARY_MAGIC        0
+#define hypre_BINARY_VERSION      1
+#define hypre_BINARY_KIND         2
+#define hypre_BINARY_INDEX_SIZE   3
+#define hypre_BINARY_VALUE_SIZE   4
+#define hypre_BINARY_NUM_ROWS     5
+#define hypre_BINARY_NUM_COLS     6
+#define hypre_BINARY_NNZ          7
+#define hypre_BINARY_NUM_PARTS    8
+#define hypre_BINARY_HEADER_SIZE  16
+
+#define hypre_BINARY_FORMAT_VERSION 1
+#define hypre_BINARY_KIND_MATRIX    1
+#define hypre_BINARY_KIND_VECTOR    2
+
+/* maximum number of bytes moved by a single MPI-IO call */
+#define hypre_BINARY_CHUNK_SIZE   ((hypre_longint) 1 << 30)
+
+static const char hypre_BinaryMagic[8] = {'H', 'Y', 'P', 'R', 'E', 'B', 'I', 'N'};
+
+typedef struct
+{
+   MPI_Comm  comm;
+#ifdef HYPRE_SEQUENTIAL
+   FILE     *fp;
+#else
+   MPI_File  fh;
+#endif
+} hypre_BinaryFile;
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileOpen
+ *
+ * Collective. Returns nonzero on every process if the file could not be
+ * opened.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryFileOpen( MPI_Comm          comm,
+                      const char       *file_name,
+                      HYPRE_Int         write,
+                      hypre_BinaryFile *file )
+{
+   HYPRE_Int ierr;
+
+   file -> comm = comm;
+#ifdef HYPRE_SEQUENTIAL
+   file -> fp = fopen(file_name, write ? "wb" : "rb");
+   ierr = (file -> fp == NULL);
+#else
+   {
+      int amode = write ? (MPI_MODE_CREATE | MPI_MODE_WRONLY) : MPI_MODE_RDONLY;
+
+      ierr = (MPI_File_open(comm, (char *) file_name, amode, MPI_INFO_NULL,
+                            &(file -> fh)) != MPI_SUCCESS);
+      if (!ierr && write)
+      {
+         /* drop the tail of a longer file with the same name */
+         MPI_File_set_size(file -> fh, 0);
+      }
+   }
+#endif
+
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: cannot open binary file\n");
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileClose
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryFileClose( hypre_BinaryFile *file )
+{
+#ifdef HYPRE_SEQUENTIAL
+   fclose(file -> fp);
+#else
+   MPI_File_close(&(file -> fh));
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileAccessAll
+ *
+ * Collective read (write = 0) or write (write = 1) of nbytes bytes at byte
+ * offset offset. Processes with nothing to move pass nbytes = 0. Large
+ * requests are split into chunks so that MPI counts fit in an int.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryFileAccessAll( hypre_BinaryFile *file,
+                           hypre_longint     offset,
+                           void             *buf,
+                           hypre_longint     nbytes,
+                           HYPRE_Int         write )
+{
+#ifdef HYPRE_SEQUENTIAL
+   size_t count = 0;
+
+   if (nbytes > 0)
+   {
+      fseek(file -> fp, offset, SEEK_SET);
+      count = write ? fwrite(buf, 1, nbytes, file -> fp) : fread(buf, 1, nbytes, file -> fp);
+   }
+   if ((hypre_longint) count != nbytes)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file access failed\n");
+   }
+#else
+   HYPRE_Int   num_chunks, max_chunks, c, ierr = 0, all_ierr;
+   MPI_Status  status;
+
+   num_chunks = (HYPRE_Int) ((nbytes + hypre_BINARY_CHUNK_SIZE - 1) / hypre_BINARY_CHUNK_SIZE);
+   hypre_MPI_Allreduce(&num_chunks, &max_chunks, 1, HYPRE_MPI_INT, hypre_MPI_MAX, file -> comm);
+
+   for (c = 0; c < max_chunks; c++)
+   {
+      hypre_longint pos   = hypre_min((hypre_longint) c * hypre_BINARY_CHUNK_SIZE, nbytes);
+      hypre_longint count = hypre_min(nbytes - pos, hypre_BINARY_CHUNK_SIZE);
+
+      if (write)
+      {
+         ierr |= MPI_File_write_at_all(file -> fh, (MPI_Offset) (offset + pos),
+                                       (char *) buf + pos, (int) count, MPI_BYTE, &status);
+      }
+      else
+      {
+         ierr |= MPI_File_read_at_all(file -> fh, (MPI_Offset) (offset + pos),
+                                      (char *) buf + pos, (int) count, MPI_BYTE, &status);
+      }
+   }
+
+   hypre_MPI_Allreduce(&ierr, &all_ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, file -> comm);
+   if (all_ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file access failed\n");
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryReadHeader
+ *
+ * Process 0 reads the header and broadcasts it. Returns nonzero on every
+ * process if the header does not describe an object of the given kind that
+ * this build can read.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryReadHeader( hypre_BinaryFile *file,
+                        HYPRE_Int         kind,
+                        hypre_BinaryInt  *header )
+{
+   HYPRE_Int my_id;
+
+   hypre_MPI_Comm_rank(file -> comm, &my_id);
+
+   hypre_BinaryFileAccessAll(file, 0, header,
+                             my_id ? 0 : hypre_BINARY_HEADER_SIZE * sizeof(hypre_BinaryInt), 0);
+   hypre_MPI_Bcast(header, hypre_BINARY_HEADER_SIZE * sizeof(hypre_BinaryInt), hypre_MPI_BYTE,
+                   0, file -> comm);
+
+   if ( memcmp(&header[hypre_BINARY_MAGIC], hypre_BinaryMagic, sizeof(hypre_BinaryInt)) ||
+        header[hypre_BINARY_VERSION] != hypre_BINARY_FORMAT_VERSION )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: not a hypre binary file\n");
+      return 1;
+   }
+   if (header[hypre_BINARY_KIND] != kind)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file holds a different object type\n");
+      return 1;
+   }
+   if ( header[hypre_BINARY_INDEX_SIZE] != sizeof(hypre_BinaryInt) ||
+        header[hypre_BINARY_VALUE_SIZE] != sizeof(HYPRE_Complex) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file value type does not match this build\n");
+      return 1;
+   }
+   if ( (hypre_BinaryInt) (HYPRE_BigInt) header[hypre_BINARY_NUM_ROWS] != header[hypre_BINARY_NUM_ROWS] ||
+        (hypre_BinaryInt) (HYPRE_BigInt) header[hypre_BINARY_NUM_COLS] != header[hypre_BINARY_NUM_COLS] )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file too large, reconfigure with --enable-bigint\n");
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryLocalPartitioning
+ *
+ * Returns the [first, last+1) range of rows (part = 0) or columns (part = 1)
+ * owned by this process: the writer's range if the file was written by as
+ * many processes as there are now, a uniform partitioning otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryLocalPartitioning( hypre_BinaryFile *file,
+                               hypre_BinaryInt  *header,
+                               HYPRE_Int         part,
+                               HYPRE_BigInt    **starts_ptr )
+{
+   HYPRE_Int        num_procs, my_id;
+   HYPRE_Int        num_parts = (HYPRE_Int) header[hypre_BINARY_NUM_PARTS];
+   HYPRE_BigInt     global_size = (HYPRE_BigInt)
+                                  header[part ? hypre_BINARY_NUM_COLS : hypre_BINARY_NUM_ROWS];
+   HYPRE_BigInt    *starts;
+   hypre_BinaryInt  range[2];
+   hypre_longint    offset;
+
+   hypre_MPI_Comm_size(file -> comm, &num_procs);
+   hypre_MPI_Comm_rank(file -> comm, &my_id);
+
+   if (num_procs == num_parts)
+   {
+      offset = (hypre_longint) sizeof(hypre_BinaryInt) *
+               (hypre_BINARY_HEADER_SIZE + part * (num_parts + 1) + my_id);
+      hypre_BinaryFileAccessAll(file, offset, range, 2 * sizeof(hypre_BinaryInt), 0);
+
+      starts = hypre_TAlloc(HYPRE_BigInt, 2, HYPRE_MEMORY_HOST);
+      starts[0] = (HYPRE_BigInt) range[0];
+      starts[1] = (HYPRE_BigInt) range[1];
+   }
+   else
+   {
+      hypre_GenerateLocalPartitioning(global_size, num_procs, my_id, &starts);
+   }
+
+   *starts_ptr = starts;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryWritePartIndex
+ *
+ * Process 0 writes the header and the part index. all_starts holds the
+ * num_fields local starts of each process, gathered on all processes.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryWritePartIndex( hypre_BinaryFile *file,
+                            hypre_BinaryInt  *header,
+                            HYPRE_Int         num_fields,
+                            hypre_BinaryInt  *all_starts,
+                            hypre_BinaryInt  *global_sizes )
+{
+   HYPRE_Int         num_procs, my_id, p, f;
+   hypre_BinaryInt  *index = NULL;
+   hypre_longint     index_size;
+
+   hypre_MPI_Comm_size(file -> comm, &num_procs);
+   hypre_MPI_Comm_rank(file -> comm, &my_id);
+
+   index_size = (hypre_longint) (hypre_BINARY_HEADER_SIZE + num_fields * (num_procs + 1));
+
+   if (my_id == 0)
+   {
+      index = hypre_TAlloc(hypre_BinaryInt, index_size, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(index, header, hypre_BinaryInt, hypre_BINARY_HEADER_SIZE,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      for (f = 0; f < num_fields; f++)
+      {
+         hypre_BinaryInt *starts = index + hypre_BINARY_HEADER_SIZE + f * (num_procs + 1);
+
+         for (p = 0; p < num_procs; p++)
+         {
+            starts[p] = all_starts[p * num_fields + f];
+         }
+         starts[num_procs] = global_sizes[f];
+      }
+   }
+
+   hypre_BinaryFileAccessAll(file, 0, index, my_id ? 0 : index_size * sizeof(hypre_BinaryInt), 1);
+
+   hypre_TFree(index, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryInitHeader
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryInitHeader( hypre_BinaryInt *header,
+                        HYPRE_Int        kind,
+                        hypre_BinaryInt  num_rows,
+                        hypre_BinaryInt  num_cols,
+                        hypre_BinaryInt  nnz,
+                        HYPRE_Int        num_parts )
+{
+   memset(header, 0, hypre_BINARY_HEADER_SIZE * sizeof(hypre_BinaryInt));
+   memcpy(&header[hypre_BINARY_MAGIC], hypre_BinaryMagic, sizeof(hypre_BinaryInt));
+   header[hypre_BINARY_VERSION]    = hypre_BINARY_FORMAT_VERSION;
+   header[hypre_BINARY_KIND]       = kind;
+   header[hypre_BINARY_INDEX_SIZE] = sizeof(hypre_BinaryInt);
+   header[hypre_BINARY_VALUE_SIZE] = sizeof(HYPRE_Complex);
+   header[hypre_BINARY_NUM_ROWS]   = num_rows;
+   header[hypre_BINARY_NUM_COLS]   = num_cols;
+   header[hypre_BINARY_NNZ]        = nnz;
+   header[hypre_BINARY_NUM_PARTS]  = num_parts;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintBinary
+ *
+ * Collective. Rows are written with their diag entries first, so the
+ * diagonal of a square matrix stays the first entry of its row.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintBinary( hypre_ParCSRMatrix *matrix,
+                               const char         *file_name )
+{
+   MPI_Comm          comm;
+   HYPRE_Int         num_procs, my_id, p;
+   hypre_CSRMatrix  *diag, *offd;
+   HYPRE_Int        *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex    *diag_data, *offd_data;
+   hypre_float      *diag_data_sp, *offd_data_sp;
+   HYPRE_BigInt     *col_map_offd, first_col;
+   HYPRE_Int         num_rows, num_rowptr, local_nnz, i;
+   hypre_BinaryInt   header[hypre_BINARY_HEADER_SIZE], local_info[3], global_sizes[3];
+   hypre_BinaryInt  *all_info, nnz_start, global_nnz, global_num_rows;
+   hypre_BinaryInt  *rowptr, *cols;
+   HYPRE_Complex    *values;
+   hypre_longint     rowptr_offset, cols_offset, values_offset;
+   hypre_BinaryFile  file;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(matrix)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Binary output requires a host matrix\n");
+      return hypre_error_flag;
+   }
+
+   comm = hypre_ParCSRMatrixComm(matrix);
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   diag         = hypre_ParCSRMatrixDiag(matrix);
+   offd         = hypre_ParCSRMatrixOffd(matrix);
+   diag_i       = hypre_CSRMatrixI(diag);
+   diag_j       = hypre_CSRMatrixJ(diag);
+   diag_data    = hypre_CSRMatrixData(diag);
+   diag_data_sp = hypre_CSRMatrixDataSp(diag);
+   offd_i       = hypre_CSRMatrixI(offd);
+   offd_j       = hypre_CSRMatrixJ(offd);
+   offd_data    = hypre_CSRMatrixData(offd);
+   offd_data_sp = hypre_CSRMatrixDataSp(offd);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(matrix);
+   first_col    = hypre_ParCSRMatrixFirstColDiag(matrix);
+   num_rows     = hypre_CSRMatrixNumRows(diag);
+   local_nnz    = diag_i[num_rows] + offd_i[num_rows];
+
+   /* gather the local row, column and nonzero starts of all processes */
+   local_info[0] = (hypre_BinaryInt) hypre_ParCSRMatrixFirstRowIndex(matrix);
+   local_info[1] = (hypre_BinaryInt) first_col;
+   local_info[2] = (hypre_BinaryInt) local_nnz;
+
+   all_info = hypre_TAlloc(hypre_BinaryInt, 3 * num_procs, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(local_info, 3 * sizeof(hypre_BinaryInt), hypre_MPI_BYTE,
+                       all_info, 3 * sizeof(hypre_BinaryInt), hypre_MPI_BYTE, comm);
+
+   global_nnz = 0;
+   for (p = 0; p < num_procs; p++)
+   {
+      hypre_BinaryInt nnz = all_info[3 * p + 2];
+
+      all_info[3 * p + 2] = global_nnz;
+      global_nnz += nnz;
+   }
+   nnz_start       = all_info[3 * my_id + 2];
+   global_num_rows = (hypre_BinaryInt) hypre_ParCSRMatrixGlobalNumRows(matrix);
+
+   global_sizes[0] = global_num_rows;
+   global_sizes[1] = (hypre_BinaryInt) hypre_ParCSRMatrixGlobalNumCols(matrix);
+   global_sizes[2] = global_nnz;
+
+   hypre_BinaryInitHeader(header, hypre_BINARY_KIND_MATRIX, global_sizes[0], global_sizes[1],
+                          global_nnz, num_procs);
+
+   if (hypre_BinaryFileOpen(comm, file_name, 1, &file))
+   {
+      hypre_TFree(all_info, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   hypre_BinaryWritePartIndex(&file, header, 3, all_info, global_sizes);
+   hypre_TFree(all_info, HYPRE_MEMORY_HOST);
+
+   /* convert the local rows to global rows; the last process closes the
+    * row pointer */
+   num_rowptr = num_rows + (my_id == num_procs - 1);
+   rowptr = hypre_TAlloc(hypre_BinaryInt, num_rowptr, HYPRE_MEMORY_HOST);
+   cols   = hypre_TAlloc(hypre_BinaryInt, local_nnz, HYPRE_MEMORY_HOST);
+   values = hypre_TAlloc(HYPRE_Complex, local_nnz, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int j, pos = diag_i[i] + offd_i[i];
+
+      rowptr[i] = nnz_start + pos;
+      for (j = diag_i[i]; j < diag_i[i + 1]; j++, pos++)
+      {
+         cols[pos]   = (hypre_BinaryInt) (first_col + diag_j[j]);
+         values[pos] = diag_data ? diag_data[j] : (HYPRE_Complex) diag_data_sp[j];
+      }
+      for (j = offd_i[i]; j < offd_i[i + 1]; j++, pos++)
+      {
+         cols[pos]   = (hypre_BinaryInt) col_map_offd[offd_j[j]];
+         values[pos] = offd_data ? offd_data[j] : (HYPRE_Complex) offd_data_sp[j];
+      }
+   }
+   if (num_rowptr > num_rows)
+   {
+      rowptr[num_rows] = nnz_start + local_nnz;
+   }
+
+   rowptr_offset = (hypre_longint) sizeof(hypre_BinaryInt) *
+                   (hypre_BINARY_HEADER_SIZE + 3 * (num_procs + 1));
+   cols_offset   = rowptr_offset + (hypre_longint) sizeof(hypre_BinaryInt) * (global_num_rows + 1);
+   values_offset = cols_offset + (hypre_longint) sizeof(hypre_BinaryInt) * global_nnz;
+
+   hypre_BinaryFileAccessAll(&file, rowptr_offset + sizeof(hypre_BinaryInt) * local_info[0],
+                             rowptr, sizeof(hypre_BinaryInt) * (hypre_longint) num_rowptr, 1);
+   hypre_BinaryFileAccessAll(&file, cols_offset + sizeof(hypre_BinaryInt) * nnz_start,
+                             cols, sizeof(hypre_BinaryInt) * (hypre_longint) local_nnz, 1);
+   hypre_BinaryFileAccessAll(&file, values_offset + sizeof(HYPRE_Complex) * nnz_start,
+                             values, sizeof(HYPRE_Complex) * (hypre_longint) local_nnz, 1);
+
+   hypre_BinaryFileClose(&file);
+
+   hypre_TFree(rowptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinary
+ *
+ * Collective. Returns NULL if the file cannot be read.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix *
+hypre_ParCSRMatrixReadBinary( MPI_Comm    comm,
+                              const char *file_name )
+{
+   hypre_ParCSRMatrix  *matrix;
+   hypre_CSRMatrix     *diag, *offd;
+   HYPRE_Int           *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex       *diag_data, *offd_data;
+   HYPRE_BigInt        *row_starts, *col_starts, *col_map_offd, *offd_cols;
+   HYPRE_BigInt         first_row, first_col, last_col;
+   HYPRE_Int            num_procs, num_parts, num_rows, local_nnz;
+   HYPRE_Int            diag_nnz, offd_nnz, num_cols_offd, i, k;
+   hypre_BinaryInt      header[hypre_BINARY_HEADER_SIZE];
+   hypre_BinaryInt      global_num_rows, global_nnz, nnz_start;
+   hypre_BinaryInt     *rowptr, *cols;
+   HYPRE_Complex       *values;
+   hypre_longint        rowptr_offset, cols_offset, values_offset;
+   hypre_BinaryFile     file;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (hypre_BinaryFileOpen(comm, file_name, 0, &file))
+   {
+      return NULL;
+   }
+   if (hypre_BinaryReadHeader(&file, hypre_BINARY_KIND_MATRIX, header))
+   {
+      hypre_BinaryFileClose(&file);
+      return NULL;
+   }
+
+   global_num_rows = header[hypre_BINARY_NUM_ROWS];
+   global_nnz      = header[hypre_BINARY_NNZ];
+   num_parts       = (HYPRE_Int) header[hypre_BINARY_NUM_PARTS];
+
+   hypre_BinaryLocalPartitioning(&file, header, 0, &row_starts);
+   if (num_parts != num_procs && header[hypre_BINARY_NUM_COLS] == global_num_rows)
+   {
+      col_starts = row_starts;
+   }
+   else
+   {
+      hypre_BinaryLocalPartitioning(&file, header, 1, &col_starts);
+      if (col_starts[0] == row_starts[0] && col_starts[1] == row_starts[1])
+      {
+         hypre_TFree(col_starts, HYPRE_MEMORY_HOST);
+         col_starts = row_starts;
+      }
+   }
+
+   first_row = row_starts[0];
+   first_col = col_starts[0];
+   last_col  = col_starts[1] - 1;
+   num_rows  = (HYPRE_Int) (row_starts[1] - first_row);
+
+   rowptr_offset = (hypre_longint) sizeof(hypre_BinaryInt) *
+                   (hypre_BINARY_HEADER_SIZE + 3 * (num_parts + 1));
+   cols_offset   = rowptr_offset + (hypre_longint) sizeof(hypre_BinaryInt) * (global_num_rows + 1);
+   values_offset = cols_offset + (hypre_longint) sizeof(hypre_BinaryInt) * global_nnz;
+
+   /* read the local rows */
+   rowptr = hypre_TAlloc(hypre_BinaryInt, num_rows + 1, HYPRE_MEMORY_HOST);
+   hypre_BinaryFileAccessAll(&file, rowptr_offset + sizeof(hypre_BinaryInt) * (hypre_longint) first_row,
+                             rowptr, sizeof(hypre_BinaryInt) * (hypre_longint) (num_rows + 1), 0);
+
+   nnz_start = rowptr[0];
+   local_nnz = (HYPRE_Int) (rowptr[num_rows] - nnz_start);
+   cols   = hypre_TAlloc(hypre_BinaryInt, local_nnz, HYPRE_MEMORY_HOST);
+   values = hypre_TAlloc(HYPRE_Complex, local_nnz, HYPRE_MEMORY_HOST);
+
+   hypre_BinaryFileAccessAll(&file, cols_offset + sizeof(hypre_BinaryInt) * nnz_start,
+                             cols, sizeof(hypre_BinaryInt) * (hypre_longint) local_nnz, 0);
+   hypre_BinaryFileAccessAll(&file, values_offset + sizeof(HYPRE_Complex) * nnz_start,
+                             values, sizeof(HYPRE_Complex) * (hypre_longint) local_nnz, 0);
+
+   hypre_BinaryFileClose(&file);
+
+   /* split the rows into diag and offd and build the offd column map */
+   diag_nnz = 0;
+   for (k = 0; k < local_nnz; k++)
+   {
+      if (cols[k] >= first_col && cols[k] <= last_col)
+      {
+         diag_nnz++;
+      }
+   }
+   offd_nnz = local_nnz - diag_nnz;
+
+   offd_cols = hypre_TAlloc(HYPRE_BigInt, offd_nnz, HYPRE_MEMORY_HOST);
+   for (k = 0, i = 0; k < local_nnz; k++)
+   {
+      if (cols[k] < first_col || cols[k] > last_col)
+      {
+         offd_cols[i++] = (HYPRE_BigInt) cols[k];
+      }
+   }
+   hypre_BigQsort0(offd_cols, 0, offd_nnz - 1);
+   num_cols_offd = 0;
+   for (k = 0; k < offd_nnz; k++)
+   {
+      if (num_cols_offd == 0 || offd_cols[k] != offd_cols[num_cols_offd - 1])
+      {
+         offd_cols[num_cols_offd++] = offd_cols[k];
+      }
+   }
+
+   matrix = hypre_ParCSRMatrixCreate(comm, (HYPRE_BigInt) global_num_rows,
+                                     (HYPRE_BigInt) header[hypre_BINARY_NUM_COLS],
+                                     row_starts, col_starts, num_cols_offd, diag_nnz, offd_nnz);
+   hypre_ParCSRMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+
+   diag         = hypre_ParCSRMatrixDiag(matrix);
+   offd         = hypre_ParCSRMatrixOffd(matrix);
+   diag_i       = hypre_CSRMatrixI(diag);
+   diag_j       = hypre_CSRMatrixJ(diag);
+   diag_data    = hypre_CSRMatrixData(diag);
+   offd_i       = hypre_CSRMatrixI(offd);
+   offd_j       = hypre_CSRMatrixJ(offd);
+   offd_data    = hypre_CSRMatrixData(offd);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(matrix);
+
+   hypre_TMemcpy(col_map_offd, offd_cols, HYPRE_BigInt, num_cols_offd,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_cols, HYPRE_MEMORY_HOST);
+
+   diag_i[0] = 0;
+   offd_i[0] = 0;
+   diag_nnz  = 0;
+   offd_nnz  = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int row_start = diag_nnz;
+
+      for (k = (HYPRE_Int) (rowptr[i] - nnz_start); k < (HYPRE_Int) (rowptr[i + 1] - nnz_start); k++)
+      {
+         HYPRE_BigInt col = (HYPRE_BigInt) cols[k];
+
+         if (col >= first_col && col <= last_col)
+         {
+            diag_j[diag_nnz]    = (HYPRE_Int) (col - first_col);
+            diag_data[diag_nnz] = values[k];
+
+            /* keep the diagonal first */
+            if (col == first_row + i && diag_nnz > row_start)
+            {
+               diag_j[diag_nnz]     = diag_j[row_start];
+               diag_data[diag_nnz]  = diag_data[row_start];
+               diag_j[row_start]    = (HYPRE_Int) (col - first_col);
+               diag_data[row_start] = values[k];
+            }
+            diag_nnz++;
+         }
+         else
+         {
+            offd_j[offd_nnz]    = hypre_BigBinarySearch(col_map_offd, col, num_cols_offd);
+            offd_data[offd_nnz] = values[k];
+            offd_nnz++;
+         }
+      }
+      diag_i[i + 1] = diag_nnz;
+      offd_i[i + 1] = offd_nnz;
+   }
+
+   hypre_CSRMatrixSetRownnz(diag);
+   hypre_CSRMatrixSetRownnz(offd);
+
+   hypre_TFree(rowptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   return matrix;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPrintBinary( hypre_ParVector *vector,
+                            const char      *file_name )
+{
+   MPI_Comm          comm;
+   HYPRE_Int         num_procs, my_id, local_size;
+   HYPRE_Complex    *data;
+   hypre_BinaryInt   header[hypre_BINARY_HEADER_SIZE], first_index, global_size;
+   hypre_BinaryInt  *all_starts;
+   hypre_longint     values_offset;
+   hypre_BinaryFile  file;
+
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (hypre_VectorNumVectors(hypre_ParVectorLocalVector(vector)) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Binary output of multivectors is not supported\n");
+      return hypre_error_flag;
+   }
+   if (hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(vector)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Binary output requires a host vector\n");
+      return hypre_error_flag;
+   }
+
+   comm = hypre_ParVectorComm(vector);
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   data        = hypre_VectorData(hypre_ParVectorLocalVector(vector));
+   local_size  = hypre_VectorSize(hypre_ParVectorLocalVector(vector));
+   first_index = (hypre_BinaryInt) hypre_ParVectorFirstIndex(vector);
+   global_size = (hypre_BinaryInt) hypre_ParVectorGlobalSize(vector);
+
+   all_starts = hypre_TAlloc(hypre_BinaryInt, num_procs, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&first_index, sizeof(hypre_BinaryInt), hypre_MPI_BYTE,
+                       all_starts, sizeof(hypre_BinaryInt), hypre_MPI_BYTE, comm);
+
+   hypre_BinaryInitHeader(header, hypre_BINARY_KIND_VECTOR, global_size, 1, 0, num_procs);
+
+   if (hypre_BinaryFileOpen(comm, file_name, 1, &file))
+   {
+      hypre_TFree(all_starts, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   hypre_BinaryWritePartIndex(&file, header, 1, all_starts, &global_size);
+   hypre_TFree(all_starts, HYPRE_MEMORY_HOST);
+
+   values_offset = (hypre_longint) sizeof(hypre_BinaryInt) * (hypre_BINARY_HEADER_SIZE + num_procs + 1);
+   hypre_BinaryFileAccessAll(&file, values_offset + sizeof(HYPRE_Complex) * first_index,
+                             data, sizeof(HYPRE_Complex) * (hypre_longint) local_size, 1);
+
+   hypre_BinaryFileClose(&file);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorReadBinary
+ *
+ * Collective. Returns NULL if the file cannot be read.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParVector *
+hypre_ParVectorReadBinary( MPI_Comm    comm,
+                           const char *file_name )
+{
+   hypre_ParVector   *vector;
+   HYPRE_BigInt      *partitioning;
+   HYPRE_Int          num_parts;
+   hypre_BinaryInt    header[hypre_BINARY_HEADER_SIZE];
+   hypre_longint      values_offset;
+   hypre_BinaryFile   file;
+
+   if (hypre_BinaryFileOpen(comm, file_name, 0, &file))
+   {
+      return NULL;
+   }
+   if (hypre_BinaryReadHeader(&file, hypre_BINARY_KIND_VECTOR, header))
+   {
+      hypre_BinaryFileClose(&file);
+      return NULL;
+   }
+
+   num_parts = (HYPRE_Int) header[hypre_BINARY_NUM_PARTS];
+   hypre_BinaryLocalPartitioning(&file, header, 0, &partitioning);
+
+   vector = hypre_ParVectorCreate(comm, (HYPRE_BigInt) header[hypre_BINARY_NUM_ROWS], partitioning);
+   hypre_ParVectorInitialize_v2(vector, HYPRE_MEMORY_HOST);
+
+   values_offset = (hypre_longint) sizeof(hypre_BinaryInt) * (hypre_BINARY_HEADER_SIZE + num_parts + 1);
+   hypre_BinaryFileAccessAll(&file, values_offset + sizeof(HYPRE_Complex) * (hypre_longint) partitioning[0],
+                             hypre_VectorData(hypre_ParVectorLocalVector(vector)),
+                             sizeof(HYPRE_Complex) * (hypre_longint) (partitioning[1] - partitioning[0]), 0);
+
+   hypre_BinaryFileClose(&file);
+
+   return vector;
+}
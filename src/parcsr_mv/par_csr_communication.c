@@ -9,7 +9,6 @@
 
 /*==========================================================================*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 static CommPkgJobType getJobTypeOf(HYPRE_Int job)
 {
    CommPkgJobType job_type = HYPRE_COMM_PKG_JOB_COMPLEX;
@@ -246,6 +245,7 @@ void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *co
 {
    hypre_ParCSRCommHandleSendData(comm_handle) = send_data;
    hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = send_memory_location;
+   hypre_ParCSRCommHandleActive(comm_handle) = 1;
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
@@ -272,6 +272,7 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
 {
    hypre_ParCSRCommHandleRecvData(comm_handle) = recv_data;
    hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = recv_memory_location;
+   hypre_ParCSRCommHandleActive(comm_handle) = 0;
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
@@ -292,7 +293,152 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
                     HYPRE_MEMORY_HOST);
    }
 }
-#endif // HYPRE_USING_PERSISTENT_COMM
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNeighborComm
+ *
+ * Builds the distributed graph communicators used by the neighborhood
+ * collective transport, together with the MPI count and displacement arrays
+ * derived from send_map_starts and recv_vec_starts. Collective on the
+ * communicator of comm_pkg, so it is called where the comm_pkg is created and
+ * not from an exchange: processes without neighbors skip some exchanges.
+ * Without MPI-3 this is a no-op and the comm_pkg keeps using point-to-point
+ * messages.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+#ifdef HYPRE_HAVE_MPI_NEIGHBOR_COLL
+   MPI_Comm   comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   hypre_int *send_counts, *send_displs;
+   hypre_int *recv_counts, *recv_displs;
+   HYPRE_Int  i;
+
+   if (hypre_ParCSRCommPkgHasNeighborComm(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Dist_graph_create_adjacent(comm, num_recvs, hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                                        num_sends, hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                                        &hypre_ParCSRCommPkgNeighborComm(comm_pkg));
+   hypre_MPI_Dist_graph_create_adjacent(comm, num_sends, hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                                        num_recvs, hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                                        &hypre_ParCSRCommPkgNeighborCommT(comm_pkg));
+
+   /* one extra entry so that the arrays are never NULL */
+   send_counts = hypre_TAlloc(hypre_int, num_sends + 1, HYPRE_MEMORY_HOST);
+   send_displs = hypre_TAlloc(hypre_int, num_sends + 1, HYPRE_MEMORY_HOST);
+   recv_counts = hypre_TAlloc(hypre_int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   recv_displs = hypre_TAlloc(hypre_int, num_recvs + 1, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_sends; i++)
+   {
+      send_displs[i] = (hypre_int) hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+      send_counts[i] = (hypre_int) (hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) -
+                                    hypre_ParCSRCommPkgSendMapStart(comm_pkg, i));
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      recv_displs[i] = (hypre_int) hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+      recv_counts[i] = (hypre_int) (hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) -
+                                    hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i));
+   }
+
+   hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg) = send_counts;
+   hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg) = send_displs;
+   hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg) = recv_counts;
+   hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg) = recv_displs;
+   hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)    = 1;
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgDestroyNeighborComm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgDestroyNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+#ifdef HYPRE_HAVE_MPI_NEIGHBOR_COLL
+   if (!hypre_ParCSRCommPkgHasNeighborComm(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_free(&hypre_ParCSRCommPkgNeighborComm(comm_pkg));
+   hypre_MPI_Comm_free(&hypre_ParCSRCommPkgNeighborCommT(comm_pkg));
+   hypre_TFree(hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgHasNeighborComm(comm_pkg) = 0;
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgNeighborAlltoallv
+ *
+ * Posts the exchange of jobs 1, 2, 11, 12, 21 and 22 as a single
+ * nonblocking neighborhood collective.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRCommPkgNeighborAlltoallv( HYPRE_Int            job,
+                                      hypre_ParCSRCommPkg *comm_pkg,
+                                      void                *send_data,
+                                      void                *recv_data,
+                                      hypre_MPI_Request   *request )
+{
+#ifdef HYPRE_HAVE_MPI_NEIGHBOR_COLL
+   hypre_MPI_Datatype type;
+
+   switch (job)
+   {
+      case 1:
+      case 2:
+         type = HYPRE_MPI_COMPLEX;
+         break;
+      case 11:
+      case 12:
+         type = HYPRE_MPI_INT;
+         break;
+      default:
+         type = HYPRE_MPI_BIG_INT;
+         break;
+   }
+
+   if (job == 1 || job == 11 || job == 21)
+   {
+      hypre_MPI_Ineighbor_alltoallv(send_data,
+                                    hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg),
+                                    hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg), type,
+                                    recv_data,
+                                    hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg),
+                                    hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg), type,
+                                    hypre_ParCSRCommPkgNeighborComm(comm_pkg), request);
+   }
+   else
+   {
+      hypre_MPI_Ineighbor_alltoallv(send_data,
+                                    hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg),
+                                    hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg), type,
+                                    recv_data,
+                                    hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg),
+                                    hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg), type,
+                                    hypre_ParCSRCommPkgNeighborCommT(comm_pkg), request);
+   }
+#endif
+
+   return hypre_error_flag;
+}
 
 hypre_ParCSRCommHandle*
 hypre_ParCSRCommHandleCreate ( HYPRE_Int            job,
@@ -325,6 +471,8 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    HYPRE_Int                  ip, vec_start, vec_len;
    void                      *send_data;
    void                      *recv_data;
+   HYPRE_Int                  transport = hypre_HandleCommTransport(hypre_handle());
+   HYPRE_Int                  alt_job, use_neighbor;
 
    /*--------------------------------------------------------------------
     * hypre_Initialize sets up a communication handle,
@@ -355,7 +503,38 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
     *           and recv_mpi_types to be set in comm_pkg.
     *           datatypes need to point to absolute
     *           addresses, e.g. generated using hypre_MPI_Address .
+    *
+    * Jobs 1, 2, 11, 12, 21 and 22 can also use the persistent or the
+    * neighborhood collective transport (see HYPRE_ParCSRSetCommTransport).
     *--------------------------------------------------------------------*/
+   alt_job = (job == 1 || job == 2 || job == 11 || job == 12 || job == 21 || job == 22);
+
+   if (transport == 1 && alt_job && hypre_ParCSRCommPkgCacheTransport(comm_pkg))
+   {
+      hypre_ParCSRPersistentCommHandle *persistent_handle =
+         hypre_ParCSRCommPkgGetPersistentCommHandle(job, comm_pkg);
+
+      /* another exchange of the same job type still in flight falls back
+       * to point-to-point below */
+      if (!hypre_ParCSRCommHandleActive(persistent_handle))
+      {
+         hypre_ParCSRPersistentCommHandleStart(persistent_handle, send_memory_location, send_data_in);
+
+         comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle, 1, HYPRE_MEMORY_HOST);
+
+         hypre_ParCSRCommHandleCommPkg(comm_handle)              = comm_pkg;
+         hypre_ParCSRCommHandleSendMemoryLocation(comm_handle)   = send_memory_location;
+         hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle)   = recv_memory_location;
+         hypre_ParCSRCommHandleSendData(comm_handle)             = send_data_in;
+         hypre_ParCSRCommHandleRecvData(comm_handle)             = recv_data_in;
+         hypre_ParCSRCommHandlePersistentCommHandle(comm_handle) = persistent_handle;
+
+         return ( comm_handle );
+      }
+   }
+
+   use_neighbor = (transport == 2 && alt_job && hypre_ParCSRCommPkgHasNeighborComm(comm_pkg));
+
 #ifndef HYPRE_WITH_GPU_AWARE_MPI
    switch (job)
    {
@@ -417,6 +596,29 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    hypre_SyncCudaComputeStream(hypre_handle());
 #endif
 
+   if (use_neighbor)
+   {
+      num_requests = 1;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgNeighborAlltoallv(job, comm_pkg, send_data, recv_data, requests);
+
+      comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle,  1, HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
+      hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = send_memory_location;
+      hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = recv_memory_location;
+      hypre_ParCSRCommHandleNumSendBytes(comm_handle)       = num_send_bytes;
+      hypre_ParCSRCommHandleNumRecvBytes(comm_handle)       = num_recv_bytes;
+      hypre_ParCSRCommHandleSendData(comm_handle)           = send_data_in;
+      hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data_in;
+      hypre_ParCSRCommHandleSendDataBuffer(comm_handle)     = send_data;
+      hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data;
+      hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
+      hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
+
+      return ( comm_handle );
+   }
+
    num_requests = num_sends + num_recvs;
    requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
 
@@ -580,6 +782,142 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    return ( comm_handle );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleCreateMultiVector
+ *
+ * Same as jobs 1 and 2 of hypre_ParCSRCommHandleCreate_v2, but every entry
+ * of the send map (job 1) or of the external columns (job 2) carries
+ * num_vectors consecutive HYPRE_Complex values, i.e., the buffers hold the
+ * halo of a multivector in row-major (interleaved) order. This exchanges all
+ * vectors with one message per neighbor instead of one per vector and
+ * neighbor. Always uses point-to-point messages.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRCommHandle*
+hypre_ParCSRCommHandleCreateMultiVector( HYPRE_Int            job,
+                                         hypre_ParCSRCommPkg *comm_pkg,
+                                         HYPRE_Int            num_vectors,
+                                         HYPRE_MemoryLocation send_memory_location,
+                                         void                *send_data_in,
+                                         HYPRE_MemoryLocation recv_memory_location,
+                                         void                *recv_data_in )
+{
+   HYPRE_Int                  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   MPI_Comm                   comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                  num_send_bytes = 0;
+   HYPRE_Int                  num_recv_bytes = 0;
+   hypre_ParCSRCommHandle    *comm_handle;
+   HYPRE_Int                  num_requests;
+   hypre_MPI_Request         *requests;
+   HYPRE_Int                  i, j;
+   HYPRE_Int                  ip, vec_start, vec_len;
+   HYPRE_Int                  num_send_procs, num_recv_procs;
+   HYPRE_Int                 *send_procs, *recv_procs;
+   HYPRE_Int                 *send_starts, *recv_starts;
+   HYPRE_Complex             *send_data;
+   HYPRE_Complex             *recv_data;
+
+   if (job != 1 && job != 2)
+   {
+      hypre_error_in_arg(1);
+      return NULL;
+   }
+
+   /* job 2 runs the exchange of job 1 backwards */
+   if (job == 1)
+   {
+      num_send_procs = num_sends;
+      send_procs     = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      send_starts    = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+      num_recv_procs = num_recvs;
+      recv_procs     = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      recv_starts    = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   }
+   else
+   {
+      num_send_procs = num_recvs;
+      send_procs     = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      send_starts    = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+      num_recv_procs = num_sends;
+      recv_procs     = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      recv_starts    = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   }
+
+#ifndef HYPRE_WITH_GPU_AWARE_MPI
+   num_send_bytes = send_starts[num_send_procs] * num_vectors * sizeof(HYPRE_Complex);
+   num_recv_bytes = recv_starts[num_recv_procs] * num_vectors * sizeof(HYPRE_Complex);
+
+   hypre_MemoryLocation act_send_memory_location = hypre_GetActualMemLocation(send_memory_location);
+
+   if ( act_send_memory_location == hypre_MEMORY_DEVICE || act_send_memory_location == hypre_MEMORY_UNIFIED )
+   {
+      send_data = (HYPRE_Complex *) hypre_TAlloc(char, num_send_bytes, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(send_data, send_data_in, char, num_send_bytes, HYPRE_MEMORY_HOST, HYPRE_MEMORY_DEVICE);
+   }
+   else
+   {
+      send_data = (HYPRE_Complex *) send_data_in;
+   }
+
+   hypre_MemoryLocation act_recv_memory_location = hypre_GetActualMemLocation(recv_memory_location);
+
+   if ( act_recv_memory_location == hypre_MEMORY_DEVICE || act_recv_memory_location == hypre_MEMORY_UNIFIED )
+   {
+      recv_data = (HYPRE_Complex *) hypre_TAlloc(char, num_recv_bytes, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      recv_data = (HYPRE_Complex *) recv_data_in;
+   }
+#else /* #ifndef HYPRE_WITH_GPU_AWARE_MPI */
+   send_data = (HYPRE_Complex *) send_data_in;
+   recv_data = (HYPRE_Complex *) recv_data_in;
+   hypre_SyncCudaComputeStream(hypre_handle());
+#endif
+
+   num_requests = num_send_procs + num_recv_procs;
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (i = 0; i < num_recv_procs; i++)
+   {
+      ip = recv_procs[i];
+      vec_start = recv_starts[i] * num_vectors;
+      vec_len = (recv_starts[i+1] - recv_starts[i]) * num_vectors;
+      hypre_MPI_Irecv(&recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      ip, 0, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_send_procs; i++)
+   {
+      ip = send_procs[i];
+      vec_start = send_starts[i] * num_vectors;
+      vec_len = (send_starts[i+1] - send_starts[i]) * num_vectors;
+      hypre_MPI_Isend(&send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      ip, 0, comm, &requests[j++]);
+   }
+
+   /*--------------------------------------------------------------------
+    * set up comm_handle and return
+    *--------------------------------------------------------------------*/
+
+   comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle,  1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
+   hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = send_memory_location;
+   hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = recv_memory_location;
+   hypre_ParCSRCommHandleNumSendBytes(comm_handle)       = num_send_bytes;
+   hypre_ParCSRCommHandleNumRecvBytes(comm_handle)       = num_recv_bytes;
+   hypre_ParCSRCommHandleSendData(comm_handle)           = send_data_in;
+   hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data_in;
+   hypre_ParCSRCommHandleSendDataBuffer(comm_handle)     = send_data;
+   hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data;
+   hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
+   hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
+
+   return ( comm_handle );
+}
+
 HYPRE_Int
 hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
 {
@@ -588,6 +926,16 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
       return hypre_error_flag;
    }
 
+   if (hypre_ParCSRCommHandlePersistentCommHandle(comm_handle))
+   {
+      hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRCommHandlePersistentCommHandle(comm_handle),
+                                           hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle),
+                                           hypre_ParCSRCommHandleRecvData(comm_handle));
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    if (hypre_ParCSRCommHandleNumRequests(comm_handle))
    {
       hypre_MPI_Status *status0;
@@ -932,6 +1280,14 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
                                     apart,
                                     comm_pkg );
 
+   /* the matrix comm_pkg is freed by hypre_MatvecCommPkgDestroy, so it
+    * may cache transport state */
+   hypre_ParCSRCommPkgCacheTransport(comm_pkg) = 1;
+   if (hypre_HandleCommTransport(hypre_handle()) == 2)
+   {
+      hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+   }
+
    return hypre_error_flag;
 }
 
@@ -939,7 +1295,6 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
 HYPRE_Int
 hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
 {
-#ifdef HYPRE_USING_PERSISTENT_COMM
    HYPRE_Int i;
    for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
    {
@@ -948,7 +1303,7 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
          hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
       }
    }
-#endif
+   hypre_ParCSRCommPkgDestroyNeighborComm(comm_pkg);
 
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
@@ -966,6 +1321,8 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
    hypre_TFree(hypre_ParCSRCommPkgRecvVecStarts(comm_pkg), HYPRE_MEMORY_HOST);
    /* if (hypre_ParCSRCommPkgRecvMPITypes(comm_pkg))
       hypre_TFree(hypre_ParCSRCommPkgRecvMPITypes(comm_pkg), HYPRE_MEMORY_HOST); */
+   hypre_TFree(hypre_ParCSRCommPkgInteriorRows(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgBoundaryRows(comm_pkg), HYPRE_MEMORY_HOST);
 
 #if defined(HYPRE_USING_GPU)
    //hypre_TFree(hypre_ParCSRCommPkgTmpData(comm_pkg),   HYPRE_MEMORY_DEVICE);
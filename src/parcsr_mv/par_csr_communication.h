@@ -13,7 +13,6 @@
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -24,14 +23,13 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
  *--------------------------------------------------------------------------*/
 struct _hypre_ParCSRCommPkg;
 
-typedef struct
+typedef struct _hypre_ParCSRCommHandle
 {
    struct _hypre_ParCSRCommPkg *comm_pkg;
    HYPRE_MemoryLocation  send_memory_location;
@@ -44,6 +42,11 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+
+   /* persistent handles: non-zero between Start and Wait */
+   HYPRE_Int             active;
+   /* set when this handle only wraps a started persistent handle */
+   struct _hypre_ParCSRCommHandle *persistent_comm_handle;
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
@@ -66,9 +69,30 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_MPI_Datatype          *send_mpi_types;
    hypre_MPI_Datatype          *recv_mpi_types;
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
+
+   /* transport state (see HYPRE_ParCSRSetCommTransport). It is only cached
+    * on comm_pkgs that are created collectively and released with
+    * hypre_MatvecCommPkgDestroy, flagged by `cache_transport'. The neighbor
+    * communicators are distributed graphs recv_procs -> me -> send_procs
+    * (forward jobs) and its reverse (transpose jobs) */
+   HYPRE_Int                    cache_transport;
+   HYPRE_Int                    has_neighbor_comm;
+   hypre_MPI_Comm               neighbor_comm;
+   hypre_MPI_Comm               neighbor_comm_T;
+   hypre_int                   *neighbor_send_counts;
+   hypre_int                   *neighbor_send_displs;
+   hypre_int                   *neighbor_recv_counts;
+   hypre_int                   *neighbor_recv_displs;
+
+   /* interior (no offd coupling) and boundary rows of the matrix owning this
+    * comm_pkg, used by the split host matvec. `split_offd_i' is the offd row
+    * pointer the split was computed from */
+   HYPRE_Int                    num_interior_rows;
+   HYPRE_Int                   *interior_rows;
+   HYPRE_Int                    num_boundary_rows;
+   HYPRE_Int                   *boundary_rows;
+   HYPRE_Int                   *split_offd_i;
 
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
 #if defined(HYPRE_USING_GPU)
@@ -101,6 +125,19 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNumInteriorRows(comm_pkg)     (comm_pkg -> num_interior_rows)
+#define hypre_ParCSRCommPkgInteriorRows(comm_pkg)        (comm_pkg -> interior_rows)
+#define hypre_ParCSRCommPkgNumBoundaryRows(comm_pkg)     (comm_pkg -> num_boundary_rows)
+#define hypre_ParCSRCommPkgBoundaryRows(comm_pkg)        (comm_pkg -> boundary_rows)
+#define hypre_ParCSRCommPkgSplitOffdI(comm_pkg)          (comm_pkg -> split_offd_i)
+#define hypre_ParCSRCommPkgCacheTransport(comm_pkg)      (comm_pkg -> cache_transport)
+#define hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)     (comm_pkg -> has_neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg)        (comm_pkg -> neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborCommT(comm_pkg)       (comm_pkg -> neighbor_comm_T)
+#define hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg)  (comm_pkg -> neighbor_send_counts)
+#define hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg)  (comm_pkg -> neighbor_send_displs)
+#define hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg)  (comm_pkg -> neighbor_recv_counts)
+#define hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg)  (comm_pkg -> neighbor_recv_displs)
 
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -140,5 +177,7 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandleActive(comm_handle)                 (comm_handle -> active)
+#define hypre_ParCSRCommHandlePersistentCommHandle(comm_handle)   (comm_handle -> persistent_comm_handle)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
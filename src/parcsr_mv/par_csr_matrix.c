@@ -467,6 +467,81 @@ hypre_ParCSRMatrixSetDataOwner( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetSpMVUseSell
+ *
+ * Selects the host matvec storage format of the diag and offd blocks
+ * (-1: global setting, 0: CSR, 1: SELL-C-sigma).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetSpMVUseSell( hypre_ParCSRMatrix *matrix,
+                                  HYPRE_Int           use_sell )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSetSpMVUseSell(hypre_ParCSRMatrixDiag(matrix), use_sell);
+   hypre_CSRMatrixSetSpMVUseSell(hypre_ParCSRMatrixOffd(matrix), use_sell);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSellDestroy
+ *
+ * Drops the SELL-C-sigma shadows of the diag and offd blocks. Must be called
+ * by code that modifies the values or column indices of matrix in place;
+ * the shadows are rebuilt on the next host matvec.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSellDestroy( hypre_ParCSRMatrix *matrix )
+{
+   if (matrix)
+   {
+      hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(matrix));
+      hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertToSinglePrecision
+ *
+ * Stores the values of the diag and offd blocks (and of their transposes,
+ * if present) in single precision. Only matvec, matvecT and the host
+ * relaxation kernels accept the converted matrix.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertToSinglePrecision( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertToSinglePrecision(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixConvertToSinglePrecision(hypre_ParCSRMatrixOffd(matrix));
+
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixConvertToSinglePrecision(hypre_ParCSRMatrixDiagT(matrix));
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixConvertToSinglePrecision(hypre_ParCSRMatrixOffdT(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixSetRowStartsOwner
  *--------------------------------------------------------------------------*/
@@ -2314,6 +2389,8 @@ hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A,
       return hypre_error_flag;
    }
 
+   hypre_ParCSRMatrixSellDestroy(A);
+
    marker_offd = hypre_CTAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
 
    nnz_diag = nnz_offd = A_diag_i_i = A_offd_i_i = 0;
@@ -2504,6 +2581,9 @@ hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A,
    HYPRE_Int * num_lost_per_thread;
    HYPRE_Int * num_lost_offd_per_thread;
 
+   /* the entries of A are truncated and rescaled in place */
+   hypre_ParCSRMatrixSellDestroy(A);
+
    /* Initialize threading variables */
    max_num_threads[0] = hypre_NumThreads();
    cum_lost_per_thread = hypre_CTAlloc(HYPRE_Int,  max_num_threads[0], HYPRE_MEMORY_HOST);
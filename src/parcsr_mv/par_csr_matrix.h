@@ -149,6 +149,41 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Reusable plan of the Galerkin product C = P^T A P
+ *
+ * Holds everything of the product that depends only on the sparsity
+ * pattern of A and on P, so that new values of A (same pattern) give new
+ * values of C without any symbolic work. The columns of AP, P_ext and
+ * RAP_int are numbered in one local space: the coarse columns owned by
+ * this process first, then the offd columns of AP (col_map_offd_AP).
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            num_cols_diag;     /* local coarse columns */
+   HYPRE_Int            num_cols_offd_AP;
+   HYPRE_BigInt        *col_map_offd_AP;
+   hypre_CSRMatrix     *P_loc;             /* local rows of P */
+   hypre_CSRMatrix     *P_ext;             /* rows of P matching the offd columns of A */
+   hypre_CSRMatrix     *AP;                /* local rows of A*P */
+   hypre_CSRMatrix     *PT_diag;
+   hypre_CSRMatrix     *PT_offd;
+   hypre_CSRMatrix     *RAP_int;           /* P_offd^T*AP, rows owned by other processes */
+   HYPRE_Int           *AP_to_C;           /* column of AP -> column of C, -1 if absent */
+   hypre_ParCSRCommPkg *comm_pkg_int;      /* sends the values of RAP_int to their owners */
+   HYPRE_Int            num_recv;
+   HYPRE_Int           *recv_pos;          /* position in C of the received values, -1 if absent */
+   HYPRE_Complex       *recv_data;
+
+   /* sizes of A and C the plan was built for */
+   HYPRE_Int            A_diag_nnz;
+   HYPRE_Int            A_offd_nnz;
+   HYPRE_Int            C_diag_nnz;
+   HYPRE_Int            C_offd_nnz;
+
+} hypre_ParCSRRAPPlan;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
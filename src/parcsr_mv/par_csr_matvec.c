@@ -14,6 +14,344 @@
 #include "_hypre_parcsr_mv.h"
 #include "_hypre_utilities.hpp" //RL: TODO par_csr_matvec_device.c, include cuda there
 
+/* number of interior rows computed between two MPI progress calls */
+#define HYPRE_MATVEC_SPLIT_BLOCK 4096
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecSplitSetup
+ *
+ * Splits the local rows of A into interior rows, which have no entries in
+ * offd, and boundary rows. The lists are cached in the comm_pkg of A and
+ * recomputed only when the offd row pointer of A changes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecSplitSetup( hypre_ParCSRMatrix *A )
+{
+   hypre_ParCSRCommPkg *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_CSRMatrix     *offd     = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *offd_i   = hypre_CSRMatrixI(offd);
+   HYPRE_Int            num_rows = hypre_CSRMatrixNumRows(offd);
+   HYPRE_Int           *interior_rows, *boundary_rows;
+   HYPRE_Int            num_interior = 0, num_boundary = 0;
+   HYPRE_Int            i;
+
+   if ( hypre_ParCSRCommPkgSplitOffdI(comm_pkg) == offd_i &&
+        hypre_ParCSRCommPkgNumInteriorRows(comm_pkg) +
+        hypre_ParCSRCommPkgNumBoundaryRows(comm_pkg) == num_rows )
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_TFree(hypre_ParCSRCommPkgInteriorRows(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgBoundaryRows(comm_pkg), HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      if (offd_i[i+1] > offd_i[i])
+      {
+         num_boundary++;
+      }
+   }
+   num_interior = num_rows - num_boundary;
+
+   interior_rows = hypre_TAlloc(HYPRE_Int, num_interior, HYPRE_MEMORY_HOST);
+   boundary_rows = hypre_TAlloc(HYPRE_Int, num_boundary, HYPRE_MEMORY_HOST);
+
+   num_interior = num_boundary = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (offd_i[i+1] > offd_i[i])
+      {
+         boundary_rows[num_boundary++] = i;
+      }
+      else
+      {
+         interior_rows[num_interior++] = i;
+      }
+   }
+
+   hypre_ParCSRCommPkgNumInteriorRows(comm_pkg) = num_interior;
+   hypre_ParCSRCommPkgInteriorRows(comm_pkg)    = interior_rows;
+   hypre_ParCSRCommPkgNumBoundaryRows(comm_pkg) = num_boundary;
+   hypre_ParCSRCommPkgBoundaryRows(comm_pkg)    = boundary_rows;
+   hypre_ParCSRCommPkgSplitOffdI(comm_pkg)      = offd_i;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecSplitRows
+ *
+ * y[r] = alpha*(A_diag[r,:]*x + A_offd[r,:]*x_offd) + beta*b[r] for the rows
+ * r = rows[0:num_rows]. x_offd may be NULL for interior rows.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatrixMatvecSplitRows( HYPRE_Complex    alpha,
+                                   hypre_CSRMatrix *diag,
+                                   hypre_CSRMatrix *offd,
+                                   HYPRE_Complex   *x_data,
+                                   HYPRE_Complex   *x_offd_data,
+                                   HYPRE_Complex    beta,
+                                   HYPRE_Complex   *b_data,
+                                   HYPRE_Complex   *y_data,
+                                   HYPRE_Int        num_rows,
+                                   HYPRE_Int       *rows )
+{
+   HYPRE_Int     *diag_i    = hypre_CSRMatrixI(diag);
+   HYPRE_Int     *diag_j    = hypre_CSRMatrixJ(diag);
+   HYPRE_Complex *diag_data = hypre_CSRMatrixData(diag);
+   HYPRE_Int     *offd_i    = hypre_CSRMatrixI(offd);
+   HYPRE_Int     *offd_j    = hypre_CSRMatrixJ(offd);
+   HYPRE_Complex *offd_data = hypre_CSRMatrixData(offd);
+   HYPRE_Complex  tempx;
+   HYPRE_Int      i, ii, jj;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_rows; ii++)
+   {
+      i = rows[ii];
+      tempx = 0.0;
+      for (jj = diag_i[i]; jj < diag_i[i+1]; jj++)
+      {
+         tempx += diag_data[jj] * x_data[diag_j[jj]];
+      }
+      if (x_offd_data)
+      {
+         for (jj = offd_i[i]; jj < offd_i[i+1]; jj++)
+         {
+            tempx += offd_data[jj] * x_offd_data[offd_j[jj]];
+         }
+      }
+      y_data[i] = (beta == 0.0) ? alpha*tempx : alpha*tempx + beta*b_data[i];
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecMultiVectorHost
+ *
+ * y = alpha*A*x + beta*b for multivectors on the host. The halo of all
+ * vectors is packed row-major and exchanged with a single message per
+ * neighbor, and the offd product runs on the row-major external multivector.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecMultiVectorHost( HYPRE_Complex       alpha,
+                                         hypre_ParCSRMatrix *A,
+                                         hypre_ParVector    *x,
+                                         HYPRE_Complex       beta,
+                                         hypre_ParVector    *b,
+                                         hypre_ParVector    *y )
+{
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *b_local = hypre_ParVectorLocalVector(b);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector *x_tmp;
+
+   HYPRE_Int num_vectors   = hypre_VectorNumVectors(x_local);
+   HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int vecstride     = hypre_VectorVectorStride(x_local);
+   HYPRE_Int idxstride     = hypre_VectorIndexStride(x_local);
+   HYPRE_Int num_sends, send_size, i;
+
+   HYPRE_Complex *x_local_data = hypre_VectorData(x_local);
+   HYPRE_Complex *x_buf_data;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   x_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+   hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
+
+   x_buf_data = hypre_TAlloc(HYPRE_Complex, send_size * num_vectors, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < send_size; i++)
+   {
+      const HYPRE_Complex *x_i = x_local_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+      HYPRE_Int            jv;
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         x_buf_data[i * num_vectors + jv] = x_i[jv * vecstride];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreateMultiVector(1, comm_pkg, num_vectors,
+                                                         HYPRE_MEMORY_HOST, x_buf_data,
+                                                         HYPRE_MEMORY_HOST, hypre_VectorData(x_tmp));
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /* overlapped local computation */
+   hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, x_local, beta, b_local, y_local, 0);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   if (num_cols_offd)
+   {
+      hypre_CSRMatrixMatvec(alpha, offd, x_tmp, 1.0, y_local);
+   }
+
+   hypre_SeqVectorDestroy(x_tmp);
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecTMultiVectorHost
+ *
+ * y = alpha*A^T*x + beta*y for multivectors on the host, the transpose
+ * counterpart of hypre_ParCSRMatrixMatvecMultiVectorHost.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecTMultiVectorHost( HYPRE_Complex       alpha,
+                                          hypre_ParCSRMatrix *A,
+                                          hypre_ParVector    *x,
+                                          HYPRE_Complex       beta,
+                                          hypre_ParVector    *y )
+{
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   hypre_CSRMatrix *diag  = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd  = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *diagT = hypre_ParCSRMatrixDiagT(A);
+   hypre_CSRMatrix *offdT = hypre_ParCSRMatrixOffdT(A);
+
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector *y_tmp;
+
+   HYPRE_Int num_vectors   = hypre_VectorNumVectors(y_local);
+   HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int vecstride     = hypre_VectorVectorStride(y_local);
+   HYPRE_Int idxstride     = hypre_VectorIndexStride(y_local);
+   HYPRE_Int num_sends, recv_size, i, jv;
+
+   HYPRE_Complex *y_local_data = hypre_VectorData(y_local);
+   HYPRE_Complex *y_buf_data;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   recv_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   y_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(y_tmp) = 1;
+   hypre_SeqVectorInitialize_v2(y_tmp, HYPRE_MEMORY_HOST);
+
+   y_buf_data = hypre_TAlloc(HYPRE_Complex, recv_size * num_vectors, HYPRE_MEMORY_HOST);
+
+   if (num_cols_offd)
+   {
+      if (offdT)
+      {
+         hypre_CSRMatrixMatvec(alpha, offdT, x_local, 0.0, y_tmp);
+      }
+      else
+      {
+         hypre_CSRMatrixMatvecT(alpha, offd, x_local, 0.0, y_tmp);
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreateMultiVector(2, comm_pkg, num_vectors,
+                                                         HYPRE_MEMORY_HOST, hypre_VectorData(y_tmp),
+                                                         HYPRE_MEMORY_HOST, y_buf_data);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /* overlapped local computation */
+   if (diagT)
+   {
+      hypre_CSRMatrixMatvec(alpha, diagT, x_local, beta, y_local);
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecT(alpha, diag, x_local, beta, y_local);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   /* unpack: a row may appear in the send map more than once, not threaded */
+   for (i = 0; i < recv_size; i++)
+   {
+      HYPRE_Complex *y_i = y_local_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         y_i[jv * vecstride] += y_buf_data[i * num_vectors + jv];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   hypre_SeqVectorDestroy(y_tmp);
+   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -54,6 +392,8 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    HYPRE_Complex *x_tmp_data, **x_buf_data;
    HYPRE_Complex *x_local_data = hypre_VectorData(x_local);
 
+   HYPRE_Int use_split = 0;
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_Int sync_stream;
    hypre_GetSyncCudaCompute(&sync_stream);
@@ -90,6 +430,18 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(b_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
+   if ( num_vectors > 1 &&
+        hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) == hypre_MEMORY_HOST )
+   {
+      hypre_ParCSRMatrixMatvecMultiVectorHost(alpha, A, x, beta, b, y);
+
+#if defined(HYPRE_USING_GPU)
+      hypre_SetSyncCudaCompute(sync_stream);
+#endif
+
+      return ierr;
+   }
+
    if ( num_vectors == 1 )
    {
       x_tmp = hypre_SeqVectorCreate( num_cols_offd );
@@ -114,6 +466,19 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_assert( num_cols_offd == hypre_ParCSRCommPkgRecvVecStart(comm_pkg, hypre_ParCSRCommPkgNumRecvs(comm_pkg)) );
    hypre_assert( hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0) == 0 );
 
+   /*---------------------------------------------------------------------
+    * Split host matvec: interior rows are computed while the halo is in
+    * flight, and the diag and offd parts of the boundary rows are fused
+    * once it has arrived.
+    *--------------------------------------------------------------------*/
+   if ( hypre_HandleMatvecSplit(hypre_handle()) && num_vectors == 1 && x_local != y_local &&
+        hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) == hypre_MEMORY_HOST &&
+        !hypre_CSRMatrixDataSp(diag) && !hypre_CSRMatrixDataSp(offd) )
+   {
+      use_split = 1;
+      hypre_ParCSRMatrixMatvecSplitSetup(A);
+   }
+
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
@@ -283,7 +648,39 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
 
    /* overlapped local computation */
-   hypre_CSRMatrixMatvecOutOfPlace( alpha, diag, x_local, beta, b_local, y_local, 0 );
+   if (use_split)
+   {
+      hypre_ParCSRCommHandle *handle = NULL;
+      HYPRE_Int               num_interior = hypre_ParCSRCommPkgNumInteriorRows(comm_pkg);
+      HYPRE_Int              *interior_rows = hypre_ParCSRCommPkgInteriorRows(comm_pkg);
+      HYPRE_Int               done = 0, start, size;
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+      handle = use_persistent_comm ? persistent_comm_handle : comm_handle[0];
+#else
+      handle = comm_handle[0];
+#endif
+
+      for (start = 0; start < num_interior; start += HYPRE_MATVEC_SPLIT_BLOCK)
+      {
+         size = hypre_min(HYPRE_MATVEC_SPLIT_BLOCK, num_interior - start);
+         hypre_ParCSRMatrixMatvecSplitRows(alpha, diag, offd, x_local_data, NULL,
+                                           beta, hypre_VectorData(b_local), hypre_VectorData(y_local),
+                                           size, interior_rows + start);
+
+         /* let MPI progress the halo exchange */
+         if (!done && handle && hypre_ParCSRCommHandleNumRequests(handle))
+         {
+            hypre_MPI_Testall(hypre_ParCSRCommHandleNumRequests(handle),
+                              hypre_ParCSRCommHandleRequests(handle),
+                              &done, hypre_MPI_STATUSES_IGNORE);
+         }
+      }
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecOutOfPlace( alpha, diag, x_local, beta, b_local, y_local, 0 );
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
@@ -311,7 +708,14 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
 
    /* computation offd part */
-   if (num_cols_offd)
+   if (use_split)
+   {
+      hypre_ParCSRMatrixMatvecSplitRows(alpha, diag, offd, x_local_data, x_tmp_data,
+                                        beta, hypre_VectorData(b_local), hypre_VectorData(y_local),
+                                        hypre_ParCSRCommPkgNumBoundaryRows(comm_pkg),
+                                        hypre_ParCSRCommPkgBoundaryRows(comm_pkg));
+   }
+   else if (num_cols_offd)
    {
       hypre_CSRMatrixMatvec( alpha, offd, x_tmp, 1.0, y_local );
    }
@@ -435,6 +839,18 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(x_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
+   if ( num_vectors > 1 &&
+        hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) == hypre_MEMORY_HOST )
+   {
+      hypre_ParCSRMatrixMatvecTMultiVectorHost(alpha, A, x, beta, y);
+
+#if defined(HYPRE_USING_GPU)
+      hypre_SetSyncCudaCompute(sync_stream);
+#endif
+
+      return ierr;
+   }
+
    if ( num_vectors == 1 )
    {
       y_tmp = hypre_SeqVectorCreate(num_cols_offd);
@@ -0,0 +1,740 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Numeric-only recomputation of the Galerkin product C = P^T A P
+ *
+ * hypre_ParCSRRAPPlanCreate does the symbolic work of the product once, for
+ * a given P and sparsity pattern of A, and keeps it next to the pattern of
+ * C. hypre_ParCSRRAPPlanCompute then recomputes the values of C from new
+ * values of A with three row-wise passes (AP, the rows of C owned by other
+ * processes, the local rows of C) and a single exchange of values.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_RAPPlanCSRCreate
+ *
+ * Host CSR matrix with the given arrays (data is allocated and zeroed).
+ *--------------------------------------------------------------------------*/
+
+static hypre_CSRMatrix *
+hypre_RAPPlanCSRCreate( HYPRE_Int  num_rows,
+                        HYPRE_Int  num_cols,
+                        HYPRE_Int *C_i,
+                        HYPRE_Int *C_j )
+{
+   HYPRE_Int        nnz = C_i[num_rows];
+   hypre_CSRMatrix *C   = hypre_CSRMatrixCreate(num_rows, num_cols, nnz);
+
+   hypre_CSRMatrixI(C)              = C_i;
+   hypre_CSRMatrixJ(C)              = C_j;
+   hypre_CSRMatrixData(C)           = hypre_CTAlloc(HYPRE_Complex, nnz, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixMemoryLocation(C) = HYPRE_MEMORY_HOST;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RAPPlanProductPattern
+ *
+ * Sparsity pattern of M1*N1 + M2*N2 (M2 and N2 may be NULL). The columns of
+ * M1 and M2 index the rows of N1 and N2.
+ *--------------------------------------------------------------------------*/
+
+static hypre_CSRMatrix *
+hypre_RAPPlanProductPattern( hypre_CSRMatrix *M1,
+                             hypre_CSRMatrix *N1,
+                             hypre_CSRMatrix *M2,
+                             hypre_CSRMatrix *N2,
+                             HYPRE_Int        num_rows,
+                             HYPRE_Int        num_cols )
+{
+   hypre_CSRMatrix *M, *N;
+   HYPRE_Int       *marker = hypre_TAlloc(HYPRE_Int, hypre_max(num_cols, 1), HYPRE_MEMORY_HOST);
+   HYPRE_Int       *C_i    = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   HYPRE_Int       *C_j    = NULL;
+   HYPRE_Int        pass, t, i, jj, kk, col, cnt = 0;
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (i = 0; i < num_cols; i++)
+      {
+         marker[i] = -1;
+      }
+
+      cnt = 0;
+      for (i = 0; i < num_rows; i++)
+      {
+         C_i[i] = cnt;
+         for (t = 0; t < 2; t++)
+         {
+            M = t ? M2 : M1;
+            N = t ? N2 : N1;
+            if (!M || !N)
+            {
+               continue;
+            }
+
+            for (jj = hypre_CSRMatrixI(M)[i]; jj < hypre_CSRMatrixI(M)[i+1]; jj++)
+            {
+               HYPRE_Int r = hypre_CSRMatrixJ(M)[jj];
+
+               for (kk = hypre_CSRMatrixI(N)[r]; kk < hypre_CSRMatrixI(N)[r+1]; kk++)
+               {
+                  col = hypre_CSRMatrixJ(N)[kk];
+                  if (marker[col] != i)
+                  {
+                     marker[col] = i;
+                     if (pass)
+                     {
+                        C_j[cnt] = col;
+                     }
+                     cnt++;
+                  }
+               }
+            }
+         }
+      }
+      C_i[num_rows] = cnt;
+
+      if (!pass)
+      {
+         C_j = hypre_TAlloc(HYPRE_Int, cnt, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+
+   return hypre_RAPPlanCSRCreate(num_rows, num_cols, C_i, C_j);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RAPPlanProductValues
+ *
+ * Values of C = M1*N1 + M2*N2 for the pattern of C computed by
+ * hypre_RAPPlanProductPattern. work holds num_cols integers per thread.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RAPPlanProductValues( hypre_CSRMatrix *M1,
+                            hypre_CSRMatrix *N1,
+                            hypre_CSRMatrix *M2,
+                            hypre_CSRMatrix *N2,
+                            hypre_CSRMatrix *C,
+                            HYPRE_Int       *work )
+{
+   HYPRE_Int      num_rows = hypre_CSRMatrixNumRows(C);
+   HYPRE_Int      num_cols = hypre_CSRMatrixNumCols(C);
+   HYPRE_Int     *C_i      = hypre_CSRMatrixI(C);
+   HYPRE_Int     *C_j      = hypre_CSRMatrixJ(C);
+   HYPRE_Complex *C_data   = hypre_CSRMatrixData(C);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      hypre_CSRMatrix *M, *N;
+      HYPRE_Int       *marker = work + hypre_GetThreadNum() * num_cols;
+      HYPRE_Int        ns, ne, i, t, p, jj, kk;
+
+      hypre_partition1D(num_rows, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      for (i = ns; i < ne; i++)
+      {
+         for (p = C_i[i]; p < C_i[i+1]; p++)
+         {
+            marker[C_j[p]] = p;
+            C_data[p] = 0.0;
+         }
+
+         for (t = 0; t < 2; t++)
+         {
+            M = t ? M2 : M1;
+            N = t ? N2 : N1;
+            if (!M || !N)
+            {
+               continue;
+            }
+
+            {
+               HYPRE_Int     *M_i = hypre_CSRMatrixI(M), *M_j = hypre_CSRMatrixJ(M);
+               HYPRE_Int     *N_i = hypre_CSRMatrixI(N), *N_j = hypre_CSRMatrixJ(N);
+               HYPRE_Complex *M_data = hypre_CSRMatrixData(M);
+               HYPRE_Complex *N_data = hypre_CSRMatrixData(N);
+
+               for (jj = M_i[i]; jj < M_i[i+1]; jj++)
+               {
+                  const HYPRE_Complex m = M_data[jj];
+                  const HYPRE_Int     r = M_j[jj];
+
+                  for (kk = N_i[r]; kk < N_i[r+1]; kk++)
+                  {
+                     C_data[marker[N_j[kk]]] += m * N_data[kk];
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RAPPlanLocalValues
+ *
+ * Values of the local rows of C = PT_diag*AP. Positions of C are numbered
+ * diag first, then offd. Contributions outside of the pattern of C (entries
+ * dropped after the product was formed) are skipped. work holds
+ * 2*(num_cols_diag + num_cols_offd_C) integers per thread.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RAPPlanLocalValues( hypre_CSRMatrix *PT_diag,
+                          hypre_CSRMatrix *AP,
+                          HYPRE_Int       *AP_to_C,
+                          hypre_CSRMatrix *C_diag,
+                          hypre_CSRMatrix *C_offd,
+                          HYPRE_Int       *work )
+{
+   HYPRE_Int      num_rows      = hypre_CSRMatrixNumRows(C_diag);
+   HYPRE_Int      width         = num_rows + hypre_CSRMatrixNumCols(C_offd);
+   HYPRE_Int     *C_diag_i      = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int     *C_diag_j      = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex *C_diag_data   = hypre_CSRMatrixData(C_diag);
+   HYPRE_Int     *C_offd_i      = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int     *C_offd_j      = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Complex *C_offd_data   = hypre_CSRMatrixData(C_offd);
+   HYPRE_Int      C_diag_nnz    = C_diag_i[num_rows];
+   HYPRE_Int     *PT_i          = hypre_CSRMatrixI(PT_diag);
+   HYPRE_Int     *PT_j          = hypre_CSRMatrixJ(PT_diag);
+   HYPRE_Complex *PT_data       = hypre_CSRMatrixData(PT_diag);
+   HYPRE_Int     *AP_i          = hypre_CSRMatrixI(AP);
+   HYPRE_Int     *AP_j          = hypre_CSRMatrixJ(AP);
+   HYPRE_Complex *AP_data       = hypre_CSRMatrixData(AP);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      HYPRE_Int *row_tag = work + 2 * hypre_GetThreadNum() * width;
+      HYPRE_Int *pos     = row_tag + width;
+      HYPRE_Int  ns, ne, k, p, jj, kk, c;
+
+      for (c = 0; c < width; c++)
+      {
+         row_tag[c] = -1;
+      }
+
+      hypre_partition1D(num_rows, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      for (k = ns; k < ne; k++)
+      {
+         for (p = C_diag_i[k]; p < C_diag_i[k+1]; p++)
+         {
+            c = C_diag_j[p];
+            row_tag[c] = k;
+            pos[c] = p;
+            C_diag_data[p] = 0.0;
+         }
+         for (p = C_offd_i[k]; p < C_offd_i[k+1]; p++)
+         {
+            c = num_rows + C_offd_j[p];
+            row_tag[c] = k;
+            pos[c] = C_diag_nnz + p;
+            C_offd_data[p] = 0.0;
+         }
+
+         for (jj = PT_i[k]; jj < PT_i[k+1]; jj++)
+         {
+            const HYPRE_Complex m = PT_data[jj];
+            const HYPRE_Int     i = PT_j[jj];
+
+            for (kk = AP_i[i]; kk < AP_i[i+1]; kk++)
+            {
+               c = AP_to_C[AP_j[kk]];
+               if (c >= 0 && row_tag[c] == k)
+               {
+                  p = pos[c];
+                  if (p < C_diag_nnz)
+                  {
+                     C_diag_data[p] += m * AP_data[kk];
+                  }
+                  else
+                  {
+                     C_offd_data[p - C_diag_nnz] += m * AP_data[kk];
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RAPPlanMergeRows
+ *
+ * Merges a diag and an offd block into one CSR matrix in the column space
+ * of the plan: diag column k stays k, offd column c becomes
+ * num_cols_diag + offd_map[c] (or num_cols_diag + c without map).
+ *--------------------------------------------------------------------------*/
+
+static hypre_CSRMatrix *
+hypre_RAPPlanMergeRows( hypre_CSRMatrix *B_diag,
+                        hypre_CSRMatrix *B_offd,
+                        HYPRE_Int       *offd_map,
+                        HYPRE_Int        num_cols_diag,
+                        HYPRE_Int        num_cols )
+{
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(B_diag);
+   HYPRE_Int       *Bd_i     = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int       *Bd_j     = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Complex   *Bd_data  = hypre_CSRMatrixData(B_diag);
+   HYPRE_Int       *Bo_i     = B_offd ? hypre_CSRMatrixI(B_offd) : NULL;
+   HYPRE_Int       *Bo_j     = B_offd ? hypre_CSRMatrixJ(B_offd) : NULL;
+   HYPRE_Complex   *Bo_data  = B_offd ? hypre_CSRMatrixData(B_offd) : NULL;
+   HYPRE_Int        nnz      = Bd_i[num_rows] + (Bo_i ? Bo_i[num_rows] : 0);
+   HYPRE_Int       *C_i      = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   HYPRE_Int       *C_j      = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   HYPRE_Complex   *C_data;
+   hypre_CSRMatrix *C;
+   HYPRE_Int        i, p, cnt = 0;
+
+   C_i[num_rows] = nnz;
+   C      = hypre_RAPPlanCSRCreate(num_rows, num_cols, C_i, C_j);
+   C_data = hypre_CSRMatrixData(C);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      C_i[i] = cnt;
+      for (p = Bd_i[i]; p < Bd_i[i+1]; p++)
+      {
+         C_j[cnt] = Bd_j[p];
+         C_data[cnt++] = Bd_data[p];
+      }
+      if (Bo_i)
+      {
+         for (p = Bo_i[i]; p < Bo_i[i+1]; p++)
+         {
+            C_j[cnt] = num_cols_diag + (offd_map ? offd_map[Bo_j[p]] : Bo_j[p]);
+            C_data[cnt++] = Bo_data[p];
+         }
+      }
+   }
+   C_i[num_rows] = cnt;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanCreate
+ *
+ * Builds the plan of C = P^T A P for host matrices in double precision. C
+ * must be the Galerkin product of A and P (possibly with entries dropped);
+ * its pattern is reused by hypre_ParCSRRAPPlanCompute, which also does not
+ * read P any more. Collective on the communicator of A.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRRAPPlan *
+hypre_ParCSRRAPPlanCreate( hypre_ParCSRMatrix *A,
+                           hypre_ParCSRMatrix *P,
+                           hypre_ParCSRMatrix *C )
+{
+   MPI_Comm             comm            = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix     *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int            num_rows        = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+   hypre_CSRMatrix     *P_diag          = hypre_ParCSRMatrixDiag(P);
+   hypre_CSRMatrix     *P_offd          = hypre_ParCSRMatrixOffd(P);
+   HYPRE_BigInt        *col_map_offd_P  = hypre_ParCSRMatrixColMapOffd(P);
+   HYPRE_Int            num_cols_offd_P = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_Int            nc              = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_BigInt         first_col_diag  = hypre_ParCSRMatrixFirstColDiag(P);
+   hypre_CSRMatrix     *C_diag          = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrix     *C_offd          = hypre_ParCSRMatrixOffd(C);
+   HYPRE_BigInt        *col_map_offd_C  = hypre_ParCSRMatrixColMapOffd(C);
+   HYPRE_Int            num_cols_offd_C = hypre_CSRMatrixNumCols(C_offd);
+
+   hypre_ParCSRRAPPlan *plan;
+   hypre_CSRMatrix     *Ps_ext, *Pext_diag = NULL, *Pext_offd = NULL;
+   HYPRE_Int            num_cols_offd_AP = 0;
+   HYPRE_BigInt        *col_map_offd_AP = NULL;
+   HYPRE_Int           *P_offd_to_AP = NULL;
+   HYPRE_Int           *AP_to_C;
+   HYPRE_Int            num_procs, i, cnt;
+
+   if ( hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+        hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(P)) != hypre_MEMORY_HOST ||
+        hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(C)) != hypre_MEMORY_HOST )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "RAP plans are only available for host matrices\n");
+      return NULL;
+   }
+
+   if ( hypre_CSRMatrixDataSp(A_diag) || hypre_CSRMatrixDataSp(P_diag) || hypre_CSRMatrixDataSp(C_diag) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "RAP plans need double precision matrices\n");
+      return NULL;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   plan = hypre_CTAlloc(hypre_ParCSRRAPPlan, 1, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Rows of P needed by A_offd and the column space of AP
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+
+      Ps_ext = hypre_ParCSRMatrixExtractBExt(P, A, 1);
+      if (num_cols_offd_A)
+      {
+         hypre_CSRMatrixSplit(Ps_ext, first_col_diag, first_col_diag + nc - 1,
+                              num_cols_offd_P, col_map_offd_P,
+                              &num_cols_offd_AP, &col_map_offd_AP, &Pext_diag, &Pext_offd);
+      }
+      hypre_CSRMatrixDestroy(Ps_ext);
+   }
+
+   if (!col_map_offd_AP)
+   {
+      num_cols_offd_AP = num_cols_offd_P;
+      col_map_offd_AP  = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_P, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_offd_P; i++)
+      {
+         col_map_offd_AP[i] = col_map_offd_P[i];
+      }
+   }
+
+   if (num_cols_offd_P)
+   {
+      P_offd_to_AP = hypre_TAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+      for (i = 0, cnt = 0; i < num_cols_offd_AP && cnt < num_cols_offd_P; i++)
+      {
+         if (col_map_offd_AP[i] == col_map_offd_P[cnt])
+         {
+            P_offd_to_AP[cnt++] = i;
+         }
+      }
+   }
+
+   plan -> num_cols_diag    = nc;
+   plan -> num_cols_offd_AP = num_cols_offd_AP;
+   plan -> col_map_offd_AP  = col_map_offd_AP;
+   plan -> P_loc            = hypre_RAPPlanMergeRows(P_diag, P_offd, P_offd_to_AP, nc, nc + num_cols_offd_AP);
+   if (Pext_diag)
+   {
+      plan -> P_ext = hypre_RAPPlanMergeRows(Pext_diag, Pext_offd, NULL, nc, nc + num_cols_offd_AP);
+      hypre_CSRMatrixDestroy(Pext_diag);
+      hypre_CSRMatrixDestroy(Pext_offd);
+   }
+   hypre_TFree(P_offd_to_AP, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Patterns of AP and of the rows of C owned by other processes
+    *-----------------------------------------------------------------------*/
+
+   plan -> AP = hypre_RAPPlanProductPattern(A_diag, plan -> P_loc, A_offd, plan -> P_ext,
+                                            num_rows, nc + num_cols_offd_AP);
+
+   hypre_CSRMatrixTranspose(P_diag, &(plan -> PT_diag), 1);
+   hypre_CSRMatrixMemoryLocation(plan -> PT_diag) = HYPRE_MEMORY_HOST;
+   if (num_cols_offd_P)
+   {
+      hypre_CSRMatrixTranspose(P_offd, &(plan -> PT_offd), 1);
+      hypre_CSRMatrixMemoryLocation(plan -> PT_offd) = HYPRE_MEMORY_HOST;
+      plan -> RAP_int = hypre_RAPPlanProductPattern(plan -> PT_offd, plan -> AP, NULL, NULL,
+                                                    num_cols_offd_P, nc + num_cols_offd_AP);
+   }
+
+   AP_to_C = hypre_TAlloc(HYPRE_Int, nc + num_cols_offd_AP, HYPRE_MEMORY_HOST);
+   for (i = 0; i < nc; i++)
+   {
+      AP_to_C[i] = i;
+   }
+   for (i = 0; i < num_cols_offd_AP; i++)
+   {
+      cnt = hypre_BigBinarySearch(col_map_offd_C, col_map_offd_AP[i], num_cols_offd_C);
+      AP_to_C[nc + i] = (cnt < 0) ? -1 : nc + cnt;
+   }
+   plan -> AP_to_C = AP_to_C;
+
+   plan -> A_diag_nnz = hypre_CSRMatrixNumNonzeros(A_diag);
+   plan -> A_offd_nnz = hypre_CSRMatrixNumNonzeros(A_offd);
+   plan -> C_diag_nnz = hypre_CSRMatrixNumNonzeros(C_diag);
+   plan -> C_offd_nnz = hypre_CSRMatrixNumNonzeros(C_offd);
+
+   /*-----------------------------------------------------------------------
+    * Communication of the rows of RAP_int: they go to the owners of the
+    * offd columns of P, i.e. in reverse direction of the comm_pkg of P.
+    * Lengths and global columns are exchanged once; later only values.
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      hypre_ParCSRCommPkg    *comm_pkg_P, *comm_pkg_int;
+      hypre_ParCSRCommHandle *comm_handle;
+      HYPRE_Int               num_sends_P, num_recvs_P, num_elmts_P;
+      HYPRE_Int              *int_i = plan -> RAP_int ? hypre_CSRMatrixI(plan -> RAP_int) : NULL;
+      HYPRE_Int              *int_j = plan -> RAP_int ? hypre_CSRMatrixJ(plan -> RAP_int) : NULL;
+      HYPRE_Int               int_nnz = int_i ? int_i[num_cols_offd_P] : 0;
+      HYPRE_Int              *int_len, *recv_len, *recv_pos;
+      HYPRE_BigInt           *int_big_j, *recv_big_j;
+      HYPRE_Int              *C_diag_i = hypre_CSRMatrixI(C_diag);
+      HYPRE_Int              *C_diag_j = hypre_CSRMatrixJ(C_diag);
+      HYPRE_Int              *C_offd_i = hypre_CSRMatrixI(C_offd);
+      HYPRE_Int              *C_offd_j = hypre_CSRMatrixJ(C_offd);
+      HYPRE_Int               C_diag_nnz = plan -> C_diag_nnz;
+      HYPRE_Int               num_recv, e, p, k, q;
+
+      if (!hypre_ParCSRMatrixCommPkg(P))
+      {
+         hypre_MatvecCommPkgCreate(P);
+      }
+      comm_pkg_P  = hypre_ParCSRMatrixCommPkg(P);
+      num_sends_P = hypre_ParCSRCommPkgNumSends(comm_pkg_P);
+      num_recvs_P = hypre_ParCSRCommPkgNumRecvs(comm_pkg_P);
+      num_elmts_P = hypre_ParCSRCommPkgSendMapStart(comm_pkg_P, num_sends_P);
+
+      int_len  = hypre_TAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+      recv_len = hypre_TAlloc(HYPRE_Int, num_elmts_P, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_offd_P; i++)
+      {
+         int_len[i] = int_i[i+1] - int_i[i];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(12, comm_pkg_P, int_len, recv_len);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      comm_pkg_int = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgComm(comm_pkg_int)          = comm;
+      hypre_ParCSRCommPkgNumSends(comm_pkg_int)      = num_recvs_P;
+      hypre_ParCSRCommPkgSendProcs(comm_pkg_int)     = hypre_TAlloc(HYPRE_Int, num_recvs_P, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgSendMapStarts(comm_pkg_int) = hypre_TAlloc(HYPRE_Int, num_recvs_P + 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgNumRecvs(comm_pkg_int)      = num_sends_P;
+      hypre_ParCSRCommPkgRecvProcs(comm_pkg_int)     = hypre_TAlloc(HYPRE_Int, num_sends_P, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_int) = hypre_TAlloc(HYPRE_Int, num_sends_P + 1, HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < num_recvs_P; i++)
+      {
+         hypre_ParCSRCommPkgSendProc(comm_pkg_int, i) = hypre_ParCSRCommPkgRecvProc(comm_pkg_P, i);
+      }
+      for (i = 0; i <= num_recvs_P; i++)
+      {
+         k = hypre_ParCSRCommPkgRecvVecStart(comm_pkg_P, i);
+         hypre_ParCSRCommPkgSendMapStarts(comm_pkg_int)[i] = int_i ? int_i[k] : 0;
+      }
+      hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_int)[0] = 0;
+      for (i = 0; i < num_sends_P; i++)
+      {
+         hypre_ParCSRCommPkgRecvProc(comm_pkg_int, i) = hypre_ParCSRCommPkgSendProc(comm_pkg_P, i);
+         cnt = hypre_ParCSRCommPkgRecvVecStart(comm_pkg_int, i);
+         for (e = hypre_ParCSRCommPkgSendMapStart(comm_pkg_P, i);
+              e < hypre_ParCSRCommPkgSendMapStart(comm_pkg_P, i + 1); e++)
+         {
+            cnt += recv_len[e];
+         }
+         hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_int)[i + 1] = cnt;
+      }
+      num_recv = hypre_ParCSRCommPkgRecvVecStart(comm_pkg_int, num_sends_P);
+
+      /* the pkg lives as long as the plan, so it may cache transport state */
+      hypre_ParCSRCommPkgCacheTransport(comm_pkg_int) = 1;
+      if (hypre_HandleCommTransport(hypre_handle()) == 2)
+      {
+         hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg_int);
+      }
+
+      int_big_j  = hypre_TAlloc(HYPRE_BigInt, int_nnz, HYPRE_MEMORY_HOST);
+      recv_big_j = hypre_TAlloc(HYPRE_BigInt, num_recv, HYPRE_MEMORY_HOST);
+      for (i = 0; i < int_nnz; i++)
+      {
+         int_big_j[i] = (int_j[i] < nc) ? first_col_diag + (HYPRE_BigInt) int_j[i] :
+                        col_map_offd_AP[int_j[i] - nc];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg_int, int_big_j, recv_big_j);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      /* positions of the received entries in C, diag first, then offd */
+      recv_pos = hypre_TAlloc(HYPRE_Int, num_recv, HYPRE_MEMORY_HOST);
+      for (e = 0, cnt = 0; e < num_elmts_P; e++)
+      {
+         k = hypre_ParCSRCommPkgSendMapElmt(comm_pkg_P, e);
+         for (i = 0; i < recv_len[e]; i++, cnt++)
+         {
+            HYPRE_BigInt col = recv_big_j[cnt];
+
+            recv_pos[cnt] = -1;
+            if (col >= first_col_diag && col < first_col_diag + nc)
+            {
+               q = (HYPRE_Int) (col - first_col_diag);
+               for (p = C_diag_i[k]; p < C_diag_i[k+1]; p++)
+               {
+                  if (C_diag_j[p] == q)
+                  {
+                     recv_pos[cnt] = p;
+                     break;
+                  }
+               }
+            }
+            else
+            {
+               q = hypre_BigBinarySearch(col_map_offd_C, col, num_cols_offd_C);
+               for (p = C_offd_i[k]; q >= 0 && p < C_offd_i[k+1]; p++)
+               {
+                  if (C_offd_j[p] == q)
+                  {
+                     recv_pos[cnt] = C_diag_nnz + p;
+                     break;
+                  }
+               }
+            }
+         }
+      }
+
+      plan -> comm_pkg_int = comm_pkg_int;
+      plan -> num_recv     = num_recv;
+      plan -> recv_pos     = recv_pos;
+      plan -> recv_data    = hypre_CTAlloc(HYPRE_Complex, num_recv, HYPRE_MEMORY_HOST);
+
+      hypre_TFree(int_len, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_len, HYPRE_MEMORY_HOST);
+      hypre_TFree(int_big_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_big_j, HYPRE_MEMORY_HOST);
+   }
+
+   return plan;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanCompute
+ *
+ * Recomputes the values of C = P^T A P from the values of A. A must have
+ * the sparsity pattern, and C the pattern and column map, the plan was
+ * built for. Collective on the communicator of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanCompute( hypre_ParCSRRAPPlan *plan,
+                            hypre_ParCSRMatrix  *A,
+                            hypre_ParCSRMatrix  *C )
+{
+   hypre_CSRMatrix        *A_diag      = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd      = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix        *C_diag      = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrix        *C_offd      = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Complex          *C_diag_data = hypre_CSRMatrixData(C_diag);
+   HYPRE_Complex          *C_offd_data = hypre_CSRMatrixData(C_offd);
+   HYPRE_Int               nc          = plan -> num_cols_diag;
+   HYPRE_Int               width_AP    = nc + plan -> num_cols_offd_AP;
+   HYPRE_Int               width_C     = 2 * (nc + hypre_CSRMatrixNumCols(C_offd));
+   HYPRE_Int               num_threads = hypre_NumThreads();
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Int              *work;
+   HYPRE_Int               e;
+
+   if ( hypre_CSRMatrixNumNonzeros(A_diag) != plan -> A_diag_nnz ||
+        hypre_CSRMatrixNumNonzeros(A_offd) != plan -> A_offd_nnz ||
+        hypre_CSRMatrixNumNonzeros(C_diag) != plan -> C_diag_nnz ||
+        hypre_CSRMatrixNumNonzeros(C_offd) != plan -> C_offd_nnz )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Sparsity pattern differs from the one of the RAP plan\n");
+      return hypre_error_flag;
+   }
+
+   if ( hypre_CSRMatrixDataSp(A_diag) || hypre_CSRMatrixDataSp(A_offd) ||
+        hypre_CSRMatrixDataSp(C_diag) || hypre_CSRMatrixDataSp(C_offd) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "RAP plans need double precision matrices\n");
+      return hypre_error_flag;
+   }
+
+   /* the values of C are overwritten in place */
+   hypre_ParCSRMatrixSellDestroy(C);
+
+   work = hypre_TAlloc(HYPRE_Int, num_threads * hypre_max(hypre_max(width_AP, width_C), 1),
+                       HYPRE_MEMORY_HOST);
+
+   /* AP = A*P */
+   hypre_RAPPlanProductValues(A_diag, plan -> P_loc, A_offd, plan -> P_ext, plan -> AP, work);
+
+   /* rows of C owned by other processes, sent while the local rows are computed */
+   if (plan -> RAP_int)
+   {
+      hypre_RAPPlanProductValues(plan -> PT_offd, plan -> AP, NULL, NULL, plan -> RAP_int, work);
+   }
+   if (plan -> comm_pkg_int)
+   {
+      comm_handle = hypre_ParCSRCommHandleCreate(1, plan -> comm_pkg_int,
+                                                 plan -> RAP_int ? hypre_CSRMatrixData(plan -> RAP_int) : NULL,
+                                                 plan -> recv_data);
+   }
+
+   hypre_RAPPlanLocalValues(plan -> PT_diag, plan -> AP, plan -> AP_to_C, C_diag, C_offd, work);
+
+   if (comm_handle)
+   {
+      HYPRE_Int     *recv_pos   = plan -> recv_pos;
+      HYPRE_Complex *recv_data  = plan -> recv_data;
+      HYPRE_Int      C_diag_nnz = plan -> C_diag_nnz;
+
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      for (e = 0; e < plan -> num_recv; e++)
+      {
+         if (recv_pos[e] >= C_diag_nnz)
+         {
+            C_offd_data[recv_pos[e] - C_diag_nnz] += recv_data[e];
+         }
+         else if (recv_pos[e] >= 0)
+         {
+            C_diag_data[recv_pos[e]] += recv_data[e];
+         }
+      }
+   }
+
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanDestroy( hypre_ParCSRRAPPlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(plan -> col_map_offd_AP, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(plan -> P_loc);
+      hypre_CSRMatrixDestroy(plan -> P_ext);
+      hypre_CSRMatrixDestroy(plan -> AP);
+      hypre_CSRMatrixDestroy(plan -> PT_diag);
+      hypre_CSRMatrixDestroy(plan -> PT_offd);
+      hypre_CSRMatrixDestroy(plan -> RAP_int);
+      hypre_TFree(plan -> AP_to_C, HYPRE_MEMORY_HOST);
+      if (plan -> comm_pkg_int)
+      {
+         hypre_MatvecCommPkgDestroy(plan -> comm_pkg_int);
+      }
+      hypre_TFree(plan -> recv_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> recv_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
@@ -321,6 +321,90 @@ hypre_ParVectorCopy( hypre_ParVector *x,
    return hypre_SeqVectorCopy(x_local, y_local);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorPack
+ *
+ * Copies the k single vectors x[j] into the first k vectors of the
+ * multivector x_mv, for either storage method of x_mv.  Host memory only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMultiVectorPack( HYPRE_Int         k,
+                          hypre_ParVector **x,
+                          hypre_ParVector  *x_mv )
+{
+   hypre_Vector   *mv_local  = hypre_ParVectorLocalVector(x_mv);
+   HYPRE_Complex  *mv_data   = hypre_VectorData(mv_local);
+   HYPRE_Int       vecstride = hypre_VectorVectorStride(mv_local);
+   HYPRE_Int       idxstride = hypre_VectorIndexStride(mv_local);
+   HYPRE_Int       size      = hypre_VectorSize(mv_local);
+   HYPRE_Complex **x_data;
+   HYPRE_Int       i, j;
+
+   x_data = hypre_TAlloc(HYPRE_Complex *, k, HYPRE_MEMORY_HOST);
+   for (j = 0; j < k; j++)
+   {
+      x_data[j] = hypre_VectorData(hypre_ParVectorLocalVector(x[j]));
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      for (j = 0; j < k; j++)
+      {
+         mv_data[j*vecstride + i*idxstride] = x_data[j][i];
+      }
+   }
+
+   hypre_TFree(x_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMultiVectorUnpack
+ *
+ * Copies the first k vectors of the multivector x_mv into the k single
+ * vectors x[j].  Host memory only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMultiVectorUnpack( hypre_ParVector  *x_mv,
+                            HYPRE_Int         k,
+                            hypre_ParVector **x )
+{
+   hypre_Vector   *mv_local  = hypre_ParVectorLocalVector(x_mv);
+   HYPRE_Complex  *mv_data   = hypre_VectorData(mv_local);
+   HYPRE_Int       vecstride = hypre_VectorVectorStride(mv_local);
+   HYPRE_Int       idxstride = hypre_VectorIndexStride(mv_local);
+   HYPRE_Int       size      = hypre_VectorSize(mv_local);
+   HYPRE_Complex **x_data;
+   HYPRE_Int       i, j;
+
+   x_data = hypre_TAlloc(HYPRE_Complex *, k, HYPRE_MEMORY_HOST);
+   for (j = 0; j < k; j++)
+   {
+      x_data[j] = hypre_VectorData(hypre_ParVectorLocalVector(x[j]));
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      for (j = 0; j < k; j++)
+      {
+         x_data[j][i] = mv_data[j*vecstride + i*idxstride];
+      }
+   }
+
+   hypre_TFree(x_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorCloneShallow
  * returns a complete copy of a hypre_ParVector x - a shallow copy, re-using
@@ -104,3 +104,18 @@ HYPRE_CSRMatrixSetSpGemmUseCusparse( HYPRE_Int use_cusparse )
    return hypre_CSRMatrixDeviceSpGemmSetUseCusparse(use_cusparse);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_CSRMatrixSetSpMVUseSell
+ *
+ * Global default for the host matvec storage format of all CSR matrices
+ * that do not set their own (0: CSR, 1: SELL-C-sigma).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CSRMatrixSetSpMVUseSell( HYPRE_Int use_sell )
+{
+   hypre_HandleSpMVUseSell(hypre_handle()) = use_sell;
+
+   return hypre_error_flag;
+}
+
@@ -1527,6 +1527,8 @@ hypre_CSRMatrixReorderHost(hypre_CSRMatrix *A)
       return -1;
    }
 
+   hypre_CSRMatrixSellDestroy(A);
+
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i, ii, j) HYPRE_SMP_SCHEDULE
 #endif
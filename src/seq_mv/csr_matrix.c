@@ -40,6 +40,9 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
    hypre_CSRMatrixMemoryLocation(matrix) = hypre_HandleMemoryLocation(hypre_handle());
+   hypre_CSRMatrixSpMVUseSell(matrix)    = -1;
+   hypre_CSRMatrixSellData(matrix)       = NULL;
+   hypre_CSRMatrixDataSp(matrix)         = NULL;
 
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)  = 1;
@@ -72,10 +75,12 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
 
       hypre_TFree(hypre_CSRMatrixI(matrix),      memory_location);
       hypre_TFree(hypre_CSRMatrixRownnz(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixSellDestroy(matrix);
 
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
          hypre_TFree(hypre_CSRMatrixData(matrix), memory_location);
+         hypre_TFree(hypre_CSRMatrixDataSp(matrix), HYPRE_MEMORY_HOST);
          hypre_TFree(hypre_CSRMatrixJ(matrix),    memory_location);
          hypre_TFree(hypre_CSRMatrixBigJ(matrix), memory_location);
 #if defined(HYPRE_USING_CUSPARSE)
@@ -724,6 +729,9 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
    HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
 
+   /* B is overwritten in place */
+   hypre_CSRMatrixSellDestroy(B);
+
    hypre_TMemcpy(B_i, A_i, HYPRE_Int, num_rows + 1, memory_location_B, memory_location_A);
 
    if (A_j && B_j)
@@ -26,6 +26,54 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) shadow of a CSR matrix, used by the host
+ * matvec kernels. Rows are sorted by length within windows of sigma rows
+ * and grouped in chunks of C rows; each chunk is stored column-major and
+ * padded to the length of its longest row, so that one column of a chunk
+ * maps onto one SIMD register.
+ *--------------------------------------------------------------------------*/
+
+#if defined(HYPRE_SINGLE)
+#define hypre_SELL_C 16
+#else
+#define hypre_SELL_C 8
+#endif
+#define hypre_SELL_SIGMA 256
+
+typedef struct
+{
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_chunks;
+   HYPRE_Int             sigma;
+   HYPRE_Int            *chunk_ptr;       /* offset of each chunk in `j', `data' */
+   HYPRE_Int            *chunk_len;       /* padded row length of each chunk */
+   HYPRE_Int            *rows;            /* slot -> original row, -1 for padding */
+   HYPRE_Int            *j;
+   HYPRE_Complex        *data;
+   HYPRE_Int             nnz_padded;
+
+   /* CSR arrays the shadow was built from, used to detect stale shadows */
+   HYPRE_Int            *csr_i;
+   HYPRE_Int            *csr_j;
+   HYPRE_Complex        *csr_data;
+   HYPRE_Int             csr_num_nonzeros;
+} hypre_SellData;
+
+#define hypre_SellDataNumRows(sell)          ((sell) -> num_rows)
+#define hypre_SellDataNumChunks(sell)        ((sell) -> num_chunks)
+#define hypre_SellDataSigma(sell)            ((sell) -> sigma)
+#define hypre_SellDataChunkPtr(sell)         ((sell) -> chunk_ptr)
+#define hypre_SellDataChunkLen(sell)         ((sell) -> chunk_len)
+#define hypre_SellDataRows(sell)             ((sell) -> rows)
+#define hypre_SellDataJ(sell)                ((sell) -> j)
+#define hypre_SellDataData(sell)             ((sell) -> data)
+#define hypre_SellDataNnzPadded(sell)        ((sell) -> nnz_padded)
+#define hypre_SellDataCSRI(sell)             ((sell) -> csr_i)
+#define hypre_SellDataCSRJ(sell)             ((sell) -> csr_j)
+#define hypre_SellDataCSRData(sell)          ((sell) -> csr_data)
+#define hypre_SellDataCSRNumNonzeros(sell)   ((sell) -> csr_num_nonzeros)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -45,6 +93,10 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   HYPRE_Int             spmv_use_sell;   /* -1: use global setting, 0: CSR, 1: SELL-C-sigma */
+   hypre_SellData       *sell_data;       /* lazily built SELL-C-sigma shadow for host matvec */
+   hypre_float          *data_sp;         /* single precision values (mixed-precision AMG);
+                                             `data' is NULL when this is set */
 #if defined(HYPRE_USING_CUSPARSE)
    HYPRE_Int            *sorted_j;        /* some cusparse routines require sorted CSR */
    HYPRE_Complex        *sorted_data;
@@ -71,6 +123,9 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)            ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSpMVUseSell(matrix)          ((matrix) -> spmv_use_sell)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
+#define hypre_CSRMatrixDataSp(matrix)               ((matrix) -> data_sp)
 
 #if defined(HYPRE_USING_CUSPARSE)
 #define hypre_CSRMatrixSortedJ(matrix)              ((matrix) -> sorted_j)
@@ -0,0 +1,465 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma (sorted, sliced ELLPACK) shadow storage for hypre_CSRMatrix
+ * and the corresponding host matvec kernels.
+ *
+ * The shadow is built lazily the first time a matvec is requested on a matrix
+ * for which SELL is enabled (per matrix or globally), and it is rebuilt when
+ * the CSR arrays it was built from are replaced. Replacement is detected by
+ * comparing array pointers, which cannot see in-place changes (and can be
+ * fooled by the allocator handing back a freed address), so every routine
+ * that modifies the values or column indices of a CSR matrix in place calls
+ * hypre_CSRMatrixSellDestroy (hypre_ParCSRMatrixSellDestroy for ParCSR):
+ * hypre_CSRMatrixCopy, hypre_CSRMatrixReorder, hypre_CSRMatrixScale,
+ * hypre_CSRMatrixDropInplace, hypre_ParCSRMatrixDropSmallEntries,
+ * hypre_ParCSRMatrixTruncate, hypre_ParCSRMatrixFixZeroRows,
+ * hypre_ParCSRRAPPlanCompute and the IJ Set/AddTo/SetConstantValues routines
+ * on assembled matrices. New in-place writers must do the same.
+ * hypre_BoomerAMGSetupUpdate also drops the shadow of its fine matrix, since
+ * callers may change its values directly through the CSR arrays.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+#if defined(__AVX512F__) && !defined(HYPRE_COMPLEX) && !defined(HYPRE_LONG_DOUBLE) && !defined(HYPRE_BIGINT)
+#include <immintrin.h>
+#define HYPRE_SELL_USING_AVX512
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellDestroy( hypre_CSRMatrix *A )
+{
+   hypre_SellData *sell = hypre_CSRMatrixSellData(A);
+
+   if (sell)
+   {
+      hypre_TFree(hypre_SellDataChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellDataChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellDataRows(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellDataJ(sell),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellDataData(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(sell,                         HYPRE_MEMORY_HOST);
+
+      hypre_CSRMatrixSellData(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellCreate
+ *
+ * Builds the SELL-C-sigma shadow of A. Rows are sorted by decreasing length
+ * within windows of sigma rows, then split into chunks of hypre_SELL_C rows.
+ * Padding entries carry a zero value and a valid column index of the row,
+ * so the kernels never need to test for them.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellCreate( hypre_CSRMatrix *A,
+                           HYPRE_Int        sigma )
+{
+   HYPRE_Int      *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int      *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Complex  *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int       num_rows = hypre_CSRMatrixNumRows(A);
+
+   hypre_SellData *sell;
+   HYPRE_Int       num_chunks, nnz_padded;
+   HYPRE_Int      *chunk_ptr, *chunk_len, *rows;
+   HYPRE_Int      *sell_j;
+   HYPRE_Complex  *sell_data;
+   HYPRE_Int      *row_len, *perm;
+   HYPRE_Int       i, k, c, l, w, w_end, len, row, pad_j;
+
+   hypre_CSRMatrixSellDestroy(A);
+
+   if (sigma < 1)
+   {
+      sigma = hypre_SELL_SIGMA;
+   }
+   /* sorting windows are made of whole chunks */
+   sigma = ((sigma + hypre_SELL_C - 1) / hypre_SELL_C) * hypre_SELL_C;
+
+   num_chunks = (num_rows + hypre_SELL_C - 1) / hypre_SELL_C;
+
+   chunk_ptr = hypre_CTAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_len = hypre_CTAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+   rows      = hypre_TAlloc(HYPRE_Int, num_chunks * hypre_SELL_C, HYPRE_MEMORY_HOST);
+   row_len   = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   perm      = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+   /* sort rows by decreasing length within each sigma window */
+   for (i = 0; i < num_rows; i++)
+   {
+      row_len[i] = -(A_i[i+1] - A_i[i]);
+      perm[i]    = i;
+   }
+   for (w = 0; w < num_rows; w += sigma)
+   {
+      w_end = hypre_min(w + sigma, num_rows);
+      hypre_qsort2i(row_len, perm, w, w_end - 1);
+   }
+
+   for (i = 0; i < num_chunks * hypre_SELL_C; i++)
+   {
+      rows[i] = (i < num_rows) ? perm[i] : -1;
+   }
+
+   /* chunk lengths and offsets */
+   for (c = 0; c < num_chunks; c++)
+   {
+      len = 0;
+      for (l = 0; l < hypre_SELL_C; l++)
+      {
+         row = rows[c*hypre_SELL_C + l];
+         if (row >= 0)
+         {
+            len = hypre_max(len, A_i[row+1] - A_i[row]);
+         }
+      }
+      chunk_len[c]     = len;
+      chunk_ptr[c + 1] = chunk_ptr[c] + len * hypre_SELL_C;
+   }
+   nnz_padded = chunk_ptr[num_chunks];
+
+   sell_j    = hypre_TAlloc(HYPRE_Int,     nnz_padded, HYPRE_MEMORY_HOST);
+   sell_data = hypre_TAlloc(HYPRE_Complex, nnz_padded, HYPRE_MEMORY_HOST);
+
+   /* fill column-major chunks */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c,l,k,row,len,pad_j) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      for (l = 0; l < hypre_SELL_C; l++)
+      {
+         row = rows[c*hypre_SELL_C + l];
+         len = (row >= 0) ? A_i[row+1] - A_i[row] : 0;
+         pad_j = (len > 0) ? A_j[A_i[row]] : 0;
+
+         for (k = 0; k < len; k++)
+         {
+            sell_j   [chunk_ptr[c] + k*hypre_SELL_C + l] = A_j[A_i[row] + k];
+            sell_data[chunk_ptr[c] + k*hypre_SELL_C + l] = A_data[A_i[row] + k];
+         }
+         for (k = len; k < chunk_len[c]; k++)
+         {
+            sell_j   [chunk_ptr[c] + k*hypre_SELL_C + l] = pad_j;
+            sell_data[chunk_ptr[c] + k*hypre_SELL_C + l] = 0.0;
+         }
+      }
+   }
+
+   hypre_TFree(row_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm,    HYPRE_MEMORY_HOST);
+
+   sell = hypre_CTAlloc(hypre_SellData, 1, HYPRE_MEMORY_HOST);
+
+   hypre_SellDataNumRows(sell)        = num_rows;
+   hypre_SellDataNumChunks(sell)      = num_chunks;
+   hypre_SellDataSigma(sell)          = sigma;
+   hypre_SellDataChunkPtr(sell)       = chunk_ptr;
+   hypre_SellDataChunkLen(sell)       = chunk_len;
+   hypre_SellDataRows(sell)           = rows;
+   hypre_SellDataJ(sell)              = sell_j;
+   hypre_SellDataData(sell)           = sell_data;
+   hypre_SellDataNnzPadded(sell)      = nnz_padded;
+   hypre_SellDataCSRI(sell)           = A_i;
+   hypre_SellDataCSRJ(sell)           = A_j;
+   hypre_SellDataCSRData(sell)        = A_data;
+   hypre_SellDataCSRNumNonzeros(sell) = hypre_CSRMatrixNumNonzeros(A);
+
+   hypre_CSRMatrixSellData(A) = sell;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellSetup
+ *
+ * Returns the SELL shadow of A if SELL is enabled for A and usable on the
+ * host, building or rebuilding it when needed, and NULL otherwise.
+ *--------------------------------------------------------------------------*/
+
+hypre_SellData *
+hypre_CSRMatrixSellSetup( hypre_CSRMatrix *A )
+{
+   hypre_SellData *sell     = hypre_CSRMatrixSellData(A);
+   HYPRE_Int       use_sell = hypre_CSRMatrixSpMVUseSell(A);
+
+   if (use_sell < 0)
+   {
+      use_sell = hypre_HandleSpMVUseSell(hypre_handle());
+   }
+
+   if (!use_sell ||
+       hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+       hypre_CSRMatrixNumNonzeros(A) == 0)
+   {
+      return NULL;
+   }
+
+   if ( !sell ||
+        hypre_SellDataNumRows(sell)        != hypre_CSRMatrixNumRows(A)     ||
+        hypre_SellDataCSRI(sell)           != hypre_CSRMatrixI(A)           ||
+        hypre_SellDataCSRJ(sell)           != hypre_CSRMatrixJ(A)           ||
+        hypre_SellDataCSRData(sell)        != hypre_CSRMatrixData(A)        ||
+        hypre_SellDataCSRNumNonzeros(sell) != hypre_CSRMatrixNumNonzeros(A) )
+   {
+      hypre_CSRMatrixSellCreate(A, hypre_SELL_SIGMA);
+      sell = hypre_CSRMatrixSellData(A);
+   }
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SellChunkProduct
+ *
+ * acc[0:C] = chunk c of A times x
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_SellChunkProduct( hypre_SellData *sell,
+                        HYPRE_Int       c,
+                        HYPRE_Complex  *x_data,
+                        HYPRE_Complex  *acc )
+{
+   HYPRE_Int      len    = hypre_SellDataChunkLen(sell)[c];
+   HYPRE_Int     *s_j    = hypre_SellDataJ(sell) + hypre_SellDataChunkPtr(sell)[c];
+   HYPRE_Complex *s_data = hypre_SellDataData(sell) + hypre_SellDataChunkPtr(sell)[c];
+   HYPRE_Int      k;
+
+#if defined(HYPRE_SELL_USING_AVX512) && defined(HYPRE_SINGLE)
+   __m512 vacc = _mm512_setzero_ps();
+   for (k = 0; k < len; k++)
+   {
+      __m512i vj = _mm512_loadu_si512((const void *) (s_j + k*hypre_SELL_C));
+      __m512  va = _mm512_loadu_ps(s_data + k*hypre_SELL_C);
+      __m512  vx = _mm512_i32gather_ps(vj, x_data, sizeof(float));
+      vacc = _mm512_fmadd_ps(va, vx, vacc);
+   }
+   _mm512_storeu_ps(acc, vacc);
+#elif defined(HYPRE_SELL_USING_AVX512)
+   __m512d vacc = _mm512_setzero_pd();
+   for (k = 0; k < len; k++)
+   {
+      __m256i vj = _mm256_loadu_si256((const __m256i *) (s_j + k*hypre_SELL_C));
+      __m512d va = _mm512_loadu_pd(s_data + k*hypre_SELL_C);
+      __m512d vx = _mm512_i32gather_pd(vj, x_data, sizeof(double));
+      vacc = _mm512_fmadd_pd(va, vx, vacc);
+   }
+   _mm512_storeu_pd(acc, vacc);
+#else
+   HYPRE_Int      l;
+
+   for (l = 0; l < hypre_SELL_C; l++)
+   {
+      acc[l] = 0.0;
+   }
+   for (k = 0; k < len; k++)
+   {
+      for (l = 0; l < hypre_SELL_C; l++)
+      {
+         acc[l] += s_data[k*hypre_SELL_C + l] * x_data[s_j[k*hypre_SELL_C + l]];
+      }
+   }
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSellHost
+ *
+ * y = alpha*A*x + beta*b using the SELL shadow of A (single vector only).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSellHost( HYPRE_Complex    alpha,
+                               hypre_SellData  *sell,
+                               hypre_Vector    *x,
+                               HYPRE_Complex    beta,
+                               hypre_Vector    *b,
+                               hypre_Vector    *y )
+{
+   HYPRE_Int      num_chunks = hypre_SellDataNumChunks(sell);
+   HYPRE_Int     *rows       = hypre_SellDataRows(sell);
+   HYPRE_Complex *x_data     = hypre_VectorData(x);
+   HYPRE_Complex *b_data     = hypre_VectorData(b);
+   HYPRE_Complex *y_data     = hypre_VectorData(y);
+   HYPRE_Complex  acc[hypre_SELL_C];
+   HYPRE_Int      c, l, row;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c,l,row,acc) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      hypre_SellChunkProduct(sell, c, x_data, acc);
+
+      if (beta == 0.0)
+      {
+         for (l = 0; l < hypre_SELL_C; l++)
+         {
+            row = rows[c*hypre_SELL_C + l];
+            if (row >= 0)
+            {
+               y_data[row] = alpha*acc[l];
+            }
+         }
+      }
+      else
+      {
+         for (l = 0; l < hypre_SELL_C; l++)
+         {
+            row = rows[c*hypre_SELL_C + l];
+            if (row >= 0)
+            {
+               y_data[row] = alpha*acc[l] + beta*b_data[row];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSellHost
+ *
+ * y = alpha*A^T*x + beta*y using the SELL shadow of A (single vector only).
+ * Lanes of a chunk may update the same entry of y, so the scatter is done
+ * in scalar order; with threads, each thread accumulates into its own copy
+ * of y as in hypre_CSRMatrixMatvecTHost.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSellHost( HYPRE_Complex    alpha,
+                                hypre_SellData  *sell,
+                                hypre_Vector    *x,
+                                HYPRE_Complex    beta,
+                                hypre_Vector    *y )
+{
+   HYPRE_Int      num_chunks = hypre_SellDataNumChunks(sell);
+   HYPRE_Int     *chunk_ptr  = hypre_SellDataChunkPtr(sell);
+   HYPRE_Int     *chunk_len  = hypre_SellDataChunkLen(sell);
+   HYPRE_Int     *rows       = hypre_SellDataRows(sell);
+   HYPRE_Int     *s_j        = hypre_SellDataJ(sell);
+   HYPRE_Complex *s_data     = hypre_SellDataData(sell);
+   HYPRE_Complex *x_data     = hypre_VectorData(x);
+   HYPRE_Complex *y_data     = hypre_VectorData(y);
+   HYPRE_Int      y_size     = hypre_VectorSize(y);
+   HYPRE_Int      num_threads = hypre_NumThreads();
+   HYPRE_Complex *y_data_expand = NULL;
+   HYPRE_Complex *y_local;
+   HYPRE_Complex  xr;
+   HYPRE_Int      i, c, k, l, t, row, pos, my_thread_num;
+
+   if (beta == 0.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < y_size; i++)
+      {
+         y_data[i] = 0.0;
+      }
+   }
+   else if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < y_size; i++)
+      {
+         y_data[i] *= beta;
+      }
+   }
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*y_size, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,c,k,l,t,row,pos,xr,my_thread_num,y_local)
+#endif
+   {
+      my_thread_num = hypre_GetThreadNum();
+      y_local = (num_threads > 1) ? y_data_expand + my_thread_num*y_size : y_data;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (c = 0; c < num_chunks; c++)
+      {
+         for (l = 0; l < hypre_SELL_C; l++)
+         {
+            row = rows[c*hypre_SELL_C + l];
+            if (row < 0)
+            {
+               continue;
+            }
+            xr = alpha*x_data[row];
+            for (k = 0; k < chunk_len[c]; k++)
+            {
+               pos = chunk_ptr[c] + k*hypre_SELL_C + l;
+               y_local[s_j[pos]] += s_data[pos]*xr;
+            }
+         }
+      }
+
+      if (num_threads > 1)
+      {
+         /* implied barrier (for threads) */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (t = 0; t < num_threads; t++)
+            {
+               y_data[i] += y_data_expand[t*y_size + i];
+            }
+         }
+      }
+   }
+
+   hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetSpMVUseSell
+ *
+ * use_sell = -1: follow the global setting (HYPRE_CSRMatrixSetSpMVUseSell)
+ * use_sell =  0: always use the CSR kernels
+ * use_sell =  1: use the SELL-C-sigma kernels on the host
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetSpMVUseSell( hypre_CSRMatrix *A,
+                               HYPRE_Int        use_sell )
+{
+   hypre_CSRMatrixSpMVUseSell(A) = use_sell;
+
+   if (use_sell == 0)
+   {
+      hypre_CSRMatrixSellDestroy(A);
+   }
+
+   return hypre_error_flag;
+}
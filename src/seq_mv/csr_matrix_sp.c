@@ -0,0 +1,228 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single precision value storage for hypre_CSRMatrix and the corresponding
+ * host matvec kernels.
+ *
+ * A matrix converted with hypre_CSRMatrixConvertToSinglePrecision keeps its
+ * values in `data_sp' and no longer has `data'; vectors stay in HYPRE_Complex
+ * and all products are accumulated in HYPRE_Complex. This is used for the
+ * coarse levels of mixed-precision BoomerAMG hierarchies, where only the
+ * kernels of the solve phase (matvec, matvecT and relaxation) touch the
+ * matrices after setup.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToSinglePrecision
+ *
+ * Replaces the values of a host matrix by a single precision copy. Matrices
+ * that do not own their data or live on the device are left alone.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToSinglePrecision( hypre_CSRMatrix *A )
+{
+   HYPRE_Complex *data     = hypre_CSRMatrixData(A);
+   HYPRE_Int      num_nnz  = hypre_CSRMatrixNumNonzeros(A);
+   hypre_float   *data_sp;
+   HYPRE_Int      i;
+
+#if defined(HYPRE_COMPLEX)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single precision storage is not available for complex matrices\n");
+   return hypre_error_flag;
+#endif
+
+   if ( hypre_CSRMatrixDataSp(A) || !hypre_CSRMatrixOwnsData(A) ||
+        hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST )
+   {
+      return hypre_error_flag;
+   }
+
+   data_sp = hypre_TAlloc(hypre_float, hypre_max(num_nnz, 1), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nnz; i++)
+   {
+      data_sp[i] = (hypre_float) data[i];
+   }
+
+   hypre_CSRMatrixSellDestroy(A);
+   hypre_TFree(data, hypre_CSRMatrixMemoryLocation(A));
+   hypre_CSRMatrixData(A)   = NULL;
+   hypre_CSRMatrixDataSp(A) = data_sp;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSpHost
+ *
+ * y[offset:] = alpha*A[offset:,:]*x + beta*b[offset:] for a matrix stored
+ * in single precision. Only single vectors are supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSpHost( HYPRE_Complex    alpha,
+                             hypre_CSRMatrix *A,
+                             hypre_Vector    *x,
+                             HYPRE_Complex    beta,
+                             hypre_Vector    *b,
+                             hypre_Vector    *y,
+                             HYPRE_Int        offset )
+{
+   hypre_float      *A_data   = hypre_CSRMatrixDataSp(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A) + offset;
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A) - offset;
+   HYPRE_Complex    *x_data   = hypre_VectorData(x);
+   HYPRE_Complex    *b_data   = hypre_VectorData(b) + offset;
+   HYPRE_Complex    *y_data   = hypre_VectorData(y) + offset;
+   hypre_Vector     *x_tmp    = NULL;
+   HYPRE_Complex     sum;
+   HYPRE_Int         i, jj;
+
+   if (hypre_VectorNumVectors(x) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single precision matvec supports one vector only\n");
+      return hypre_error_flag;
+   }
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,sum) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      sum = 0.0;
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         sum += A_data[jj] * x_data[A_j[jj]];
+      }
+      y_data[i] = (beta == 0.0) ? alpha * sum : alpha * sum + beta * b_data[i];
+   }
+
+   if (x_tmp)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSpHost
+ *
+ * y = alpha*A^T*x + beta*y for a matrix stored in single precision. Uses
+ * one private copy of y per thread, like hypre_CSRMatrixMatvecTHost.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSpHost( HYPRE_Complex    alpha,
+                              hypre_CSRMatrix *A,
+                              hypre_Vector    *x,
+                              HYPRE_Complex    beta,
+                              hypre_Vector    *y )
+{
+   hypre_float      *A_data      = hypre_CSRMatrixDataSp(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A);
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *y_data      = hypre_VectorData(y);
+   HYPRE_Int         y_size      = hypre_VectorSize(y);
+   HYPRE_Int         num_threads = hypre_NumThreads();
+   HYPRE_Complex    *y_data_expand;
+   hypre_Vector     *x_tmp = NULL;
+   HYPRE_Int         i, jj, t;
+
+   if (hypre_VectorNumVectors(x) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single precision matvec supports one vector only\n");
+      return hypre_error_flag;
+   }
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < y_size; i++)
+   {
+      y_data[i] *= beta;
+   }
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,jj,t)
+#endif
+      {
+         HYPRE_Complex *y_thread = y_data_expand + hypre_GetThreadNum() * y_size;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               y_thread[A_j[jj]] += A_data[jj] * x_data[i];
+            }
+         }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (t = 0; t < num_threads; t++)
+            {
+               y_data[i] += alpha * y_data_expand[t * y_size + i];
+            }
+         }
+      }
+
+      hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         const HYPRE_Complex ax = alpha * x_data[i];
+
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            y_data[A_j[jj]] += A_data[jj] * ax;
+         }
+      }
+   }
+
+   if (x_tmp)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return hypre_error_flag;
+}
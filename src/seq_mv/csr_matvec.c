@@ -13,6 +13,155 @@
 
 #include "seq_mv.h"
 
+/* number of vectors of a multivector accumulated together in the SpMM kernels */
+#define HYPRE_SPMM_CHUNK 8
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMMHost
+ *
+ * y[m,:] += A[m,:]*x[:,:] for the num_vectors columns of a multivector, where
+ * m = rownnz[i] if rownnz is given and m = i otherwise. Vectors are processed
+ * in chunks of HYPRE_SPMM_CHUNK so that A is streamed once per chunk rather
+ * than once per vector. With row-major (interleaved) storage the entries of
+ * a chunk are contiguous and the inner loop has unit stride.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixSpMMHost( HYPRE_Int      num_rows,
+                         HYPRE_Int     *rownnz,
+                         HYPRE_Int     *A_i,
+                         HYPRE_Int     *A_j,
+                         HYPRE_Complex *A_data,
+                         HYPRE_Int      num_vectors,
+                         HYPRE_Complex *x_data,
+                         HYPRE_Int      vecstride_x,
+                         HYPRE_Int      idxstride_x,
+                         HYPRE_Complex *y_data,
+                         HYPRE_Int      vecstride_y,
+                         HYPRE_Int      idxstride_y )
+{
+   HYPRE_Int i;
+
+   if (vecstride_x == 1 && vecstride_y == 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         const HYPRE_Int  m = rownnz ? rownnz[i] : i;
+         HYPRE_Complex   *y_m = y_data + m*idxstride_y;
+         HYPRE_Complex    sum[HYPRE_SPMM_CHUNK];
+         HYPRE_Int        jj, v, v0, nv;
+
+         for (v0 = 0; v0 < num_vectors; v0 += HYPRE_SPMM_CHUNK)
+         {
+            nv = hypre_min(HYPRE_SPMM_CHUNK, num_vectors - v0);
+            for (v = 0; v < nv; v++)
+            {
+               sum[v] = 0.0;
+            }
+            for (jj = A_i[m]; jj < A_i[m+1]; jj++)
+            {
+               const HYPRE_Complex  a   = A_data[jj];
+               const HYPRE_Complex *x_j = x_data + A_j[jj]*idxstride_x + v0;
+               for (v = 0; v < nv; v++)
+               {
+                  sum[v] += a * x_j[v];
+               }
+            }
+            for (v = 0; v < nv; v++)
+            {
+               y_m[v0 + v] += sum[v];
+            }
+         }
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         const HYPRE_Int  m = rownnz ? rownnz[i] : i;
+         HYPRE_Complex    sum[HYPRE_SPMM_CHUNK];
+         HYPRE_Int        jj, v, v0, nv;
+
+         for (v0 = 0; v0 < num_vectors; v0 += HYPRE_SPMM_CHUNK)
+         {
+            nv = hypre_min(HYPRE_SPMM_CHUNK, num_vectors - v0);
+            for (v = 0; v < nv; v++)
+            {
+               sum[v] = 0.0;
+            }
+            for (jj = A_i[m]; jj < A_i[m+1]; jj++)
+            {
+               const HYPRE_Complex  a   = A_data[jj];
+               const HYPRE_Complex *x_j = x_data + A_j[jj]*idxstride_x + v0*vecstride_x;
+               for (v = 0; v < nv; v++)
+               {
+                  sum[v] += a * x_j[v*vecstride_x];
+               }
+            }
+            for (v = 0; v < nv; v++)
+            {
+               y_data[(v0 + v)*vecstride_y + m*idxstride_y] += sum[v];
+            }
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMMTHost
+ *
+ * y[:,:] += A^T*x[:,:] for the num_vectors columns of a multivector, reading
+ * A once for all vectors. Not threaded, as the scatter into y would race.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixSpMMTHost( HYPRE_Int      num_rows,
+                          HYPRE_Int     *A_i,
+                          HYPRE_Int     *A_j,
+                          HYPRE_Complex *A_data,
+                          HYPRE_Int      num_vectors,
+                          HYPRE_Complex *x_data,
+                          HYPRE_Int      vecstride_x,
+                          HYPRE_Int      idxstride_x,
+                          HYPRE_Complex *y_data,
+                          HYPRE_Int      vecstride_y,
+                          HYPRE_Int      idxstride_y )
+{
+   HYPRE_Int i, jj, v;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      const HYPRE_Complex *x_i = x_data + i*idxstride_x;
+
+      for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+      {
+         const HYPRE_Complex  a   = A_data[jj];
+         HYPRE_Complex       *y_j = y_data + A_j[jj]*idxstride_y;
+
+         if (vecstride_x == 1 && vecstride_y == 1)
+         {
+            for (v = 0; v < num_vectors; v++)
+            {
+               y_j[v] += a * x_i[v];
+            }
+         }
+         else
+         {
+            for (v = 0; v < num_vectors; v++)
+            {
+               y_j[v*vecstride_y] += a * x_i[v*vecstride_x];
+            }
+         }
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -54,6 +203,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
    HYPRE_Int         i, j, jj, m, ierr=0;
    HYPRE_Real        xpar=0.7;
    hypre_Vector     *x_tmp = NULL;
+   hypre_SellData   *sell = NULL;
 
    /*---------------------------------------------------------------------
     *  Check for size compatibility.  Matvec returns ierr = 1 if
@@ -105,6 +255,14 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
       return ierr;
    }
 
+   if (hypre_CSRMatrixDataSp(A))
+   {
+      /* values stored in single precision */
+      hypre_CSRMatrixMatvecSpHost(alpha, A, x, beta, b, y, offset);
+
+      return ierr;
+   }
+
    if (x == y)
    {
       x_tmp = hypre_SeqVectorCloneDeep(x);
@@ -113,7 +271,20 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
    temp = beta / alpha;
 
-   if (num_vectors > 1)
+   if (num_vectors == 1 && offset == 0)
+   {
+      sell = hypre_CSRMatrixSellSetup(A);
+   }
+
+   if (sell)
+   {
+      /*-----------------------------------------------------------------------
+       * y = alpha*A*x + beta*b with the SELL-C-sigma kernel
+       *-----------------------------------------------------------------------*/
+
+      hypre_CSRMatrixMatvecSellHost(alpha, sell, x_tmp ? x_tmp : x, beta, b, y);
+   }
+   else if (num_vectors > 1)
    {
       /*-----------------------------------------------------------------------
        * y = (beta/alpha)*b
@@ -166,40 +337,15 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
       if (num_rownnz < xpar*num_rows)
       {
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,j,jj,m,tempx) HYPRE_SMP_SCHEDULE
-#endif
-         for (i = 0; i < num_rownnz; i++)
-         {
-            m = A_rownnz[i];
-            for (j = 0; j < num_vectors; j++)
-            {
-               tempx = 0.0;
-               for (jj = A_i[m]; jj < A_i[m+1]; jj++)
-               {
-                  tempx += A_data[jj] * x_data[j*vecstride_x + A_j[jj]*idxstride_x];
-               }
-               y_data[j*vecstride_y + m*idxstride_y] += tempx;
-            }
-         }
+         hypre_CSRMatrixSpMMHost(num_rownnz, A_rownnz, A_i, A_j, A_data, num_vectors,
+                                 x_data, vecstride_x, idxstride_x,
+                                 y_data, vecstride_y, idxstride_y);
       }
       else
       {
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,j,jj,tempx) HYPRE_SMP_SCHEDULE
-#endif
-         for (i = 0; i < num_rows; i++)
-         {
-            for (j = 0; j < num_vectors; ++j)
-            {
-               tempx = 0.0;
-               for (jj = A_i[i]; jj < A_i[i+1]; jj++)
-               {
-                  tempx += A_data[jj] * x_data[j*vecstride_x + A_j[jj]*idxstride_x];
-               }
-               y_data[j*vecstride_y + i*idxstride_y] += tempx;
-            }
-         }
+         hypre_CSRMatrixSpMMHost(num_rows, NULL, A_i, A_j, A_data, num_vectors,
+                                 x_data, vecstride_x, idxstride_x,
+                                 y_data, vecstride_y, idxstride_y);
       }
 
       /*-----------------------------------------------------------------
@@ -779,12 +925,13 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
    HYPRE_Complex    *y_data_expand;
    HYPRE_Int         my_thread_num = 0, offset = 0;
 
-   HYPRE_Int         i, j, jv, jj;
+   HYPRE_Int         i, j, jj;
    HYPRE_Int         num_threads;
 
    HYPRE_Int         ierr  = 0;
 
    hypre_Vector     *x_tmp = NULL;
+   hypre_SellData   *sell = NULL;
 
    /*---------------------------------------------------------------------
     *  Check for size compatibility.  MatvecT returns ierr = 1 if
@@ -822,12 +969,41 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
       return ierr;
    }
 
+   if (hypre_CSRMatrixDataSp(A))
+   {
+      /* values stored in single precision */
+      hypre_CSRMatrixMatvecTSpHost(alpha, A, x, beta, y);
+
+      return ierr;
+   }
+
    if (x == y)
    {
       x_tmp = hypre_SeqVectorCloneDeep(x);
       x_data = hypre_VectorData(x_tmp);
    }
 
+   if (num_vectors == 1)
+   {
+      sell = hypre_CSRMatrixSellSetup(A);
+   }
+
+   if (sell)
+   {
+      /*-----------------------------------------------------------------------
+       * y = alpha*A^T*x + beta*y with the SELL-C-sigma kernel
+       *-----------------------------------------------------------------------*/
+
+      hypre_CSRMatrixMatvecTSellHost(alpha, sell, x_tmp ? x_tmp : x, beta, y);
+
+      if (x == y)
+      {
+         hypre_SeqVectorDestroy(x_tmp);
+      }
+
+      return ierr;
+   }
+
    /*-----------------------------------------------------------------------
     * y = (beta/alpha)*y
     *-----------------------------------------------------------------------*/
@@ -901,49 +1077,31 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
       else
       {
          /* multiple vector case is not threaded */
-         for (i = 0; i < num_rows; i++)
-         {
-            for ( jv=0; jv<num_vectors; ++jv )
-            {
-               for (jj = A_i[i]; jj < A_i[i+1]; jj++)
-               {
-                  j = A_j[jj];
-                  y_data[ j*idxstride_y + jv*vecstride_y ] +=
-                     A_data[jj] * x_data[ i*idxstride_x + jv*vecstride_x];
-               }
-            }
-         }
+         hypre_CSRMatrixSpMMTHost(num_rows, A_i, A_j, A_data, num_vectors,
+                                  x_data, vecstride_x, idxstride_x,
+                                  y_data, vecstride_y, idxstride_y);
       }
 
       hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
 
    }
-   else
+   else if (num_vectors == 1)
    {
       for (i = 0; i < num_rows; i++)
       {
-         if ( num_vectors==1 )
-         {
-            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
-            {
-               j = A_j[jj];
-               y_data[j] += A_data[jj] * x_data[i];
-            }
-         }
-         else
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
          {
-            for ( jv=0; jv<num_vectors; ++jv )
-            {
-               for (jj = A_i[i]; jj < A_i[i+1]; jj++)
-               {
-                  j = A_j[jj];
-                  y_data[ j*idxstride_y + jv*vecstride_y ] +=
-                     A_data[jj] * x_data[ i*idxstride_x + jv*vecstride_x ];
-               }
-            }
+            j = A_j[jj];
+            y_data[j] += A_data[jj] * x_data[i];
          }
       }
    }
+   else
+   {
+      hypre_CSRMatrixSpMMTHost(num_rows, A_i, A_j, A_data, num_vectors,
+                               x_data, vecstride_x, idxstride_x,
+                               y_data, vecstride_y, idxstride_y);
+   }
    /*-----------------------------------------------------------------
     * y = alpha*y
     *-----------------------------------------------------------------*/
@@ -69,6 +69,19 @@ HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memo
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows, HYPRE_Int new_num_cols, HYPRE_Int new_num_nonzeros );
 
+/* csr_matrix_sell.c */
+HYPRE_Int hypre_CSRMatrixSellDestroy( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellCreate( hypre_CSRMatrix *A, HYPRE_Int sigma );
+hypre_SellData *hypre_CSRMatrixSellSetup( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost( HYPRE_Complex alpha, hypre_SellData *sell, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSellHost( HYPRE_Complex alpha, hypre_SellData *sell, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixSetSpMVUseSell( hypre_CSRMatrix *A, HYPRE_Int use_sell );
+
+/* csr_matrix_sp.c */
+HYPRE_Int hypre_CSRMatrixConvertToSinglePrecision( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSpHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTSpHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
 HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
@@ -46,6 +46,54 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) shadow of a CSR matrix, used by the host
+ * matvec kernels. Rows are sorted by length within windows of sigma rows
+ * and grouped in chunks of C rows; each chunk is stored column-major and
+ * padded to the length of its longest row, so that one column of a chunk
+ * maps onto one SIMD register.
+ *--------------------------------------------------------------------------*/
+
+#if defined(HYPRE_SINGLE)
+#define hypre_SELL_C 16
+#else
+#define hypre_SELL_C 8
+#endif
+#define hypre_SELL_SIGMA 256
+
+typedef struct
+{
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_chunks;
+   HYPRE_Int             sigma;
+   HYPRE_Int            *chunk_ptr;       /* offset of each chunk in `j', `data' */
+   HYPRE_Int            *chunk_len;       /* padded row length of each chunk */
+   HYPRE_Int            *rows;            /* slot -> original row, -1 for padding */
+   HYPRE_Int            *j;
+   HYPRE_Complex        *data;
+   HYPRE_Int             nnz_padded;
+
+   /* CSR arrays the shadow was built from, used to detect stale shadows */
+   HYPRE_Int            *csr_i;
+   HYPRE_Int            *csr_j;
+   HYPRE_Complex        *csr_data;
+   HYPRE_Int             csr_num_nonzeros;
+} hypre_SellData;
+
+#define hypre_SellDataNumRows(sell)          ((sell) -> num_rows)
+#define hypre_SellDataNumChunks(sell)        ((sell) -> num_chunks)
+#define hypre_SellDataSigma(sell)            ((sell) -> sigma)
+#define hypre_SellDataChunkPtr(sell)         ((sell) -> chunk_ptr)
+#define hypre_SellDataChunkLen(sell)         ((sell) -> chunk_len)
+#define hypre_SellDataRows(sell)             ((sell) -> rows)
+#define hypre_SellDataJ(sell)                ((sell) -> j)
+#define hypre_SellDataData(sell)             ((sell) -> data)
+#define hypre_SellDataNnzPadded(sell)        ((sell) -> nnz_padded)
+#define hypre_SellDataCSRI(sell)             ((sell) -> csr_i)
+#define hypre_SellDataCSRJ(sell)             ((sell) -> csr_j)
+#define hypre_SellDataCSRData(sell)          ((sell) -> csr_data)
+#define hypre_SellDataCSRNumNonzeros(sell)   ((sell) -> csr_num_nonzeros)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -65,6 +113,10 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   HYPRE_Int             spmv_use_sell;   /* -1: use global setting, 0: CSR, 1: SELL-C-sigma */
+   hypre_SellData       *sell_data;       /* lazily built SELL-C-sigma shadow for host matvec */
+   hypre_float          *data_sp;         /* single precision values (mixed-precision AMG);
+                                             `data' is NULL when this is set */
 #if defined(HYPRE_USING_CUSPARSE)
    HYPRE_Int            *sorted_j;        /* some cusparse routines require sorted CSR */
    HYPRE_Complex        *sorted_data;
@@ -91,6 +143,9 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)            ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSpMVUseSell(matrix)          ((matrix) -> spmv_use_sell)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
+#define hypre_CSRMatrixDataSp(matrix)               ((matrix) -> data_sp)
 
 #if defined(HYPRE_USING_CUSPARSE)
 #define hypre_CSRMatrixSortedJ(matrix)              ((matrix) -> sorted_j)
@@ -349,6 +404,19 @@ HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memo
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows, HYPRE_Int new_num_cols, HYPRE_Int new_num_nonzeros );
 
+/* csr_matrix_sell.c */
+HYPRE_Int hypre_CSRMatrixSellDestroy( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellCreate( hypre_CSRMatrix *A, HYPRE_Int sigma );
+hypre_SellData *hypre_CSRMatrixSellSetup( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost( HYPRE_Complex alpha, hypre_SellData *sell, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSellHost( HYPRE_Complex alpha, hypre_SellData *sell, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixSetSpMVUseSell( hypre_CSRMatrix *A, HYPRE_Int use_sell );
+
+/* csr_matrix_sp.c */
+HYPRE_Int hypre_CSRMatrixConvertToSinglePrecision( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSpHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTSpHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
 HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
@@ -21,7 +21,8 @@ HYPRE_SStructLGMRESCreate( MPI_Comm             comm,
          hypre_SStructKrylovCreateVectorArray,
          hypre_SStructKrylovDestroyVector, hypre_SStructKrylovMatvecCreate,
          hypre_SStructKrylovMatvec, hypre_SStructKrylovMatvecDestroy,
-         hypre_SStructKrylovInnerProd, hypre_SStructKrylovCopyVector,
+         hypre_SStructKrylovInnerProd,
+         hypre_SStructKrylovMultiInnerProd, hypre_SStructKrylovCopyVector,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
@@ -80,6 +81,16 @@ HYPRE_SStructLGMRESSetKDim( HYPRE_SStructSolver solver,
    return( HYPRE_LGMRESSetKDim( (HYPRE_Solver) solver, k_dim ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructLGMRESSetCGS( HYPRE_SStructSolver solver,
+                           HYPRE_Int           cgs )
+{
+   return( HYPRE_LGMRESSetCGS( (HYPRE_Solver) solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
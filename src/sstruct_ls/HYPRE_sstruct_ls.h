@@ -789,6 +789,15 @@ HYPRE_Int
 HYPRE_SStructPCGSetTwoNorm(HYPRE_SStructSolver solver,
                            HYPRE_Int           two_norm);
 
+/**
+ * (Optional) Select the CG recurrence: 0 (default) is standard PCG, 1 is
+ * Chronopoulos-Gear single-reduction CG and 2 is Ghysels-Vanroose pipelined CG.
+ * See HYPRE_PCGSetVariant.
+ **/
+HYPRE_Int
+HYPRE_SStructPCGSetVariant(HYPRE_SStructSolver solver,
+                           HYPRE_Int           variant);
+
 HYPRE_Int
 HYPRE_SStructPCGSetRelChange(HYPRE_SStructSolver solver,
                              HYPRE_Int           rel_change);
@@ -905,6 +914,15 @@ HYPRE_Int
 HYPRE_SStructGMRESSetKDim(HYPRE_SStructSolver solver,
                           HYPRE_Int           k_dim);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant: 0 (default) is modified
+ * Gram-Schmidt, 1 is classical Gram-Schmidt and 2 is classical Gram-Schmidt
+ * with reorthogonalization.  See HYPRE_GMRESSetCGS.
+ **/
+HYPRE_Int
+HYPRE_SStructGMRESSetCGS(HYPRE_SStructSolver solver,
+                         HYPRE_Int           cgs);
+
 /*
  * RE-VISIT
  **/
@@ -1006,6 +1024,15 @@ HYPRE_Int
 HYPRE_SStructFlexGMRESSetKDim(HYPRE_SStructSolver solver,
                               HYPRE_Int           k_dim);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant: 0 (default) is modified
+ * Gram-Schmidt, 1 is classical Gram-Schmidt and 2 is classical Gram-Schmidt
+ * with reorthogonalization.  See HYPRE_GMRESSetCGS.
+ **/
+HYPRE_Int
+HYPRE_SStructFlexGMRESSetCGS(HYPRE_SStructSolver solver,
+                             HYPRE_Int           cgs);
+
 HYPRE_Int
 HYPRE_SStructFlexGMRESSetPrecond(HYPRE_SStructSolver          solver,
                                  HYPRE_PtrToSStructSolverFcn  precond,
@@ -1104,6 +1131,16 @@ HYPRE_SStructLGMRESSetMaxIter(HYPRE_SStructSolver solver,
 HYPRE_Int
 HYPRE_SStructLGMRESSetKDim(HYPRE_SStructSolver solver,
                            HYPRE_Int           k_dim);
+
+/**
+ * (Optional) Select the Gram-Schmidt variant: 0 (default) is modified
+ * Gram-Schmidt, 1 is classical Gram-Schmidt and 2 is classical Gram-Schmidt
+ * with reorthogonalization.  See HYPRE_GMRESSetCGS.
+ **/
+HYPRE_Int
+HYPRE_SStructLGMRESSetCGS(HYPRE_SStructSolver solver,
+                          HYPRE_Int           cgs);
+
 HYPRE_Int
 HYPRE_SStructLGMRESSetAugDim(HYPRE_SStructSolver solver,
                              HYPRE_Int           aug_dim);
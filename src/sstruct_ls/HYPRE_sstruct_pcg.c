@@ -20,7 +20,8 @@ HYPRE_SStructPCGCreate( MPI_Comm             comm,
          hypre_SStructKrylovCreateVector,
          hypre_SStructKrylovDestroyVector, hypre_SStructKrylovMatvecCreate,
          hypre_SStructKrylovMatvec, hypre_SStructKrylovMatvecDestroy,
-         hypre_SStructKrylovInnerProd, hypre_SStructKrylovCopyVector,
+         hypre_SStructKrylovInnerProd,
+         hypre_SStructKrylovMultiInnerProd, hypre_SStructKrylovCopyVector,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
@@ -108,6 +109,16 @@ HYPRE_SStructPCGSetTwoNorm( HYPRE_SStructSolver solver,
    return( HYPRE_PCGSetTwoNorm( (HYPRE_Solver) solver, two_norm ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPCGSetVariant( HYPRE_SStructSolver solver,
+                            HYPRE_Int           variant )
+{
+   return( HYPRE_PCGSetVariant( (HYPRE_Solver) solver, variant ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -215,6 +215,34 @@ hypre_SStructKrylovInnerProd( void *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * Starts the inner products <x[j],y[j]>, j < k, as one non-blocking global
+ * reduction into result.  The local buffer must stay untouched until the
+ * request completes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovMultiInnerProd( HYPRE_Int          k,
+                                   void             **x,
+                                   void             **y,
+                                   HYPRE_Real        *local,
+                                   HYPRE_Real        *result,
+                                   hypre_MPI_Request *request )
+{
+   HYPRE_Int j;
+
+   for (j = 0; j < k; j++)
+   {
+      hypre_SStructInnerProdLocal( (hypre_SStructVector *) x[j],
+                                   (hypre_SStructVector *) y[j], &local[j] );
+   }
+
+   hypre_MPI_Iallreduce(local, result, k, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                        hypre_SStructVectorComm((hypre_SStructVector *) x[0]), request);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
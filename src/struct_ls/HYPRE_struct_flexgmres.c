@@ -20,7 +20,8 @@ HYPRE_StructFlexGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovCreateVectorArray,
          hypre_StructKrylovDestroyVector, hypre_StructKrylovMatvecCreate,
          hypre_StructKrylovMatvec, hypre_StructKrylovMatvecDestroy,
-         hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
+         hypre_StructKrylovInnerProd,
+         hypre_StructKrylovMultiInnerProd, hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
@@ -104,6 +105,15 @@ HYPRE_StructFlexGMRESSetKDim( HYPRE_StructSolver solver,
 
 /*==========================================================================*/
 
+HYPRE_Int
+HYPRE_StructFlexGMRESSetCGS( HYPRE_StructSolver solver,
+                             HYPRE_Int          cgs )
+{
+   return( HYPRE_FlexGMRESSetCGS( (HYPRE_Solver) solver, cgs ) );
+}
+
+/*==========================================================================*/
+
 HYPRE_Int
 HYPRE_StructFlexGMRESSetPrecond( HYPRE_StructSolver         solver,
                                  HYPRE_PtrToStructSolverFcn precond,
@@ -20,7 +20,8 @@ HYPRE_StructLGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovCreateVectorArray,
          hypre_StructKrylovDestroyVector, hypre_StructKrylovMatvecCreate,
          hypre_StructKrylovMatvec, hypre_StructKrylovMatvecDestroy,
-         hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
+         hypre_StructKrylovInnerProd,
+         hypre_StructKrylovMultiInnerProd, hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
@@ -100,6 +101,15 @@ HYPRE_StructLGMRESSetKDim( HYPRE_StructSolver solver,
    return( HYPRE_LGMRESSetKDim( (HYPRE_Solver) solver, k_dim ) );
 }
 
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructLGMRESSetCGS( HYPRE_StructSolver solver,
+                          HYPRE_Int          cgs )
+{
+   return( HYPRE_LGMRESSetCGS( (HYPRE_Solver) solver, cgs ) );
+}
+
 
 
 /*==========================================================================*/
@@ -288,6 +288,38 @@ HYPRE_Int HYPRE_StructPFMGSetNumPostRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
                                  HYPRE_Int          skip_relax);
 
+/**
+ * (Optional) Use red/black split storage for red/black Gauss-Seidel
+ * relaxation (relax types 2 and 3).  At setup, the coefficients on each level
+ * are copied into separate arrays for the red and the black points, and at
+ * each relaxation call x is copied into the same layout, so that every half
+ * sweep is a unit-stride loop.  b is copied at pre-relaxation and reused for
+ * post-relaxation on the same level.  Results are unchanged.  This needs
+ * memory for a second copy of the matrix coefficients.  x stays in the
+ * regular layout between relaxation calls, since residuals, restriction and
+ * interpolation work on it, so each call pays for copying x in and out, which
+ * costs about as much as one sweep.  It pays off mostly with several sweeps
+ * per relaxation call.  Only variable-coefficient 3/5/7-pt stencils on host
+ * builds are affected; weighted Jacobi relaxation (relax types 0 and 1)
+ * already sweeps with unit stride and is not affected.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetRBSplitStorage(HYPRE_StructSolver solver,
+                                      HYPRE_Int          rb_split_storage);
+
+/**
+ * (Optional) Stop coarsening once a grid has at most {\tt redundant\_size}
+ * points (measured by its bounding box) and solve that grid directly.  The
+ * ranks that still own points gather the coarsest matrix, factor it
+ * redundantly, and each coarse solve becomes one gather plus local triangular
+ * solves instead of many relaxation sweeps, each with its own ghost exchange.
+ * Every rank that owns coarse points holds a dense copy of the factors, so
+ * sizes above 4096 are treated as 4096.  If the coarsest matrix is singular
+ * (e.g., periodic or pure Neumann problems), the usual coarsest grid
+ * relaxation is kept.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetRedundantSize(HYPRE_StructSolver solver,
+                                     HYPRE_Int          redundant_size);
+
 /*
  * RE-VISIT
  **/
@@ -417,6 +449,14 @@ HYPRE_Int HYPRE_StructSMGSetNumPreRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructSMGSetNumPostRelax(HYPRE_StructSolver solver,
                                    HYPRE_Int          num_post_relax);
 
+/**
+ * (Optional) Stop coarsening once a grid has at most {\tt redundant\_size}
+ * points and solve that grid directly on the ranks that still own points.
+ * See \Ref{HYPRE_StructPFMGSetRedundantSize}.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_StructSMGSetRedundantSize(HYPRE_StructSolver solver,
+                                    HYPRE_Int          redundant_size);
+
 /**
  * (Optional) Set the amount of logging to do.
  **/
@@ -554,6 +594,14 @@ HYPRE_Int HYPRE_StructPCGSetMaxIter(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPCGSetTwoNorm(HYPRE_StructSolver solver,
                               HYPRE_Int          two_norm);
 
+/**
+ * (Optional) Select the CG recurrence: 0 (default) is standard PCG, 1 is
+ * Chronopoulos-Gear single-reduction CG and 2 is Ghysels-Vanroose pipelined CG.
+ * See HYPRE_PCGSetVariant.
+ **/
+HYPRE_Int HYPRE_StructPCGSetVariant(HYPRE_StructSolver solver,
+                              HYPRE_Int          variant);
+
 HYPRE_Int HYPRE_StructPCGSetRelChange(HYPRE_StructSolver solver,
                                 HYPRE_Int          rel_change);
 
@@ -641,6 +689,14 @@ HYPRE_Int HYPRE_StructGMRESSetMaxIter(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructGMRESSetKDim(HYPRE_StructSolver solver,
                              HYPRE_Int          k_dim);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant: 0 (default) is modified
+ * Gram-Schmidt, 1 is classical Gram-Schmidt and 2 is classical Gram-Schmidt
+ * with reorthogonalization.  See HYPRE_GMRESSetCGS.
+ **/
+HYPRE_Int HYPRE_StructGMRESSetCGS(HYPRE_StructSolver solver,
+                                  HYPRE_Int          cgs);
+
 HYPRE_Int HYPRE_StructGMRESSetPrecond(HYPRE_StructSolver         solver,
                                 HYPRE_PtrToStructSolverFcn precond,
                                 HYPRE_PtrToStructSolverFcn precond_setup,
@@ -707,6 +763,14 @@ HYPRE_Int HYPRE_StructFlexGMRESSetMaxIter(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructFlexGMRESSetKDim(HYPRE_StructSolver solver,
                                  HYPRE_Int          k_dim);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant: 0 (default) is modified
+ * Gram-Schmidt, 1 is classical Gram-Schmidt and 2 is classical Gram-Schmidt
+ * with reorthogonalization.  See HYPRE_GMRESSetCGS.
+ **/
+HYPRE_Int HYPRE_StructFlexGMRESSetCGS(HYPRE_StructSolver solver,
+                                      HYPRE_Int          cgs);
+
 HYPRE_Int HYPRE_StructFlexGMRESSetPrecond(HYPRE_StructSolver         solver,
                                     HYPRE_PtrToStructSolverFcn precond,
                                     HYPRE_PtrToStructSolverFcn precond_setup,
@@ -777,6 +841,14 @@ HYPRE_Int HYPRE_StructLGMRESSetMaxIter(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructLGMRESSetKDim(HYPRE_StructSolver solver,
                               HYPRE_Int          k_dim);
 
+/**
+ * (Optional) Select the Gram-Schmidt variant: 0 (default) is modified
+ * Gram-Schmidt, 1 is classical Gram-Schmidt and 2 is classical Gram-Schmidt
+ * with reorthogonalization.  See HYPRE_GMRESSetCGS.
+ **/
+HYPRE_Int HYPRE_StructLGMRESSetCGS(HYPRE_StructSolver solver,
+                                   HYPRE_Int          cgs);
+
 HYPRE_Int HYPRE_StructLGMRESSetAugDim(HYPRE_StructSolver solver,
                                 HYPRE_Int          aug_dim);
 
@@ -25,7 +25,8 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovCreateVector,
          hypre_StructKrylovDestroyVector, hypre_StructKrylovMatvecCreate,
          hypre_StructKrylovMatvec, hypre_StructKrylovMatvecDestroy,
-         hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
+         hypre_StructKrylovInnerProd,
+         hypre_StructKrylovMultiInnerProd, hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
@@ -109,6 +110,15 @@ HYPRE_StructPCGSetTwoNorm( HYPRE_StructSolver solver,
 
 /*==========================================================================*/
 
+HYPRE_Int
+HYPRE_StructPCGSetVariant( HYPRE_StructSolver solver,
+                           HYPRE_Int          variant )
+{
+   return( HYPRE_PCGSetVariant( (HYPRE_Solver) solver, variant ) );
+}
+
+/*==========================================================================*/
+
 HYPRE_Int
 HYPRE_StructPCGSetRelChange( HYPRE_StructSolver solver,
                              HYPRE_Int          rel_change )
@@ -205,9 +215,10 @@ HYPRE_StructDiagScale( HYPRE_StructSolver solver,
    hypre_Index           stride;
    hypre_Index           loop_size;
 
-   HYPRE_Int             i;
+   HYPRE_Int             num_components = hypre_StructVectorNumComponents(x);
+   HYPRE_Int             i, c;
 
-   /* x = D^{-1} y */
+   /* x = D^{-1} y, for each component */
    hypre_SetIndex(stride, 1);
    boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
    hypre_ForBoxI(i, boxes)
@@ -220,23 +231,27 @@ HYPRE_StructDiagScale( HYPRE_StructSolver solver,
 
       hypre_SetIndex(index, 0);
       Ap = hypre_StructMatrixExtractPointerByIndex(A, i, index);
-      xp = hypre_StructVectorBoxData(x, i);
-      yp = hypre_StructVectorBoxData(y, i);
 
       start  = hypre_BoxIMin(box);
 
       hypre_BoxGetSize(box, loop_size);
 
-#define DEVICE_VAR is_device_ptr(xp,yp,Ap)
-      hypre_BoxLoop3Begin(hypre_StructVectorNDim(Hx), loop_size,
-                          A_data_box, start, stride, Ai,
-                          x_data_box, start, stride, xi,
-                          y_data_box, start, stride, yi);
+      for (c = 0; c < num_components; c++)
       {
-         xp[xi] = yp[yi] / Ap[Ai];
-      }
-      hypre_BoxLoop3End(Ai, xi, yi);
+         xp = hypre_StructVectorBoxDataComponent(x, i, c);
+         yp = hypre_StructVectorBoxDataComponent(y, i, c);
+
+#define DEVICE_VAR is_device_ptr(xp,yp,Ap)
+         hypre_BoxLoop3Begin(hypre_StructVectorNDim(Hx), loop_size,
+                             A_data_box, start, stride, Ai,
+                             x_data_box, start, stride, xi,
+                             y_data_box, start, stride, yi);
+         {
+            xp[xi] = yp[yi] / Ap[Ai];
+         }
+         hypre_BoxLoop3End(Ai, xi, yi);
 #undef DEVICE_VAR
+      }
    }
 
    return hypre_error_flag;
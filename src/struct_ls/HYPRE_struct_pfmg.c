@@ -250,6 +250,40 @@ HYPRE_StructPFMGGetSkipRelax( HYPRE_StructSolver solver,
    return( hypre_PFMGGetSkipRelax( (void *) solver, skip_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetRBSplitStorage( HYPRE_StructSolver solver,
+                                   HYPRE_Int          rb_split_storage )
+{
+   return( hypre_PFMGSetRBSplitStorage( (void *) solver, rb_split_storage) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetRBSplitStorage( HYPRE_StructSolver solver,
+                                   HYPRE_Int        * rb_split_storage )
+{
+   return( hypre_PFMGGetRBSplitStorage( (void *) solver, rb_split_storage) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetRedundantSize( HYPRE_StructSolver solver,
+                                  HYPRE_Int          redundant_size )
+{
+   return( hypre_PFMGSetRedundantSize( (void *) solver, redundant_size) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetRedundantSize( HYPRE_StructSolver solver,
+                                  HYPRE_Int        * redundant_size )
+{
+   return( hypre_PFMGGetRedundantSize( (void *) solver, redundant_size) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
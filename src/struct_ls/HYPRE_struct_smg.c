@@ -74,6 +74,23 @@ HYPRE_StructSMGGetMemoryUse( HYPRE_StructSolver solver,
    return( hypre_SMGGetMemoryUse( (void *) solver, memory_use ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructSMGSetRedundantSize( HYPRE_StructSolver solver,
+                                 HYPRE_Int          redundant_size )
+{
+   return( hypre_SMGSetRedundantSize( (void *) solver, redundant_size ) );
+}
+
+HYPRE_Int
+HYPRE_StructSMGGetRedundantSize( HYPRE_StructSolver solver,
+                                 HYPRE_Int        * redundant_size )
+{
+   return( hypre_SMGGetRedundantSize( (void *) solver, redundant_size ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
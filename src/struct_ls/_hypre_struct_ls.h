@@ -27,6 +27,10 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+
+/* Largest grid (by bounding box volume) solved by the redundant direct coarse
+ * solve.  Every rank that owns points holds dense factors of 8*size^2 bytes. */
+#define hypre_REDUNDANT_MAX_SIZE 4096
 /* coarsen.c */
 HYPRE_Int hypre_StructMapFineToCoarse ( hypre_Index findex , hypre_Index index , hypre_Index stride , hypre_Index cindex );
 HYPRE_Int hypre_StructMapCoarseToFine ( hypre_Index cindex , hypre_Index index , hypre_Index stride , hypre_Index findex );
@@ -97,6 +101,7 @@ HYPRE_Int HYPRE_StructFlexGMRESSetTol ( HYPRE_StructSolver solver , HYPRE_Real t
 HYPRE_Int HYPRE_StructFlexGMRESSetAbsoluteTol ( HYPRE_StructSolver solver , HYPRE_Real atol );
 HYPRE_Int HYPRE_StructFlexGMRESSetMaxIter ( HYPRE_StructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_StructFlexGMRESSetKDim ( HYPRE_StructSolver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_StructFlexGMRESSetCGS ( HYPRE_StructSolver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_StructFlexGMRESSetPrecond ( HYPRE_StructSolver solver , HYPRE_PtrToStructSolverFcn precond , HYPRE_PtrToStructSolverFcn precond_setup , HYPRE_StructSolver precond_solver );
 HYPRE_Int HYPRE_StructFlexGMRESSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
 HYPRE_Int HYPRE_StructFlexGMRESSetPrintLevel ( HYPRE_StructSolver solver , HYPRE_Int print_level );
@@ -113,6 +118,7 @@ HYPRE_Int HYPRE_StructGMRESSetTol ( HYPRE_StructSolver solver , HYPRE_Real tol )
 HYPRE_Int HYPRE_StructGMRESSetAbsoluteTol ( HYPRE_StructSolver solver , HYPRE_Real atol );
 HYPRE_Int HYPRE_StructGMRESSetMaxIter ( HYPRE_StructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_StructGMRESSetKDim ( HYPRE_StructSolver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_StructGMRESSetCGS ( HYPRE_StructSolver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_StructGMRESSetPrecond ( HYPRE_StructSolver solver , HYPRE_PtrToStructSolverFcn precond , HYPRE_PtrToStructSolverFcn precond_setup , HYPRE_StructSolver precond_solver );
 HYPRE_Int HYPRE_StructGMRESSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
 HYPRE_Int HYPRE_StructGMRESSetPrintLevel ( HYPRE_StructSolver solver , HYPRE_Int print_level );
@@ -172,6 +178,7 @@ HYPRE_Int HYPRE_StructLGMRESSetTol ( HYPRE_StructSolver solver , HYPRE_Real tol
 HYPRE_Int HYPRE_StructLGMRESSetAbsoluteTol ( HYPRE_StructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_StructLGMRESSetMaxIter ( HYPRE_StructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_StructLGMRESSetKDim ( HYPRE_StructSolver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_StructLGMRESSetCGS ( HYPRE_StructSolver solver , HYPRE_Int cgs );
 HYPRE_Int HYPRE_StructLGMRESSetAugDim ( HYPRE_StructSolver solver , HYPRE_Int aug_dim );
 HYPRE_Int HYPRE_StructLGMRESSetPrecond ( HYPRE_StructSolver solver , HYPRE_PtrToStructSolverFcn precond , HYPRE_PtrToStructSolverFcn precond_setup , HYPRE_StructSolver precond_solver );
 HYPRE_Int HYPRE_StructLGMRESSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
@@ -188,6 +195,7 @@ HYPRE_Int HYPRE_StructPCGSetTol ( HYPRE_StructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_StructPCGSetAbsoluteTol ( HYPRE_StructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_StructPCGSetMaxIter ( HYPRE_StructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_StructPCGSetTwoNorm ( HYPRE_StructSolver solver , HYPRE_Int two_norm );
+HYPRE_Int HYPRE_StructPCGSetVariant ( HYPRE_StructSolver solver , HYPRE_Int variant );
 HYPRE_Int HYPRE_StructPCGSetRelChange ( HYPRE_StructSolver solver , HYPRE_Int rel_change );
 HYPRE_Int HYPRE_StructPCGSetPrecond ( HYPRE_StructSolver solver , HYPRE_PtrToStructSolverFcn precond , HYPRE_PtrToStructSolverFcn precond_setup , HYPRE_StructSolver precond_solver );
 HYPRE_Int HYPRE_StructPCGSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
@@ -225,6 +233,10 @@ HYPRE_Int HYPRE_StructPFMGSetNumPostRelax ( HYPRE_StructSolver solver , HYPRE_In
 HYPRE_Int HYPRE_StructPFMGGetNumPostRelax ( HYPRE_StructSolver solver , HYPRE_Int *num_post_relax );
 HYPRE_Int HYPRE_StructPFMGSetSkipRelax ( HYPRE_StructSolver solver , HYPRE_Int skip_relax );
 HYPRE_Int HYPRE_StructPFMGGetSkipRelax ( HYPRE_StructSolver solver , HYPRE_Int *skip_relax );
+HYPRE_Int HYPRE_StructPFMGSetRBSplitStorage ( HYPRE_StructSolver solver , HYPRE_Int rb_split_storage );
+HYPRE_Int HYPRE_StructPFMGGetRBSplitStorage ( HYPRE_StructSolver solver , HYPRE_Int *rb_split_storage );
+HYPRE_Int HYPRE_StructPFMGSetRedundantSize ( HYPRE_StructSolver solver , HYPRE_Int redundant_size );
+HYPRE_Int HYPRE_StructPFMGGetRedundantSize ( HYPRE_StructSolver solver , HYPRE_Int *redundant_size );
 HYPRE_Int HYPRE_StructPFMGSetDxyz ( HYPRE_StructSolver solver , HYPRE_Real *dxyz );
 HYPRE_Int HYPRE_StructPFMGSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
 HYPRE_Int HYPRE_StructPFMGGetLogging ( HYPRE_StructSolver solver , HYPRE_Int *logging );
@@ -241,6 +253,8 @@ HYPRE_Int HYPRE_StructSMGSetup ( HYPRE_StructSolver solver , HYPRE_StructMatrix
 HYPRE_Int HYPRE_StructSMGSolve ( HYPRE_StructSolver solver , HYPRE_StructMatrix A , HYPRE_StructVector b , HYPRE_StructVector x );
 HYPRE_Int HYPRE_StructSMGSetMemoryUse ( HYPRE_StructSolver solver , HYPRE_Int memory_use );
 HYPRE_Int HYPRE_StructSMGGetMemoryUse ( HYPRE_StructSolver solver , HYPRE_Int *memory_use );
+HYPRE_Int HYPRE_StructSMGSetRedundantSize ( HYPRE_StructSolver solver , HYPRE_Int redundant_size );
+HYPRE_Int HYPRE_StructSMGGetRedundantSize ( HYPRE_StructSolver solver , HYPRE_Int *redundant_size );
 HYPRE_Int HYPRE_StructSMGSetTol ( HYPRE_StructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_StructSMGGetTol ( HYPRE_StructSolver solver , HYPRE_Real *tol );
 HYPRE_Int HYPRE_StructSMGSetMaxIter ( HYPRE_StructSolver solver , HYPRE_Int max_iter );
@@ -298,6 +312,15 @@ HYPRE_Int hypre_JacobiGetNumIterations ( void *jacobi_vdata , HYPRE_Int *num_ite
 HYPRE_Int hypre_JacobiSetTempVec ( void *jacobi_vdata , hypre_StructVector *t );
 HYPRE_Int hypre_JacobiGetFinalRelativeResidualNorm ( void *jacobi_vdata , HYPRE_Real *norm );
 
+/* line_solve.c */
+HYPRE_Int hypre_LineSolveIsApplicable ( MPI_Comm comm , hypre_StructMatrix *A , HYPRE_Int cdir , hypre_Index base_stride , HYPRE_Int *applicable );
+void *hypre_LineSolveCreate ( MPI_Comm comm );
+HYPRE_Int hypre_LineSolveSetup ( void *line_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_LineSolve ( void *line_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_LineSolveSetBase ( void *line_vdata , hypre_Index base_index , hypre_Index base_stride );
+HYPRE_Int hypre_LineSolveSetCDir ( void *line_vdata , HYPRE_Int cdir );
+HYPRE_Int hypre_LineSolveDestroy ( void *line_vdata );
+
 /* pcg_struct.c */
 void *hypre_StructKrylovCAlloc ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
 HYPRE_Int hypre_StructKrylovFree ( void *ptr );
@@ -308,6 +331,7 @@ void *hypre_StructKrylovMatvecCreate ( void *A , void *x );
 HYPRE_Int hypre_StructKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_StructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_StructKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_StructKrylovMultiInnerProd ( HYPRE_Int k , void **x , void **y , HYPRE_Real *local , HYPRE_Real *result , hypre_MPI_Request *request );
 HYPRE_Int hypre_StructKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha , void *x );
@@ -371,6 +395,10 @@ HYPRE_Int hypre_PFMGSetNumPostRelax ( void *pfmg_vdata , HYPRE_Int num_post_rela
 HYPRE_Int hypre_PFMGGetNumPostRelax ( void *pfmg_vdata , HYPRE_Int *num_post_relax );
 HYPRE_Int hypre_PFMGSetSkipRelax ( void *pfmg_vdata , HYPRE_Int skip_relax );
 HYPRE_Int hypre_PFMGGetSkipRelax ( void *pfmg_vdata , HYPRE_Int *skip_relax );
+HYPRE_Int hypre_PFMGSetRBSplitStorage ( void *pfmg_vdata , HYPRE_Int rb_split_storage );
+HYPRE_Int hypre_PFMGGetRBSplitStorage ( void *pfmg_vdata , HYPRE_Int *rb_split_storage );
+HYPRE_Int hypre_PFMGSetRedundantSize ( void *pfmg_vdata , HYPRE_Int redundant_size );
+HYPRE_Int hypre_PFMGGetRedundantSize ( void *pfmg_vdata , HYPRE_Int *redundant_size );
 HYPRE_Int hypre_PFMGSetDxyz ( void *pfmg_vdata , HYPRE_Real *dxyz );
 HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata , HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata , HYPRE_Int *logging );
@@ -391,6 +419,8 @@ HYPRE_Int hypre_PFMGRelaxSetPreRelax ( void *pfmg_relax_vdata );
 HYPRE_Int hypre_PFMGRelaxSetPostRelax ( void *pfmg_relax_vdata );
 HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata , HYPRE_Real tol );
 HYPRE_Int hypre_PFMGRelaxSetMaxIter ( void *pfmg_relax_vdata , HYPRE_Int max_iter );
+HYPRE_Int hypre_PFMGRelaxSetRBSplitStorage ( void *pfmg_relax_vdata , HYPRE_Int rb_split_storage );
+HYPRE_Int hypre_PFMGRelaxSetSameRHS ( void *pfmg_relax_vdata , HYPRE_Int same_rhs );
 HYPRE_Int hypre_PFMGRelaxSetZeroGuess ( void *pfmg_relax_vdata , HYPRE_Int zero_guess );
 HYPRE_Int hypre_PFMGRelaxSetTempVec ( void *pfmg_relax_vdata , hypre_StructVector *t );
 
@@ -445,6 +475,7 @@ HYPRE_Int hypre_PointRelaxSetup ( void *relax_vdata , hypre_StructMatrix *A , hy
 HYPRE_Int hypre_PointRelax ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
 HYPRE_Int hypre_PointRelax_core0 ( void *relax_vdata , hypre_StructMatrix *A , HYPRE_Int constant_coefficient , hypre_Box *compute_box , HYPRE_Real *bp , HYPRE_Real *xp , HYPRE_Real *tp , HYPRE_Int boxarray_id , hypre_Box *A_data_box , hypre_Box *b_data_box , hypre_Box *x_data_box , hypre_Box *t_data_box , hypre_IndexRef stride );
 HYPRE_Int hypre_PointRelax_core12 ( void *relax_vdata , hypre_StructMatrix *A , HYPRE_Int constant_coefficient , hypre_Box *compute_box , HYPRE_Real *bp , HYPRE_Real *xp , HYPRE_Real *tp , HYPRE_Int boxarray_id , hypre_Box *A_data_box , hypre_Box *b_data_box , hypre_Box *x_data_box , hypre_Box *t_data_box , hypre_IndexRef stride );
+HYPRE_Int hypre_PointRelax_multi ( void *relax_vdata , hypre_StructMatrix *A , hypre_Box *compute_box , hypre_StructVector *b , hypre_StructVector *x , hypre_StructVector *t , HYPRE_Int boxarray_id , hypre_IndexRef stride );
 HYPRE_Int hypre_PointRelaxSetTol ( void *relax_vdata , HYPRE_Real tol );
 HYPRE_Int hypre_PointRelaxGetTol ( void *relax_vdata , HYPRE_Real *tol );
 HYPRE_Int hypre_PointRelaxSetMaxIter ( void *relax_vdata , HYPRE_Int max_iter );
@@ -472,9 +503,18 @@ HYPRE_Int hypre_RedBlackGS ( void *relax_vdata , hypre_StructMatrix *A , hypre_S
 HYPRE_Int hypre_RedBlackGSSetTol ( void *relax_vdata , HYPRE_Real tol );
 HYPRE_Int hypre_RedBlackGSSetMaxIter ( void *relax_vdata , HYPRE_Int max_iter );
 HYPRE_Int hypre_RedBlackGSSetZeroGuess ( void *relax_vdata , HYPRE_Int zero_guess );
+HYPRE_Int hypre_RedBlackGSSetSplitStorage ( void *relax_vdata , HYPRE_Int split_storage );
+HYPRE_Int hypre_RedBlackGSSetSameRHS ( void *relax_vdata , HYPRE_Int same_rhs );
 HYPRE_Int hypre_RedBlackGSSetStartRed ( void *relax_vdata );
 HYPRE_Int hypre_RedBlackGSSetStartBlack ( void *relax_vdata );
 
+/* redundant_solve.c */
+void *hypre_RedundantSolveCreate ( MPI_Comm comm );
+HYPRE_Int hypre_RedundantSolveDestroy ( void *redundant_vdata );
+HYPRE_Int hypre_RedundantSolveSetup ( void *redundant_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_RedundantSolve ( void *redundant_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_RedundantSolveGetFactored ( void *redundant_vdata , HYPRE_Int *factored );
+
 /* semi.c */
 HYPRE_Int hypre_StructInterpAssemble ( hypre_StructMatrix *A , hypre_StructMatrix *P , HYPRE_Int P_stored_as_transpose , HYPRE_Int cdir , hypre_Index index , hypre_Index stride );
 
@@ -516,6 +556,8 @@ void *hypre_SMGCreate ( MPI_Comm comm );
 HYPRE_Int hypre_SMGDestroy ( void *smg_vdata );
 HYPRE_Int hypre_SMGSetMemoryUse ( void *smg_vdata , HYPRE_Int memory_use );
 HYPRE_Int hypre_SMGGetMemoryUse ( void *smg_vdata , HYPRE_Int *memory_use );
+HYPRE_Int hypre_SMGSetRedundantSize ( void *smg_vdata , HYPRE_Int redundant_size );
+HYPRE_Int hypre_SMGGetRedundantSize ( void *smg_vdata , HYPRE_Int *redundant_size );
 HYPRE_Int hypre_SMGSetTol ( void *smg_vdata , HYPRE_Real tol );
 HYPRE_Int hypre_SMGGetTol ( void *smg_vdata , HYPRE_Real *tol );
 HYPRE_Int hypre_SMGSetMaxIter ( void *smg_vdata , HYPRE_Int max_iter );
@@ -459,7 +459,8 @@ hypre_HybridSolveUsePCG( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovCreateVector,
          hypre_StructKrylovDestroyVector, hypre_StructKrylovMatvecCreate,
          hypre_StructKrylovMatvec, hypre_StructKrylovMatvecDestroy,
-         hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
+         hypre_StructKrylovInnerProd,
+         hypre_StructKrylovMultiInnerProd, hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
@@ -498,7 +499,8 @@ hypre_HybridSolveUseGMRES( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovCreateVectorArray,
          hypre_StructKrylovDestroyVector, hypre_StructKrylovMatvecCreate,
          hypre_StructKrylovMatvec, hypre_StructKrylovMatvecDestroy,
-         hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
+         hypre_StructKrylovInnerProd,
+         hypre_StructKrylovMultiInnerProd, hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
@@ -573,6 +575,15 @@ hypre_HybridSolve( void               *hybrid_vdata,
    HYPRE_Real         res_norm;
    HYPRE_Int          myid;
 
+   /* the default preconditioner (SMG) handles one component only */
+   if (krylov_default &&
+       (hypre_StructVectorNumComponents(b) > 1 || hypre_StructVectorNumComponents(x) > 1))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Multi-component vectors require a preconditioner set with HYPRE_StructHybridSetPrecond\n");
+      return hypre_error_flag;
+   }
+
    if (solver_type == 1)
    {
       /*--------------------------------------------------------------------
@@ -0,0 +1,613 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ * Batched tridiagonal line solver
+ *
+ * Solves the 3-point systems along direction cdir for every line of a grid at
+ * once with the Thomas algorithm.  Lines are processed in batches of
+ * LINE_BATCH_SIZE, and the factorization and sweep data are stored
+ * interleaved (point k of every line in the batch is contiguous), so each
+ * step of the recurrence is a unit-stride loop across independent lines.
+ *
+ * This is an alternative to hypre_CyclicReduction for the case where no line
+ * crosses a box boundary, i.e., every line is local to one box of one process.
+ * Use hypre_LineSolveIsApplicable to check this before calling Setup.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+/* the batched sweeps are only built for host loops */
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_LINE_SOLVE_BATCHED
+#endif
+
+/* number of lines solved together in one pass of the recurrence */
+#define LINE_BATCH_SIZE 32
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolveData data structure
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm              comm;
+
+   HYPRE_Int             cdir;         /* line direction */
+   hypre_Index           base_index;
+   hypre_Index           base_stride;
+
+   hypre_BoxArray       *base_points;
+   HYPRE_Int            *num_lines;    /* number of lines in each box */
+   HYPRE_Real          **factors;      /* LU factors of the lines in each box */
+
+   HYPRE_Real           *work;
+   HYPRE_Int            *iwork;
+   HYPRE_Int             work_size;    /* per-thread size of work */
+
+   HYPRE_Int             time_index;
+   HYPRE_BigInt          solve_flops;
+} hypre_LineSolveData;
+
+/*--------------------------------------------------------------------------
+ * Compute the starting index of line 'line' in box 'box', where the lines run
+ * along cdir and are enumerated lexicographically over the other directions.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_LineSolveLineStart( hypre_Box      *box,
+                          hypre_Index     loop_size,
+                          hypre_IndexRef  stride,
+                          HYPRE_Int       cdir,
+                          HYPRE_Int       line,
+                          hypre_Index     index )
+{
+   HYPRE_Int  d;
+
+   hypre_CopyIndex(hypre_BoxIMin(box), index);
+   for (d = 0; d < hypre_BoxNDim(box); d++)
+   {
+      if (d != cdir)
+      {
+         hypre_IndexD(index, d) += (line % hypre_IndexD(loop_size, d)) * hypre_IndexD(stride, d);
+         line /= hypre_IndexD(loop_size, d);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if a local box of grid has a neighbor box (on any process) across
+ * one of its cdir faces, or if the grid is periodic in cdir, i.e., if some
+ * lines along cdir are not local to one box.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineSolveGridIsSplit( hypre_StructGrid *grid,
+                            HYPRE_Int         cdir )
+{
+   hypre_BoxManager    *boxman = hypre_StructGridBoxMan(grid);
+   hypre_BoxArray      *boxes  = hypre_StructGridBoxes(grid);
+
+   hypre_Box           *box;
+   hypre_BoxManEntry  **entries;
+   hypre_Index          ilower, iupper;
+   HYPRE_Int            nentries, i, side;
+
+   if (hypre_IndexD(hypre_StructGridPeriodic(grid), cdir) != 0)
+   {
+      return 1;
+   }
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxVolume(box) == 0)
+      {
+         continue;
+      }
+
+      /* look for a box on either side of this one along cdir */
+      for (side = -1; side < 2; side += 2)
+      {
+         hypre_CopyIndex(hypre_BoxIMin(box), ilower);
+         hypre_CopyIndex(hypre_BoxIMax(box), iupper);
+         if (side < 0)
+         {
+            hypre_IndexD(ilower, cdir) -= 1;
+            hypre_IndexD(iupper, cdir)  = hypre_IndexD(ilower, cdir);
+         }
+         else
+         {
+            hypre_IndexD(iupper, cdir) += 1;
+            hypre_IndexD(ilower, cdir)  = hypre_IndexD(iupper, cdir);
+         }
+
+         hypre_BoxManIntersect(boxman, ilower, iupper, &entries, &nentries);
+         hypre_TFree(entries, HYPRE_MEMORY_HOST);
+         if (nentries > 0)
+         {
+            return 1;
+         }
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolveIsApplicable
+ *
+ * Returns applicable = 1 if the batched solver can replace cyclic reduction
+ * for the lines of A along cdir: A must be a variable-coefficient 3-point
+ * operator along cdir, the lines must not be strided, and no box on any
+ * process may have a neighbor across its cdir faces.  The grid must also not
+ * be periodic in any direction, where the batched solve does not reproduce
+ * the cyclic reduction results, and every box must hold at least two lines,
+ * since a single line gains nothing from batching.  This is a collective call
+ * over comm.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineSolveIsApplicable( MPI_Comm             comm,
+                             hypre_StructMatrix  *A,
+                             HYPRE_Int            cdir,
+                             hypre_Index          base_stride,
+                             HYPRE_Int           *applicable )
+{
+   HYPRE_Int           local_applicable = 0;
+
+#ifdef HYPRE_LINE_SOLVE_BATCHED
+   hypre_StructGrid    *grid          = hypre_StructMatrixGrid(A);
+   hypre_StructStencil *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index         *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int            stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int            ndim          = hypre_StructMatrixNDim(A);
+   hypre_BoxArray      *boxes         = hypre_StructGridBoxes(grid);
+
+   hypre_Box           *box;
+   hypre_Index          loop_size;
+   HYPRE_Int            s, d, i, nl;
+
+   local_applicable = 1;
+
+   if (hypre_StructMatrixConstantCoefficient(A) != 0 ||
+       hypre_IndexD(base_stride, cdir) != 1)
+   {
+      local_applicable = 0;
+   }
+
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_IndexD(hypre_StructGridPeriodic(grid), d) != 0)
+      {
+         local_applicable = 0;
+      }
+   }
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxVolume(box) == 0)
+      {
+         continue;
+      }
+
+      hypre_BoxGetStrideSize(box, base_stride, loop_size);
+      nl = 1;
+      for (d = 0; d < ndim; d++)
+      {
+         if (d != cdir)
+         {
+            nl *= hypre_IndexD(loop_size, d);
+         }
+      }
+      if (nl < 2)
+      {
+         local_applicable = 0;
+      }
+   }
+
+   for (s = 0; (s < stencil_size) && local_applicable; s++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if ( (d == cdir && hypre_abs(hypre_IndexD(stencil_shape[s], d)) > 1) ||
+              (d != cdir && hypre_IndexD(stencil_shape[s], d) != 0) )
+         {
+            local_applicable = 0;
+         }
+      }
+   }
+
+   if (local_applicable && hypre_LineSolveGridIsSplit(grid, cdir))
+   {
+      local_applicable = 0;
+   }
+#endif
+
+   hypre_MPI_Allreduce(&local_applicable, applicable, 1, HYPRE_MPI_INT,
+                       hypre_MPI_MIN, comm);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolveCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_LineSolveCreate( MPI_Comm  comm )
+{
+   hypre_LineSolveData *line_data;
+
+   line_data = hypre_CTAlloc(hypre_LineSolveData,  1, HYPRE_MEMORY_HOST);
+
+   (line_data -> comm)       = comm;
+   (line_data -> cdir)       = 0;
+   (line_data -> time_index) = hypre_InitializeTiming("LineSolve");
+
+   /* set defaults */
+   hypre_SetIndex3((line_data -> base_index), 0, 0, 0);
+   hypre_SetIndex3((line_data -> base_stride), 1, 1, 1);
+
+   return (void *) line_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolveSetup
+ *
+ * Factors the tridiagonal matrix of every line.  For each batch of lines the
+ * factor data is stored as three interleaved arrays of length n*w (n points
+ * per line, w lines): the sub-diagonal coefficient, the modified
+ * super-diagonal coefficient, and the inverse pivot.  An error is returned if
+ * the grid is partitioned along cdir, or if a line has a zero pivot.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineSolveSetup( void               *line_vdata,
+                      hypre_StructMatrix *A,
+                      hypre_StructVector *b,
+                      hypre_StructVector *x          )
+{
+   hypre_LineSolveData  *line_data   = (hypre_LineSolveData *) line_vdata;
+
+   HYPRE_Int             cdir        = (line_data -> cdir);
+   hypre_IndexRef        base_index  = (line_data -> base_index);
+   hypre_IndexRef        base_stride = (line_data -> base_stride);
+
+   hypre_StructGrid     *grid;
+   hypre_BoxArray       *base_points;
+   HYPRE_Int            *num_lines;
+   HYPRE_Real          **factors;
+   HYPRE_Int             max_length = 0;
+
+   hypre_Box            *compute_box;
+   hypre_Box            *A_dbox;
+   HYPRE_Real           *Ap, *Awp, *Aep;
+   HYPRE_Real           *lo, *cp, *inv;
+   HYPRE_Int            *Astart;
+
+   hypre_Index           index;
+   hypre_Index           loop_size;
+   HYPRE_Int             Astride;
+   HYPRE_Int             n, nl, w, line0, jj, k, Ai, i;
+   HYPRE_Real            pivot;
+   HYPRE_Int             zero_pivot = 0;
+
+   HYPRE_BigInt          num_points = 0;
+
+#ifndef HYPRE_LINE_SOLVE_BATCHED
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Batched line solve is not available in device builds\n");
+   return hypre_error_flag;
+#endif
+
+   grid = hypre_StructMatrixGrid(A);
+
+   /* every line must be local to one box, see hypre_LineSolveIsApplicable */
+   if (hypre_LineSolveGridIsSplit(grid, cdir))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Line solve requires a grid that is not partitioned along the line direction\n");
+      return hypre_error_flag;
+   }
+
+   base_points = hypre_BoxArrayDuplicate(hypre_StructGridBoxes(grid));
+   hypre_ProjectBoxArray(base_points, base_index, base_stride);
+
+   num_lines = hypre_CTAlloc(HYPRE_Int, hypre_BoxArraySize(base_points), HYPRE_MEMORY_HOST);
+   factors   = hypre_CTAlloc(HYPRE_Real *, hypre_BoxArraySize(base_points), HYPRE_MEMORY_HOST);
+   Astart    = hypre_TAlloc(HYPRE_Int, LINE_BATCH_SIZE, HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxI(i, base_points)
+   {
+      compute_box = hypre_BoxArrayBox(base_points, i);
+      if (hypre_BoxVolume(compute_box) == 0)
+      {
+         continue;
+      }
+
+      hypre_BoxGetStrideSize(compute_box, base_stride, loop_size);
+      n  = hypre_IndexD(loop_size, cdir);
+      nl = 1;
+      for (k = 0; k < hypre_BoxNDim(compute_box); k++)
+      {
+         if (k != cdir)
+         {
+            nl *= hypre_IndexD(loop_size, k);
+         }
+      }
+      num_lines[i] = nl;
+      max_length   = hypre_max(max_length, n);
+      num_points  += (HYPRE_BigInt) n * nl;
+
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+
+      hypre_SetIndex3(index, 0, 0, 0);
+      Ap = hypre_StructMatrixExtractPointerByIndex(A, i, index);
+      hypre_IndexD(index, cdir) = -1;
+      Awp = hypre_StructMatrixExtractPointerByIndex(A, i, index);
+      hypre_IndexD(index, cdir) = 1;
+      Aep = hypre_StructMatrixExtractPointerByIndex(A, i, index);
+      Astride = hypre_BoxOffsetDistance(A_dbox, index);
+
+      factors[i] = hypre_TAlloc(HYPRE_Real, 3 * n * nl, HYPRE_MEMORY_HOST);
+
+      for (line0 = 0; line0 < nl; line0 += LINE_BATCH_SIZE)
+      {
+         w   = hypre_min(LINE_BATCH_SIZE, nl - line0);
+         lo  = factors[i] + 3 * n * line0;
+         cp  = lo + n * w;
+         inv = cp + n * w;
+
+         for (jj = 0; jj < w; jj++)
+         {
+            hypre_LineSolveLineStart(compute_box, loop_size, base_stride, cdir,
+                                     line0 + jj, index);
+            Astart[jj] = hypre_BoxIndexRank(A_dbox, index);
+         }
+
+         for (k = 0; k < n; k++)
+         {
+            for (jj = 0; jj < w; jj++)
+            {
+               Ai = Astart[jj] + k * Astride;
+
+               /* couplings to points outside the line are dropped */
+               lo[jj] = (k > 0 && Awp) ? Awp[Ai] : 0.0;
+               pivot  = Ap[Ai];
+               if (k > 0)
+               {
+                  pivot -= lo[jj] * cp[jj - w];
+               }
+
+               /* a zero pivot (singular line) is reported at the end */
+               if (pivot != 0.0)
+               {
+                  inv[jj] = 1.0 / pivot;
+               }
+               else
+               {
+                  inv[jj] = 0.0;
+                  zero_pivot = 1;
+               }
+               cp[jj]  = (k < n - 1 && Aep) ? Aep[Ai] * inv[jj] : 0.0;
+            }
+            lo  += w;
+            cp  += w;
+            inv += w;
+         }
+      }
+   }
+
+   hypre_TFree(Astart, HYPRE_MEMORY_HOST);
+
+   (line_data -> base_points) = base_points;
+   (line_data -> num_lines)   = num_lines;
+   (line_data -> factors)     = factors;
+   (line_data -> work_size)   = max_length * LINE_BATCH_SIZE;
+   (line_data -> work)  = hypre_TAlloc(HYPRE_Real, max_length * LINE_BATCH_SIZE * hypre_NumThreads(),
+                                       HYPRE_MEMORY_HOST);
+   (line_data -> iwork) = hypre_TAlloc(HYPRE_Int, 2 * LINE_BATCH_SIZE * hypre_NumThreads(),
+                                       HYPRE_MEMORY_HOST);
+
+   /* 3 flops in the forward sweep and 2 in the backward sweep per point */
+   hypre_MPI_Allreduce(&num_points, &(line_data -> solve_flops), 1, HYPRE_MPI_BIG_INT,
+                       hypre_MPI_SUM, (line_data -> comm));
+   (line_data -> solve_flops) *= 5;
+
+   if (zero_pivot)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Zero pivot in line solve factorization\n");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolve
+ *
+ * Solves A x = b on the base points.  Only x values on the base points are
+ * written, as in hypre_CyclicReduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineSolve( void               *line_vdata,
+                 hypre_StructMatrix *A,
+                 hypre_StructVector *b,
+                 hypre_StructVector *x          )
+{
+   hypre_LineSolveData  *line_data   = (hypre_LineSolveData *) line_vdata;
+
+   HYPRE_Int             cdir        = (line_data -> cdir);
+   hypre_IndexRef        base_stride = (line_data -> base_stride);
+   hypre_BoxArray       *base_points = (line_data -> base_points);
+   HYPRE_Int            *num_lines   = (line_data -> num_lines);
+   HYPRE_Real          **factors     = (line_data -> factors);
+   HYPRE_Real           *work        = (line_data -> work);
+   HYPRE_Int            *iwork       = (line_data -> iwork);
+   HYPRE_Int             work_size   = (line_data -> work_size);
+
+   hypre_Box            *compute_box;
+   hypre_Box            *b_dbox;
+   hypre_Box            *x_dbox;
+   HYPRE_Real           *bp, *xp;
+
+   hypre_Index           index;
+   hypre_Index           loop_size;
+   HYPRE_Int             bstride, xstride;
+   HYPRE_Int             n, nl, line0, i;
+
+   hypre_BeginTiming(line_data -> time_index);
+
+   hypre_ForBoxI(i, base_points)
+   {
+      nl = num_lines[i];
+      if (nl == 0)
+      {
+         continue;
+      }
+
+      compute_box = hypre_BoxArrayBox(base_points, i);
+      hypre_BoxGetStrideSize(compute_box, base_stride, loop_size);
+      n = hypre_IndexD(loop_size, cdir);
+
+      b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      bp = hypre_StructVectorBoxData(b, i);
+      xp = hypre_StructVectorBoxData(x, i);
+
+      hypre_SetIndex3(index, 0, 0, 0);
+      hypre_IndexD(index, cdir) = 1;
+      bstride = hypre_BoxOffsetDistance(b_dbox, index);
+      xstride = hypre_BoxOffsetDistance(x_dbox, index);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(line0) HYPRE_SMP_SCHEDULE
+#endif
+      for (line0 = 0; line0 < nl; line0 += LINE_BATCH_SIZE)
+      {
+         HYPRE_Real  *y      = work + work_size * hypre_GetThreadNum();
+         HYPRE_Int   *bstart = iwork + 2 * LINE_BATCH_SIZE * hypre_GetThreadNum();
+         HYPRE_Int   *xstart = bstart + LINE_BATCH_SIZE;
+         HYPRE_Int    w      = hypre_min(LINE_BATCH_SIZE, nl - line0);
+         HYPRE_Real  *lo     = factors[i] + 3 * n * line0;
+         HYPRE_Real  *cp     = lo + n * w;
+         HYPRE_Real  *inv    = cp + n * w;
+         HYPRE_Real  *yk;
+         hypre_Index  start;
+         HYPRE_Int    jj, k;
+
+         for (jj = 0; jj < w; jj++)
+         {
+            hypre_LineSolveLineStart(compute_box, loop_size, base_stride, cdir,
+                                     line0 + jj, start);
+            bstart[jj] = hypre_BoxIndexRank(b_dbox, start);
+            xstart[jj] = hypre_BoxIndexRank(x_dbox, start);
+         }
+
+         /* forward sweep: y_k = (b_k - lo_k y_{k-1}) / pivot_k */
+         for (jj = 0; jj < w; jj++)
+         {
+            y[jj] = bp[bstart[jj]] * inv[jj];
+         }
+         for (k = 1; k < n; k++)
+         {
+            yk = y + k * w;
+            for (jj = 0; jj < w; jj++)
+            {
+               yk[jj] = (bp[bstart[jj] + k * bstride] - lo[k * w + jj] * yk[jj - w]) *
+                        inv[k * w + jj];
+            }
+         }
+
+         /* backward sweep: x_k = y_k - cp_k x_{k+1} */
+         yk = y + (n - 1) * w;
+         for (jj = 0; jj < w; jj++)
+         {
+            xp[xstart[jj] + (n - 1) * xstride] = yk[jj];
+         }
+         for (k = n - 2; k >= 0; k--)
+         {
+            yk = y + k * w;
+            for (jj = 0; jj < w; jj++)
+            {
+               yk[jj] -= cp[k * w + jj] * yk[jj + w];
+               xp[xstart[jj] + k * xstride] = yk[jj];
+            }
+         }
+      }
+   }
+
+   hypre_IncFLOPCount(line_data -> solve_flops);
+   hypre_EndTiming(line_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolveSetBase
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineSolveSetBase( void        *line_vdata,
+                        hypre_Index  base_index,
+                        hypre_Index  base_stride )
+{
+   hypre_LineSolveData *line_data = (hypre_LineSolveData *)line_vdata;
+
+   hypre_CopyIndex(base_index,  (line_data -> base_index));
+   hypre_CopyIndex(base_stride, (line_data -> base_stride));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolveSetCDir
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineSolveSetCDir( void       *line_vdata,
+                        HYPRE_Int   cdir )
+{
+   hypre_LineSolveData *line_data = (hypre_LineSolveData *)line_vdata;
+
+   (line_data -> cdir) = cdir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolveDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineSolveDestroy( void *line_vdata )
+{
+   hypre_LineSolveData *line_data = (hypre_LineSolveData *)line_vdata;
+   HYPRE_Int            i;
+
+   if (line_data)
+   {
+      if (line_data -> base_points)
+      {
+         hypre_ForBoxI(i, (line_data -> base_points))
+         {
+            hypre_TFree(line_data -> factors[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_BoxArrayDestroy(line_data -> base_points);
+      }
+      hypre_TFree(line_data -> factors, HYPRE_MEMORY_HOST);
+      hypre_TFree(line_data -> num_lines, HYPRE_MEMORY_HOST);
+      hypre_TFree(line_data -> work, HYPRE_MEMORY_HOST);
+      hypre_TFree(line_data -> iwork, HYPRE_MEMORY_HOST);
+
+      hypre_FinalizeTiming(line_data -> time_index);
+      hypre_TFree(line_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
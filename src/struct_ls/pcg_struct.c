@@ -42,6 +42,8 @@ hypre_StructKrylovCreateVector( void *vvector )
    new_vector = hypre_StructVectorCreate( hypre_StructVectorComm(vector),
                                           hypre_StructVectorGrid(vector) );
    hypre_StructVectorSetNumGhost(new_vector, num_ghost);
+   hypre_StructVectorSetNumComponents(new_vector,
+                                      hypre_StructVectorNumComponents(vector));
    hypre_StructVectorInitialize(new_vector);
    hypre_StructVectorAssemble(new_vector);
 
@@ -66,6 +68,8 @@ hypre_StructKrylovCreateVectorArray(HYPRE_Int n, void *vvector )
                                hypre_StructVectorGrid(vector),
                                (HYPRE_StructVector *) &new_vector[i] );
       hypre_StructVectorSetNumGhost(new_vector[i], num_ghost);
+      hypre_StructVectorSetNumComponents(new_vector[i],
+                                         hypre_StructVectorNumComponents(vector));
       HYPRE_StructVectorInitialize((HYPRE_StructVector) new_vector[i]);
       HYPRE_StructVectorAssemble((HYPRE_StructVector) new_vector[i]);
    }
@@ -138,6 +142,53 @@ hypre_StructKrylovInnerProd( void *x,
                                    (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * Starts the inner products <x[j],y[j]>, j < k, as one non-blocking global
+ * reduction into result.  The local buffer must stay untouched until the
+ * request completes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovMultiInnerProd( HYPRE_Int          k,
+                                  void             **x,
+                                  void             **y,
+                                  HYPRE_Real        *local,
+                                  HYPRE_Real        *result,
+                                  hypre_MPI_Request *request )
+{
+   hypre_StructVector *xj, *yj;
+   HYPRE_Real         *components;
+   HYPRE_Int           j, c, num_components;
+
+   for (j = 0; j < k; j++)
+   {
+      xj = (hypre_StructVector *) x[j];
+      yj = (hypre_StructVector *) y[j];
+      num_components = hypre_StructVectorNumComponents(yj);
+      if (num_components > 1)
+      {
+         components = hypre_TAlloc(HYPRE_Real, num_components, HYPRE_MEMORY_HOST);
+         hypre_StructInnerProdLocal(xj, yj, components);
+         local[j] = 0.0;
+         for (c = 0; c < num_components; c++)
+         {
+            local[j] += components[c];
+         }
+         hypre_TFree(components, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         hypre_StructInnerProdLocal(xj, yj, &local[j]);
+      }
+      hypre_IncFLOPCount(2*hypre_StructVectorGlobalSize(xj));
+   }
+
+   hypre_MPI_Iallreduce(local, result, k, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                        hypre_StructVectorComm((hypre_StructVector *) x[0]), request);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -37,6 +37,8 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> num_pre_relax)    = 1;
    (pfmg_data -> num_post_relax)   = 1;
    (pfmg_data -> skip_relax)       = 1;
+   (pfmg_data -> rb_split_storage) = 0;
+   (pfmg_data -> redundant_size)   = 0;
    (pfmg_data -> logging)          = 0;
    (pfmg_data -> print_level)      = 0;
 
@@ -83,6 +85,7 @@ hypre_PFMGDestroy( void *pfmg_vdata )
             hypre_SemiRestrictDestroy(pfmg_data -> restrict_data_l[l]);
             hypre_SemiInterpDestroy(pfmg_data -> interp_data_l[l]);
          }
+         hypre_RedundantSolveDestroy(pfmg_data -> coarse_solve_data);
          hypre_TFree(pfmg_data -> relax_data_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> matvec_data_l, HYPRE_MEMORY_HOST);
          hypre_TFree(pfmg_data -> restrict_data_l, HYPRE_MEMORY_HOST);
@@ -404,6 +407,56 @@ hypre_PFMGGetSkipRelax( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetRBSplitStorage( void *pfmg_vdata,
+                             HYPRE_Int  rb_split_storage )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> rb_split_storage) = rb_split_storage;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetRBSplitStorage( void *pfmg_vdata,
+                             HYPRE_Int *rb_split_storage )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *rb_split_storage = (pfmg_data -> rb_split_storage);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetRedundantSize( void *pfmg_vdata,
+                            HYPRE_Int  redundant_size )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> redundant_size) = redundant_size;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetRedundantSize( void *pfmg_vdata,
+                            HYPRE_Int *redundant_size )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *redundant_size = (pfmg_data -> redundant_size);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
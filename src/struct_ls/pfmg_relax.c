@@ -258,6 +258,34 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetRBSplitStorage( void      *pfmg_relax_vdata,
+                                  HYPRE_Int  rb_split_storage )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_RedBlackGSSetSplitStorage((pfmg_relax_data -> rb_relax_data), rb_split_storage);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetSameRHS( void      *pfmg_relax_vdata,
+                           HYPRE_Int  same_rhs )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_RedBlackGSSetSameRHS((pfmg_relax_data -> rb_relax_data), same_rhs);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
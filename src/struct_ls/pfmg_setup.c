@@ -73,7 +73,11 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             usr_jacobi_weight= (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
+   HYPRE_Int             rb_split_storage = (pfmg_data -> rb_split_storage);
+   HYPRE_Int             redundant_size = hypre_min((pfmg_data -> redundant_size),
+                                                    hypre_REDUNDANT_MAX_SIZE);
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
+   HYPRE_Int             num_components = hypre_StructVectorNumComponents(b);
    HYPRE_Int             rap_type;
 
    HYPRE_Int             max_iter;
@@ -115,6 +119,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    void                **matvec_data_l;
    void                **restrict_data_l;
    void                **interp_data_l;
+   void                 *coarse_solve_data = NULL;
 
    hypre_StructGrid     *grid;
    HYPRE_Int             ndim;
@@ -142,12 +147,28 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    char                  filename[255];
 #endif
 
+   /* several right-hand sides are only supported with Jacobi relaxation */
+   if (hypre_StructVectorNumComponents(x) != num_components)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "b and x must have the same number of components\n");
+      return hypre_error_flag;
+   }
+   if (num_components > 1 && relax_type > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Multi-component vectors require Jacobi relaxation (relax type 0 or 1)\n");
+      return hypre_error_flag;
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
 
+   HYPRE_ANNOTATE_REGION_BEGIN("coarsening");
+
    grid  = hypre_StructMatrixGrid(A);
    ndim  = hypre_StructGridNDim(grid);
 
@@ -289,6 +310,13 @@ hypre_PFMGSetup( void               *pfmg_vdata,
          {
             cdir = -1;
          }
+
+         /* don't coarsen if the grid is small enough to solve redundantly */
+         if (l > 0 && redundant_size > 0 &&
+             hypre_BoxVolume(cbox) <= redundant_size)
+         {
+            cdir = -1;
+         }
       }
 
       /* stop coarsening */
@@ -378,10 +406,14 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    (pfmg_data -> grid_l)       = grid_l;
    (pfmg_data -> P_grid_l)     = P_grid_l;
 
+   HYPRE_ANNOTATE_REGION_END("coarsening");
+
    /*-----------------------------------------------------
     * Set up matrix and vector structures
     *-----------------------------------------------------*/
 
+   HYPRE_ANNOTATE_REGION_BEGIN("allocation");
+
    /*-----------------------------------------------------
     * Modify the rap_type if red-black Gauss-Seidel is
     * used. Red-black gs is used only in the non-Galerkin
@@ -408,6 +440,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
    tx_l[0] = hypre_StructVectorCreate(comm, grid_l[0]);
    hypre_StructVectorSetNumGhost(tx_l[0], x_num_ghost);
+   hypre_StructVectorSetNumComponents(tx_l[0], num_components);
    hypre_StructVectorInitializeShell(tx_l[0]);
 
    hypre_StructVectorSetDataSize(tx_l[0], &data_size, &data_size_const);
@@ -446,16 +479,19 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
       b_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(b_l[l+1], b_num_ghost);
+      hypre_StructVectorSetNumComponents(b_l[l+1], num_components);
       hypre_StructVectorInitializeShell(b_l[l+1]);
       hypre_StructVectorSetDataSize(b_l[l+1], &data_size, &data_size_const);
 
       x_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(x_l[l+1], x_num_ghost);
+      hypre_StructVectorSetNumComponents(x_l[l+1], num_components);
       hypre_StructVectorInitializeShell(x_l[l+1]);
       hypre_StructVectorSetDataSize(x_l[l+1], &data_size, &data_size_const);
 
       tx_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(tx_l[l+1], x_num_ghost);
+      hypre_StructVectorSetNumComponents(tx_l[l+1], num_components);
       hypre_StructVectorInitializeShell(tx_l[l+1]);
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
       if (l+1 == num_level_GPU)
@@ -577,6 +613,8 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    (pfmg_data -> r_l)  = r_l;
    (pfmg_data -> e_l)  = e_l;
 
+   HYPRE_ANNOTATE_REGION_END("allocation");
+
    /*-----------------------------------------------------
     * Set up multigrid operators and call setup routines
     *-----------------------------------------------------*/
@@ -594,6 +632,8 @@ hypre_PFMGSetup( void               *pfmg_vdata,
          hypre_SetDeviceOff();
       }
 #endif
+      HYPRE_ANNOTATE_MGLEVEL_BEGIN(l);
+
       cdir = cdir_l[l];
 
       hypre_PFMGSetCIndex(cdir, cindex);
@@ -601,7 +641,9 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGSetStride(cdir, stride);
 
       /* set up interpolation operator */
+      HYPRE_ANNOTATE_REGION_BEGIN("interpolation");
       hypre_PFMGSetupInterpOp(A_l[l], cdir, findex, stride, P_l[l], rap_type);
+      HYPRE_ANNOTATE_REGION_END("interpolation");
 
       /* set up the restriction operator */
 #if 0
@@ -612,10 +654,13 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 #endif
 
       /* set up the coarse grid operator */
+      HYPRE_ANNOTATE_REGION_BEGIN("RAP");
       hypre_PFMGSetupRAPOp(RT_l[l], A_l[l], P_l[l],
                            cdir, cindex, stride, rap_type, A_l[l+1]);
+      HYPRE_ANNOTATE_REGION_END("RAP");
 
       /* set up the interpolation routine */
+      HYPRE_ANNOTATE_REGION_BEGIN("transfer setup");
       interp_data_l[l] = hypre_SemiInterpCreate();
       hypre_SemiInterpSetup(interp_data_l[l], P_l[l], 0, x_l[l+1], e_l[l],
                             cindex, findex, stride);
@@ -624,6 +669,9 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       restrict_data_l[l] = hypre_SemiRestrictCreate();
       hypre_SemiRestrictSetup(restrict_data_l[l], RT_l[l], 1, r_l[l], b_l[l+1],
                               cindex, findex, stride);
+      HYPRE_ANNOTATE_REGION_END("transfer setup");
+
+      HYPRE_ANNOTATE_MGLEVEL_END(l);
    }
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -655,6 +703,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    }
 #endif
    /* set up fine grid relaxation */
+   HYPRE_ANNOTATE_REGION_BEGIN("relax setup");
    relax_data_l[0] = hypre_PFMGRelaxCreate(comm);
    hypre_PFMGRelaxSetTol(relax_data_l[0], 0.0);
    if (usr_jacobi_weight)
@@ -666,8 +715,10 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGRelaxSetJacobiWeight(relax_data_l[0], relax_weights[0]);
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   hypre_PFMGRelaxSetRBSplitStorage(relax_data_l[0], rb_split_storage);
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
+   HYPRE_ANNOTATE_REGION_END("relax setup");
    if (num_levels > 1)
    {
       for (l = 1; l < num_levels; l++)
@@ -686,6 +737,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
                hypre_PFMGRelaxSetJacobiWeight(relax_data_l[l], relax_weights[l]);
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
+            hypre_PFMGRelaxSetRBSplitStorage(relax_data_l[l], rb_split_storage);
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
          }
       }
@@ -709,6 +761,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       }
 
       /* call relax setup */
+      HYPRE_ANNOTATE_REGION_BEGIN("relax setup");
       for (l = 1; l < num_levels; l++)
       {
          if (active_l[l])
@@ -716,18 +769,49 @@ hypre_PFMGSetup( void               *pfmg_vdata,
             hypre_PFMGRelaxSetup(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
          }
       }
+
+      HYPRE_ANNOTATE_REGION_END("relax setup");
+
+      /* set up the redundant coarsest grid solve */
+      HYPRE_ANNOTATE_REGION_BEGIN("coarse solve setup");
+      l = num_levels - 1;
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      if (hypre_StructGridDataLocation(grid_l[l]) != HYPRE_MEMORY_HOST)
+      {
+         redundant_size = 0;
+      }
+#endif
+      if (redundant_size > 0 &&
+          hypre_BoxVolume(hypre_StructGridBoundingBox(grid_l[l])) <= redundant_size)
+      {
+         HYPRE_Int factored;
+
+         coarse_solve_data = hypre_RedundantSolveCreate(comm);
+         hypre_RedundantSolveSetup(coarse_solve_data, A_l[l], b_l[l], x_l[l]);
+         hypre_RedundantSolveGetFactored(coarse_solve_data, &factored);
+         if (!factored)
+         {
+            /* singular coarse problem, keep relaxing */
+            hypre_RedundantSolveDestroy(coarse_solve_data);
+            coarse_solve_data = NULL;
+         }
+      }
+      HYPRE_ANNOTATE_REGION_END("coarse solve setup");
    }
    hypre_TFree(relax_weights, HYPRE_MEMORY_HOST);
 
+   HYPRE_ANNOTATE_REGION_BEGIN("matvec setup");
    for (l = 0; l < num_levels; l++)
    {
       /* set up the residual routine */
       matvec_data_l[l] = hypre_StructMatvecCreate();
       hypre_StructMatvecSetup(matvec_data_l[l], A_l[l], x_l[l]);
    }
+   HYPRE_ANNOTATE_REGION_END("matvec setup");
 
    (pfmg_data -> active_l)        = active_l;
    (pfmg_data -> relax_data_l)    = relax_data_l;
+   (pfmg_data -> coarse_solve_data) = coarse_solve_data;
    (pfmg_data -> matvec_data_l)   = matvec_data_l;
    (pfmg_data -> restrict_data_l) = restrict_data_l;
    (pfmg_data -> interp_data_l)   = interp_data_l;
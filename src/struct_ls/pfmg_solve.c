@@ -50,6 +50,7 @@ hypre_PFMGSolve( void               *pfmg_vdata,
    hypre_StructVector  **r_l             = (pfmg_data -> r_l);
    hypre_StructVector  **e_l             = (pfmg_data -> e_l);
    void                **relax_data_l    = (pfmg_data -> relax_data_l);
+   void                 *coarse_solve_data = (pfmg_data -> coarse_solve_data);
    void                **matvec_data_l   = (pfmg_data -> matvec_data_l);
    void                **restrict_data_l = (pfmg_data -> restrict_data_l);
    void                **interp_data_l   = (pfmg_data -> interp_data_l);
@@ -60,8 +61,10 @@ hypre_PFMGSolve( void               *pfmg_vdata,
 
    HYPRE_Real            b_dot_b = 0, r_dot_r, eps = 0;
    HYPRE_Real            e_dot_e = 0.0, x_dot_x = 1.0;
+   HYPRE_Real           *b_dots = NULL, *r_dots = NULL;
 
-   HYPRE_Int             i, l;
+   HYPRE_Int             num_components = hypre_StructVectorNumComponents(b);
+   HYPRE_Int             i, l, c;
    HYPRE_Int             constant_coefficient;
 
 #if DEBUG
@@ -71,6 +74,20 @@ hypre_PFMGSolve( void               *pfmg_vdata,
    /*-----------------------------------------------------
     * Initialize some things and deal with special cases
     *-----------------------------------------------------*/
+   if ((pfmg_data -> tx_l) == NULL)
+   {
+      /* the setup failed or was not called */
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "PFMG setup has not been completed\n");
+      return hypre_error_flag;
+   }
+   if (hypre_StructVectorNumComponents(x) != num_components ||
+       hypre_StructVectorNumComponents((pfmg_data -> tx_l)[0]) != num_components)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Number of vector components does not match the PFMG setup\n");
+      return hypre_error_flag;
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_BeginTiming(pfmg_data -> time_index);
 
@@ -107,6 +124,14 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       b_dot_b = hypre_StructInnerProd(b_l[0], b_l[0]);
       eps = tol*tol;
 
+      /* with several right-hand sides, test the worst one */
+      if (num_components > 1)
+      {
+         b_dots = hypre_TAlloc(HYPRE_Real, num_components, HYPRE_MEMORY_HOST);
+         r_dots = hypre_TAlloc(HYPRE_Real, num_components, HYPRE_MEMORY_HOST);
+         hypre_StructInnerProdComponents(b_l[0], b_l[0], b_dots);
+      }
+
       /* if rhs is zero, return a zero solution */
       if (b_dot_b == 0.0)
       {
@@ -117,6 +142,8 @@ hypre_PFMGSolve( void               *pfmg_vdata,
             rel_norms[0] = 0.0;
          }
 
+         hypre_TFree(b_dots, HYPRE_MEMORY_HOST);
+         hypre_TFree(r_dots, HYPRE_MEMORY_HOST);
          hypre_EndTiming(pfmg_data -> time_index);
          HYPRE_ANNOTATE_FUNC_END;
 
@@ -144,20 +171,43 @@ hypre_PFMGSolve( void               *pfmg_vdata,
 
       /* fine grid pre-relaxation */
       hypre_PFMGRelaxSetPreRelax(relax_data_l[0]);
+      hypre_PFMGRelaxSetSameRHS(relax_data_l[0], 0);
       hypre_PFMGRelaxSetMaxIter(relax_data_l[0], num_pre_relax);
       hypre_PFMGRelaxSetZeroGuess(relax_data_l[0], zero_guess);
+      HYPRE_ANNOTATE_REGION_BEGIN("relax");
       hypre_PFMGRelax(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
+      HYPRE_ANNOTATE_REGION_END("relax");
       zero_guess = 0;
 
       /* compute fine grid residual (b - Ax) */
+      HYPRE_ANNOTATE_REGION_BEGIN("residual");
       hypre_StructCopy(b_l[0], r_l[0]);
       hypre_StructMatvecCompute(matvec_data_l[0],
                                 -1.0, A_l[0], x_l[0], 1.0, r_l[0]);
+      HYPRE_ANNOTATE_REGION_END("residual");
 
       /* convergence check */
       if (tol > 0.0)
       {
-         r_dot_r = hypre_StructInnerProd(r_l[0], r_l[0]);
+         if (num_components > 1)
+         {
+            /* components with a zero right-hand side are not tested */
+            hypre_StructInnerProdComponents(r_l[0], r_l[0], r_dots);
+            r_dot_r = 0.0;
+            b_dot_b = 1.0;
+            for (c = 0; c < num_components; c++)
+            {
+               if (b_dots[c] > 0 && r_dots[c]*b_dot_b >= r_dot_r*b_dots[c])
+               {
+                  r_dot_r = r_dots[c];
+                  b_dot_b = b_dots[c];
+               }
+            }
+         }
+         else
+         {
+            r_dot_r = hypre_StructInnerProd(r_l[0], r_l[0]);
+         }
 
          if (logging > 0)
          {
@@ -186,7 +236,9 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       if (num_levels > 1)
       {
          /* restrict fine grid residual */
+         HYPRE_ANNOTATE_REGION_BEGIN("restrict");
          hypre_SemiRestrict(restrict_data_l[0], RT_l[0], r_l[0], b_l[1]);
+         HYPRE_ANNOTATE_REGION_END("restrict");
 #if DEBUG
          hypre_sprintf(filename, "zout_xdown.%02d", 0);
          hypre_StructVectorPrint(filename, x_l[0], 0);
@@ -216,14 +268,19 @@ hypre_PFMGSolve( void               *pfmg_vdata,
             {
                /* pre-relaxation */
                hypre_PFMGRelaxSetPreRelax(relax_data_l[l]);
+               hypre_PFMGRelaxSetSameRHS(relax_data_l[l], 0);
                hypre_PFMGRelaxSetMaxIter(relax_data_l[l], num_pre_relax);
                hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 1);
+               HYPRE_ANNOTATE_REGION_BEGIN("relax");
                hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
+               HYPRE_ANNOTATE_REGION_END("relax");
 
                /* compute residual (b - Ax) */
+               HYPRE_ANNOTATE_REGION_BEGIN("residual");
                hypre_StructCopy(b_l[l], r_l[l]);
                hypre_StructMatvecCompute(matvec_data_l[l],
                                          -1.0, A_l[l], x_l[l], 1.0, r_l[l]);
+               HYPRE_ANNOTATE_REGION_END("residual");
             }
             else
             {
@@ -233,7 +290,9 @@ hypre_PFMGSolve( void               *pfmg_vdata,
             }
 
             /* restrict residual */
+            HYPRE_ANNOTATE_REGION_BEGIN("restrict");
             hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l+1]);
+            HYPRE_ANNOTATE_REGION_END("restrict");
 #if DEBUG
             hypre_printf("Level %d: b_l = %.30e\n",l+1, hypre_StructInnerProd(b_l[l+1], b_l[l+1]));
             hypre_sprintf(filename, "zout_xdown.%02d", l);
@@ -252,10 +311,18 @@ hypre_PFMGSolve( void               *pfmg_vdata,
           *--------------------------------------------------*/
          HYPRE_ANNOTATE_MGLEVEL_BEGIN(num_levels - 1);
 
-         if (active_l[l])
+         if (coarse_solve_data)
+         {
+            HYPRE_ANNOTATE_REGION_BEGIN("coarse solve");
+            hypre_RedundantSolve(coarse_solve_data, A_l[l], b_l[l], x_l[l]);
+            HYPRE_ANNOTATE_REGION_END("coarse solve");
+         }
+         else if (active_l[l])
          {
             hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 1);
+            HYPRE_ANNOTATE_REGION_BEGIN("relax");
             hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
+            HYPRE_ANNOTATE_REGION_END("relax");
          }
          else
          {
@@ -284,8 +351,10 @@ hypre_PFMGSolve( void               *pfmg_vdata,
                hypre_StructVectorClearAllValues(e_l[l]);
             }
             /* interpolate error and correct (x = x + Pe_c) */
+            HYPRE_ANNOTATE_REGION_BEGIN("interpolate");
             hypre_SemiInterp(interp_data_l[l], P_l[l], x_l[l+1], e_l[l]);
             hypre_StructAxpy(1.0, e_l[l], x_l[l]);
+            HYPRE_ANNOTATE_REGION_END("interpolate");
             HYPRE_ANNOTATE_MGLEVEL_END(l + 1);
 #if DEBUG
             hypre_sprintf(filename, "zout_eup.%02d", l);
@@ -300,9 +369,12 @@ hypre_PFMGSolve( void               *pfmg_vdata,
             {
                /* post-relaxation */
                hypre_PFMGRelaxSetPostRelax(relax_data_l[l]);
+               hypre_PFMGRelaxSetSameRHS(relax_data_l[l], 1);
                hypre_PFMGRelaxSetMaxIter(relax_data_l[l], num_post_relax);
                hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 0);
+               HYPRE_ANNOTATE_REGION_BEGIN("relax");
                hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
+               HYPRE_ANNOTATE_REGION_END("relax");
             }
          }
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -316,8 +388,10 @@ hypre_PFMGSolve( void               *pfmg_vdata,
             hypre_StructVectorClearAllValues(e_l[0]);
          }
          /* interpolate error and correct on fine grid (x = x + Pe_c) */
+         HYPRE_ANNOTATE_REGION_BEGIN("interpolate");
          hypre_SemiInterp(interp_data_l[0], P_l[0], x_l[1], e_l[0]);
          hypre_StructAxpy(1.0, e_l[0], x_l[0]);
+         HYPRE_ANNOTATE_REGION_END("interpolate");
          HYPRE_ANNOTATE_MGLEVEL_END(1);
 #if DEBUG
          hypre_printf("Level 0: x_l = %.15e\n", hypre_StructInnerProd(x_l[0], x_l[0]));
@@ -345,14 +419,19 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       }
 
       hypre_PFMGRelaxSetPostRelax(relax_data_l[0]);
+      hypre_PFMGRelaxSetSameRHS(relax_data_l[0], 1);
       hypre_PFMGRelaxSetMaxIter(relax_data_l[0], num_post_relax);
       hypre_PFMGRelaxSetZeroGuess(relax_data_l[0], 0);
+      HYPRE_ANNOTATE_REGION_BEGIN("relax");
       hypre_PFMGRelax(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
+      HYPRE_ANNOTATE_REGION_END("relax");
       (pfmg_data -> num_iterations) = (i + 1);
 
       HYPRE_ANNOTATE_MGLEVEL_END(0);
    }
 
+   hypre_TFree(b_dots, HYPRE_MEMORY_HOST);
+   hypre_TFree(r_dots, HYPRE_MEMORY_HOST);
    hypre_EndTiming(pfmg_data -> time_index);
    HYPRE_ANNOTATE_FUNC_END;
 
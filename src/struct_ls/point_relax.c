@@ -14,6 +14,14 @@
 #endif
 #define MAX_DEPTH 7
 
+/* multi-component sweeps are only built for host loops */
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_POINTRELAX_MULTI_COMPONENT
+#endif
+
+/* number of vector components processed per pass of hypre_PointRelax_multi */
+#define MAX_COMPONENTS 8
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -184,6 +192,7 @@ hypre_PointRelaxSetup( void               *relax_vdata,
       t = hypre_StructVectorCreate(hypre_StructVectorComm(b),
                                    hypre_StructVectorGrid(b));
       hypre_StructVectorSetNumGhost(t, hypre_StructVectorNumGhost(b));
+      hypre_StructVectorSetNumComponents(t, hypre_StructVectorNumComponents(b));
       hypre_StructVectorInitialize(t);
       hypre_StructVectorAssemble(t);
       (relax_data -> t) = t;
@@ -267,7 +276,8 @@ hypre_PointRelaxSetup( void               *relax_vdata,
 
       hypre_CopyIndex(stride, hypre_ComputeInfoStride(compute_info));
 
-      hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
+      hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x),
+                             hypre_StructVectorNumComponents(x),
                              grid, &compute_pkgs[p]);
 
       hypre_BoxArrayArrayDestroy(orig_indt_boxes);
@@ -352,8 +362,9 @@ hypre_PointRelax( void               *relax_vdata,
    hypre_Index            loop_size;
 
    HYPRE_Int              constant_coefficient;
+   HYPRE_Int              num_components = hypre_StructVectorNumComponents(x);
 
-   HYPRE_Int              iter, p, compute_i, i, j;
+   HYPRE_Int              iter, p, compute_i, i, j, c;
    HYPRE_Int              pointset;
 
    HYPRE_Real             bsumsq, rsumsq;
@@ -373,6 +384,16 @@ hypre_PointRelax( void               *relax_vdata,
 
    (relax_data -> num_iterations) = 0;
 
+   if (hypre_StructVectorNumComponents(b) != num_components ||
+       hypre_StructVectorNumComponents(t) != num_components ||
+       hypre_ComputePkgNumValues(compute_pkgs[0]) != num_components)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Number of vector components does not match the relaxation setup\n");
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
    /* if max_iter is zero, return */
    if (max_iter == 0)
    {
@@ -445,8 +466,6 @@ hypre_PointRelax( void               *relax_vdata,
                hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
 
             Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
-            bp = hypre_StructVectorBoxData(b, i);
-            xp = hypre_StructVectorBoxData(x, i);
 
             hypre_ForBoxI(j, compute_box_a)
             {
@@ -455,35 +474,41 @@ hypre_PointRelax( void               *relax_vdata,
                start  = hypre_BoxIMin(compute_box);
                hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
-               /* all matrix coefficients are constant */
-               if ( constant_coefficient==1 )
+               for (c = 0; c < num_components; c++)
                {
-                  Ai = hypre_CCBoxIndexRank( A_data_box, start );
-                  AAp0 = 1/Ap[Ai];
-#define DEVICE_VAR is_device_ptr(xp,bp)
-                  hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
-                                      b_data_box, start, stride, bi,
-                                      x_data_box, start, stride, xi);
+                  bp = hypre_StructVectorBoxDataComponent(b, i, c);
+                  xp = hypre_StructVectorBoxDataComponent(x, i, c);
+
+                  /* all matrix coefficients are constant */
+                  if ( constant_coefficient==1 )
                   {
-                     xp[xi] = bp[bi] * AAp0;
-                  }
-                  hypre_BoxLoop2End(bi, xi);
+                     Ai = hypre_CCBoxIndexRank( A_data_box, start );
+                     AAp0 = 1/Ap[Ai];
+#define DEVICE_VAR is_device_ptr(xp,bp)
+                     hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                                         b_data_box, start, stride, bi,
+                                         x_data_box, start, stride, xi);
+                     {
+                        xp[xi] = bp[bi] * AAp0;
+                     }
+                     hypre_BoxLoop2End(bi, xi);
 #undef DEVICE_VAR
-               }
-               /* constant_coefficent 0 (variable) or 2 (variable diagonal
-                  only) are the same for the diagonal */
-               else
-               {
-#define DEVICE_VAR is_device_ptr(xp,bp,Ap)
-                  hypre_BoxLoop3Begin(hypre_StructVectorNDim(x), loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      b_data_box, start, stride, bi,
-                                      x_data_box, start, stride, xi);
-                  {
-                     xp[xi] = bp[bi] / Ap[Ai];
                   }
-                  hypre_BoxLoop3End(Ai, bi, xi);
+                  /* constant_coefficent 0 (variable) or 2 (variable diagonal
+                     only) are the same for the diagonal */
+                  else
+                  {
+#define DEVICE_VAR is_device_ptr(xp,bp,Ap)
+                     hypre_BoxLoop3Begin(hypre_StructVectorNDim(x), loop_size,
+                                         A_data_box, start, stride, Ai,
+                                         b_data_box, start, stride, bi,
+                                         x_data_box, start, stride, xi);
+                     {
+                        xp[xi] = bp[bi] / Ap[Ai];
+                     }
+                     hypre_BoxLoop3End(Ai, bi, xi);
 #undef DEVICE_VAR
+                  }
                }
             }
          }
@@ -566,6 +591,14 @@ hypre_PointRelax( void               *relax_vdata,
             {
                compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
+               /* all components at once, including the diagonal scaling */
+               if (num_components > 1)
+               {
+                  hypre_PointRelax_multi(
+                     relax_vdata, A, compute_box, b, x, t, i, stride);
+                  continue;
+               }
+
                if ( constant_coefficient==1 || constant_coefficient==2 )
                {
                   hypre_PointRelax_core12(
@@ -906,6 +939,138 @@ hypre_PointRelax_core0( void               *relax_vdata,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_PointRelax_multi
+ *
+ * Computes t = D^{-1} (b - (A - D) x) on a compute box for vectors with
+ * several components, for any constant_coefficient type.  The components are
+ * processed MAX_COMPONENTS at a time so that each matrix coefficient is read
+ * once per group of components.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelax_multi( void               *relax_vdata,
+                        hypre_StructMatrix *A,
+                        hypre_Box          *compute_box,
+                        hypre_StructVector *b,
+                        hypre_StructVector *x,
+                        hypre_StructVector *t,
+                        HYPRE_Int           boxarray_id,
+                        hypre_IndexRef      stride )
+{
+#ifdef HYPRE_POINTRELAX_MULTI_COMPONENT
+   hypre_PointRelaxData  *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   HYPRE_Int              diag_rank = (relax_data -> diag_rank);
+   HYPRE_Int              constant_coefficient;
+   HYPRE_Int              num_components = hypre_StructVectorNumComponents(x);
+
+   hypre_StructStencil   *stencil;
+   hypre_Index           *stencil_shape;
+   HYPRE_Int              stencil_size;
+
+   hypre_Box             *A_data_box;
+   hypre_Box             *b_data_box;
+   hypre_Box             *x_data_box;
+   hypre_Box             *t_data_box;
+   HYPRE_Int              bvol, xvol, tvol;
+
+   HYPRE_Real           **Ap;
+   HYPRE_Real            *AAp;
+   HYPRE_Int             *Avar;
+   HYPRE_Int             *xoff;
+   HYPRE_Real            *bp, *xp, *tp;
+
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   HYPRE_Int              si, c0, nc, Ai_CC;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+
+   A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), boxarray_id);
+   b_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), boxarray_id);
+   x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), boxarray_id);
+   t_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), boxarray_id);
+   bvol = hypre_BoxVolume(b_data_box);
+   xvol = hypre_BoxVolume(x_data_box);
+   tvol = hypre_BoxVolume(t_data_box);
+
+   start  = hypre_BoxIMin(compute_box);
+   hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+   Ap   = hypre_TAlloc(HYPRE_Real *, stencil_size, HYPRE_MEMORY_HOST);
+   AAp  = hypre_CTAlloc(HYPRE_Real, stencil_size, HYPRE_MEMORY_HOST);
+   Avar = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+
+   Ai_CC = hypre_CCBoxIndexRank(A_data_box, start);
+   for (si = 0; si < stencil_size; si++)
+   {
+      Ap[si]   = hypre_StructMatrixBoxData(A, boxarray_id, si);
+      xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      Avar[si] = (constant_coefficient == 0 ||
+                  (constant_coefficient == 2 && si == diag_rank));
+      if (!Avar[si])
+      {
+         AAp[si] = Ap[si][Ai_CC];
+      }
+   }
+
+   for (c0 = 0; c0 < num_components; c0 += MAX_COMPONENTS)
+   {
+      nc = hypre_min(MAX_COMPONENTS, num_components - c0);
+      bp = hypre_StructVectorBoxDataComponent(b, boxarray_id, c0);
+      xp = hypre_StructVectorBoxDataComponent(x, boxarray_id, c0);
+      tp = hypre_StructVectorBoxDataComponent(t, boxarray_id, c0);
+
+      hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                          A_data_box, start, stride, Ai,
+                          b_data_box, start, stride, bi,
+                          x_data_box, start, stride, xi,
+                          t_data_box, start, stride, ti);
+      {
+         HYPRE_Real sum[MAX_COMPONENTS];
+         HYPRE_Real a, diag;
+         HYPRE_Int  s, c;
+
+         for (c = 0; c < nc; c++)
+         {
+            sum[c] = bp[bi + c*bvol];
+         }
+         for (s = 0; s < stencil_size; s++)
+         {
+            if (s != diag_rank)
+            {
+               a = Avar[s] ? Ap[s][Ai] : AAp[s];
+               for (c = 0; c < nc; c++)
+               {
+                  sum[c] -= a * xp[xi + xoff[s] + c*xvol];
+               }
+            }
+         }
+         diag = Avar[diag_rank] ? Ap[diag_rank][Ai] : AAp[diag_rank];
+         for (c = 0; c < nc; c++)
+         {
+            tp[ti + c*tvol] = sum[c] / diag;
+         }
+      }
+      hypre_BoxLoop4End(Ai, bi, xi, ti);
+   }
+
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(AAp, HYPRE_MEMORY_HOST);
+   hypre_TFree(Avar, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+#else
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Multi-component relaxation is not available\n");
+#endif
+
+   return hypre_error_flag;
+}
+
 /* for constant_coefficient==1 or 2, all offdiagonal coefficients constant over space ...*/
 HYPRE_Int
 hypre_PointRelax_core12( void               *relax_vdata,
@@ -1446,7 +1611,8 @@ HYPRE_Int hypre_relax_wtx( void *relax_vdata, HYPRE_Int pointset,
 
    HYPRE_Real weightc = 1 - weight;
    HYPRE_Real *xp, *tp;
-   HYPRE_Int compute_i, i, j;
+   HYPRE_Int num_components = hypre_StructVectorNumComponents(x);
+   HYPRE_Int compute_i, i, j, c;
 
    hypre_BoxArrayArray   *compute_box_aa;
    hypre_BoxArray        *compute_box_a;
@@ -1483,9 +1649,6 @@ HYPRE_Int hypre_relax_wtx( void *relax_vdata, HYPRE_Int pointset,
          t_data_box =
             hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
 
-         xp = hypre_StructVectorBoxData(x, i);
-         tp = hypre_StructVectorBoxData(t, i);
-
          hypre_ForBoxI(j, compute_box_a)
          {
             compute_box = hypre_BoxArrayBox(compute_box_a, j);
@@ -1493,15 +1656,21 @@ HYPRE_Int hypre_relax_wtx( void *relax_vdata, HYPRE_Int pointset,
             start  = hypre_BoxIMin(compute_box);
             hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
-#define DEVICE_VAR is_device_ptr(xp,tp)
-            hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            for (c = 0; c < num_components; c++)
             {
-               xp[xi] = weight*tp[ti] + weightc*xp[xi];
-            }
-            hypre_BoxLoop2End(xi, ti);
+               xp = hypre_StructVectorBoxDataComponent(x, i, c);
+               tp = hypre_StructVectorBoxDataComponent(t, i, c);
+
+#define DEVICE_VAR is_device_ptr(xp,tp)
+               hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                                   x_data_box, start, stride, xi,
+                                   t_data_box, start, stride, ti);
+               {
+                  xp[xi] = weight*tp[ti] + weightc*xp[xi];
+               }
+               hypre_BoxLoop2End(xi, ti);
 #undef DEVICE_VAR
+            }
          }
       }
    }
@@ -1528,7 +1697,8 @@ HYPRE_Int hypre_relax_copy( void *relax_vdata, HYPRE_Int pointset,
    hypre_Index            loop_size;
 
    HYPRE_Real *xp, *tp;
-   HYPRE_Int compute_i, i, j;
+   HYPRE_Int num_components = hypre_StructVectorNumComponents(x);
+   HYPRE_Int compute_i, i, j, c;
 
    hypre_BoxArrayArray   *compute_box_aa;
    hypre_BoxArray        *compute_box_a;
@@ -1565,9 +1735,6 @@ HYPRE_Int hypre_relax_copy( void *relax_vdata, HYPRE_Int pointset,
          t_data_box =
             hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
 
-         xp = hypre_StructVectorBoxData(x, i);
-         tp = hypre_StructVectorBoxData(t, i);
-
          hypre_ForBoxI(j, compute_box_a)
          {
             compute_box = hypre_BoxArrayBox(compute_box_a, j);
@@ -1575,15 +1742,21 @@ HYPRE_Int hypre_relax_copy( void *relax_vdata, HYPRE_Int pointset,
             start  = hypre_BoxIMin(compute_box);
             hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
-#define DEVICE_VAR is_device_ptr(xp,tp)
-            hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            for (c = 0; c < num_components; c++)
             {
-               xp[xi] = tp[ti];
-            }
-            hypre_BoxLoop2End(xi, ti);
+               xp = hypre_StructVectorBoxDataComponent(x, i, c);
+               tp = hypre_StructVectorBoxDataComponent(t, i, c);
+
+#define DEVICE_VAR is_device_ptr(xp,tp)
+               hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                                   x_data_box, start, stride, xi,
+                                   t_data_box, start, stride, ti);
+               {
+                  xp[xi] = tp[ti];
+               }
+               hypre_BoxLoop2End(xi, ti);
 #undef DEVICE_VAR
+            }
          }
       }
    }
@@ -15,6 +15,18 @@
 #include "_hypre_struct_mv.hpp"
 #include "red_black_gs.h"
 
+/* split storage is only built for host loops */
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_REDBLACK_SPLIT_STORAGE
+#endif
+
+#ifdef HYPRE_REDBLACK_SPLIT_STORAGE
+#define HYPRE_REDBLACK_SPLIT_CHUNK 64
+static HYPRE_Int hypre_RedBlackGSSplitSetup( hypre_RedBlackGSData *relax_data,
+                                             hypre_StructMatrix *A, hypre_StructVector *x );
+static HYPRE_Int hypre_RedBlackGSSplitDestroy( hypre_RedBlackGSData *relax_data );
+#endif
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -34,6 +46,8 @@ hypre_RedBlackGSCreate( MPI_Comm  comm )
    (relax_data -> rel_change)  = 0;
    (relax_data -> zero_guess)  = 0;
    (relax_data -> rb_start)    = 1;
+   (relax_data -> split_storage) = 0;
+   (relax_data -> same_rhs)    = 0;
    (relax_data -> flops)       = 0;
    (relax_data -> A)           = NULL;
    (relax_data -> b)           = NULL;
@@ -57,6 +71,9 @@ hypre_RedBlackGSDestroy( void *relax_vdata )
       hypre_StructVectorDestroy(relax_data -> b);
       hypre_StructVectorDestroy(relax_data -> x);
       hypre_ComputePkgDestroy(relax_data -> compute_pkg);
+#ifdef HYPRE_REDBLACK_SPLIT_STORAGE
+      hypre_RedBlackGSSplitDestroy(relax_data);
+#endif
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -84,6 +101,13 @@ hypre_RedBlackGSSetup( void               *relax_vdata,
    hypre_Index            diag_index;
    hypre_ComputeInfo     *compute_info;
 
+   if (hypre_StructVectorNumComponents(b) > 1 || hypre_StructVectorNumComponents(x) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Red/black Gauss-Seidel does not support multi-component vectors\n");
+      return hypre_error_flag;
+   }
+
    /*----------------------------------------------------------
     * Find the matrix diagonal
     *----------------------------------------------------------*/
@@ -112,9 +136,663 @@ hypre_RedBlackGSSetup( void               *relax_vdata,
    (relax_data -> diag_rank) = diag_rank;
    (relax_data -> compute_pkg) = compute_pkg;
 
+#ifdef HYPRE_REDBLACK_SPLIT_STORAGE
+   if (relax_data -> split_storage)
+   {
+      hypre_RedBlackGSSplitSetup(relax_data, A, x);
+   }
+#endif
+
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Red/black split storage.
+ *
+ * For each box, the split arrays are laid out on the data box of x.  Each
+ * row (fixed j and k) of the data box is split into its two colors, and the
+ * points of one color are stored contiguously, so that the points of color q
+ * are in a (h x nj x nk) array with h = (ni+1)/2 and point (i,j,k) stored at
+ * (k*nj + j)*h + i/2 (local indices).  With a 3/5/7-pt stencil, the y and z
+ * neighbors of a point are at the same position in the rows above and below
+ * in the other color's array, and the x neighbors are at a fixed offset
+ * within the row, so each row of a half sweep is a unit-stride loop.
+ *
+ * The coefficients of A are split once at setup.  At each call, b and x are
+ * split, the half sweeps are done on the split arrays, and x is copied back.
+ * Between half sweeps, only the boundary layer and the ghost layer of x are
+ * copied back and forth around the usual ghost exchange.  The split b is kept
+ * when the caller says b is unchanged (see hypre_RedBlackGSSetSameRHS), as
+ * PFMG does for post-relaxation.  x has to be copied back at every call,
+ * since the callers compute residuals, restrict, and interpolate on the
+ * regular layout.
+ *--------------------------------------------------------------------------*/
+
+#ifdef HYPRE_REDBLACK_SPLIT_STORAGE
+
+/*--------------------------------------------------------------------------
+ * Sizes of the split layout for a data box: n[3] is the data box size
+ * (padded with 1's), h the half row length, and p the parity of the data box
+ * imin (the color of a point is the parity of the sum of its indices).
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RedBlackGSSplitLayout( hypre_Box *dbox,
+                             HYPRE_Int  ndim,
+                             HYPRE_Int *n,
+                             HYPRE_Int *h_ptr,
+                             HYPRE_Int *p_ptr )
+{
+   HYPRE_Int  d, p;
+
+   p = 0;
+   for (d = 0; d < 3; d++)
+   {
+      n[d] = 1;
+      if (d < ndim)
+      {
+         n[d] = hypre_BoxSizeD(dbox, d);
+         p   += hypre_BoxIMinD(dbox, d);
+      }
+   }
+
+   *h_ptr = (n[0] + 1) / 2;
+   *p_ptr = hypre_abs(p) % 2;
+}
+
+/*--------------------------------------------------------------------------
+ * Copy the points of 'region' that are not in 'inner' (may be NULL) between
+ * natural data 'dp' on data box 'dbox' and split data 'sp' laid out on data
+ * box 'sbox'.  If 'to_split' is true, copy into the split data.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RedBlackGSSplitCopy( HYPRE_Real *dp,
+                           hypre_Box  *dbox,
+                           HYPRE_Real *sp,
+                           hypre_Box  *sbox,
+                           HYPRE_Int   ndim,
+                           hypre_Box  *region,
+                           hypre_Box  *inner,
+                           HYPRE_Int   to_split )
+{
+   HYPRE_Int  n[3], m[3], lo[3], hi[3], ilo[3], ihi[3], shift[3];
+   HYPRE_Int  h, p, vol, d, r, nr, nj;
+
+   if (hypre_BoxVolume(region) == 0)
+   {
+      return;
+   }
+
+   hypre_RedBlackGSSplitLayout(sbox, ndim, n, &h, &p);
+   vol = h * n[1] * n[2];
+
+   for (d = 0; d < 3; d++)
+   {
+      m[d] = 1;  lo[d] = 0;  hi[d] = 0;  ilo[d] = 0;  ihi[d] = 0;  shift[d] = 0;
+      if (d < ndim)
+      {
+         m[d]     = hypre_BoxSizeD(dbox, d);
+         lo[d]    = hypre_BoxIMinD(region, d) - hypre_BoxIMinD(sbox, d);
+         hi[d]    = hypre_BoxIMaxD(region, d) - hypre_BoxIMinD(sbox, d);
+         shift[d] = hypre_BoxIMinD(sbox, d) - hypre_BoxIMinD(dbox, d);
+         if (inner != NULL)
+         {
+            ilo[d] = hypre_BoxIMinD(inner, d) - hypre_BoxIMinD(sbox, d);
+            ihi[d] = hypre_BoxIMaxD(inner, d) - hypre_BoxIMinD(sbox, d);
+         }
+      }
+   }
+   nj = hi[1] - lo[1] + 1;
+   nr = nj * (hi[2] - lo[2] + 1);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < nr; r++)
+   {
+      HYPRE_Int  lj = lo[1] + r % nj;
+      HYPRE_Int  lk = lo[2] + r / nj;
+      HYPRE_Int  skip_lo = hi[0] + 1;
+      HYPRE_Int  skip_hi = hi[0];
+      HYPRE_Int  srow = (lk * n[1] + lj) * h;
+      HYPRE_Int  drow = ((lk + shift[2]) * m[1] + (lj + shift[1])) * m[0] + shift[0];
+      HYPRE_Int  li, g, e;
+
+      if ( (inner != NULL) &&
+           (lj >= ilo[1]) && (lj <= ihi[1]) && (lk >= ilo[2]) && (lk <= ihi[2]) )
+      {
+         skip_lo = ilo[0];
+         skip_hi = ihi[0];
+      }
+
+      /* copy [lo[0], skip_lo) and (skip_hi, hi[0]], one parity at a time */
+      for (g = 0; g < 2; g++)
+      {
+         HYPRE_Int  a = (g == 0) ? lo[0] : hypre_max(skip_hi + 1, lo[0]);
+         HYPRE_Int  z = (g == 0) ? hypre_min(skip_lo - 1, hi[0]) : hi[0];
+
+         if ((g == 1) && (skip_lo > hi[0]))
+         {
+            break;
+         }
+         for (e = 0; e < 2; e++)
+         {
+            HYPRE_Int   li0 = a + (((a & 1) != e) ? 1 : 0);
+            HYPRE_Real *rp  = sp + ((e + lj + lk + p) & 1) * vol + srow;
+            HYPRE_Real *np  = dp + drow;
+
+            if (to_split)
+            {
+               for (li = li0; li <= z; li += 2)
+               {
+                  rp[li >> 1] = np[li];
+               }
+            }
+            else
+            {
+               for (li = li0; li <= z; li += 2)
+               {
+                  np[li] = rp[li >> 1];
+               }
+            }
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Relax the points of color q in 'box' using the split arrays of the box.
+ * Entry 0 of the split coefficients is the diagonal, entries 1..num_offd
+ * are the off-diagonals in 'offd' order.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RedBlackGSSplitHalfSweep( HYPRE_Real  *As,
+                                HYPRE_Real  *bs,
+                                HYPRE_Real  *xs,
+                                hypre_Box   *box,
+                                hypre_Box   *sbox,
+                                HYPRE_Int    ndim,
+                                hypre_Index *stencil_shape,
+                                HYPRE_Int   *offd,
+                                HYPRE_Int    num_offd,
+                                HYPRE_Int    q,
+                                HYPRE_Int    zero_guess )
+{
+   HYPRE_Int  n[3], lo[3], hi[3], yzoff[6], dx[6];
+   HYPRE_Int  h, p, vol, d, s, r, nr, nj;
+
+   if (hypre_BoxVolume(box) == 0)
+   {
+      return;
+   }
+
+   hypre_RedBlackGSSplitLayout(sbox, ndim, n, &h, &p);
+   vol = h * n[1] * n[2];
+
+   for (d = 0; d < 3; d++)
+   {
+      lo[d] = 0;
+      hi[d] = 0;
+      if (d < ndim)
+      {
+         lo[d] = hypre_BoxIMinD(box, d) - hypre_BoxIMinD(sbox, d);
+         hi[d] = hypre_BoxIMaxD(box, d) - hypre_BoxIMinD(sbox, d);
+      }
+   }
+   for (s = 0; s < num_offd; s++)
+   {
+      yzoff[s] = 0;
+      dx[s]    = hypre_IndexD(stencil_shape[offd[s]], 0);
+      if (ndim > 1)
+      {
+         yzoff[s] += hypre_IndexD(stencil_shape[offd[s]], 1) * h;
+      }
+      if (ndim > 2)
+      {
+         yzoff[s] += hypre_IndexD(stencil_shape[offd[s]], 2) * h * n[1];
+      }
+   }
+   nj = hi[1] - lo[1] + 1;
+   nr = nj * (hi[2] - lo[2] + 1);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < nr; r++)
+   {
+      HYPRE_Int    lj = lo[1] + r % nj;
+      HYPRE_Int    lk = lo[2] + r / nj;
+      HYPRE_Int    e  = (q + lj + lk + p) & 1;  /* parity of i for color q */
+      HYPRE_Int    srow = (lk * n[1] + lj) * h;
+      HYPRE_Int    li0, li1, m, m0, m1, c0, c1, t;
+      HYPRE_Real   chunk[HYPRE_REDBLACK_SPLIT_CHUNK];
+      HYPRE_Int    xoff0, xoff1, xoff2, xoff3, xoff4, xoff5;
+      HYPRE_Int    xoff[6];
+      HYPRE_Real  *Ap, *Ap0, *Ap1, *Ap2, *Ap3, *Ap4, *Ap5;
+      HYPRE_Real  *bp, *xp, *xop;
+
+      li0 = lo[0] + (((lo[0] & 1) != e) ? 1 : 0);
+      li1 = hi[0] - (((hi[0] & 1) != e) ? 1 : 0);
+      if (li0 > li1)
+      {
+         continue;
+      }
+      m0 = li0 >> 1;
+      m1 = li1 >> 1;
+
+      /* x neighbors: i-1 is at i/2 - 1 + e, i+1 is at i/2 + e */
+      for (t = 0; t < num_offd; t++)
+      {
+         xoff[t] = yzoff[t];
+         if (dx[t] < 0)
+         {
+            xoff[t] += e - 1;
+         }
+         else if (dx[t] > 0)
+         {
+            xoff[t] += e;
+         }
+      }
+
+      Ap  = As + (q * (num_offd + 1)) * vol + srow;
+      bp  = bs + q * vol + srow;
+      xp  = xs + q * vol + srow;
+      xop = xs + (1 - q) * vol + srow;
+
+      if (zero_guess)
+      {
+         for (m = m0; m <= m1; m++)
+         {
+            xp[m] = bp[m] / Ap[m];
+         }
+         continue;
+      }
+
+      switch (num_offd)
+      {
+         case 6:
+            Ap5 = Ap + 6 * vol;  xoff5 = xoff[5];
+            Ap4 = Ap + 5 * vol;  xoff4 = xoff[4];
+            Ap3 = Ap + 4 * vol;  xoff3 = xoff[3];
+            Ap2 = Ap + 3 * vol;  xoff2 = xoff[2];
+            Ap1 = Ap + 2 * vol;  xoff1 = xoff[1];
+            Ap0 = Ap + 1 * vol;  xoff0 = xoff[0];
+            /* accumulate into a local chunk so that the loop vectorizes
+             * without runtime alias checks on the many pointers */
+            for (c0 = m0; c0 <= m1; c0 += HYPRE_REDBLACK_SPLIT_CHUNK)
+            {
+               c1 = hypre_min(c0 + HYPRE_REDBLACK_SPLIT_CHUNK - 1, m1);
+               for (m = c0; m <= c1; m++)
+               {
+                  chunk[m - c0] =
+                     (bp[m] -
+                      Ap0[m] * xop[m + xoff0] -
+                      Ap1[m] * xop[m + xoff1] -
+                      Ap2[m] * xop[m + xoff2] -
+                      Ap3[m] * xop[m + xoff3] -
+                      Ap4[m] * xop[m + xoff4] -
+                      Ap5[m] * xop[m + xoff5]) / Ap[m];
+               }
+               for (m = c0; m <= c1; m++)
+               {
+                  xp[m] = chunk[m - c0];
+               }
+            }
+            break;
+
+         case 4:
+            Ap3 = Ap + 4 * vol;  xoff3 = xoff[3];
+            Ap2 = Ap + 3 * vol;  xoff2 = xoff[2];
+            Ap1 = Ap + 2 * vol;  xoff1 = xoff[1];
+            Ap0 = Ap + 1 * vol;  xoff0 = xoff[0];
+            for (m = m0; m <= m1; m++)
+            {
+               xp[m] =
+                  (bp[m] -
+                   Ap0[m] * xop[m + xoff0] -
+                   Ap1[m] * xop[m + xoff1] -
+                   Ap2[m] * xop[m + xoff2] -
+                   Ap3[m] * xop[m + xoff3]) / Ap[m];
+            }
+            break;
+
+         case 2:
+            Ap1 = Ap + 2 * vol;  xoff1 = xoff[1];
+            Ap0 = Ap + 1 * vol;  xoff0 = xoff[0];
+            for (m = m0; m <= m1; m++)
+            {
+               xp[m] =
+                  (bp[m] -
+                   Ap0[m] * xop[m + xoff0] -
+                   Ap1[m] * xop[m + xoff1]) / Ap[m];
+            }
+            break;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_RedBlackGSSplitDestroy( hypre_RedBlackGSData *relax_data )
+{
+   hypre_BoxArrayDestroy(relax_data -> split_dspace);
+   hypre_TFree(relax_data -> split_offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> split_A, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> split_b, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> split_x, HYPRE_MEMORY_HOST);
+   (relax_data -> split_dspace)  = NULL;
+   (relax_data -> split_b_valid) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Split the coefficients of A.  Nothing is set up (and the regular sweeps
+ * are used) unless A has variable coefficients and a 3-pt (1D), 5-pt (2D),
+ * or 7-pt (3D) stencil.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_RedBlackGSSplitSetup( hypre_RedBlackGSData *relax_data,
+                            hypre_StructMatrix   *A,
+                            hypre_StructVector   *x )
+{
+   HYPRE_Int              ndim          = hypre_StructMatrixNDim(A);
+   HYPRE_Int              diag_rank     = (relax_data -> diag_rank);
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   hypre_BoxArray        *boxes         = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   hypre_BoxArray        *dspace        = hypre_StructVectorDataSpace(x);
+
+   hypre_Box             *box;
+   hypre_Box             *A_dbox;
+   hypre_Box             *x_dbox;
+   HYPRE_Int             *split_offsets;
+   HYPRE_Real            *split_A;
+   HYPRE_Real            *As;
+   HYPRE_Real            *Ap[7];
+   HYPRE_Int              ranks[7];
+   hypre_Index            index;
+   HYPRE_Int              n[3], lo[3], hi[3];
+   HYPRE_Int              h, p, vol, total, Ai;
+   HYPRE_Int              i, s, d, li, lj, lk, si, q;
+
+   hypre_RedBlackGSSplitDestroy(relax_data);
+
+   if ( hypre_StructMatrixConstantCoefficient(A) ||
+        (ndim > 3) || (stencil_size != 2*ndim + 1) )
+   {
+      return hypre_error_flag;
+   }
+   ranks[0] = diag_rank;
+   i = 1;
+   for (s = 0; s < stencil_size; s++)
+   {
+      if (s != diag_rank)
+      {
+         ranks[i++] = s;
+      }
+      p = 0;
+      for (d = 0; d < ndim; d++)
+      {
+         p += hypre_abs(hypre_IndexD(stencil_shape[s], d));
+      }
+      if (p != ((s == diag_rank) ? 0 : 1))
+      {
+         return hypre_error_flag;
+      }
+   }
+
+   split_offsets = hypre_TAlloc(HYPRE_Int, hypre_BoxArraySize(boxes), HYPRE_MEMORY_HOST);
+   total = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      hypre_RedBlackGSSplitLayout(hypre_BoxArrayBox(dspace, i), ndim, n, &h, &p);
+      split_offsets[i] = total;
+      total += 2 * h * n[1] * n[2];
+   }
+   split_A = hypre_CTAlloc(HYPRE_Real, total * stencil_size, HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_dbox = hypre_BoxArrayBox(dspace, i);
+
+      hypre_RedBlackGSSplitLayout(x_dbox, ndim, n, &h, &p);
+      vol = h * n[1] * n[2];
+      As  = split_A + split_offsets[i] * stencil_size;
+      for (s = 0; s < stencil_size; s++)
+      {
+         Ap[s] = hypre_StructMatrixBoxData(A, i, ranks[s]);
+      }
+
+      hypre_SetIndex(index, 0);
+      for (d = 0; d < 3; d++)
+      {
+         lo[d] = 0;
+         hi[d] = 0;
+         if (d < ndim)
+         {
+            lo[d] = hypre_BoxIMinD(box, d) - hypre_BoxIMinD(x_dbox, d);
+            hi[d] = hypre_BoxIMaxD(box, d) - hypre_BoxIMinD(x_dbox, d);
+            hypre_IndexD(index, d) = hypre_BoxIMinD(box, d);
+         }
+      }
+
+      for (lk = lo[2]; lk <= hi[2]; lk++)
+      {
+         for (lj = lo[1]; lj <= hi[1]; lj++)
+         {
+            if (ndim > 1)
+            {
+               hypre_IndexD(index, 1) = lj + hypre_BoxIMinD(x_dbox, 1);
+            }
+            if (ndim > 2)
+            {
+               hypre_IndexD(index, 2) = lk + hypre_BoxIMinD(x_dbox, 2);
+            }
+            Ai = hypre_BoxIndexRank(A_dbox, index);
+            for (li = lo[0]; li <= hi[0]; li++, Ai++)
+            {
+               q  = (li + lj + lk + p) & 1;
+               si = (lk * n[1] + lj) * h + (li >> 1);
+               for (s = 0; s < stencil_size; s++)
+               {
+                  As[(q * stencil_size + s) * vol + si] = Ap[s][Ai];
+               }
+            }
+         }
+      }
+   }
+
+   (relax_data -> split_dspace)  = hypre_BoxArrayDuplicate(dspace);
+   (relax_data -> split_offsets) = split_offsets;
+   (relax_data -> split_A)       = split_A;
+   (relax_data -> split_b)       = hypre_CTAlloc(HYPRE_Real, total, HYPRE_MEMORY_HOST);
+   (relax_data -> split_x)       = hypre_CTAlloc(HYPRE_Real, total, HYPRE_MEMORY_HOST);
+   (relax_data -> split_b_valid) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Return true if the split layout can be used for x
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_RedBlackGSSplitMatches( hypre_RedBlackGSData *relax_data,
+                              hypre_StructVector   *x )
+{
+   hypre_BoxArray  *split_dspace = (relax_data -> split_dspace);
+   hypre_BoxArray  *dspace       = hypre_StructVectorDataSpace(x);
+   hypre_Box       *box, *sbox;
+   HYPRE_Int        ndim = hypre_StructVectorNDim(x);
+   HYPRE_Int        i;
+
+   if ( (split_dspace == NULL) ||
+        (hypre_BoxArraySize(split_dspace) != hypre_BoxArraySize(dspace)) )
+   {
+      return 0;
+   }
+   hypre_ForBoxI(i, dspace)
+   {
+      box  = hypre_BoxArrayBox(dspace, i);
+      sbox = hypre_BoxArrayBox(split_dspace, i);
+      if ( !hypre_IndexesEqual(hypre_BoxIMin(box), hypre_BoxIMin(sbox), ndim) ||
+           !hypre_IndexesEqual(hypre_BoxIMax(box), hypre_BoxIMax(sbox), ndim) )
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * Do all of the half sweeps of a hypre_RedBlackGS call in split storage
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_RedBlackGSSplitSweeps( hypre_RedBlackGSData *relax_data,
+                             hypre_StructMatrix   *A,
+                             hypre_StructVector   *b,
+                             hypre_StructVector   *x,
+                             HYPRE_Int            *offd )
+{
+   HYPRE_Int              max_iter      = (relax_data -> max_iter);
+   HYPRE_Int              zero_guess    = (relax_data -> zero_guess);
+   hypre_ComputePkg      *compute_pkg   = (relax_data -> compute_pkg);
+   HYPRE_Int             *split_offsets = (relax_data -> split_offsets);
+   HYPRE_Real            *split_A       = (relax_data -> split_A);
+   HYPRE_Real            *split_b       = (relax_data -> split_b);
+   HYPRE_Real            *split_x       = (relax_data -> split_x);
+   HYPRE_Int              ndim          = hypre_StructMatrixNDim(A);
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   hypre_BoxArray        *boxes         = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+
+   hypre_CommHandle      *comm_handle;
+   hypre_Box             *box;
+   hypre_Box             *x_dbox;
+   hypre_Box             *b_dbox;
+   hypre_Box             *inner;
+   HYPRE_Real            *xp;
+   HYPRE_Int              exchange, iter, rb, i, d;
+
+   inner = hypre_BoxCreate(ndim);
+
+   /* split b, unless it is unchanged since it was last split */
+   if (!(relax_data -> split_b_valid))
+   {
+      hypre_ForBoxI(i, boxes)
+      {
+         box    = hypre_BoxArrayBox(boxes, i);
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+         hypre_RedBlackGSSplitCopy(hypre_StructVectorBoxData(b, i), b_dbox,
+                                   split_b + split_offsets[i], x_dbox,
+                                   ndim, box, NULL, 1);
+      }
+      (relax_data -> split_b_valid) = 1;
+   }
+
+   /* split x, including ghost values.  With a zero guess, x is not read in
+    * the first half sweep, but (e.g., with odd periodicity) the other color
+    * may still be read later, so it must match the unsplit x. */
+   if (!zero_guess)
+   {
+      xp = hypre_StructVectorData(x);
+      hypre_InitializeIndtComputations(compute_pkg, xp, &comm_handle);
+      hypre_FinalizeIndtComputations(comm_handle);
+   }
+   hypre_ForBoxI(i, boxes)
+   {
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      hypre_RedBlackGSSplitCopy(hypre_StructVectorBoxData(x, i), x_dbox,
+                                split_x + split_offsets[i], x_dbox,
+                                ndim, x_dbox, NULL, 1);
+   }
+
+   /* ghost values only change between half sweeps if something is sent,
+    * received, or copied locally (e.g., multiple boxes or periodicity) */
+   exchange = hypre_CommPkgHasExchanges(hypre_ComputePkgCommPkg(compute_pkg));
+
+   rb = (relax_data -> rb_start);
+   iter = 0;
+   while (iter < 2*max_iter)
+   {
+      if ((iter > 0) && exchange)
+      {
+         /* copy back the boundary layer, exchange, and split the ghosts */
+         hypre_ForBoxI(i, boxes)
+         {
+            box    = hypre_BoxArrayBox(boxes, i);
+            x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+            hypre_CopyBox(box, inner);
+            for (d = 0; d < ndim; d++)
+            {
+               hypre_BoxIMinD(inner, d) += 1;
+               hypre_BoxIMaxD(inner, d) -= 1;
+            }
+            hypre_RedBlackGSSplitCopy(hypre_StructVectorBoxData(x, i), x_dbox,
+                                      split_x + split_offsets[i], x_dbox,
+                                      ndim, box, inner, 0);
+         }
+
+         xp = hypre_StructVectorData(x);
+         hypre_InitializeIndtComputations(compute_pkg, xp, &comm_handle);
+         hypre_FinalizeIndtComputations(comm_handle);
+
+         hypre_ForBoxI(i, boxes)
+         {
+            box    = hypre_BoxArrayBox(boxes, i);
+            x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+            hypre_RedBlackGSSplitCopy(hypre_StructVectorBoxData(x, i), x_dbox,
+                                      split_x + split_offsets[i], x_dbox,
+                                      ndim, x_dbox, box, 1);
+         }
+      }
+
+      hypre_ForBoxI(i, boxes)
+      {
+         box    = hypre_BoxArrayBox(boxes, i);
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         hypre_RedBlackGSSplitHalfSweep(split_A + split_offsets[i] * stencil_size,
+                                        split_b + split_offsets[i],
+                                        split_x + split_offsets[i],
+                                        box, x_dbox, ndim, stencil_shape,
+                                        offd, stencil_size - 1, rb,
+                                        (zero_guess && (iter == 0)));
+      }
+
+      rb = (rb + 1) % 2;
+      iter++;
+   }
+
+   /* copy x back */
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      hypre_RedBlackGSSplitCopy(hypre_StructVectorBoxData(x, i), x_dbox,
+                                split_x + split_offsets[i], x_dbox,
+                                ndim, box, NULL, 0);
+   }
+
+   hypre_BoxDestroy(inner);
+
+   return hypre_error_flag;
+}
+
+#endif
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -171,6 +849,20 @@ hypre_RedBlackGS( void               *relax_vdata,
 
    hypre_BeginTiming(relax_data -> time_index);
 
+#ifdef HYPRE_REDBLACK_SPLIT_STORAGE
+   /* the split coefficients belong to the matrix given at setup */
+   if ((relax_data -> A) != A)
+   {
+      hypre_RedBlackGSSplitDestroy(relax_data);
+   }
+
+   /* the split b can only be reused for the same, unchanged b */
+   if (!(relax_data -> same_rhs) || (relax_data -> b) != b)
+   {
+      (relax_data -> split_b_valid) = 0;
+   }
+#endif
+
    hypre_StructMatrixDestroy(relax_data -> A);
    hypre_StructVectorDestroy(relax_data -> b);
    hypre_StructVectorDestroy(relax_data -> x);
@@ -210,6 +902,20 @@ hypre_RedBlackGS( void               *relax_vdata,
       }
    }
 
+#ifdef HYPRE_REDBLACK_SPLIT_STORAGE
+   if ( (relax_data -> split_A) != NULL &&
+        hypre_RedBlackGSSplitMatches(relax_data, x) )
+   {
+      hypre_RedBlackGSSplitSweeps(relax_data, A, b, x, offd);
+
+      (relax_data -> num_iterations) = max_iter;
+      hypre_IncFLOPCount(relax_data -> flops);
+      hypre_EndTiming(relax_data -> time_index);
+
+      return hypre_error_flag;
+   }
+#endif
+
    /*----------------------------------------------------------
     * Do zero_guess iteration
     *----------------------------------------------------------*/
@@ -527,6 +1233,39 @@ hypre_RedBlackGSSetZeroGuess( void *relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Store the colors of x, b and the coefficients of A separately, so that
+ * each half sweep is a unit-stride loop.  Takes effect at setup, and only
+ * for variable-coefficient 3/5/7-pt stencils on host builds.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSetSplitStorage( void      *relax_vdata,
+                                 HYPRE_Int  split_storage )
+{
+   hypre_RedBlackGSData *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   (relax_data -> split_storage) = split_storage;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Tell the next call that b has not changed since the previous call, so
+ * that the split copy of b can be reused (split storage only).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSetSameRHS( void      *relax_vdata,
+                            HYPRE_Int  same_rhs )
+{
+   hypre_RedBlackGSData *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   (relax_data -> same_rhs) = same_rhs;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -18,6 +18,8 @@ typedef struct
    HYPRE_Int               rel_change;         /* not yet used */
    HYPRE_Int               zero_guess;
    HYPRE_Int               rb_start;
+   HYPRE_Int               split_storage;      /* use red/black split storage */
+   HYPRE_Int               same_rhs;           /* b unchanged since last call */
 
    hypre_StructMatrix     *A;
    hypre_StructVector     *b;
@@ -27,6 +29,15 @@ typedef struct
 
    hypre_ComputePkg       *compute_pkg;
 
+   /* red/black split storage: per box, the points of each color are stored
+    * contiguously row by row, laid out on the data space of x */
+   hypre_BoxArray         *split_dspace;
+   HYPRE_Int              *split_offsets;
+   HYPRE_Real             *split_A;
+   HYPRE_Real             *split_b;
+   HYPRE_Real             *split_x;
+   HYPRE_Int               split_b_valid;      /* split_b holds the current b */
+
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
    HYPRE_Int               time_index;
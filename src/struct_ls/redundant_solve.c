@@ -0,0 +1,548 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Redundant direct solve for small (coarse) struct grids.  The ranks that own
+ * grid points gather the whole matrix onto a sub-communicator and each one
+ * LU-factors a dense copy of it.  A solve is then a single gather of the
+ * right-hand side followed by local triangular solves, instead of a
+ * relaxation sweep (and a ghost exchange) per iteration.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_lapack.h"
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+   MPI_Comm                sub_comm;     /* ranks that own grid points */
+
+   HYPRE_Int               num_points;   /* local number of grid points */
+   HYPRE_Int               global_size;
+   HYPRE_Int              *recv_counts;
+   HYPRE_Int              *recv_displs;
+
+   HYPRE_Real             *LU;           /* dense LU factors (column major) */
+   HYPRE_Int              *piv;
+   HYPRE_Real             *rhs;
+   HYPRE_Real             *local_rhs;
+   HYPRE_Int               factored;
+
+   HYPRE_Int               time_index;
+
+} hypre_RedundantSolveData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_RedundantSolveCreate( MPI_Comm  comm )
+{
+   hypre_RedundantSolveData *solve_data;
+
+   solve_data = hypre_CTAlloc(hypre_RedundantSolveData, 1, HYPRE_MEMORY_HOST);
+
+   (solve_data -> comm)        = comm;
+   (solve_data -> sub_comm)    = hypre_MPI_COMM_NULL;
+   (solve_data -> num_points)  = 0;
+   (solve_data -> global_size) = 0;
+   (solve_data -> recv_counts) = NULL;
+   (solve_data -> recv_displs) = NULL;
+   (solve_data -> LU)          = NULL;
+   (solve_data -> piv)         = NULL;
+   (solve_data -> rhs)         = NULL;
+   (solve_data -> local_rhs)   = NULL;
+   (solve_data -> factored)    = 0;
+   (solve_data -> time_index)  = hypre_InitializeTiming("RedundantSolve");
+
+   return (void *) solve_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedundantSolveDestroy( void *solve_vdata )
+{
+   hypre_RedundantSolveData *solve_data = (hypre_RedundantSolveData *)solve_vdata;
+
+   if (solve_data)
+   {
+      if ((solve_data -> sub_comm) != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&(solve_data -> sub_comm));
+      }
+      hypre_TFree(solve_data -> recv_counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> recv_displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> LU, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> piv, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> rhs, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> local_rhs, HYPRE_MEMORY_HOST);
+
+      hypre_FinalizeTiming(solve_data -> time_index);
+      hypre_TFree(solve_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Gathers A and factors it.  The grid's bounding box is used to number the
+ * grid points, so its volume should be of the same order as the number of
+ * points.  If the bounding box holds more than hypre_REDUNDANT_MAX_SIZE
+ * points, or the matrix turns out to be (numerically) singular, e.g. for
+ * periodic or pure Neumann problems, nothing is factored and the caller is
+ * expected to keep using its iterative coarse solve; see
+ * hypre_RedundantSolveGetFactored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedundantSolveSetup( void               *solve_vdata,
+                           hypre_StructMatrix *A,
+                           hypre_StructVector *b,
+                           hypre_StructVector *x )
+{
+   hypre_RedundantSolveData *solve_data = (hypre_RedundantSolveData *)solve_vdata;
+
+   MPI_Comm               comm = (solve_data -> comm);
+   MPI_Comm               sub_comm;
+
+   hypre_StructGrid      *grid = hypre_StructMatrixGrid(A);
+   hypre_BoxArray        *boxes = hypre_StructGridBoxes(grid);
+   hypre_Box             *bbox = hypre_StructGridBoundingBox(grid);
+   hypre_IndexRef         periodic = hypre_StructGridPeriodic(grid);
+   HYPRE_Int              ndim = hypre_StructGridNDim(grid);
+
+   hypre_StructStencil   *stencil = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size = hypre_StructStencilSize(stencil);
+   HYPRE_Int              constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_Int              diag_rank;
+
+   hypre_Box             *box;
+   hypre_Box             *A_dbox;
+   hypre_Index            loop_size, index, diag_index, unit_stride;
+   hypre_IndexRef         start;
+   HYPRE_Real            *Ap;
+
+   HYPRE_Int              num_points, global_size, bbox_size;
+   HYPRE_Int              num_procs, i, j, n, r, s, d, col, info, factored;
+   HYPRE_Int             *recv_counts, *recv_displs, *coef_counts, *coef_displs;
+   HYPRE_Int             *local_ids, *ids, *map;
+   HYPRE_Real            *local_coefs, *coefs;
+   HYPRE_Real            *LU, pivot, min_pivot, max_pivot;
+   HYPRE_Int             *piv;
+   HYPRE_Int              id, q[HYPRE_MAXDIM];
+
+   hypre_BeginTiming(solve_data -> time_index);
+
+   hypre_SetIndex(unit_stride, 1);
+   hypre_SetIndex(diag_index, 0);
+   diag_rank = hypre_StructStencilElementRank(stencil, diag_index);
+
+   num_points = hypre_StructGridLocalSize(grid);
+   bbox_size  = hypre_BoxVolume(bbox);
+
+   /* the bounding box is global, so all ranks take this branch together */
+   if (bbox_size > hypre_REDUNDANT_MAX_SIZE)
+   {
+      (solve_data -> factored)   = 0;
+      (solve_data -> num_points) = num_points;
+      hypre_EndTiming(solve_data -> time_index);
+
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------
+    * Number the local points by their place in the bounding box and pull
+    * out their rows of A
+    *-----------------------------------------------------*/
+
+   local_ids   = hypre_TAlloc(HYPRE_Int, num_points, HYPRE_MEMORY_HOST);
+   local_coefs = hypre_TAlloc(HYPRE_Real, num_points * stencil_size, HYPRE_MEMORY_HOST);
+
+   n = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      start  = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      for (s = 0; s < stencil_size; s++)
+      {
+         Ap = hypre_StructMatrixBoxData(A, i, s);
+         r  = n;
+         if (constant_coefficient == 1 ||
+             (constant_coefficient == 2 && s != diag_rank))
+         {
+            hypre_SerialBoxLoop0Begin(ndim, loop_size)
+            {
+               local_coefs[(r++) * stencil_size + s] = Ap[hypre_CCBoxIndexRank(A_dbox, start)];
+            }
+            hypre_SerialBoxLoop0End()
+         }
+         else
+         {
+            hypre_SerialBoxLoop1Begin(ndim, loop_size, A_dbox, start, unit_stride, Ai)
+            {
+               local_coefs[(r++) * stencil_size + s] = Ap[Ai];
+            }
+            hypre_SerialBoxLoop1End(Ai)
+         }
+      }
+
+      hypre_SerialBoxLoop0Begin(ndim, loop_size)
+      {
+         zypre_BoxLoopGetIndex(index);
+         id = 0;
+         for (d = ndim - 1; d >= 0; d--)
+         {
+            id = id * hypre_BoxSizeD(bbox, d) +
+                 hypre_IndexD(start, d) + hypre_IndexD(index, d) - hypre_BoxIMinD(bbox, d);
+         }
+         local_ids[n++] = id;
+      }
+      hypre_SerialBoxLoop0End()
+   }
+
+   /*-----------------------------------------------------
+    * Gather all rows on the ranks that own points
+    *-----------------------------------------------------*/
+
+   hypre_MPI_Comm_split(comm, (num_points > 0) ? 0 : hypre_MPI_UNDEFINED, 0, &sub_comm);
+
+   factored = 0;
+   if (num_points > 0)
+   {
+      hypre_MPI_Comm_size(sub_comm, &num_procs);
+
+      recv_counts = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+      recv_displs = hypre_TAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+      coef_counts = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+      coef_displs = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+
+      hypre_MPI_Allgather(&num_points, 1, HYPRE_MPI_INT, recv_counts, 1, HYPRE_MPI_INT, sub_comm);
+      recv_displs[0] = 0;
+      for (i = 0; i < num_procs; i++)
+      {
+         recv_displs[i + 1] = recv_displs[i] + recv_counts[i];
+         coef_counts[i] = recv_counts[i] * stencil_size;
+         coef_displs[i] = recv_displs[i] * stencil_size;
+      }
+      global_size = recv_displs[num_procs];
+
+      ids   = hypre_TAlloc(HYPRE_Int, global_size, HYPRE_MEMORY_HOST);
+      coefs = hypre_TAlloc(HYPRE_Real, global_size * stencil_size, HYPRE_MEMORY_HOST);
+      hypre_MPI_Allgatherv(local_ids, num_points, HYPRE_MPI_INT,
+                           ids, recv_counts, recv_displs, HYPRE_MPI_INT, sub_comm);
+      hypre_MPI_Allgatherv(local_coefs, num_points * stencil_size, HYPRE_MPI_REAL,
+                           coefs, coef_counts, coef_displs, HYPRE_MPI_REAL, sub_comm);
+
+      /*--------------------------------------------------
+       * Assemble the dense matrix (column major)
+       *--------------------------------------------------*/
+
+      map = hypre_TAlloc(HYPRE_Int, bbox_size, HYPRE_MEMORY_HOST);
+      for (i = 0; i < bbox_size; i++)
+      {
+         map[i] = -1;
+      }
+      for (r = 0; r < global_size; r++)
+      {
+         map[ids[r]] = r;
+      }
+
+      LU = hypre_CTAlloc(HYPRE_Real, global_size * global_size, HYPRE_MEMORY_HOST);
+      for (r = 0; r < global_size; r++)
+      {
+         for (s = 0; s < stencil_size; s++)
+         {
+            if (coefs[r * stencil_size + s] == 0.0)
+            {
+               continue;
+            }
+
+            /* locate the neighbor, wrapping around periodic directions */
+            id = ids[r];
+            for (d = 0; d < ndim; d++)
+            {
+               q[d] = id % hypre_BoxSizeD(bbox, d) + hypre_BoxIMinD(bbox, d) +
+                      hypre_IndexD(stencil_shape[s], d);
+               id  /= hypre_BoxSizeD(bbox, d);
+               if (hypre_IndexD(periodic, d))
+               {
+                  while (q[d] < hypre_BoxIMinD(bbox, d))
+                  {
+                     q[d] += hypre_IndexD(periodic, d);
+                  }
+                  while (q[d] > hypre_BoxIMaxD(bbox, d))
+                  {
+                     q[d] -= hypre_IndexD(periodic, d);
+                  }
+               }
+            }
+            id = 0;
+            for (d = ndim - 1; d >= 0; d--)
+            {
+               if (q[d] < hypre_BoxIMinD(bbox, d) || q[d] > hypre_BoxIMaxD(bbox, d))
+               {
+                  break;
+               }
+               id = id * hypre_BoxSizeD(bbox, d) + q[d] - hypre_BoxIMinD(bbox, d);
+            }
+            if (d >= 0 || map[id] < 0)
+            {
+               continue;
+            }
+
+            /* symmetric storage also maps the full stencil onto A's data */
+            col = map[id];
+            LU[r + col * global_size] += coefs[r * stencil_size + s];
+         }
+      }
+
+      /*--------------------------------------------------
+       * Factor
+       *--------------------------------------------------*/
+
+      piv = hypre_TAlloc(HYPRE_Int, global_size, HYPRE_MEMORY_HOST);
+      hypre_dgetrf(&global_size, &global_size, LU, &global_size, piv, &info);
+
+      factored = (info == 0);
+      if (factored)
+      {
+         min_pivot = max_pivot = hypre_abs(LU[0]);
+         for (j = 1; j < global_size; j++)
+         {
+            pivot = hypre_abs(LU[j + j * global_size]);
+            min_pivot = hypre_min(min_pivot, pivot);
+            max_pivot = hypre_max(max_pivot, pivot);
+         }
+         factored = (min_pivot > 1.0e-12 * max_pivot);
+      }
+
+      if (factored)
+      {
+         (solve_data -> sub_comm)    = sub_comm;
+         (solve_data -> global_size) = global_size;
+         (solve_data -> recv_counts) = recv_counts;
+         (solve_data -> recv_displs) = recv_displs;
+         (solve_data -> LU)          = LU;
+         (solve_data -> piv)         = piv;
+         (solve_data -> rhs)         = hypre_TAlloc(HYPRE_Real, global_size, HYPRE_MEMORY_HOST);
+         (solve_data -> local_rhs)   = hypre_TAlloc(HYPRE_Real, num_points, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         hypre_MPI_Comm_free(&sub_comm);
+         hypre_TFree(recv_counts, HYPRE_MEMORY_HOST);
+         hypre_TFree(recv_displs, HYPRE_MEMORY_HOST);
+         hypre_TFree(LU, HYPRE_MEMORY_HOST);
+         hypre_TFree(piv, HYPRE_MEMORY_HOST);
+      }
+
+      hypre_TFree(coef_counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(coef_displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(ids, HYPRE_MEMORY_HOST);
+      hypre_TFree(coefs, HYPRE_MEMORY_HOST);
+      hypre_TFree(map, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      /* no points, nothing to solve */
+      factored = 1;
+   }
+
+   hypre_TFree(local_ids, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_coefs, HYPRE_MEMORY_HOST);
+
+   /* all ranks must agree on whether to use the direct solve */
+   hypre_MPI_Allreduce(&factored, &(solve_data -> factored), 1, HYPRE_MPI_INT,
+                       hypre_MPI_MIN, comm);
+   if (!(solve_data -> factored) && (solve_data -> sub_comm) != hypre_MPI_COMM_NULL)
+   {
+      hypre_MPI_Comm_free(&(solve_data -> sub_comm));
+      hypre_TFree(solve_data -> recv_counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> recv_displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> LU, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> piv, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> rhs, HYPRE_MEMORY_HOST);
+      hypre_TFree(solve_data -> local_rhs, HYPRE_MEMORY_HOST);
+   }
+   (solve_data -> num_points) = num_points;
+
+   hypre_EndTiming(solve_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Solves A x = b for each component of b.  The grid is assumed to be the one
+ * passed to Setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedundantSolve( void               *solve_vdata,
+                      hypre_StructMatrix *A,
+                      hypre_StructVector *b,
+                      hypre_StructVector *x )
+{
+   hypre_RedundantSolveData *solve_data = (hypre_RedundantSolveData *)solve_vdata;
+
+   HYPRE_Int              num_points  = (solve_data -> num_points);
+   HYPRE_Int              global_size = (solve_data -> global_size);
+   HYPRE_Int             *recv_counts = (solve_data -> recv_counts);
+   HYPRE_Int             *recv_displs = (solve_data -> recv_displs);
+   HYPRE_Real            *rhs         = (solve_data -> rhs);
+   HYPRE_Real            *local_rhs   = (solve_data -> local_rhs);
+   HYPRE_Real            *recv_rhs;
+   HYPRE_Int             *counts, *displs;
+
+   hypre_BoxArray        *boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+   HYPRE_Int              ndim  = hypre_StructVectorNDim(x);
+   HYPRE_Int              num_components = hypre_StructVectorNumComponents(x);
+   hypre_Box             *box;
+   hypre_Box             *b_dbox;
+   hypre_Box             *x_dbox;
+   hypre_Index            loop_size, unit_stride;
+   hypre_IndexRef         start;
+   HYPRE_Real            *bp, *xp;
+   HYPRE_Int              i, k, n, p, c, my_id, num_procs, info;
+
+   if (!(solve_data -> factored))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Redundant solve was not set up\n");
+      return hypre_error_flag;
+   }
+   if (num_points == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_BeginTiming(solve_data -> time_index);
+
+   hypre_MPI_Comm_rank(solve_data -> sub_comm, &my_id);
+   hypre_MPI_Comm_size(solve_data -> sub_comm, &num_procs);
+
+   /* with several components, gather all of them in one message per rank
+    * and solve for all right-hand sides at once */
+   recv_rhs = rhs;
+   counts   = recv_counts;
+   displs   = recv_displs;
+   if (num_components > 1)
+   {
+      local_rhs = hypre_TAlloc(HYPRE_Real, num_points*num_components, HYPRE_MEMORY_HOST);
+      rhs       = hypre_TAlloc(HYPRE_Real, global_size*num_components, HYPRE_MEMORY_HOST);
+      recv_rhs  = hypre_TAlloc(HYPRE_Real, global_size*num_components, HYPRE_MEMORY_HOST);
+      counts    = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+      displs    = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+      for (p = 0; p < num_procs; p++)
+      {
+         counts[p] = recv_counts[p] * num_components;
+         displs[p] = recv_displs[p] * num_components;
+      }
+   }
+
+   hypre_SetIndex(unit_stride, 1);
+   /* pack b in Setup order, one component after the other */
+   n = 0;
+   for (c = 0; c < num_components; c++)
+   {
+      hypre_ForBoxI(i, boxes)
+      {
+         box    = hypre_BoxArrayBox(boxes, i);
+         b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+         bp     = hypre_StructVectorBoxDataComponent(b, i, c);
+         start  = hypre_BoxIMin(box);
+         hypre_BoxGetSize(box, loop_size);
+
+         hypre_SerialBoxLoop1Begin(ndim, loop_size, b_dbox, start, unit_stride, bi)
+         {
+            local_rhs[n++] = bp[bi];
+         }
+         hypre_SerialBoxLoop1End(bi)
+      }
+   }
+
+   hypre_MPI_Allgatherv(local_rhs, num_points*num_components, HYPRE_MPI_REAL,
+                        recv_rhs, counts, displs,
+                        HYPRE_MPI_REAL, (solve_data -> sub_comm));
+
+   if (num_components > 1)
+   {
+      /* reorder from [rank][component][point] to [component][rank][point] */
+      for (p = 0; p < num_procs; p++)
+      {
+         for (c = 0; c < num_components; c++)
+         {
+            for (k = 0; k < recv_counts[p]; k++)
+            {
+               rhs[c*global_size + recv_displs[p] + k] =
+                  recv_rhs[displs[p] + c*recv_counts[p] + k];
+            }
+         }
+      }
+   }
+
+   hypre_dgetrs("N", &global_size, &num_components, (solve_data -> LU), &global_size,
+                (solve_data -> piv), rhs, &global_size, &info);
+
+   /* unpack the local part of the solution */
+   for (c = 0; c < num_components; c++)
+   {
+      n = c*global_size + recv_displs[my_id];
+      hypre_ForBoxI(i, boxes)
+      {
+         box    = hypre_BoxArrayBox(boxes, i);
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         xp     = hypre_StructVectorBoxDataComponent(x, i, c);
+         start  = hypre_BoxIMin(box);
+         hypre_BoxGetSize(box, loop_size);
+
+         hypre_SerialBoxLoop1Begin(ndim, loop_size, x_dbox, start, unit_stride, xi)
+         {
+            xp[xi] = rhs[n++];
+         }
+         hypre_SerialBoxLoop1End(xi)
+      }
+   }
+
+   if (num_components > 1)
+   {
+      hypre_TFree(local_rhs, HYPRE_MEMORY_HOST);
+      hypre_TFree(rhs, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_rhs, HYPRE_MEMORY_HOST);
+      hypre_TFree(counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(displs, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_EndTiming(solve_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns whether Setup produced a usable factorization (the same on all
+ * ranks).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedundantSolveGetFactored( void      *solve_vdata,
+                                 HYPRE_Int *factored )
+{
+   hypre_RedundantSolveData *solve_data = (hypre_RedundantSolveData *)solve_vdata;
+
+   *factored = (solve_data -> factored);
+
+   return hypre_error_flag;
+}
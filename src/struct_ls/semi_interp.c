@@ -70,7 +70,8 @@ hypre_SemiInterpSetup( void               *interp_vdata,
    hypre_ComputeInfoProjectSend(compute_info, cindex, stride);
    hypre_ComputeInfoProjectRecv(compute_info, cindex, stride);
    hypre_ComputeInfoProjectComp(compute_info, findex, stride);
-   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(e), 1,
+   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(e),
+                          hypre_StructVectorNumComponents(e),
                           grid, &compute_pkg);
 
    /*----------------------------------------------------------
@@ -135,7 +136,8 @@ hypre_SemiInterp( void               *interp_vdata,
    hypre_StructStencil    *stencil;
    hypre_Index            *stencil_shape;
 
-   HYPRE_Int               compute_i, fi, ci, j;
+   HYPRE_Int               num_components;
+   HYPRE_Int               compute_i, fi, ci, j, c;
    hypre_StructVector     *xc_tmp;
 
    /*-----------------------------------------------------------------------
@@ -156,6 +158,8 @@ hypre_SemiInterp( void               *interp_vdata,
    hypre_assert( constant_coefficient==0 || constant_coefficient==1 );
    /* ... constant_coefficient==2 for P shouldn't happen, see
       hypre_PFMGCreateInterpOp in pfmg_setup_interp.c */
+   num_components = hypre_StructVectorNumComponents(e);
+   hypre_assert( hypre_StructVectorNumComponents(xc) == num_components );
 
    if (constant_coefficient) hypre_StructVectorClearBoundGhostValues(e, 0);
 
@@ -179,6 +183,7 @@ hypre_SemiInterp( void               *interp_vdata,
    {
       xc_tmp = hypre_StructVectorCreate(hypre_MPI_COMM_WORLD, cgrid);
       hypre_StructVectorSetNumGhost(xc_tmp, hypre_StructVectorNumGhost(xc));
+      hypre_StructVectorSetNumComponents(xc_tmp, num_components);
       hypre_StructGridDataLocation(cgrid) = data_location_f;
       hypre_StructVectorInitialize(xc_tmp);
       hypre_StructVectorAssemble(xc_tmp);
@@ -207,20 +212,23 @@ hypre_SemiInterp( void               *interp_vdata,
       e_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(e), fi);
       xc_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(xc), ci);
 
-      ep  = hypre_StructVectorBoxData(e, fi);
-      xcp = hypre_StructVectorBoxData(xc_tmp, ci);
-
       hypre_BoxGetSize(compute_box, loop_size);
 
-#define DEVICE_VAR is_device_ptr(ep,xcp)
-      hypre_BoxLoop2Begin(hypre_StructMatrixNDim(P), loop_size,
-                          e_dbox, start, stride, ei,
-                          xc_dbox, startc, stridec, xci);
+      for (c = 0; c < num_components; c++)
       {
-         ep[ei] = xcp[xci];
-      }
-      hypre_BoxLoop2End(ei, xci);
+         ep  = hypre_StructVectorBoxDataComponent(e, fi, c);
+         xcp = hypre_StructVectorBoxDataComponent(xc_tmp, ci, c);
+
+#define DEVICE_VAR is_device_ptr(ep,xcp)
+         hypre_BoxLoop2Begin(hypre_StructMatrixNDim(P), loop_size,
+                             e_dbox, start, stride, ei,
+                             xc_dbox, startc, stridec, xci);
+         {
+            ep[ei] = xcp[xci];
+         }
+         hypre_BoxLoop2End(ei, xci);
 #undef DEVICE_VAR
+      }
    }
 
    /*-----------------------------------------------------------------------
@@ -276,48 +284,53 @@ hypre_SemiInterp( void               *interp_vdata,
             Pp0 = hypre_StructMatrixBoxData(P, fi, 0);
             Pp1 = hypre_StructMatrixBoxData(P, fi, 1);
          }
-         ep  = hypre_StructVectorBoxData(e, fi);
          ep0_offset = hypre_BoxOffsetDistance(e_dbox, stencil_shape[0]);
          ep1_offset = hypre_BoxOffsetDistance(e_dbox, stencil_shape[1]);
 
-         hypre_ForBoxI(j, compute_box_a)
+         /* the ghost exchange above covers all components */
+         for (c = 0; c < num_components; c++)
          {
-            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+            ep = hypre_StructVectorBoxDataComponent(e, fi, c);
 
-            hypre_CopyIndex(hypre_BoxIMin(compute_box), start);
-            hypre_StructMapFineToCoarse(start, findex, stride, startc);
+            hypre_ForBoxI(j, compute_box_a)
+            {
+               compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
-            hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+               hypre_CopyIndex(hypre_BoxIMin(compute_box), start);
+               hypre_StructMapFineToCoarse(start, findex, stride, startc);
 
-            if ( constant_coefficient )
-            {
-               HYPRE_Complex Pp0val,Pp1val;
-               Pi = hypre_CCBoxIndexRank( P_dbox, startc );
-               Pp0val = Pp0[Pi];
-               Pp1val = Pp1[Pi+Pp1_offset];
+               hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
-#define DEVICE_VAR is_device_ptr(ep)
-               hypre_BoxLoop1Begin(hypre_StructMatrixNDim(P), loop_size,
-                                   e_dbox, start, stride, ei);
+               if ( constant_coefficient )
                {
-                  ep[ei] =  (Pp0val * ep[ei+ep0_offset] +
-                             Pp1val * ep[ei+ep1_offset]);
-               }
-               hypre_BoxLoop1End(ei);
+                  HYPRE_Complex Pp0val,Pp1val;
+                  Pi = hypre_CCBoxIndexRank( P_dbox, startc );
+                  Pp0val = Pp0[Pi];
+                  Pp1val = Pp1[Pi+Pp1_offset];
+
+#define DEVICE_VAR is_device_ptr(ep)
+                  hypre_BoxLoop1Begin(hypre_StructMatrixNDim(P), loop_size,
+                                      e_dbox, start, stride, ei);
+                  {
+                     ep[ei] =  (Pp0val * ep[ei+ep0_offset] +
+                                Pp1val * ep[ei+ep1_offset]);
+                  }
+                  hypre_BoxLoop1End(ei);
 #undef DEVICE_VAR
-            }
-            else
-            {
-#define DEVICE_VAR is_device_ptr(ep,Pp0,Pp1)
-               hypre_BoxLoop2Begin(hypre_StructMatrixNDim(P), loop_size,
-                                   P_dbox, startc, stridec, Pi,
-                                   e_dbox, start, stride, ei);
-               {
-                  ep[ei] =  (Pp0[Pi]            * ep[ei+ep0_offset] +
-                             Pp1[Pi+Pp1_offset] * ep[ei+ep1_offset]);
                }
-               hypre_BoxLoop2End(Pi, ei);
+               else
+               {
+#define DEVICE_VAR is_device_ptr(ep,Pp0,Pp1)
+                  hypre_BoxLoop2Begin(hypre_StructMatrixNDim(P), loop_size,
+                                      P_dbox, startc, stridec, Pi,
+                                      e_dbox, start, stride, ei);
+                  {
+                     ep[ei] =  (Pp0[Pi]            * ep[ei+ep0_offset] +
+                                Pp1[Pi+Pp1_offset] * ep[ei+ep1_offset]);
+                  }
+                  hypre_BoxLoop2End(Pi, ei);
 #undef DEVICE_VAR
+               }
             }
          }
       }
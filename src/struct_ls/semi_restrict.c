@@ -70,7 +70,8 @@ hypre_SemiRestrictSetup( void               *restrict_vdata,
    hypre_ComputeInfoProjectSend(compute_info, findex, stride);
    hypre_ComputeInfoProjectRecv(compute_info, findex, stride);
    hypre_ComputeInfoProjectComp(compute_info, cindex, stride);
-   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(r), 1,
+   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(r),
+                          hypre_StructVectorNumComponents(r),
                           grid, &compute_pkg);
 
    /*----------------------------------------------------------
@@ -133,7 +134,8 @@ hypre_SemiRestrict( void               *restrict_vdata,
    hypre_StructStencil    *stencil;
    hypre_Index            *stencil_shape;
 
-   HYPRE_Int               compute_i, fi, ci, j;
+   HYPRE_Int               num_components;
+   HYPRE_Int               compute_i, fi, ci, j, c;
    hypre_StructVector     *rc_tmp;
    /*-----------------------------------------------------------------------
     * Initialize some things.
@@ -150,6 +152,8 @@ hypre_SemiRestrict( void               *restrict_vdata,
    stencil_shape = hypre_StructStencilShape(stencil);
    constant_coefficient = hypre_StructMatrixConstantCoefficient(R);
    hypre_assert( constant_coefficient==0 || constant_coefficient==1 );
+   num_components = hypre_StructVectorNumComponents(r);
+   hypre_assert( hypre_StructVectorNumComponents(rc) == num_components );
    /* ... if A has constant_coefficient==2, R has constant_coefficient==0 */
 
    if (constant_coefficient) hypre_StructVectorClearBoundGhostValues(r, 0);
@@ -174,6 +178,7 @@ hypre_SemiRestrict( void               *restrict_vdata,
    {
       rc_tmp = hypre_StructVectorCreate(hypre_MPI_COMM_WORLD, cgrid);
       hypre_StructVectorSetNumGhost(rc_tmp, hypre_StructVectorNumGhost(rc));
+      hypre_StructVectorSetNumComponents(rc_tmp, num_components);
       hypre_StructGridDataLocation(cgrid) = data_location_f;
       hypre_StructVectorInitialize(rc_tmp);
       hypre_StructVectorAssemble(rc_tmp);
@@ -243,51 +248,56 @@ hypre_SemiRestrict( void               *restrict_vdata,
             Rp0 = hypre_StructMatrixBoxData(R, fi, 0);
             Rp1 = hypre_StructMatrixBoxData(R, fi, 1);
          }
-         rp  = hypre_StructVectorBoxData(r, fi);
          rp0_offset = hypre_BoxOffsetDistance(r_dbox, stencil_shape[0]);
          rp1_offset = hypre_BoxOffsetDistance(r_dbox, stencil_shape[1]);
-         rcp = hypre_StructVectorBoxData(rc_tmp, ci);
 
-         hypre_ForBoxI(j, compute_box_a)
+         /* the ghost exchange above covers all components */
+         for (c = 0; c < num_components; c++)
          {
-            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+            rp  = hypre_StructVectorBoxDataComponent(r, fi, c);
+            rcp = hypre_StructVectorBoxDataComponent(rc_tmp, ci, c);
 
-            start  = hypre_BoxIMin(compute_box);
-            hypre_StructMapFineToCoarse(start, cindex, stride, startc);
+            hypre_ForBoxI(j, compute_box_a)
+            {
+               compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
-            hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+               start  = hypre_BoxIMin(compute_box);
+               hypre_StructMapFineToCoarse(start, cindex, stride, startc);
 
-            if ( constant_coefficient )
-            {
-               HYPRE_Complex Rp0val,Rp1val;
-               Ri = hypre_CCBoxIndexRank( R_dbox, startc );
+               hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
-               Rp0val = Rp0[Ri+Rp0_offset];
-               Rp1val = Rp1[Ri];
-#define DEVICE_VAR is_device_ptr(rcp,rp)
-               hypre_BoxLoop2Begin(hypre_StructMatrixNDim(R), loop_size,
-                                   r_dbox,  start,  stride,  ri,
-                                   rc_dbox, startc, stridec, rci);
+               if ( constant_coefficient )
                {
-                  rcp[rci] = rp[ri] + (Rp0val * rp[ri+rp0_offset] +
-                                       Rp1val * rp[ri+rp1_offset]);
-               }
-               hypre_BoxLoop2End(ri, rci);
+                  HYPRE_Complex Rp0val,Rp1val;
+                  Ri = hypre_CCBoxIndexRank( R_dbox, startc );
+
+                  Rp0val = Rp0[Ri+Rp0_offset];
+                  Rp1val = Rp1[Ri];
+#define DEVICE_VAR is_device_ptr(rcp,rp)
+                  hypre_BoxLoop2Begin(hypre_StructMatrixNDim(R), loop_size,
+                                      r_dbox,  start,  stride,  ri,
+                                      rc_dbox, startc, stridec, rci);
+                  {
+                     rcp[rci] = rp[ri] + (Rp0val * rp[ri+rp0_offset] +
+                                          Rp1val * rp[ri+rp1_offset]);
+                  }
+                  hypre_BoxLoop2End(ri, rci);
 #undef DEVICE_VAR
-            }
-            else
-            {
-#define DEVICE_VAR is_device_ptr(rcp,rp,Rp0,Rp1)
-               hypre_BoxLoop3Begin(hypre_StructMatrixNDim(R), loop_size,
-                                   R_dbox,  startc, stridec, Ri,
-                                   r_dbox,  start,  stride,  ri,
-                                   rc_dbox, startc, stridec, rci);
-               {
-                  rcp[rci] = rp[ri] + (Rp0[Ri+Rp0_offset] * rp[ri+rp0_offset] +
-                                       Rp1[Ri]            * rp[ri+rp1_offset]);
                }
-               hypre_BoxLoop3End(Ri, ri, rci);
+               else
+               {
+#define DEVICE_VAR is_device_ptr(rcp,rp,Rp0,Rp1)
+                  hypre_BoxLoop3Begin(hypre_StructMatrixNDim(R), loop_size,
+                                      R_dbox,  startc, stridec, Ri,
+                                      r_dbox,  start,  stride,  ri,
+                                      rc_dbox, startc, stridec, rci);
+                  {
+                     rcp[rci] = rp[ri] + (Rp0[Ri+Rp0_offset] * rp[ri+rp0_offset] +
+                                          Rp1[Ri]            * rp[ri+rp1_offset]);
+                  }
+                  hypre_BoxLoop3End(Ri, ri, rci);
 #undef DEVICE_VAR
+               }
             }
          }
       }
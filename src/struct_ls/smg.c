@@ -31,6 +31,7 @@ hypre_SMGCreate( MPI_Comm  comm )
    (smg_data -> max_levels) = 0;
    (smg_data -> num_pre_relax)  = 1;
    (smg_data -> num_post_relax) = 1;
+   (smg_data -> redundant_size) = 0;
    (smg_data -> cdir) = 2;
    hypre_SetIndex3((smg_data -> base_index), 0, 0, 0);
    hypre_SetIndex3((smg_data -> base_stride), 1, 1, 1);
@@ -79,6 +80,7 @@ hypre_SMGDestroy( void *smg_vdata )
          {
             hypre_SMGResidualDestroy(smg_data -> residual_data_l[l]);
          }
+         hypre_RedundantSolveDestroy(smg_data -> coarse_solve_data);
          hypre_TFree(smg_data -> relax_data_l, HYPRE_MEMORY_HOST);
          hypre_TFree(smg_data -> residual_data_l, HYPRE_MEMORY_HOST);
          hypre_TFree(smg_data -> restrict_data_l, HYPRE_MEMORY_HOST);
@@ -155,6 +157,31 @@ hypre_SMGGetMemoryUse( void *smg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGSetRedundantSize( void *smg_vdata,
+                           HYPRE_Int   redundant_size )
+{
+   hypre_SMGData *smg_data = (hypre_SMGData *)smg_vdata;
+
+   (smg_data -> redundant_size) = redundant_size;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SMGGetRedundantSize( void *smg_vdata,
+                           HYPRE_Int * redundant_size )
+{
+   hypre_SMGData *smg_data = (hypre_SMGData *)smg_vdata;
+
+   *redundant_size = (smg_data -> redundant_size);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -33,6 +33,7 @@ typedef struct
 
    HYPRE_Int             num_pre_relax;  /* number of pre relaxation sweeps */
    HYPRE_Int             num_post_relax; /* number of post relaxation sweeps */
+   HYPRE_Int             redundant_size; /* max coarsest grid size solved redundantly */
 
    HYPRE_Int             cdir;  /* coarsening direction */
 
@@ -61,6 +62,7 @@ typedef struct
    void                **residual_data_l;
    void                **restrict_data_l;
    void                **interp_data_l;
+   void                 *coarse_solve_data;
 
    /* log info (always logged) */
    HYPRE_Int             num_iterations;
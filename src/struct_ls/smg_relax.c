@@ -49,6 +49,8 @@ typedef struct
                                       A_rem = A - A_sol                  */
    void                  **residual_data;  /* Array of size `num_spaces' */
    void                  **solve_data;     /* Array of size `num_spaces' */
+   HYPRE_Int               line_solve;     /* 1 if solve_data are batched
+                                              line solvers (stencil_dim 2) */
 
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
@@ -158,6 +160,8 @@ hypre_SMGRelaxDestroyASol( void *relax_vdata )
       {
          if (stencil_dim > 2)
             hypre_SMGDestroy(relax_data -> solve_data[i]);
+         else if (relax_data -> line_solve)
+            hypre_LineSolveDestroy(relax_data -> solve_data[i]);
          else
             hypre_CyclicReductionDestroy(relax_data -> solve_data[i]);
       }
@@ -305,6 +309,10 @@ hypre_SMGRelax( void               *relax_vdata,
 	    {
                hypre_SMGSolve(solve_data[is], A_sol, temp_vec, x);
 	    }
+            else if (relax_data -> line_solve)
+            {
+               hypre_LineSolve(solve_data[is], A_sol, temp_vec, x);
+            }
             else
 	    {
                hypre_CyclicReduction(solve_data[is], A_sol, temp_vec, x);
@@ -569,6 +577,14 @@ hypre_SMGRelaxSetupASol( void               *relax_vdata,
    hypre_StructStencilNDim(hypre_StructMatrixStencil(A_sol)) = stencil_dim - 1;
    hypre_TFree(stencil_indices, HYPRE_MEMORY_HOST);
 
+   /* Solve independent lines with the batched solver when possible */
+   (relax_data -> line_solve) = 0;
+   if (stencil_dim == 2)
+   {
+      hypre_LineSolveIsApplicable(relax_data -> comm, A_sol, 0, base_stride,
+                                  &(relax_data -> line_solve));
+   }
+
    /* Set up solve_data */
    solve_data    = hypre_TAlloc(void *,  num_spaces, HYPRE_MEMORY_HOST);
 
@@ -589,6 +605,12 @@ hypre_SMGRelaxSetupASol( void               *relax_vdata,
          hypre_StructSMGSetMaxLevel(solve_data[i], (relax_data -> max_level));	 
          hypre_SMGSetup(solve_data[i], A_sol, temp_vec, x);
       }
+      else if (relax_data -> line_solve)
+      {
+         solve_data[i] = hypre_LineSolveCreate(relax_data -> comm);
+         hypre_LineSolveSetBase(solve_data[i], base_index, base_stride);
+         hypre_LineSolveSetup(solve_data[i], A_sol, temp_vec, x);
+      }
       else
       {
          solve_data[i] = hypre_CyclicReductionCreate(relax_data -> comm);
@@ -8,6 +8,12 @@
 #include "_hypre_struct_ls.h"
 #include "_hypre_struct_mv.hpp"
 
+/* this currently cannot be greater than 7 */
+#ifdef MAX_DEPTH
+#undef MAX_DEPTH
+#endif
+#define MAX_DEPTH 7
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -135,7 +141,10 @@ hypre_SMGResidual( void               *residual_vdata,
    hypre_Box              *b_data_box;
    hypre_Box              *r_data_box;
 
-   HYPRE_Real             *Ap;
+   HYPRE_Real             *Ap0 = NULL, *Ap1 = NULL, *Ap2 = NULL, *Ap3 = NULL;
+   HYPRE_Real             *Ap4 = NULL, *Ap5 = NULL, *Ap6 = NULL;
+   HYPRE_Int               xoff0 = 0, xoff1 = 0, xoff2 = 0, xoff3 = 0;
+   HYPRE_Int               xoff4 = 0, xoff5 = 0, xoff6 = 0;
    HYPRE_Real             *xp;
    HYPRE_Real             *bp;
    HYPRE_Real             *rp;
@@ -147,7 +156,7 @@ hypre_SMGResidual( void               *residual_vdata,
    hypre_Index            *stencil_shape;
    HYPRE_Int               stencil_size;
 
-   HYPRE_Int               compute_i, i, j, si;
+   HYPRE_Int               compute_i, i, j, si, depth;
 
    hypre_BeginTiming(residual_data -> time_index);
 
@@ -222,6 +231,7 @@ hypre_SMGResidual( void               *residual_vdata,
          x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
          r_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(r), i);
 
+         xp = hypre_StructVectorBoxData(x, i);
          rp = hypre_StructVectorBoxData(r, i);
 
          hypre_ForBoxI(j, compute_box_a)
@@ -230,26 +240,181 @@ hypre_SMGResidual( void               *residual_vdata,
 
             start  = hypre_BoxIMin(compute_box);
 
-            for (si = 0; si < stencil_size; si++)
+            hypre_BoxGetStrideSize(compute_box, base_stride, loop_size);
+
+            /* unroll up to depth MAX_DEPTH, so that r is read and written
+             * once per group of stencil entries instead of once per entry;
+             * the terms are subtracted one at a time in stencil order, so
+             * the result matches the one-entry-per-pass loop exactly */
+            for (si = 0; si < stencil_size; si += MAX_DEPTH)
             {
-               Ap = hypre_StructMatrixBoxData(A, i, si);
-               xp = hypre_StructVectorBoxData(x, i);
-//RL:PTROFFSET
-               HYPRE_Int xp_off = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
-
-               hypre_BoxGetStrideSize(compute_box, base_stride,
-                                      loop_size);
-
-#define DEVICE_VAR is_device_ptr(rp,Ap,xp)
-               hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                   A_data_box, start, base_stride, Ai,
-                                   x_data_box, start, base_stride, xi,
-                                   r_data_box, start, base_stride, ri);
+               depth = hypre_min(MAX_DEPTH, (stencil_size - si));
+
+               switch(depth)
                {
-                  rp[ri] -= Ap[Ai] * xp[xi+xp_off];
+                  case 7:
+                     Ap6 = hypre_StructMatrixBoxData(A, i, si+6);
+                     xoff6 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si+6]);
+                     /* fall through */
+
+                  case 6:
+                     Ap5 = hypre_StructMatrixBoxData(A, i, si+5);
+                     xoff5 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si+5]);
+                     /* fall through */
+
+                  case 5:
+                     Ap4 = hypre_StructMatrixBoxData(A, i, si+4);
+                     xoff4 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si+4]);
+                     /* fall through */
+
+                  case 4:
+                     Ap3 = hypre_StructMatrixBoxData(A, i, si+3);
+                     xoff3 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si+3]);
+                     /* fall through */
+
+                  case 3:
+                     Ap2 = hypre_StructMatrixBoxData(A, i, si+2);
+                     xoff2 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si+2]);
+                     /* fall through */
+
+                  case 2:
+                     Ap1 = hypre_StructMatrixBoxData(A, i, si+1);
+                     xoff1 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si+1]);
+                     /* fall through */
+
+                  case 1:
+                     Ap0 = hypre_StructMatrixBoxData(A, i, si+0);
+                     xoff0 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si+0]);
+                     /* fall through */
+
+                  case 0:
+                     break;
                }
-               hypre_BoxLoop3End(Ai, xi, ri);
+
+               switch(depth)
+               {
+                  case 7:
+#define DEVICE_VAR is_device_ptr(rp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6,xp)
+                     hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                                         A_data_box, start, base_stride, Ai,
+                                         x_data_box, start, base_stride, xi,
+                                         r_data_box, start, base_stride, ri);
+                     {
+                        rp[ri] = rp[ri] -
+                           Ap0[Ai] * xp[xi + xoff0] -
+                           Ap1[Ai] * xp[xi + xoff1] -
+                           Ap2[Ai] * xp[xi + xoff2] -
+                           Ap3[Ai] * xp[xi + xoff3] -
+                           Ap4[Ai] * xp[xi + xoff4] -
+                           Ap5[Ai] * xp[xi + xoff5] -
+                           Ap6[Ai] * xp[xi + xoff6];
+                     }
+                     hypre_BoxLoop3End(Ai, xi, ri);
+#undef DEVICE_VAR
+                     break;
+
+                  case 6:
+#define DEVICE_VAR is_device_ptr(rp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,xp)
+                     hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                                         A_data_box, start, base_stride, Ai,
+                                         x_data_box, start, base_stride, xi,
+                                         r_data_box, start, base_stride, ri);
+                     {
+                        rp[ri] = rp[ri] -
+                           Ap0[Ai] * xp[xi + xoff0] -
+                           Ap1[Ai] * xp[xi + xoff1] -
+                           Ap2[Ai] * xp[xi + xoff2] -
+                           Ap3[Ai] * xp[xi + xoff3] -
+                           Ap4[Ai] * xp[xi + xoff4] -
+                           Ap5[Ai] * xp[xi + xoff5];
+                     }
+                     hypre_BoxLoop3End(Ai, xi, ri);
 #undef DEVICE_VAR
+                     break;
+
+                  case 5:
+#define DEVICE_VAR is_device_ptr(rp,Ap0,Ap1,Ap2,Ap3,Ap4,xp)
+                     hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                                         A_data_box, start, base_stride, Ai,
+                                         x_data_box, start, base_stride, xi,
+                                         r_data_box, start, base_stride, ri);
+                     {
+                        rp[ri] = rp[ri] -
+                           Ap0[Ai] * xp[xi + xoff0] -
+                           Ap1[Ai] * xp[xi + xoff1] -
+                           Ap2[Ai] * xp[xi + xoff2] -
+                           Ap3[Ai] * xp[xi + xoff3] -
+                           Ap4[Ai] * xp[xi + xoff4];
+                     }
+                     hypre_BoxLoop3End(Ai, xi, ri);
+#undef DEVICE_VAR
+                     break;
+
+                  case 4:
+#define DEVICE_VAR is_device_ptr(rp,Ap0,Ap1,Ap2,Ap3,xp)
+                     hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                                         A_data_box, start, base_stride, Ai,
+                                         x_data_box, start, base_stride, xi,
+                                         r_data_box, start, base_stride, ri);
+                     {
+                        rp[ri] = rp[ri] -
+                           Ap0[Ai] * xp[xi + xoff0] -
+                           Ap1[Ai] * xp[xi + xoff1] -
+                           Ap2[Ai] * xp[xi + xoff2] -
+                           Ap3[Ai] * xp[xi + xoff3];
+                     }
+                     hypre_BoxLoop3End(Ai, xi, ri);
+#undef DEVICE_VAR
+                     break;
+
+                  case 3:
+#define DEVICE_VAR is_device_ptr(rp,Ap0,Ap1,Ap2,xp)
+                     hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                                         A_data_box, start, base_stride, Ai,
+                                         x_data_box, start, base_stride, xi,
+                                         r_data_box, start, base_stride, ri);
+                     {
+                        rp[ri] = rp[ri] -
+                           Ap0[Ai] * xp[xi + xoff0] -
+                           Ap1[Ai] * xp[xi + xoff1] -
+                           Ap2[Ai] * xp[xi + xoff2];
+                     }
+                     hypre_BoxLoop3End(Ai, xi, ri);
+#undef DEVICE_VAR
+                     break;
+
+                  case 2:
+#define DEVICE_VAR is_device_ptr(rp,Ap0,Ap1,xp)
+                     hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                                         A_data_box, start, base_stride, Ai,
+                                         x_data_box, start, base_stride, xi,
+                                         r_data_box, start, base_stride, ri);
+                     {
+                        rp[ri] = rp[ri] -
+                           Ap0[Ai] * xp[xi + xoff0] -
+                           Ap1[Ai] * xp[xi + xoff1];
+                     }
+                     hypre_BoxLoop3End(Ai, xi, ri);
+#undef DEVICE_VAR
+                     break;
+
+                  case 1:
+#define DEVICE_VAR is_device_ptr(rp,Ap0,xp)
+                     hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
+                                         A_data_box, start, base_stride, Ai,
+                                         x_data_box, start, base_stride, xi,
+                                         r_data_box, start, base_stride, ri);
+                     {
+                        rp[ri] = rp[ri] -
+                           Ap0[Ai] * xp[xi + xoff0];
+                     }
+                     hypre_BoxLoop3End(Ai, xi, ri);
+#undef DEVICE_VAR
+                     break;
+
+                  case 0:
+                     break;
+               }
             }
          }
       }
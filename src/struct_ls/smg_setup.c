@@ -27,6 +27,8 @@ hypre_SMGSetup( void               *smg_vdata,
 
    HYPRE_Int             n_pre   = (smg_data -> num_pre_relax);
    HYPRE_Int             n_post  = (smg_data -> num_post_relax);
+   HYPRE_Int             redundant_size = hypre_min((smg_data -> redundant_size),
+                                                    hypre_REDUNDANT_MAX_SIZE);
 
    HYPRE_Int             max_iter;
    HYPRE_Int             max_levels;
@@ -69,6 +71,7 @@ hypre_SMGSetup( void               *smg_vdata,
    void                **residual_data_l;
    void                **restrict_data_l;
    void                **interp_data_l;
+   void                 *coarse_solve_data = NULL;
 
    hypre_StructGrid     *grid;
 
@@ -89,6 +92,13 @@ hypre_SMGSetup( void               *smg_vdata,
    HYPRE_Int             max_box_size  = 0;
    HYPRE_Int             device_level  = (smg_data -> devicelevel);
 #endif
+   if (hypre_StructVectorNumComponents(b) > 1 || hypre_StructVectorNumComponents(x) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "SMG does not support multi-component vectors\n");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------
     * Set up coarsening direction
     *-----------------------------------------------------*/
@@ -142,7 +152,9 @@ hypre_SMGSetup( void               *smg_vdata,
 
       /* check to see if we should coarsen */
       if ( ( hypre_BoxIMinD(cbox, cdir) == hypre_BoxIMaxD(cbox, cdir) ) ||
-           (l == (max_levels - 1)) )
+           (l == (max_levels - 1)) ||
+           (l > 0 && redundant_size > 0 &&
+            hypre_BoxVolume(cbox) <= redundant_size) )
       {
          /* stop coarsening */
          break;
@@ -538,6 +550,23 @@ hypre_SMGSetup( void               *smg_vdata,
    hypre_SMGRelaxSetNumPostRelax( relax_data_l[l], n_post);
    hypre_SMGRelaxSetup(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
 
+   /* set up the redundant coarsest grid solve */
+   if (l > 0 && redundant_size > 0 &&
+       hypre_BoxVolume(hypre_StructGridBoundingBox(grid_l[l])) <= redundant_size)
+   {
+      HYPRE_Int factored;
+
+      coarse_solve_data = hypre_RedundantSolveCreate(comm);
+      hypre_RedundantSolveSetup(coarse_solve_data, A_l[l], b_l[l], x_l[l]);
+      hypre_RedundantSolveGetFactored(coarse_solve_data, &factored);
+      if (!factored)
+      {
+         /* singular coarse problem, keep the coarsest grid relaxation */
+         hypre_RedundantSolveDestroy(coarse_solve_data);
+         coarse_solve_data = NULL;
+      }
+   }
+
    /* set up the residual routine in case of a single grid level */
    if( l == 0 )
    {
@@ -556,6 +585,7 @@ hypre_SMGSetup( void               *smg_vdata,
    hypre_StructVectorAssemble(x_l[0]);
 
    (smg_data -> relax_data_l)      = relax_data_l;
+   (smg_data -> coarse_solve_data) = coarse_solve_data;
    (smg_data -> residual_data_l)   = residual_data_l;
    (smg_data -> restrict_data_l)   = restrict_data_l;
    (smg_data -> interp_data_l)     = interp_data_l;
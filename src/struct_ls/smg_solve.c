@@ -68,6 +68,7 @@ hypre_SMGSolve( void               *smg_vdata,
    hypre_StructVector  **r_l             = (smg_data -> r_l);
    hypre_StructVector  **e_l             = (smg_data -> e_l);
    void                **relax_data_l    = (smg_data -> relax_data_l);
+   void                 *coarse_solve_data = (smg_data -> coarse_solve_data);
    void                **residual_data_l = (smg_data -> residual_data_l);
    void                **restrict_data_l = (smg_data -> restrict_data_l);
    void                **interp_data_l   = (smg_data -> interp_data_l);
@@ -88,6 +89,19 @@ hypre_SMGSolve( void               *smg_vdata,
     * Initialize some things and deal with special cases
     *-----------------------------------------------------*/
 
+   if (A_l == NULL)
+   {
+      /* the setup failed or was not called */
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "SMG setup has not been completed\n");
+      return hypre_error_flag;
+   }
+   if (hypre_StructVectorNumComponents(b) > 1 || hypre_StructVectorNumComponents(x) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "SMG does not support multi-component vectors\n");
+      return hypre_error_flag;
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_BeginTiming(smg_data -> time_index);
 
@@ -239,8 +253,15 @@ hypre_SMGSolve( void               *smg_vdata,
           * Bottom
           *--------------------------------------------------*/
 
-         hypre_SMGRelaxSetZeroGuess(relax_data_l[l], 1);
-         hypre_SMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
+         if (coarse_solve_data)
+         {
+            hypre_RedundantSolve(coarse_solve_data, A_l[l], b_l[l], x_l[l]);
+         }
+         else
+         {
+            hypre_SMGRelaxSetZeroGuess(relax_data_l[l], 1);
+            hypre_SMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
+         }
 #if DEBUG
          if(hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) == 3)
          {
@@ -115,6 +115,12 @@ hypre_SparseMSGSetup( void               *smsg_vdata,
    char                  filename[255];
 #endif
 
+   if (hypre_StructVectorNumComponents(b) > 1 || hypre_StructVectorNumComponents(x) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "SparseMSG does not support multi-component vectors\n");
+      return hypre_error_flag;
+   }
 
    /*-----------------------------------------------------
     * Set up coarse grids
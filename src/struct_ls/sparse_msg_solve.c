@@ -84,6 +84,19 @@ hypre_SparseMSGSolve( void               *smsg_vdata,
     * Initialize some things and deal with special cases
     *-----------------------------------------------------*/
 
+   if (A_array == NULL)
+   {
+      /* the setup failed or was not called */
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "SparseMSG setup has not been completed\n");
+      return hypre_error_flag;
+   }
+   if (hypre_StructVectorNumComponents(b) > 1 || hypre_StructVectorNumComponents(x) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "SparseMSG does not support multi-component vectors\n");
+      return hypre_error_flag;
+   }
+
    hypre_BeginTiming(smsg_data -> time_index);
 
    hypre_StructMatrixDestroy(A_array[0]);
@@ -520,6 +520,28 @@ HYPRE_Int HYPRE_StructVectorPrint(const char         *filename,
                                   HYPRE_StructVector  vector,
                                   HYPRE_Int           all);
 
+/**
+ * (Optional) Set the number of vectors (components) stored in the vector
+ * object, e.g., one per right-hand side.  Must be called before
+ * \ref HYPRE_StructVectorInitialize.  The default is 1.
+ *
+ * Vector operations, matrix-vector products and the PFMG solver act on all
+ * components at once, with one ghost exchange for all of them.  The routines
+ * for setting and getting values access component 0 only; use
+ * \ref HYPRE_StructVectorCopyComponent to move data between components.
+ **/
+HYPRE_Int HYPRE_StructVectorSetNumComponents(HYPRE_StructVector vector,
+                                             HYPRE_Int          num_components);
+
+/**
+ * Copy component \e x_comp of \e x into component \e y_comp of \e y.  The
+ * two vectors must be defined on the same grid.
+ **/
+HYPRE_Int HYPRE_StructVectorCopyComponent(HYPRE_StructVector x,
+                                          HYPRE_Int          x_comp,
+                                          HYPRE_StructVector y,
+                                          HYPRE_Int          y_comp);
+
 /**@}*/
 /**@}*/
 
@@ -323,6 +323,30 @@ HYPRE_StructVectorCopy( HYPRE_StructVector x, HYPRE_StructVector y )
    return( hypre_StructVectorCopy( x, y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorSetNumComponents
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorSetNumComponents( HYPRE_StructVector  vector,
+                                    HYPRE_Int           num_components )
+{
+   return ( hypre_StructVectorSetNumComponents(vector, num_components) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorCopyComponent
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorCopyComponent( HYPRE_StructVector  x,
+                                 HYPRE_Int           x_comp,
+                                 HYPRE_StructVector  y,
+                                 HYPRE_Int           y_comp )
+{
+   return ( hypre_StructVectorCopyComponent(x, x_comp, y, y_comp) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_StructVectorSetConstantValues
  *--------------------------------------------------------------------------*/
@@ -803,6 +803,22 @@ typedef struct hypre_BoxManEntry_struct
 
 } hypre_BoxManEntry;
 
+/*--------------------------------------------------------------------------
+ * BoxManTreeNode: node of the bounding box hierarchy (spatial index)
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_Index imin; /* Extents of all entries below this node */
+   hypre_Index imax;
+
+   HYPRE_Int child; /* Position of the first of two (adjacent) children in the
+                     * node array, or -1 for a leaf */
+   HYPRE_Int first; /* Leaf entries are tree_entries[first, first+count) */
+   HYPRE_Int count;
+
+} hypre_BoxManTreeNode;
+
 /*---------------------------------------------------------------------------
  * Box Manager: organizes arbitrary information in a spatial way
  *----------------------------------------------------------------------------*/
@@ -872,6 +888,17 @@ typedef struct
    HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
                                                     indexes map */
 
+   /* Alternatively, the entries are organized by a bounding box hierarchy.
+      The index table has one cell per combination of box coordinates, so it
+      grows like nentries^ndim and is expensive to build for many small boxes,
+      while the hierarchy answers an intersection in O(log(nentries)) */
+   HYPRE_Int             spatial_index; /* Use the hierarchy instead of the
+                                           index table: 1 = always, 0 = never,
+                                           -1 = for many entries (default) */
+   HYPRE_Int             num_tree_nodes;
+   hypre_BoxManTreeNode *tree_nodes; /* Root is tree_nodes[0] */
+   HYPRE_Int            *tree_entries; /* Positions in 'entries', leaf order */
+
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */ 
    hypre_BoxManEntry **my_entries; /* Points into entries that are mine and
@@ -928,6 +955,11 @@ typedef struct
 #define hypre_BoxManSize(manager)               ((manager) -> size)
 #define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
 
+#define hypre_BoxManSpatialIndex(manager)       ((manager) -> spatial_index)
+#define hypre_BoxManNumTreeNodes(manager)       ((manager) -> num_tree_nodes)
+#define hypre_BoxManTreeNodes(manager)          ((manager) -> tree_nodes)
+#define hypre_BoxManTreeEntries(manager)        ((manager) -> tree_entries)
+
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
 #define hypre_BoxManMyEntries(manager)          ((manager) -> my_entries)
@@ -960,6 +992,16 @@ typedef struct
 #define hypre_BoxManEntryNext(entry)     ((entry) -> next)
 #define hypre_BoxManEntryBoxMan(entry)   ((entry) -> boxman)
 
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_BoxManTreeNode
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BoxManTreeNodeIMin(node)   ((node) -> imin)
+#define hypre_BoxManTreeNodeIMax(node)   ((node) -> imax)
+#define hypre_BoxManTreeNodeChild(node)  ((node) -> child)
+#define hypre_BoxManTreeNodeFirst(node)  ((node) -> first)
+#define hypre_BoxManTreeNodeCount(node)  ((node) -> count)
+
 #endif
 /******************************************************************************
  * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
@@ -1169,6 +1211,10 @@ typedef struct hypre_CommType_struct
    HYPRE_Int            *rem_boxnums; /* entry remote box numbers */
    hypre_Box            *rem_boxes;   /* entry remote boxes */
 
+   /* true if the message is a single contiguous piece of user data that can
+    * be sent or received in place without packing (set by persistent setup) */
+   HYPRE_Int             direct;
+
 } hypre_CommType;
 
 /*--------------------------------------------------------------------------
@@ -1215,6 +1261,17 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* persistent mode: buffers and MPI requests are kept between exchanges */
+   HYPRE_Int           persistent;        /* use persistent mode if possible */
+   HYPRE_Int           persistent_setup;  /* is the persistent state set up? */
+   HYPRE_Int           persistent_active; /* is an exchange in progress? */
+   HYPRE_Int           persistent_tag;    /* tag of the persistent requests */
+   HYPRE_Int           num_persistent;    /* number of persistent requests */
+   hypre_MPI_Request  *requests;          /* persistent, then direct requests */
+   hypre_MPI_Status   *status;
+   HYPRE_Complex     **send_buffers;
+   HYPRE_Complex     **recv_buffers;
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -1241,6 +1298,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* true if requests and buffers are owned by comm_pkg */
+   HYPRE_Int          persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -1292,6 +1352,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommTypeRemBoxnum(type, i)  (type -> rem_boxnums[i])
 #define hypre_CommTypeRemBoxes(type)      (type -> rem_boxes)
 #define hypre_CommTypeRemBox(type, i)   (&(type -> rem_boxes[i]))
+#define hypre_CommTypeDirect(type)        (type -> direct)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommPkg
@@ -1334,6 +1395,16 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistent(comm_pkg)                 (comm_pkg -> persistent)
+#define hypre_CommPkgPersistentSetup(comm_pkg)            (comm_pkg -> persistent_setup)
+#define hypre_CommPkgPersistentActive(comm_pkg)           (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgNumPersistent(comm_pkg)              (comm_pkg -> num_persistent)
+#define hypre_CommPkgRequests(comm_pkg)                   (comm_pkg -> requests)
+#define hypre_CommPkgStatus(comm_pkg)                     (comm_pkg -> status)
+#define hypre_CommPkgSendBuffers(comm_pkg)                (comm_pkg -> send_buffers)
+#define hypre_CommPkgRecvBuffers(comm_pkg)                (comm_pkg -> recv_buffers)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1347,6 +1418,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffers(comm_handle)          (comm_handle -> send_buffers)
 #define hypre_CommHandleRecvBuffers(comm_handle)          (comm_handle -> recv_buffers)
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_device)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_device)
 
@@ -1557,6 +1629,10 @@ typedef struct hypre_StructVector_struct
    HYPRE_Complex        *data;         /* Pointer to vector data on device*/
    HYPRE_Int             data_alloced; /* Boolean used for freeing data */
    HYPRE_Int             data_size;    /* Size of vector data */
+   HYPRE_Int             num_components; /* Number of vectors stored; the
+                                            components of box b are stored
+                                            one after the other, each over
+                                            the full data box of b */
    HYPRE_Int            *data_indices; /* num-boxes array of indices into
                                           the data array.  data_indices[b]
                                           is the starting index of vector
@@ -1583,6 +1659,7 @@ typedef struct hypre_StructVector_struct
 #define hypre_StructVectorDataAlloced(vector)   ((vector) -> data_alloced)
 #define hypre_StructVectorDataSize(vector)      ((vector) -> data_size)
 #define hypre_StructVectorDataIndices(vector)   ((vector) -> data_indices)
+#define hypre_StructVectorNumComponents(vector) ((vector) -> num_components)
 #define hypre_StructVectorNumGhost(vector)      ((vector) -> num_ghost)
 #define hypre_StructVectorBGhostNotClear(vector)((vector) -> bghost_not_clear)
 #define hypre_StructVectorGlobalSize(vector)    ((vector) -> global_size)
@@ -1597,6 +1674,10 @@ hypre_BoxArrayBox(hypre_StructVectorDataSpace(vector), b)
 #define hypre_StructVectorBoxData(vector, b) \
 (hypre_StructVectorData(vector) + hypre_StructVectorDataIndices(vector)[b])
 
+#define hypre_StructVectorBoxDataComponent(vector, b, c) \
+(hypre_StructVectorBoxData(vector, b) + \
+ (c) * hypre_BoxVolume(hypre_StructVectorBox(vector, b)))
+
 #define hypre_StructVectorBoxDataValue(vector, b, index) \
 (hypre_StructVectorBoxData(vector, b) + \
  hypre_BoxIndexRank(hypre_StructVectorBox(vector, b), index))
@@ -1685,6 +1766,8 @@ HYPRE_Int hypre_BoxManSetAllGlobalKnown ( hypre_BoxManager *manager , HYPRE_Int
 HYPRE_Int hypre_BoxManGetAllGlobalKnown ( hypre_BoxManager *manager , HYPRE_Int *known );
 HYPRE_Int hypre_BoxManSetIsEntriesSort ( hypre_BoxManager *manager , HYPRE_Int is_sort );
 HYPRE_Int hypre_BoxManGetIsEntriesSort ( hypre_BoxManager *manager , HYPRE_Int *is_sort );
+HYPRE_Int hypre_BoxManSetSpatialIndex ( hypre_BoxManager *manager , HYPRE_Int spatial_index );
+HYPRE_Int hypre_BoxManGetSpatialIndex ( hypre_BoxManager *manager , HYPRE_Int *spatial_index );
 HYPRE_Int hypre_BoxManGetGlobalIsGatherCalled ( hypre_BoxManager *manager , MPI_Comm comm , HYPRE_Int *is_gather );
 HYPRE_Int hypre_BoxManGetAssumedPartition ( hypre_BoxManager *manager , hypre_StructAssumedPart **assumed_partition );
 HYPRE_Int hypre_BoxManSetAssumedPartition ( hypre_BoxManager *manager , hypre_StructAssumedPart *assumed_partition );
@@ -1703,6 +1786,7 @@ HYPRE_Int hypre_BoxManGetAllEntriesBoxesProc ( hypre_BoxManager *manager , hypre
 HYPRE_Int hypre_BoxManGatherEntries ( hypre_BoxManager *manager , hypre_Index imin , hypre_Index imax );
 HYPRE_Int hypre_BoxManAssemble ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManIntersect ( hypre_BoxManager *manager , hypre_Index ilower , hypre_Index iupper , hypre_BoxManEntry ***entries_ptr , HYPRE_Int *nentries_ptr );
+HYPRE_Int hypre_BoxManIntersectBoxes ( hypre_BoxManager *manager , hypre_BoxArray *boxes , hypre_BoxManEntry ***entries_ptr , HYPRE_Int **offsets_ptr );
 HYPRE_Int hypre_FillResponseBoxManAssemble1 ( void *p_recv_contact_buf , HYPRE_Int contact_size , HYPRE_Int contact_proc , void *ro , MPI_Comm comm , void **p_send_response_buf , HYPRE_Int *response_message_size );
 HYPRE_Int hypre_FillResponseBoxManAssemble2 ( void *p_recv_contact_buf , HYPRE_Int contact_size , HYPRE_Int contact_proc , void *ro , MPI_Comm comm , void **p_send_response_buf , HYPRE_Int *response_message_size );
 
@@ -1778,6 +1862,8 @@ HYPRE_Int HYPRE_StructVectorAssemble ( HYPRE_StructVector vector );
 HYPRE_Int HYPRE_StructVectorPrint ( const char *filename , HYPRE_StructVector vector , HYPRE_Int all );
 HYPRE_Int HYPRE_StructVectorSetNumGhost ( HYPRE_StructVector vector , HYPRE_Int *num_ghost );
 HYPRE_Int HYPRE_StructVectorCopy ( HYPRE_StructVector x , HYPRE_StructVector y );
+HYPRE_Int HYPRE_StructVectorSetNumComponents ( HYPRE_StructVector vector , HYPRE_Int num_components );
+HYPRE_Int HYPRE_StructVectorCopyComponent ( HYPRE_StructVector x , HYPRE_Int x_comp , HYPRE_StructVector y , HYPRE_Int y_comp );
 HYPRE_Int HYPRE_StructVectorSetConstantValues ( HYPRE_StructVector vector , HYPRE_Complex values );
 HYPRE_Int HYPRE_StructVectorGetMigrateCommPkg ( HYPRE_StructVector from_vector , HYPRE_StructVector to_vector , HYPRE_CommPkg *comm_pkg );
 HYPRE_Int HYPRE_StructVectorMigrate ( HYPRE_CommPkg comm_pkg , HYPRE_StructVector from_vector , HYPRE_StructVector to_vector );
@@ -1795,9 +1881,15 @@ HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha , hypre_StructVector *x , hypre
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info , hypre_BoxArray *send_data_space , hypre_BoxArray *recv_data_space , HYPRE_Int num_values , HYPRE_Int **orders , HYPRE_Int reverse , MPI_Comm comm , hypre_CommPkg **comm_pkg_ptr );
 HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type , HYPRE_Int *boxnums , hypre_Box *boxes , hypre_Index stride , hypre_Index coord , hypre_Index dir , HYPRE_Int *order , hypre_BoxArray *data_space , HYPRE_Int *data_offsets );
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box , hypre_Index stride , hypre_Index coord , hypre_Index dir , HYPRE_Int *order , hypre_Box *data_box , HYPRE_Int data_box_offset , hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommTypeIsContiguous ( hypre_CommType *comm_type , HYPRE_Int ndim , HYPRE_Int num_values , HYPRE_Int *contiguous_ptr );
+HYPRE_Int hypre_CommPkgRecvOverlap ( hypre_CommPkg *comm_pkg , hypre_CommType *skip_type , HYPRE_Int lo , HYPRE_Int hi , HYPRE_Int *overlap_ptr );
+HYPRE_Int hypre_CommPkgSetupPersistent ( hypre_CommPkg *comm_pkg , HYPRE_Int tag );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action , HYPRE_Int tag , hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
+HYPRE_Int hypre_InitializeCommunicationPersistent ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action , HYPRE_Int tag , hypre_CommHandle **comm_handle_ptr );
+HYPRE_Int hypre_FinalizeCommunicationPersistent ( hypre_CommHandle *comm_handle );
 HYPRE_Int hypre_ExchangeLocalData ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action );
+HYPRE_Int hypre_CommPkgHasExchanges ( hypre_CommPkg *comm_pkg );
 HYPRE_Int hypre_CommPkgDestroy ( hypre_CommPkg *comm_pkg );
 
 /* struct_copy.c */
@@ -1826,7 +1918,9 @@ HYPRE_Int hypre_StructGridGetMaxBoxSize(hypre_StructGrid *grid);
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid, HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Int hypre_StructInnerProdLocal ( hypre_StructVector *x , hypre_StructVector *y , HYPRE_Real *local_results );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x , hypre_StructVector *y );
+HYPRE_Int hypre_StructInnerProdComponents ( hypre_StructVector *x , hypre_StructVector *y , HYPRE_Real *results );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_values , HYPRE_Int dim , HYPRE_Complex *data );
@@ -1868,6 +1962,9 @@ HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata , HYPRE_Complex alpha ,
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecFusedSize ( hypre_StructStencil *stencil );
+HYPRE_Int hypre_StructMatvecFused ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecMulti ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y );
 
@@ -1894,9 +1991,11 @@ HYPRE_Int hypre_StructVectorClearValues ( hypre_StructVector *vector , hypre_Ind
 HYPRE_Int hypre_StructVectorClearBoxValues ( hypre_StructVector *vector , hypre_Box *clear_box , HYPRE_Int boxnum , HYPRE_Int outside );
 HYPRE_Int hypre_StructVectorClearAllValues ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorSetNumGhost ( hypre_StructVector *vector , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructVectorSetNumComponents ( hypre_StructVector *vector , HYPRE_Int num_components );
 HYPRE_Int hypre_StructVectorSetDataSize(hypre_StructVector *vector , HYPRE_Int *data_size, HYPRE_Int *data_host_size);
 HYPRE_Int hypre_StructVectorAssemble ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorCopy ( hypre_StructVector *x , hypre_StructVector *y );
+HYPRE_Int hypre_StructVectorCopyComponent ( hypre_StructVector *x , HYPRE_Int x_comp , hypre_StructVector *y , HYPRE_Int y_comp );
 HYPRE_Int hypre_StructVectorSetConstantValues ( hypre_StructVector *vector , HYPRE_Complex values );
 HYPRE_Int hypre_StructVectorSetFunctionValues ( hypre_StructVector *vector , HYPRE_Complex (*fcn )());
 HYPRE_Int hypre_StructVectorClearGhostValues ( hypre_StructVector *vector );
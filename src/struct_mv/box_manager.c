@@ -107,6 +107,228 @@ hypre_entryqsort2( HYPRE_Int *v,
    hypre_entryqsort2(v, ent, last+1, right);
 }
 
+/******************************************************************************
+ * Bounding box hierarchy (spatial index) routines used only in this file
+ *****************************************************************************/
+
+/* Use the hierarchy by default once a manager has this many entries */
+#define hypre_BOXMAN_SPATIAL_INDEX_MIN 1024
+
+/* Maximum number of entries in a leaf of the hierarchy */
+#define hypre_BOXMAN_TREE_LEAF_SIZE 8
+
+/* Deeper than any hierarchy built below (each split halves the entries) */
+#define hypre_BOXMAN_TREE_MAX_DEPTH 64
+
+/*--------------------------------------------------------------------------
+ * Build the hierarchy over the (sorted) entries.  Nodes are created breadth
+ * first, so the node array doubles as the work queue: each node's entries are
+ * sorted by their centers along the longest direction of the node and split
+ * in half.  The two children are adjacent in the node array.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManBuildSpatialIndex( hypre_BoxManager *manager )
+{
+   HYPRE_Int             ndim     = hypre_BoxManNDim(manager);
+   HYPRE_Int             nentries = hypre_BoxManNEntries(manager);
+   hypre_BoxManEntry    *entries  = hypre_BoxManEntries(manager);
+
+   hypre_BoxManTreeNode *tree_nodes;
+   hypre_BoxManTreeNode *node;
+   hypre_BoxManEntry    *entry;
+   HYPRE_Int            *tree_entries;
+   HYPRE_Int            *keys;
+   HYPRE_Int             num_tree_nodes;
+   HYPRE_Int             n, e, d, dir, first, count, width, max_width;
+
+   if (nentries == 0)
+   {
+      hypre_BoxManNumTreeNodes(manager) = 0;
+      return hypre_error_flag;
+   }
+
+   /* every leaf holds at least one entry, so there are < 2*nentries nodes */
+   tree_nodes   = hypre_TAlloc(hypre_BoxManTreeNode, 2 * nentries, HYPRE_MEMORY_HOST);
+   tree_entries = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+   keys         = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+   for (e = 0; e < nentries; e++)
+   {
+      tree_entries[e] = e;
+   }
+
+   node = &tree_nodes[0];
+   hypre_BoxManTreeNodeFirst(node) = 0;
+   hypre_BoxManTreeNodeCount(node) = nentries;
+   num_tree_nodes = 1;
+
+   for (n = 0; n < num_tree_nodes; n++)
+   {
+      node  = &tree_nodes[n];
+      first = hypre_BoxManTreeNodeFirst(node);
+      count = hypre_BoxManTreeNodeCount(node);
+
+      /* extents of the node */
+      entry = &entries[tree_entries[first]];
+      hypre_CopyIndex(hypre_BoxManEntryIMin(entry), hypre_BoxManTreeNodeIMin(node));
+      hypre_CopyIndex(hypre_BoxManEntryIMax(entry), hypre_BoxManTreeNodeIMax(node));
+      for (e = first + 1; e < first + count; e++)
+      {
+         entry = &entries[tree_entries[e]];
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_IndexD(hypre_BoxManTreeNodeIMin(node), d) =
+               hypre_min(hypre_IndexD(hypre_BoxManTreeNodeIMin(node), d),
+                         hypre_IndexD(hypre_BoxManEntryIMin(entry), d));
+            hypre_IndexD(hypre_BoxManTreeNodeIMax(node), d) =
+               hypre_max(hypre_IndexD(hypre_BoxManTreeNodeIMax(node), d),
+                         hypre_IndexD(hypre_BoxManEntryIMax(entry), d));
+         }
+      }
+
+      if (count <= hypre_BOXMAN_TREE_LEAF_SIZE)
+      {
+         hypre_BoxManTreeNodeChild(node) = -1;
+         continue;
+      }
+
+      /* split along the longest direction */
+      dir = 0;
+      max_width = -1;
+      for (d = 0; d < ndim; d++)
+      {
+         width = hypre_IndexD(hypre_BoxManTreeNodeIMax(node), d) -
+                 hypre_IndexD(hypre_BoxManTreeNodeIMin(node), d);
+         if (width > max_width)
+         {
+            dir = d;
+            max_width = width;
+         }
+      }
+      for (e = first; e < first + count; e++)
+      {
+         entry = &entries[tree_entries[e]];
+         /* twice the center, to stay in integers */
+         keys[e] = hypre_IndexD(hypre_BoxManEntryIMin(entry), dir) +
+                   hypre_IndexD(hypre_BoxManEntryIMax(entry), dir);
+      }
+      hypre_qsort2i(keys, tree_entries, first, first + count - 1);
+
+      hypre_BoxManTreeNodeChild(node) = num_tree_nodes;
+      hypre_BoxManTreeNodeFirst(&tree_nodes[num_tree_nodes]) = first;
+      hypre_BoxManTreeNodeCount(&tree_nodes[num_tree_nodes]) = count / 2;
+      num_tree_nodes++;
+      hypre_BoxManTreeNodeFirst(&tree_nodes[num_tree_nodes]) = first + count / 2;
+      hypre_BoxManTreeNodeCount(&tree_nodes[num_tree_nodes]) = count - count / 2;
+      num_tree_nodes++;
+   }
+
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+
+   hypre_BoxManNumTreeNodes(manager) = num_tree_nodes;
+   hypre_BoxManTreeNodes(manager) =
+      hypre_TReAlloc(tree_nodes, hypre_BoxManTreeNode, num_tree_nodes, HYPRE_MEMORY_HOST);
+   hypre_BoxManTreeEntries(manager) = tree_entries;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Append the positions of the entries intersecting [ilower, iupper] to
+ * positions (reallocated as needed), in ascending order.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManSpatialIndexIntersect( hypre_BoxManager *manager,
+                                   hypre_Index       ilower,
+                                   hypre_Index       iupper,
+                                   HYPRE_Int       **positions_ptr,
+                                   HYPRE_Int        *npositions_ptr,
+                                   HYPRE_Int        *alloc_ptr )
+{
+   HYPRE_Int             ndim         = hypre_BoxManNDim(manager);
+   hypre_BoxManEntry    *entries      = hypre_BoxManEntries(manager);
+   hypre_BoxManTreeNode *tree_nodes   = hypre_BoxManTreeNodes(manager);
+   HYPRE_Int            *tree_entries = hypre_BoxManTreeEntries(manager);
+
+   HYPRE_Int            *positions    = *positions_ptr;
+   HYPRE_Int             npositions   = *npositions_ptr;
+   HYPRE_Int             alloc        = *alloc_ptr;
+   HYPRE_Int             start        = npositions;
+
+   hypre_BoxManTreeNode *node;
+   hypre_BoxManEntry    *entry;
+   HYPRE_Int             stack[2 * hypre_BOXMAN_TREE_MAX_DEPTH];
+   HYPRE_Int             nstack, e, d, child;
+
+   if (hypre_BoxManNumTreeNodes(manager) == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack > 0)
+   {
+      node = &tree_nodes[stack[--nstack]];
+
+      for (d = 0; d < ndim; d++)
+      {
+         if ((hypre_IndexD(hypre_BoxManTreeNodeIMin(node), d) > hypre_IndexD(iupper, d)) ||
+             (hypre_IndexD(hypre_BoxManTreeNodeIMax(node), d) < hypre_IndexD(ilower, d)))
+         {
+            break;
+         }
+      }
+      if (d < ndim)
+      {
+         continue;
+      }
+
+      child = hypre_BoxManTreeNodeChild(node);
+      if (child >= 0)
+      {
+         stack[nstack++] = child + 1;
+         stack[nstack++] = child;
+         continue;
+      }
+
+      for (e = hypre_BoxManTreeNodeFirst(node);
+           e < hypre_BoxManTreeNodeFirst(node) + hypre_BoxManTreeNodeCount(node); e++)
+      {
+         entry = &entries[tree_entries[e]];
+         for (d = 0; d < ndim; d++)
+         {
+            if ((hypre_IndexD(hypre_BoxManEntryIMin(entry), d) > hypre_IndexD(iupper, d)) ||
+                (hypre_IndexD(hypre_BoxManEntryIMax(entry), d) < hypre_IndexD(ilower, d)))
+            {
+               break;
+            }
+         }
+         if (d < ndim)
+         {
+            continue;
+         }
+
+         if (npositions == alloc)
+         {
+            alloc = 2 * alloc + 8;
+            positions = hypre_TReAlloc(positions, HYPRE_Int, alloc, HYPRE_MEMORY_HOST);
+         }
+         positions[npositions++] = tree_entries[e];
+      }
+   }
+
+   /* return the entries in the order they are stored in the manager */
+   hypre_qsort0(positions, start, npositions - 1);
+
+   *positions_ptr  = positions;
+   *npositions_ptr = npositions;
+   *alloc_ptr      = alloc;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * This is not used
  *--------------------------------------------------------------------------*/
@@ -261,6 +483,34 @@ hypre_BoxManGetIsEntriesSort ( hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Choose how Assemble organizes the entries for hypre_BoxManIntersect: 1 for
+ * the bounding box hierarchy, 0 for the index table, or -1 (the default) for
+ * the hierarchy only when there are many entries.  Must be called before the
+ * assemble.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManSetSpatialIndex ( hypre_BoxManager *manager,
+                              HYPRE_Int spatial_index )
+{
+   hypre_BoxManSpatialIndex(manager) = spatial_index;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManGetSpatialIndex ( hypre_BoxManager *manager,
+                              HYPRE_Int *spatial_index )
+{
+   *spatial_index = hypre_BoxManSpatialIndex(manager);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -457,6 +707,11 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
    hypre_BoxManInfoObjects(manager) = hypre_TAlloc(char, max_nentries*info_size, HYPRE_MEMORY_HOST);
 
    hypre_BoxManIndexTable(manager) = NULL;
+
+   hypre_BoxManSpatialIndex(manager) = -1;
+   hypre_BoxManNumTreeNodes(manager) = 0;
+   hypre_BoxManTreeNodes(manager)    = NULL;
+   hypre_BoxManTreeEntries(manager)  = NULL;
    
    hypre_BoxManNumProcsSort(manager)     = 0;
    hypre_BoxManIdsSort(manager)          = hypre_CTAlloc(HYPRE_Int,  max_nentries, HYPRE_MEMORY_HOST);
@@ -576,6 +831,9 @@ hypre_BoxManDestroy( hypre_BoxManager *manager )
       hypre_TFree(hypre_BoxManInfoObjects(manager), HYPRE_MEMORY_HOST);
       
       hypre_TFree(hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST);
+
+      hypre_TFree(hypre_BoxManTreeNodes(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManTreeEntries(manager), HYPRE_MEMORY_HOST);
       
       hypre_TFree(hypre_BoxManIdsSort(manager), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_BoxManProcsSort(manager), HYPRE_MEMORY_HOST);
@@ -2207,8 +2465,21 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    
    /*------------------------------INDEX TABLE ---------------------------*/
 
+   /* the bounding box hierarchy replaces the index table when there are many
+      entries (the table size grows like nentries^ndim) */
+   if ( (hypre_BoxManSpatialIndex(manager) > 0) ||
+        (hypre_BoxManSpatialIndex(manager) < 0 &&
+         hypre_BoxManNEntries(manager) >= hypre_BOXMAN_SPATIAL_INDEX_MIN) )
+   {
+      nentries = hypre_BoxManNEntries(manager);
+      entries  = hypre_BoxManEntries(manager);
+
+      hypre_BoxManBuildSpatialIndex(manager);
+   }
+
    /* now build the index_table and indexes array */
    /* Note: for now we are using the same scheme as in BoxMap  */
+   else
    {
       HYPRE_Int *indexes[HYPRE_MAXDIM];
       HYPRE_Int  size[HYPRE_MAXDIM];
@@ -2484,6 +2755,32 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
       return hypre_error_flag;
    }
 
+   /* Use the bounding box hierarchy if it was built */
+   if (hypre_BoxManTreeNodes(manager) != NULL)
+   {
+      HYPRE_Int *positions = NULL;
+      HYPRE_Int  alloc = 0;
+
+      nentries = 0;
+      hypre_BoxManSpatialIndexIntersect(manager, ilower, iupper,
+                                        &positions, &nentries, &alloc);
+
+      entries = NULL;
+      if (nentries > 0)
+      {
+         entries = hypre_TAlloc(hypre_BoxManEntry *, nentries, HYPRE_MEMORY_HOST);
+         for (d = 0; d < nentries; d++)
+         {
+            entries[d] = &hypre_BoxManEntries(manager)[positions[d]];
+         }
+      }
+      hypre_TFree(positions, HYPRE_MEMORY_HOST);
+
+      *entries_ptr  = entries;
+      *nentries_ptr = nentries;
+      return hypre_error_flag;
+   }
+
    /* Loop through each dimension */
    for (d = 0; d < ndim; d++)
    {
@@ -2605,6 +2902,88 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Batched version of hypre_BoxManIntersect: intersect each box in 'boxes'
+ * with the global grid.  The entries intersected by box i are
+ * (*entries_ptr)[(*offsets_ptr)[i]] through
+ * (*entries_ptr)[(*offsets_ptr)[i+1]-1].  Both arrays are allocated here and
+ * should be freed by the caller.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManIntersectBoxes ( hypre_BoxManager *manager,
+                             hypre_BoxArray *boxes,
+                             hypre_BoxManEntry ***entries_ptr,
+                             HYPRE_Int **offsets_ptr )
+{
+   HYPRE_Int           num_boxes = hypre_BoxArraySize(boxes);
+   HYPRE_Int          *offsets;
+   HYPRE_Int          *positions = NULL;
+   HYPRE_Int           npositions = 0, alloc = 0;
+   hypre_BoxManEntry **entries = NULL;
+   hypre_BoxManEntry **box_entries;
+   HYPRE_Int           box_nentries;
+   hypre_Box          *box;
+   HYPRE_Int           i, j;
+
+   /* can only use after assembling */
+   if (!hypre_BoxManIsAssembled(manager))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   offsets = hypre_CTAlloc(HYPRE_Int, num_boxes + 1, HYPRE_MEMORY_HOST);
+
+   if (hypre_BoxManTreeNodes(manager) != NULL)
+   {
+      /* collect positions for all boxes, then convert to entries once */
+      hypre_ForBoxI(i, boxes)
+      {
+         box = hypre_BoxArrayBox(boxes, i);
+         hypre_BoxManSpatialIndexIntersect(manager, hypre_BoxIMin(box), hypre_BoxIMax(box),
+                                           &positions, &npositions, &alloc);
+         offsets[i + 1] = npositions;
+      }
+
+      if (npositions > 0)
+      {
+         entries = hypre_TAlloc(hypre_BoxManEntry *, npositions, HYPRE_MEMORY_HOST);
+         for (j = 0; j < npositions; j++)
+         {
+            entries[j] = &hypre_BoxManEntries(manager)[positions[j]];
+         }
+      }
+      hypre_TFree(positions, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      hypre_ForBoxI(i, boxes)
+      {
+         box = hypre_BoxArrayBox(boxes, i);
+         hypre_BoxManIntersect(manager, hypre_BoxIMin(box), hypre_BoxIMax(box),
+                               &box_entries, &box_nentries);
+
+         offsets[i + 1] = offsets[i] + box_nentries;
+         if (offsets[i + 1] > alloc)
+         {
+            alloc = 2 * offsets[i + 1];
+            entries = hypre_TReAlloc(entries, hypre_BoxManEntry *, alloc, HYPRE_MEMORY_HOST);
+         }
+         for (j = 0; j < box_nentries; j++)
+         {
+            entries[offsets[i] + j] = box_entries[j];
+         }
+         hypre_TFree(box_entries, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   *entries_ptr = entries;
+   *offsets_ptr = offsets;
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  * contact message is null.  need to return the (proc) id of each box in our
  * assumed partition.
@@ -32,6 +32,22 @@ typedef struct hypre_BoxManEntry_struct
 
 } hypre_BoxManEntry;
 
+/*--------------------------------------------------------------------------
+ * BoxManTreeNode: node of the bounding box hierarchy (spatial index)
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_Index imin; /* Extents of all entries below this node */
+   hypre_Index imax;
+
+   HYPRE_Int child; /* Position of the first of two (adjacent) children in the
+                     * node array, or -1 for a leaf */
+   HYPRE_Int first; /* Leaf entries are tree_entries[first, first+count) */
+   HYPRE_Int count;
+
+} hypre_BoxManTreeNode;
+
 /*---------------------------------------------------------------------------
  * Box Manager: organizes arbitrary information in a spatial way
  *----------------------------------------------------------------------------*/
@@ -101,6 +117,17 @@ typedef struct
    HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
                                                     indexes map */
 
+   /* Alternatively, the entries are organized by a bounding box hierarchy.
+      The index table has one cell per combination of box coordinates, so it
+      grows like nentries^ndim and is expensive to build for many small boxes,
+      while the hierarchy answers an intersection in O(log(nentries)) */
+   HYPRE_Int             spatial_index; /* Use the hierarchy instead of the
+                                           index table: 1 = always, 0 = never,
+                                           -1 = for many entries (default) */
+   HYPRE_Int             num_tree_nodes;
+   hypre_BoxManTreeNode *tree_nodes; /* Root is tree_nodes[0] */
+   HYPRE_Int            *tree_entries; /* Positions in 'entries', leaf order */
+
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */ 
    hypre_BoxManEntry **my_entries; /* Points into entries that are mine and
@@ -157,6 +184,11 @@ typedef struct
 #define hypre_BoxManSize(manager)               ((manager) -> size)
 #define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
 
+#define hypre_BoxManSpatialIndex(manager)       ((manager) -> spatial_index)
+#define hypre_BoxManNumTreeNodes(manager)       ((manager) -> num_tree_nodes)
+#define hypre_BoxManTreeNodes(manager)          ((manager) -> tree_nodes)
+#define hypre_BoxManTreeEntries(manager)        ((manager) -> tree_entries)
+
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
 #define hypre_BoxManMyEntries(manager)          ((manager) -> my_entries)
@@ -189,4 +221,14 @@ typedef struct
 #define hypre_BoxManEntryNext(entry)     ((entry) -> next)
 #define hypre_BoxManEntryBoxMan(entry)   ((entry) -> boxman)
 
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_BoxManTreeNode
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BoxManTreeNodeIMin(node)   ((node) -> imin)
+#define hypre_BoxManTreeNodeIMax(node)   ((node) -> imax)
+#define hypre_BoxManTreeNodeChild(node)  ((node) -> child)
+#define hypre_BoxManTreeNodeFirst(node)  ((node) -> first)
+#define hypre_BoxManTreeNodeCount(node)  ((node) -> count)
+
 #endif
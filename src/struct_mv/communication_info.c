@@ -323,15 +323,18 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
    hypre_Box             *extend_box;
    hypre_Box             *int_box;
    hypre_Box             *periodic_box;
+   hypre_BoxArray        *query_boxes;
    
    hypre_Box             *stencil_box, *sbox; /* extents of the stencil grid */
    HYPRE_Int             *stencil_grid;
    HYPRE_Int              grow[HYPRE_MAXDIM][2];
                        
    hypre_BoxManEntry    **entries;
+   hypre_BoxManEntry    **query_entries;
    hypre_BoxManEntry     *entry;
    
    HYPRE_Int              num_entries;
+   HYPRE_Int             *query_offsets;
    hypre_BoxArray        *neighbor_boxes = NULL;
    HYPRE_Int             *neighbor_procs = NULL;
    HYPRE_Int             *neighbor_ids = NULL;
@@ -459,7 +462,6 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
    grow_box = hypre_BoxCreate(hypre_StructGridNDim(grid));
    extend_box = hypre_BoxCreate(hypre_StructGridNDim(grid));
    int_box  = hypre_BoxCreate(hypre_StructGridNDim(grid));
-   periodic_box =  hypre_BoxCreate(hypre_StructGridNDim(grid));
  
    /* storage we will use and keep track of the neighbors */
    neighbor_alloc = 30; /* initial guess at max size */
@@ -477,6 +479,40 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
    cboxes = hypre_CTAlloc(hypre_Box *,  cbox_alloc, HYPRE_MEMORY_HOST);
    cboxes_mem = hypre_CTAlloc(hypre_Box,  cbox_alloc, HYPRE_MEMORY_HOST);
 
+   /*------------------------------------------------
+    * Find the potential neighbors of all local boxes
+    *------------------------------------------------*/
+
+   /* Do this by intersecting the extend boxes with the BoxManager in one
+      batch.  We must also check for periodic neighbors, so query box
+      i*num_periods+k is the extend box of local box i shifted by period k. */
+
+   query_boxes = hypre_BoxArrayCreate(num_boxes * num_periods, ndim);
+   for (i = 0; i < num_boxes; i++)
+   {
+      box = hypre_BoxArrayBox(local_boxes, i);
+
+      /* extend_box - to find the list of potential neighbors, we need to grow
+         the local box a bit differently in case, for example, the stencil grows
+         in one dimension [0] and not the other [1] */
+      hypre_CopyBox(box, extend_box);
+      for (d = 0; d < ndim; d++)
+      { 
+         hypre_BoxIMinD(extend_box, d) -= hypre_max(grow[d][0],grow[d][1]);
+         hypre_BoxIMaxD(extend_box, d) += hypre_max(grow[d][0],grow[d][1]);
+      }
+
+      /* shift the box by each period (k=0 is original box) */
+      for (k = 0; k < num_periods; k++)
+      {
+         periodic_box = hypre_BoxArrayBox(query_boxes, i*num_periods + k);
+         hypre_CopyBox(extend_box, periodic_box);
+         pshift = hypre_StructGridPShift(grid, k);
+         hypre_BoxShiftPos(periodic_box, pshift);
+      }
+   }
+   hypre_BoxManIntersectBoxes(boxman, query_boxes, &query_entries, &query_offsets);
+
    /******* loop through each local box **************/
 
    for (i = 0; i < num_boxes; i++)
@@ -493,36 +529,20 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
          hypre_BoxIMaxD(grow_box, d) += grow[d][1];
       }
 
-      /* extend_box - to find the list of potential neighbors, we need to grow
-         the local box a bit differently in case, for example, the stencil grows
-         in one dimension [0] and not the other [1] */
-      hypre_CopyBox(box, extend_box);
-      for (d = 0; d < ndim; d++)
-      { 
-         hypre_BoxIMinD(extend_box, d) -= hypre_max(grow[d][0],grow[d][1]);
-         hypre_BoxIMaxD(extend_box, d) += hypre_max(grow[d][0],grow[d][1]);
-      }
-
       /*------------------------------------------------
        * Determine the neighbors of box i
        *------------------------------------------------*/
-     
-      /* Do this by intersecting the extend box with the BoxManager. 
-         We must also check for periodic neighbors. */
 
       neighbor_count = 0;
       hypre_BoxArraySetSize(neighbor_boxes, 0);
-      /* shift the box by each period (k=0 is original box) */
       for (k = 0; k < num_periods; k++)
       {
-         hypre_CopyBox(extend_box, periodic_box);
          pshift = hypre_StructGridPShift(grid, k);
-         hypre_BoxShiftPos(periodic_box, pshift);
-         
-         /* get the intersections */
-         hypre_BoxManIntersect(boxman, hypre_BoxIMin(periodic_box) , 
-                               hypre_BoxIMax(periodic_box) , 
-                               &entries , &num_entries);
+
+         /* get the intersections (computed above) */
+         entries = &query_entries[query_offsets[i*num_periods + k]];
+         num_entries = query_offsets[i*num_periods + k + 1] -
+            query_offsets[i*num_periods + k];
       
          /* note: do we need to remove the intersection with our original box?
             no if periodic, yes if non-periodic (k=0) */ 
@@ -570,8 +590,6 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
             neighbor_count++;
          }
          hypre_BoxArraySetSize(neighbor_boxes, neighbor_count);
-
-         hypre_TFree(entries, HYPRE_MEMORY_HOST);
   
       } /* end of loop through periods k */
 
@@ -763,8 +781,10 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
 
    hypre_BoxDestroy(grow_box);
    hypre_BoxDestroy(int_box);
-   hypre_BoxDestroy(periodic_box);
    hypre_BoxDestroy(extend_box);
+   hypre_BoxArrayDestroy(query_boxes);
+   hypre_TFree(query_entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(query_offsets, HYPRE_MEMORY_HOST);
    
    hypre_BoxDestroy(stencil_box);
    hypre_BoxDestroy(sbox);
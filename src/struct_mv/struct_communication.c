@@ -19,6 +19,77 @@ FILE      *file;
 #define hypre_CommPrefixSize(ne)                                        \
    ( (((1+ne)*sizeof(HYPRE_Int) + ne*sizeof(hypre_Box))/sizeof(HYPRE_Complex)) + 1 )
 
+/* Keep message buffers and MPI requests in the CommPkg between exchanges, and
+ * send/receive contiguous messages in place.  Host memory only. */
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_COMM_PERSISTENT
+#endif
+
+/*--------------------------------------------------------------------------
+ * Sort the (p,i,j) communication box triples by process number p.  The sort
+ * is stable, so boxes for the same process stay in (i,j) order.  The triples
+ * have long runs of equal p, which makes hypre_qsort3i quadratic, so a
+ * bottom-up merge sort is used instead.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CommBoxesSort( HYPRE_Int *p,
+                     HYPRE_Int *i,
+                     HYPRE_Int *j,
+                     HYPRE_Int  n )
+{
+   HYPRE_Int  *ap, *ai, *aj;
+   HYPRE_Int  *sp, *si, *sj, *dp, *di, *dj, *tmp;
+   HYPRE_Int   width, lo, mid, hi, a, b, k;
+
+   if (n < 2)
+   {
+      return;
+   }
+
+   ap = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   ai = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   aj = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   sp = p;  si = i;  sj = j;
+   dp = ap; di = ai; dj = aj;
+   for (width = 1; width < n; width *= 2)
+   {
+      for (lo = 0; lo < n; lo += 2*width)
+      {
+         mid = hypre_min(lo + width, n);
+         hi  = hypre_min(lo + 2*width, n);
+         a = lo;
+         b = mid;
+         for (k = lo; k < hi; k++)
+         {
+            if ( (a < mid) && ((b >= hi) || (sp[a] <= sp[b])) )
+            {
+               dp[k] = sp[a]; di[k] = si[a]; dj[k] = sj[a]; a++;
+            }
+            else
+            {
+               dp[k] = sp[b]; di[k] = si[b]; dj[k] = sj[b]; b++;
+            }
+         }
+      }
+      tmp = sp; sp = dp; dp = tmp;
+      tmp = si; si = di; di = tmp;
+      tmp = sj; sj = dj; dj = tmp;
+   }
+
+   if (sp != p)
+   {
+      hypre_TMemcpy(p, sp, HYPRE_Int, n, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(i, si, HYPRE_Int, n, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(j, sj, HYPRE_Int, n, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(ai, HYPRE_MEMORY_HOST);
+   hypre_TFree(aj, HYPRE_MEMORY_HOST);
+}
+
 /*--------------------------------------------------------------------------
  * Create a communication package.  A grid-based description of a communication
  * exchange is passed in.  This description is then compiled into an
@@ -133,6 +204,9 @@ hypre_CommPkgCreate( hypre_CommInfo   *comm_info,
    hypre_CommPkgNumValues(comm_pkg) = num_values;
    hypre_CommPkgNumOrders(comm_pkg) = 0;
    hypre_CommPkgOrders(comm_pkg)    = NULL;
+#ifdef HYPRE_COMM_PERSISTENT
+   hypre_CommPkgPersistent(comm_pkg) = 1;
+#endif
    if ( (send_transforms != NULL) && (orders != NULL) )
    {
       hypre_CommPkgNumOrders(comm_pkg) = num_transforms;
@@ -212,7 +286,7 @@ hypre_CommPkgCreate( hypre_CommInfo   *comm_info,
          num_boxes++;
       }
    }
-   hypre_qsort3i(comm_boxes_p, comm_boxes_i, comm_boxes_j, 0, num_boxes-1);
+   hypre_CommBoxesSort(comm_boxes_p, comm_boxes_i, comm_boxes_j, num_boxes);
 
    /* compute comm_types */
 
@@ -350,7 +424,7 @@ hypre_CommPkgCreate( hypre_CommInfo   *comm_info,
          num_boxes++;
       }
    }
-   hypre_qsort3i(comm_boxes_p, comm_boxes_i, comm_boxes_j, 0, num_boxes-1);
+   hypre_CommBoxesSort(comm_boxes_p, comm_boxes_i, comm_boxes_j, num_boxes);
 
    /* compute comm_types */
 
@@ -762,6 +836,332 @@ hypre_CommTypeSetEntry( hypre_Box           *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Determine if the message for 'comm_type' is a single piece of contiguous
+ * user data, in which case it can be sent or received in place.  This is the
+ * case, e.g., for whole rows of data in 2D or for multi-component data where
+ * the entry spans the entire data box.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommTypeIsContiguous( hypre_CommType *comm_type,
+                            HYPRE_Int       ndim,
+                            HYPRE_Int       num_values,
+                            HYPRE_Int      *contiguous_ptr )
+{
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array;
+   HYPRE_Int           *order;
+   HYPRE_Int            contiguous, size, d, ll;
+
+   contiguous = 0;
+   if (hypre_CommTypeNumEntries(comm_type) == 1)
+   {
+      comm_entry   = hypre_CommTypeEntry(comm_type, 0);
+      length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+      stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+      order        = hypre_CommEntryTypeOrder(comm_entry);
+
+      contiguous = 1;
+      size = 1;
+      for (d = 0; d < ndim; d++)
+      {
+         if (length_array[d] > 1)
+         {
+            if (stride_array[d] != size)
+            {
+               contiguous = 0;
+            }
+            size *= length_array[d];
+         }
+      }
+      if ((num_values > 1) && (stride_array[ndim] != size))
+      {
+         contiguous = 0;
+      }
+      for (ll = 0; ll < num_values; ll++)
+      {
+         if (order[ll] != ll)
+         {
+            contiguous = 0;
+         }
+      }
+      if ((size * num_values) != hypre_CommTypeBufsize(comm_type))
+      {
+         contiguous = 0;
+      }
+   }
+
+   *contiguous_ptr = contiguous;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Determine if the data locations offset + sum_d i_d*stride_array[d], with
+ * 0 <= i_d < length_array[d] for the n dimensions, include any of the
+ * locations [lo, hi].  The dimension with the largest stride is split until
+ * the extent of a piece is either disjoint from or inside of [lo, hi].
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommEntryOverlap( HYPRE_Int  offset,
+                        HYPRE_Int  n,
+                        HYPRE_Int *length_array,
+                        HYPRE_Int *stride_array,
+                        HYPRE_Int  lo,
+                        HYPRE_Int  hi )
+{
+   HYPRE_Int  length[HYPRE_MAXDIM+1];
+   HYPRE_Int  d, m, i, ext, elo, ehi;
+
+   elo = ehi = offset;
+   m = -1;
+   for (d = 0; d < n; d++)
+   {
+      if (length_array[d] < 1)
+      {
+         return 0;
+      }
+      ext = (length_array[d] - 1) * stride_array[d];
+      if (ext < 0)
+      {
+         elo += ext;
+      }
+      else
+      {
+         ehi += ext;
+      }
+      if ( (length_array[d] > 1) &&
+           ((m < 0) || (hypre_abs(stride_array[d]) > hypre_abs(stride_array[m]))) )
+      {
+         m = d;
+      }
+   }
+
+   if ((elo > hi) || (ehi < lo))
+   {
+      return 0;
+   }
+   if (((elo >= lo) && (ehi <= hi)) || (m < 0))
+   {
+      return 1;
+   }
+
+   for (d = 0; d < n; d++)
+   {
+      length[d] = length_array[d];
+   }
+   length[m] = 1;
+   for (i = 0; i < length_array[m]; i++)
+   {
+      if (hypre_CommEntryOverlap(offset + i*stride_array[m], n, length, stride_array, lo, hi))
+      {
+         return 1;
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Determine if any of the receive data locations [lo, hi] are written by a
+ * receive of 'comm_pkg' other than 'skip_type', or by its local copies.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgRecvOverlap( hypre_CommPkg  *comm_pkg,
+                          hypre_CommType *skip_type,
+                          HYPRE_Int       lo,
+                          HYPRE_Int       hi,
+                          HYPRE_Int      *overlap_ptr )
+{
+   HYPRE_Int            ndim       = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int            num_recvs  = hypre_CommPkgNumRecvs(comm_pkg);
+
+   hypre_CommType      *comm_type;
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int            length_array[HYPRE_MAXDIM+1];
+   HYPRE_Int            overlap, i, j, d;
+
+   overlap = 0;
+   for (i = 0; (i <= num_recvs) && !overlap; i++)
+   {
+      if (i < num_recvs)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      }
+      else
+      {
+         comm_type = hypre_CommPkgCopyToType(comm_pkg);
+      }
+      if (comm_type == skip_type)
+      {
+         continue;
+      }
+
+      for (j = 0; (j < hypre_CommTypeNumEntries(comm_type)) && !overlap; j++)
+      {
+         comm_entry = hypre_CommTypeEntry(comm_type, j);
+         for (d = 0; d < ndim; d++)
+         {
+            length_array[d] = hypre_CommEntryTypeLengthArray(comm_entry)[d];
+         }
+         length_array[ndim] = num_values;
+         overlap = hypre_CommEntryOverlap(hypre_CommEntryTypeOffset(comm_entry), ndim + 1,
+                                          length_array,
+                                          hypre_CommEntryTypeStrideArray(comm_entry),
+                                          lo, hi);
+      }
+   }
+
+   *overlap_ptr = overlap;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set up the persistent communication state of a CommPkg: message buffers,
+ * contiguous (direct) messages, and persistent MPI requests for the packed
+ * messages.  This must be called after the first communication, since the
+ * message sizes and the receive entries are not known before then.  If the
+ * state is already set up, only the persistent requests are recreated (for a
+ * new 'tag').
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgSetupPersistent( hypre_CommPkg *comm_pkg,
+                              HYPRE_Int      tag )
+{
+   HYPRE_Int            ndim       = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int            num_sends  = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs  = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm       = hypre_CommPkgComm(comm_pkg);
+
+   hypre_MPI_Request   *requests;
+   HYPRE_Complex      **send_buffers;
+   HYPRE_Complex      **recv_buffers;
+   hypre_CommType      *comm_type;
+   HYPRE_Int            i, k, size, contiguous, overlap, lo;
+
+   if ( !hypre_CommPkgPersistentSetup(comm_pkg) )
+   {
+      send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
+      {
+         size = hypre_CommPkgSendBufsize(comm_pkg);
+         send_buffers[0] = hypre_CTAlloc(HYPRE_Complex, size, HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i-1);
+            send_buffers[i] = send_buffers[i-1] + hypre_CommTypeBufsize(comm_type);
+         }
+      }
+
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+      if (num_recvs > 0)
+      {
+         size = hypre_CommPkgRecvBufsize(comm_pkg);
+         recv_buffers[0] = hypre_TAlloc(HYPRE_Complex, size, HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i-1);
+            recv_buffers[i] = recv_buffers[i-1] + hypre_CommTypeBufsize(comm_type);
+         }
+      }
+
+      /* Sending in place requires that the send data is not modified before
+       * the exchange is finalized, which overlapped computations may do, and
+       * which receives and local copies into the same data may do */
+      for (i = 0; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         contiguous = 0;
+#ifndef HYPRE_OVERLAP_COMM_COMP
+         hypre_CommTypeIsContiguous(comm_type, ndim, num_values, &contiguous);
+#endif
+         if (contiguous)
+         {
+            lo = hypre_CommEntryTypeOffset(hypre_CommTypeEntry(comm_type, 0));
+            hypre_CommPkgRecvOverlap(comm_pkg, NULL, lo,
+                                     lo + hypre_CommTypeBufsize(comm_type) - 1, &overlap);
+            contiguous = !overlap;
+         }
+         hypre_CommTypeDirect(comm_type) = contiguous;
+      }
+
+      /* Receiving in place writes the data whenever the message arrives, so
+       * the locations must not be written by other receives or local copies
+       * (e.g., overlapping ghost layers on periodic grids), which are
+       * otherwise applied in a fixed order */
+      for (i = 0; i < num_recvs; i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         hypre_CommTypeIsContiguous(comm_type, ndim, num_values, &contiguous);
+         if (contiguous)
+         {
+            lo = hypre_CommEntryTypeOffset(hypre_CommTypeEntry(comm_type, 0));
+            hypre_CommPkgRecvOverlap(comm_pkg, comm_type, lo,
+                                     lo + hypre_CommTypeBufsize(comm_type) - 1, &overlap);
+            contiguous = !overlap;
+         }
+         hypre_CommTypeDirect(comm_type) = contiguous;
+      }
+
+      hypre_CommPkgRequests(comm_pkg) =
+         hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+      hypre_CommPkgStatus(comm_pkg) =
+         hypre_CTAlloc(hypre_MPI_Status, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+      hypre_CommPkgSendBuffers(comm_pkg) = send_buffers;
+      hypre_CommPkgRecvBuffers(comm_pkg) = recv_buffers;
+      hypre_CommPkgPersistentSetup(comm_pkg) = 1;
+   }
+   else
+   {
+      /* free the persistent requests for the old tag */
+      requests = hypre_CommPkgRequests(comm_pkg);
+      for (k = 0; k < hypre_CommPkgNumPersistent(comm_pkg); k++)
+      {
+         hypre_MPI_Request_free(&requests[k]);
+      }
+   }
+
+   /* create persistent requests for the packed messages */
+   requests     = hypre_CommPkgRequests(comm_pkg);
+   send_buffers = hypre_CommPkgSendBuffers(comm_pkg);
+   recv_buffers = hypre_CommPkgRecvBuffers(comm_pkg);
+   k = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      if ( !hypre_CommTypeDirect(comm_type) )
+      {
+         hypre_MPI_Recv_init(recv_buffers[i],
+                             hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                             hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                             tag, comm, &requests[k++]);
+      }
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      if ( !hypre_CommTypeDirect(comm_type) )
+      {
+         hypre_MPI_Send_init(send_buffers[i],
+                             hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                             hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                             tag, comm, &requests[k++]);
+      }
+   }
+   hypre_CommPkgNumPersistent(comm_pkg) = k;
+   hypre_CommPkgPersistentTag(comm_pkg) = tag;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
@@ -812,6 +1212,17 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
 
+#ifdef HYPRE_COMM_PERSISTENT
+   /* the first communication sets up the message sizes and receive entries */
+   if ( hypre_CommPkgPersistent(comm_pkg) &&
+        !hypre_CommPkgFirstComm(comm_pkg) &&
+        !hypre_CommPkgPersistentActive(comm_pkg) )
+   {
+      return hypre_InitializeCommunicationPersistent(comm_pkg, send_data, recv_data,
+                                                     action, tag, comm_handle_ptr);
+   }
+#endif
+
    /*--------------------------------------------------------------------
     * allocate requests and status
     *--------------------------------------------------------------------*/
@@ -1102,6 +1513,7 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    hypre_CommHandleAction(comm_handle)      = action;
    hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers_device;
    hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers_device;
+   hypre_CommHandlePersistent(comm_handle)  = 0;
 
    *comm_handle_ptr = comm_handle;
 
@@ -1148,6 +1560,11 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
    HYPRE_Complex      **send_buffers_device = hypre_CommHandleSendBuffersDevice(comm_handle);
    HYPRE_Complex      **recv_buffers_device = hypre_CommHandleRecvBuffersDevice(comm_handle);
 
+   if ( hypre_CommHandlePersistent(comm_handle) )
+   {
+      return hypre_FinalizeCommunicationPersistent(comm_handle);
+   }
+
    /*--------------------------------------------------------------------
     * finish communications
     *--------------------------------------------------------------------*/
@@ -1336,6 +1753,288 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Initialize a communication exchange in persistent mode.  This is the same
+ * as hypre_InitializeCommunication, but the message buffers and the MPI
+ * requests are owned by the CommPkg and reused between exchanges.  Contiguous
+ * messages are sent directly from 'send_data' and, when action = 0, received
+ * directly into 'recv_data' without packing.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_InitializeCommunicationPersistent( hypre_CommPkg     *comm_pkg,
+                                         HYPRE_Complex     *send_data,
+                                         HYPRE_Complex     *recv_data,
+                                         HYPRE_Int          action,
+                                         HYPRE_Int          tag,
+                                         hypre_CommHandle **comm_handle_ptr )
+{
+   hypre_CommHandle    *comm_handle;
+
+   HYPRE_Int            ndim       = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int            num_sends  = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs  = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm       = hypre_CommPkgComm(comm_pkg);
+
+   HYPRE_Int            num_requests;
+   hypre_MPI_Request   *requests;
+
+   HYPRE_Complex      **send_buffers;
+   HYPRE_Complex      **recv_buffers;
+
+   hypre_CommType      *comm_type;
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int            num_entries;
+
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array, unitst_array[HYPRE_MAXDIM+1];
+   HYPRE_Int           *order;
+
+   HYPRE_Complex       *dptr, *kptr, *lptr;
+
+   HYPRE_Int            i, j, d, ll;
+   HYPRE_Int            size;
+
+   if ( !hypre_CommPkgPersistentSetup(comm_pkg) ||
+        (hypre_CommPkgPersistentTag(comm_pkg) != tag) )
+   {
+      hypre_CommPkgSetupPersistent(comm_pkg, tag);
+   }
+   requests     = hypre_CommPkgRequests(comm_pkg);
+   send_buffers = hypre_CommPkgSendBuffers(comm_pkg);
+   recv_buffers = hypre_CommPkgRecvBuffers(comm_pkg);
+
+   /*--------------------------------------------------------------------
+    * pack send buffers (direct messages are sent in place)
+    *--------------------------------------------------------------------*/
+
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      if ( hypre_CommTypeDirect(comm_type) )
+      {
+         continue;
+      }
+      num_entries = hypre_CommTypeNumEntries(comm_type);
+
+      dptr = (HYPRE_Complex *) send_buffers[i];
+      for (j = 0; j < num_entries; j++)
+      {
+         comm_entry = hypre_CommTypeEntry(comm_type, j);
+         length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+         stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+         order = hypre_CommEntryTypeOrder(comm_entry);
+         unitst_array[0] = 1;
+         for (d = 1; d <= ndim; d++)
+         {
+            unitst_array[d] = unitst_array[d-1]*length_array[d-1];
+         }
+
+         lptr = send_data + hypre_CommEntryTypeOffset(comm_entry);
+         for (ll = 0; ll < num_values; ll++)
+         {
+            if (order[ll] > -1)
+            {
+               kptr = lptr + order[ll]*stride_array[ndim];
+
+               hypre_BasicBoxLoop2Begin(ndim, length_array,
+                                        stride_array, ki,
+                                        unitst_array, di);
+               {
+                  dptr[di] = kptr[ki];
+               }
+               hypre_BoxLoop2End(ki, di);
+
+               dptr += unitst_array[ndim];
+            }
+            else
+            {
+               size = 1;
+               for (d = 0; d < ndim; d++)
+               {
+                  size *= length_array[d];
+               }
+
+               hypre_Memset(dptr, 0, size*sizeof(HYPRE_Complex), HYPRE_MEMORY_HOST);
+
+               dptr += size;
+            }
+         }
+      }
+   }
+
+   /*--------------------------------------------------------------------
+    * start persistent requests, then post direct receives and sends
+    *--------------------------------------------------------------------*/
+
+   num_requests = hypre_CommPkgNumPersistent(comm_pkg);
+   if (num_requests > 0)
+   {
+      hypre_MPI_Startall(num_requests, requests);
+   }
+
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      if ( hypre_CommTypeDirect(comm_type) )
+      {
+         comm_entry = hypre_CommTypeEntry(comm_type, 0);
+         dptr = recv_buffers[i];
+         if (action == 0)
+         {
+            dptr = recv_data + hypre_CommEntryTypeOffset(comm_entry);
+         }
+         hypre_MPI_Irecv(dptr,
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[num_requests++]);
+      }
+   }
+
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      if ( hypre_CommTypeDirect(comm_type) )
+      {
+         comm_entry = hypre_CommTypeEntry(comm_type, 0);
+         hypre_MPI_Isend(send_data + hypre_CommEntryTypeOffset(comm_entry),
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[num_requests++]);
+      }
+   }
+
+   /*--------------------------------------------------------------------
+    * exchange local data
+    *--------------------------------------------------------------------*/
+
+   hypre_ExchangeLocalData(comm_pkg, send_data, recv_data, action);
+
+   /*--------------------------------------------------------------------
+    * set up comm_handle and return
+    *--------------------------------------------------------------------*/
+
+   comm_handle = hypre_TAlloc(hypre_CommHandle, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CommHandleCommPkg(comm_handle)     = comm_pkg;
+   hypre_CommHandleSendData(comm_handle)    = send_data;
+   hypre_CommHandleRecvData(comm_handle)    = recv_data;
+   hypre_CommHandleNumRequests(comm_handle) = num_requests;
+   hypre_CommHandleRequests(comm_handle)    = requests;
+   hypre_CommHandleStatus(comm_handle)      = hypre_CommPkgStatus(comm_pkg);
+   hypre_CommHandleSendBuffers(comm_handle) = send_buffers;
+   hypre_CommHandleRecvBuffers(comm_handle) = recv_buffers;
+   hypre_CommHandleAction(comm_handle)      = action;
+   hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers;
+   hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers;
+   hypre_CommHandlePersistent(comm_handle)  = 1;
+
+   hypre_CommPkgPersistentActive(comm_pkg) = 1;
+
+   *comm_handle_ptr = comm_handle;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Finalize a communication exchange started with
+ * hypre_InitializeCommunicationPersistent.  The buffers and the persistent
+ * requests are kept in the CommPkg for the next exchange.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FinalizeCommunicationPersistent( hypre_CommHandle *comm_handle )
+{
+   hypre_CommPkg       *comm_pkg     = hypre_CommHandleCommPkg(comm_handle);
+   HYPRE_Complex      **recv_buffers = hypre_CommHandleRecvBuffers(comm_handle);
+   HYPRE_Int            action       = hypre_CommHandleAction(comm_handle);
+
+   HYPRE_Int            ndim         = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values   = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int            num_recvs    = hypre_CommPkgNumRecvs(comm_pkg);
+
+   hypre_CommType      *comm_type;
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int            num_entries;
+
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array, unitst_array[HYPRE_MAXDIM+1];
+
+   HYPRE_Complex       *kptr, *lptr;
+   HYPRE_Complex       *dptr;
+
+   HYPRE_Int            i, j, d, ll;
+
+   /*--------------------------------------------------------------------
+    * finish communications
+    *--------------------------------------------------------------------*/
+
+   if (hypre_CommHandleNumRequests(comm_handle))
+   {
+      hypre_MPI_Waitall(hypre_CommHandleNumRequests(comm_handle),
+                        hypre_CommHandleRequests(comm_handle),
+                        hypre_CommHandleStatus(comm_handle));
+   }
+
+   /*--------------------------------------------------------------------
+    * unpack receive buffer data (direct messages are already in place)
+    *--------------------------------------------------------------------*/
+
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      if ( hypre_CommTypeDirect(comm_type) && (action == 0) )
+      {
+         continue;
+      }
+      num_entries = hypre_CommTypeNumEntries(comm_type);
+
+      dptr = (HYPRE_Complex *) recv_buffers[i];
+      for (j = 0; j < num_entries; j++)
+      {
+         comm_entry = hypre_CommTypeEntry(comm_type, j);
+         length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+         stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+         unitst_array[0] = 1;
+         for (d = 1; d <= ndim; d++)
+         {
+            unitst_array[d] = unitst_array[d-1]*length_array[d-1];
+         }
+
+         lptr = hypre_CommHandleRecvData(comm_handle) +
+            hypre_CommEntryTypeOffset(comm_entry);
+         for (ll = 0; ll < num_values; ll++)
+         {
+            kptr = lptr + ll*stride_array[ndim];
+
+            hypre_BasicBoxLoop2Begin(ndim, length_array,
+                                     stride_array, ki,
+                                     unitst_array, di);
+            {
+               if (action > 0)
+               {
+                  kptr[ki] += dptr[di];
+               }
+               else
+               {
+                  kptr[ki] = dptr[di];
+               }
+            }
+            hypre_BoxLoop2End(ki, di);
+
+            dptr += unitst_array[ndim];
+         }
+      }
+   }
+
+   hypre_CommPkgPersistentActive(comm_pkg) = 0;
+
+   hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Execute local data exchanges.
  *--------------------------------------------------------------------------*/
@@ -1421,6 +2120,31 @@ hypre_ExchangeLocalData( hypre_CommPkg *comm_pkg,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Returns 1 if the communication package moves any data on this process
+ * (sends, receives, or local copies between boxes), and 0 otherwise.  When
+ * this returns 0, none of the ghost values touched by the package depend on
+ * data owned by another box.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgHasExchanges( hypre_CommPkg *comm_pkg )
+{
+   if (comm_pkg == NULL)
+   {
+      return 0;
+   }
+
+   if ( (hypre_CommPkgNumSends(comm_pkg) > 0) ||
+        (hypre_CommPkgNumRecvs(comm_pkg) > 0) ||
+        (hypre_CommTypeNumEntries(hypre_CommPkgCopyFromType(comm_pkg)) > 0) )
+   {
+      return 1;
+   }
+
+   return 0;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1433,6 +2157,26 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
    if (comm_pkg)
    {
+      if ( hypre_CommPkgPersistentSetup(comm_pkg) )
+      {
+         for (i = 0; i < hypre_CommPkgNumPersistent(comm_pkg); i++)
+         {
+            hypre_MPI_Request_free(&hypre_CommPkgRequests(comm_pkg)[i]);
+         }
+         if (hypre_CommPkgNumSends(comm_pkg) > 0)
+         {
+            hypre_TFree(hypre_CommPkgSendBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+         }
+         if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
+         {
+            hypre_TFree(hypre_CommPkgRecvBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_CommPkgSendBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgRecvBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgRequests(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgStatus(comm_pkg), HYPRE_MEMORY_HOST);
+      }
+
       /* note that entries are allocated in two stages for To/Recv */
       if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
       {
@@ -70,6 +70,10 @@ typedef struct hypre_CommType_struct
    HYPRE_Int            *rem_boxnums; /* entry remote box numbers */
    hypre_Box            *rem_boxes;   /* entry remote boxes */
 
+   /* true if the message is a single contiguous piece of user data that can
+    * be sent or received in place without packing (set by persistent setup) */
+   HYPRE_Int             direct;
+
 } hypre_CommType;
 
 /*--------------------------------------------------------------------------
@@ -116,6 +120,17 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* persistent mode: buffers and MPI requests are kept between exchanges */
+   HYPRE_Int           persistent;        /* use persistent mode if possible */
+   HYPRE_Int           persistent_setup;  /* is the persistent state set up? */
+   HYPRE_Int           persistent_active; /* is an exchange in progress? */
+   HYPRE_Int           persistent_tag;    /* tag of the persistent requests */
+   HYPRE_Int           num_persistent;    /* number of persistent requests */
+   hypre_MPI_Request  *requests;          /* persistent, then direct requests */
+   hypre_MPI_Status   *status;
+   HYPRE_Complex     **send_buffers;
+   HYPRE_Complex     **recv_buffers;
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -142,6 +157,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* true if requests and buffers are owned by comm_pkg */
+   HYPRE_Int          persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -193,6 +211,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommTypeRemBoxnum(type, i)  (type -> rem_boxnums[i])
 #define hypre_CommTypeRemBoxes(type)      (type -> rem_boxes)
 #define hypre_CommTypeRemBox(type, i)   (&(type -> rem_boxes[i]))
+#define hypre_CommTypeDirect(type)        (type -> direct)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommPkg
@@ -235,6 +254,16 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistent(comm_pkg)                 (comm_pkg -> persistent)
+#define hypre_CommPkgPersistentSetup(comm_pkg)            (comm_pkg -> persistent_setup)
+#define hypre_CommPkgPersistentActive(comm_pkg)           (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgNumPersistent(comm_pkg)              (comm_pkg -> num_persistent)
+#define hypre_CommPkgRequests(comm_pkg)                   (comm_pkg -> requests)
+#define hypre_CommPkgStatus(comm_pkg)                     (comm_pkg -> status)
+#define hypre_CommPkgSendBuffers(comm_pkg)                (comm_pkg -> send_buffers)
+#define hypre_CommPkgRecvBuffers(comm_pkg)                (comm_pkg -> recv_buffers)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -248,6 +277,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffers(comm_handle)          (comm_handle -> send_buffers)
 #define hypre_CommHandleRecvBuffers(comm_handle)          (comm_handle -> recv_buffers)
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_device)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_device)
 
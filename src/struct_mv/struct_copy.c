@@ -34,7 +34,8 @@ hypre_StructCopy( hypre_StructVector *x,
    hypre_IndexRef   start;
    hypre_Index      unit_stride;
 
-   HYPRE_Int        i;
+   HYPRE_Int        num_components = hypre_StructVectorNumComponents(y);
+   HYPRE_Int        i, c;
 
    hypre_SetIndex(unit_stride, 1);
 
@@ -47,20 +48,23 @@ hypre_StructCopy( hypre_StructVector *x,
       x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
       y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
 
-      xp = hypre_StructVectorBoxData(x, i);
-      yp = hypre_StructVectorBoxData(y, i);
-
       hypre_BoxGetSize(box, loop_size);
 
-#define DEVICE_VAR is_device_ptr(yp,xp)
-      hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
-                          x_data_box, start, unit_stride, xi,
-                          y_data_box, start, unit_stride, yi);
+      for (c = 0; c < num_components; c++)
       {
-         yp[yi] = xp[xi];
-      }
-      hypre_BoxLoop2End(xi, yi);
+         xp = hypre_StructVectorBoxDataComponent(x, i, c);
+         yp = hypre_StructVectorBoxDataComponent(y, i, c);
+
+#define DEVICE_VAR is_device_ptr(yp,xp)
+         hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                             x_data_box, start, unit_stride, xi,
+                             y_data_box, start, unit_stride, yi);
+         {
+            yp[yi] = xp[xi];
+         }
+         hypre_BoxLoop2End(xi, yi);
 #undef DEVICE_VAR
+      }
    }
 
    return hypre_error_flag;
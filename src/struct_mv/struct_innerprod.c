@@ -15,16 +15,17 @@
 #include "_hypre_struct_mv.hpp"
 
 /*--------------------------------------------------------------------------
- * hypre_StructInnerProd
+ * hypre_StructInnerProdLocal
+ *
+ * Computes the local (on-process) inner products of the components of x and
+ * y, one entry of local_results per component.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Real
-hypre_StructInnerProd( hypre_StructVector *x,
-                       hypre_StructVector *y )
+HYPRE_Int
+hypre_StructInnerProdLocal( hypre_StructVector *x,
+                            hypre_StructVector *y,
+                            HYPRE_Real         *local_results )
 {
-   HYPRE_Real       final_innerprod_result;
-   HYPRE_Real       process_result;
-
    hypre_Box       *x_data_box;
    hypre_Box       *y_data_box;
 
@@ -38,13 +39,17 @@ hypre_StructInnerProd( hypre_StructVector *x,
    hypre_Index      unit_stride;
 
    HYPRE_Int        ndim = hypre_StructVectorNDim(x);
-   HYPRE_Int        i;
+   HYPRE_Int        num_components = hypre_StructVectorNumComponents(y);
+   HYPRE_Int        i, c;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    //const HYPRE_Int  data_location = hypre_StructGridDataLocation(hypre_StructVectorGrid(y));
 #endif
 
-   HYPRE_Real       local_result = 0.0;
+   for (c = 0; c < num_components; c++)
+   {
+      local_results[c] = 0.0;
+   }
 
    hypre_SetIndex(unit_stride, 1);
 
@@ -57,19 +62,21 @@ hypre_StructInnerProd( hypre_StructVector *x,
       x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
       y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
 
-      xp = hypre_StructVectorBoxData(x, i);
-      yp = hypre_StructVectorBoxData(y, i);
-
       hypre_BoxGetSize(box, loop_size);
 
+      for (c = 0; c < num_components; c++)
+      {
+         xp = hypre_StructVectorBoxDataComponent(x, i, c);
+         yp = hypre_StructVectorBoxDataComponent(y, i, c);
+
 #if defined(HYPRE_USING_KOKKOS)
-      HYPRE_Real box_sum = 0.0;
+         HYPRE_Real box_sum = 0.0;
 #elif defined(HYPRE_USING_RAJA)
-      ReduceSum<hypre_raja_reduce_policy, HYPRE_Real> box_sum(0.0);
+         ReduceSum<hypre_raja_reduce_policy, HYPRE_Real> box_sum(0.0);
 #elif defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-      ReduceSum<HYPRE_Real> box_sum(0.0);
+         ReduceSum<HYPRE_Real> box_sum(0.0);
 #else
-      HYPRE_Real box_sum = 0.0;
+         HYPRE_Real box_sum = 0.0;
 #endif
 
 #ifdef HYPRE_BOX_REDUCTION
@@ -83,20 +90,59 @@ hypre_StructInnerProd( hypre_StructVector *x,
 #endif
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-      hypre_BoxLoop2ReductionBegin(ndim, loop_size,
-                                   x_data_box, start, unit_stride, xi,
-                                   y_data_box, start, unit_stride, yi,
-                                   box_sum)
-      {
-         HYPRE_Real tmp = xp[xi] * hypre_conj(yp[yi]);
-         box_sum += tmp;
+         hypre_BoxLoop2ReductionBegin(ndim, loop_size,
+                                      x_data_box, start, unit_stride, xi,
+                                      y_data_box, start, unit_stride, yi,
+                                      box_sum)
+         {
+            HYPRE_Real tmp = xp[xi] * hypre_conj(yp[yi]);
+            box_sum += tmp;
+         }
+         hypre_BoxLoop2ReductionEnd(xi, yi, box_sum);
+
+         local_results[c] += (HYPRE_Real) box_sum;
       }
-      hypre_BoxLoop2ReductionEnd(xi, yi, box_sum);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd
+ *
+ * For vectors with several components, this is the inner product of the
+ * stacked vectors, i.e., the sum of the component inner products.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructInnerProd( hypre_StructVector *x,
+                       hypre_StructVector *y )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   HYPRE_Int        num_components = hypre_StructVectorNumComponents(y);
+   HYPRE_Real       local_result1;
+   HYPRE_Real      *local_results = &local_result1;
+   HYPRE_Int        c;
 
-      local_result += (HYPRE_Real) box_sum;
+   if (num_components > 1)
+   {
+      local_results = hypre_TAlloc(HYPRE_Real, num_components, HYPRE_MEMORY_HOST);
    }
 
-   process_result = (HYPRE_Real) local_result;
+   hypre_StructInnerProdLocal(x, y, local_results);
+
+   process_result = 0.0;
+   for (c = 0; c < num_components; c++)
+   {
+      process_result += local_results[c];
+   }
+
+   if (num_components > 1)
+   {
+      hypre_TFree(local_results, HYPRE_MEMORY_HOST);
+   }
 
    hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
                        HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
@@ -105,3 +151,32 @@ hypre_StructInnerProd( hypre_StructVector *x,
 
    return final_innerprod_result;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProdComponents
+ *
+ * Computes the inner products of the individual components of x and y with a
+ * single reduction.  The results array has one entry per component.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructInnerProdComponents( hypre_StructVector *x,
+                                 hypre_StructVector *y,
+                                 HYPRE_Real         *results )
+{
+   HYPRE_Int        num_components = hypre_StructVectorNumComponents(y);
+   HYPRE_Real      *local_results;
+
+   local_results = hypre_TAlloc(HYPRE_Real, num_components, HYPRE_MEMORY_HOST);
+
+   hypre_StructInnerProdLocal(x, y, local_results);
+
+   hypre_MPI_Allreduce(local_results, results, num_components,
+                       HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
+
+   hypre_TFree(local_results, HYPRE_MEMORY_HOST);
+
+   hypre_IncFLOPCount(2*hypre_StructVectorGlobalSize(x));
+
+   return hypre_error_flag;
+}
@@ -20,6 +20,14 @@
 #endif
 #define MAX_DEPTH 7
 
+/* single-pass and multi-component kernels are only built for host loops */
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_STRUCT_MATVEC_FUSED
+#endif
+
+/* number of vector components processed per pass of hypre_StructMatvecMulti */
+#define MAX_COMPONENTS 8
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecData data structure
  *--------------------------------------------------------------------------*/
@@ -29,6 +37,7 @@ typedef struct
    hypre_StructMatrix  *A;
    hypre_StructVector  *x;
    hypre_ComputePkg    *compute_pkg;
+   HYPRE_Int            fused_size;  /* stencil size of the fused kernel, 0 if none */
 
 } hypre_StructMatvecData;
 
@@ -70,7 +79,8 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    stencil = hypre_StructMatrixStencil(A);
 
    hypre_CreateComputeInfo(grid, stencil, &compute_info);
-   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
+   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x),
+                          hypre_StructVectorNumComponents(x),
                           grid, &compute_pkg);
 
    /*----------------------------------------------------------
@@ -80,6 +90,7 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    (matvec_data -> A)           = hypre_StructMatrixRef(A);
    (matvec_data -> x)           = hypre_StructVectorRef(x);
    (matvec_data -> compute_pkg) = compute_pkg;
+   (matvec_data -> fused_size)  = hypre_StructMatvecFusedSize(stencil);
 
    return hypre_error_flag;
 }
@@ -115,9 +126,11 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    hypre_IndexRef           stride;
 
    HYPRE_Int                constant_coefficient;
+   HYPRE_Int                num_components;
+   HYPRE_Int                fused, multi;
 
    HYPRE_Complex            temp;
-   HYPRE_Int                compute_i, i;
+   HYPRE_Int                compute_i, i, c;
 
    hypre_StructVector      *x_tmp = NULL;
 
@@ -132,6 +145,23 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
 
    stride = hypre_ComputePkgStride(compute_pkg);
 
+   num_components = hypre_StructVectorNumComponents(x);
+   if (hypre_StructVectorNumComponents(y) != num_components ||
+       hypre_ComputePkgNumValues(compute_pkg) != num_components)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Number of vector components does not match the matvec setup\n");
+      return hypre_error_flag;
+   }
+
+   /* the fused and multi-component kernels also apply beta, so y is written
+    * only once */
+   multi = (num_components > 1);
+   fused = ( !multi &&
+             (matvec_data -> fused_size) > 0 &&
+             (matvec_data -> fused_size) ==
+             hypre_StructStencilSize(hypre_StructMatrixStencil(A)) );
+
    /*-----------------------------------------------------------------------
     * Do (alpha == 0.0) computation
     *-----------------------------------------------------------------------*/
@@ -145,18 +175,22 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
          start = hypre_BoxIMin(box);
 
          y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
-         yp = hypre_StructVectorBoxData(y, i);
 
          hypre_BoxGetSize(box, loop_size);
 
-#define DEVICE_VAR is_device_ptr(yp)
-         hypre_BoxLoop1Begin(hypre_StructVectorNDim(x), loop_size,
-                             y_data_box, start, stride, yi);
+         for (c = 0; c < num_components; c++)
          {
-            yp[yi] *= beta;
-         }
-         hypre_BoxLoop1End(yi);
+            yp = hypre_StructVectorBoxDataComponent(y, i, c);
+
+#define DEVICE_VAR is_device_ptr(yp)
+            hypre_BoxLoop1Begin(hypre_StructVectorNDim(x), loop_size,
+                                y_data_box, start, stride, yi);
+            {
+               yp[yi] *= beta;
+            }
+            hypre_BoxLoop1End(yi);
 #undef DEVICE_VAR
+         }
       }
 
       return hypre_error_flag;
@@ -195,7 +229,7 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
             {
                temp = beta / alpha;
             }
-            if (temp != 1.0)
+            if (temp != 1.0 && !fused && !multi)
             {
                boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
                hypre_ForBoxI(i, boxes)
@@ -248,6 +282,18 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
        * y += A*x
        *--------------------------------------------------------------------*/
 
+      if (multi)
+      {
+         hypre_StructMatvecMulti( alpha, A, x, beta, y, compute_box_aa, stride );
+         continue;
+      }
+
+      if (fused)
+      {
+         hypre_StructMatvecFused( alpha, A, x, beta, y, compute_box_aa, stride );
+         continue;
+      }
+
       switch( constant_coefficient )
       {
          case 0:
@@ -1373,6 +1419,479 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFusedSize
+ *
+ * Returns the stencil size if hypre_StructMatvecFused has a kernel for the
+ * stencil (5- and 9-point in 2D, 7-, 19- and 27-point in 3D, with all entries
+ * within unit distance of the center), and 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFusedSize( hypre_StructStencil *stencil )
+{
+#ifdef HYPRE_STRUCT_MATVEC_FUSED
+   hypre_Index *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int    stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int    ndim          = hypre_StructStencilNDim(stencil);
+   HYPRE_Int    si, d;
+
+   switch (stencil_size)
+   {
+      case 5:
+      case 9:
+         if (ndim != 2)
+         {
+            return 0;
+         }
+         break;
+
+      case 7:
+      case 19:
+      case 27:
+         if (ndim != 3)
+         {
+            return 0;
+         }
+         break;
+
+      default:
+         return 0;
+   }
+
+   for (si = 0; si < stencil_size; si++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_abs(hypre_IndexD(stencil_shape[si], d)) > 1)
+         {
+            return 0;
+         }
+      }
+   }
+
+   return stencil_size;
+#else
+   return 0;
+#endif
+}
+
+#ifdef HYPRE_STRUCT_MATVEC_FUSED
+
+/* Apply M to the stencil entries 0, ..., n-1. The fused kernels name the
+ * pointers, offsets and constants of each entry separately so that they stay
+ * in registers (and are passed by value into OpenMP regions). */
+#define hypre_SMV_LIST5(M)  M(0) M(1) M(2) M(3) M(4)
+#define hypre_SMV_LIST7(M)  hypre_SMV_LIST5(M) M(5) M(6)
+#define hypre_SMV_LIST9(M)  hypre_SMV_LIST7(M) M(7) M(8)
+#define hypre_SMV_LIST19(M) hypre_SMV_LIST9(M) M(9) M(10) M(11) M(12) M(13) \
+                            M(14) M(15) M(16) M(17) M(18)
+#define hypre_SMV_LIST27(M) hypre_SMV_LIST19(M) M(19) M(20) M(21) M(22) \
+                            M(23) M(24) M(25) M(26)
+
+#define hypre_SMV_DECLARE(s)                                            \
+   HYPRE_Complex *Ap##s = NULL;                                         \
+   HYPRE_Complex  AAp##s = 0.0;                                         \
+   HYPRE_Int      xoff##s = 0;
+
+#define hypre_SMV_SET(s)                                                \
+   Ap##s   = hypre_StructMatrixBoxData(A, i, s);                        \
+   xoff##s = hypre_BoxOffsetDistance(x_data_box, stencil_shape[s]);
+
+/* constant coefficients; a variable center (si_center) is left out */
+#define hypre_SMV_SET_CONST(s)                                          \
+   hypre_SMV_SET(s)                                                     \
+   AAp##s = (s == si_center) ? 0.0 : Ap##s[Ai_CC];
+
+#define hypre_SMV_TERM(s)       + Ap##s[Ai] * xp[xi + xoff##s]
+#define hypre_SMV_TERM_CONST(s) + AAp##s * xp[xi + xoff##s]
+
+/* all coefficients variable */
+#define hypre_SMV_CASE_CC0(n)                                           \
+   case n:                                                              \
+   {                                                                    \
+      hypre_SMV_LIST##n(hypre_SMV_SET)                                  \
+      if (beta == 0.0)                                                  \
+      {                                                                 \
+         hypre_BoxLoop3Begin(ndim, loop_size,                           \
+                             A_data_box, start, stride, Ai,             \
+                             x_data_box, start, stride, xi,             \
+                             y_data_box, start, stride, yi);            \
+         {                                                              \
+            yp[yi] = alpha * ( hypre_SMV_LIST##n(hypre_SMV_TERM) );     \
+         }                                                              \
+         hypre_BoxLoop3End(Ai, xi, yi);                                 \
+      }                                                                 \
+      else                                                              \
+      {                                                                 \
+         hypre_BoxLoop3Begin(ndim, loop_size,                           \
+                             A_data_box, start, stride, Ai,             \
+                             x_data_box, start, stride, xi,             \
+                             y_data_box, start, stride, yi);            \
+         {                                                              \
+            yp[yi] = beta * yp[yi] +                                    \
+                     alpha * ( hypre_SMV_LIST##n(hypre_SMV_TERM) );     \
+         }                                                              \
+         hypre_BoxLoop3End(Ai, xi, yi);                                 \
+      }                                                                 \
+   }                                                                    \
+   break;
+
+/* all coefficients constant */
+#define hypre_SMV_CASE_CC1(n)                                           \
+   case n:                                                              \
+   {                                                                    \
+      hypre_SMV_LIST##n(hypre_SMV_SET_CONST)                            \
+      if (beta == 0.0)                                                  \
+      {                                                                 \
+         hypre_BoxLoop2Begin(ndim, loop_size,                           \
+                             x_data_box, start, stride, xi,             \
+                             y_data_box, start, stride, yi);            \
+         {                                                              \
+            yp[yi] = alpha * ( hypre_SMV_LIST##n(hypre_SMV_TERM_CONST) ); \
+         }                                                              \
+         hypre_BoxLoop2End(xi, yi);                                     \
+      }                                                                 \
+      else                                                              \
+      {                                                                 \
+         hypre_BoxLoop2Begin(ndim, loop_size,                           \
+                             x_data_box, start, stride, xi,             \
+                             y_data_box, start, stride, yi);            \
+         {                                                              \
+            yp[yi] = beta * yp[yi] +                                    \
+                     alpha * ( hypre_SMV_LIST##n(hypre_SMV_TERM_CONST) ); \
+         }                                                              \
+         hypre_BoxLoop2End(xi, yi);                                     \
+      }                                                                 \
+   }                                                                    \
+   break;
+
+/* constant off-diagonal coefficients, variable diagonal */
+#define hypre_SMV_CASE_CC2(n)                                           \
+   case n:                                                              \
+   {                                                                    \
+      hypre_SMV_LIST##n(hypre_SMV_SET_CONST)                            \
+      if (beta == 0.0)                                                  \
+      {                                                                 \
+         hypre_BoxLoop3Begin(ndim, loop_size,                           \
+                             A_data_box, start, stride, Ai,             \
+                             x_data_box, start, stride, xi,             \
+                             y_data_box, start, stride, yi);            \
+         {                                                              \
+            yp[yi] = alpha * ( Apc[Ai] * xp[xi + xoffc]                 \
+                               hypre_SMV_LIST##n(hypre_SMV_TERM_CONST) ); \
+         }                                                              \
+         hypre_BoxLoop3End(Ai, xi, yi);                                 \
+      }                                                                 \
+      else                                                              \
+      {                                                                 \
+         hypre_BoxLoop3Begin(ndim, loop_size,                           \
+                             A_data_box, start, stride, Ai,             \
+                             x_data_box, start, stride, xi,             \
+                             y_data_box, start, stride, yi);            \
+         {                                                              \
+            yp[yi] = beta * yp[yi] +                                    \
+                     alpha * ( Apc[Ai] * xp[xi + xoffc]                 \
+                               hypre_SMV_LIST##n(hypre_SMV_TERM_CONST) ); \
+         }                                                              \
+         hypre_BoxLoop3End(Ai, xi, yi);                                 \
+      }                                                                 \
+   }                                                                    \
+   break;
+
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFused
+ *
+ * Computes y = beta*y + alpha*A*x on the compute boxes in a single pass for
+ * the stencils accepted by hypre_StructMatvecFusedSize: every coefficient
+ * and x value is read once and y is written once, instead of once per group
+ * of MAX_DEPTH stencil entries as in hypre_StructMatvecCC0/1/2.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFused( HYPRE_Complex        alpha,
+                         hypre_StructMatrix  *A,
+                         hypre_StructVector  *x,
+                         HYPRE_Complex        beta,
+                         hypre_StructVector  *y,
+                         hypre_BoxArrayArray *compute_box_aa,
+                         hypre_IndexRef       stride )
+{
+#ifdef HYPRE_STRUCT_MATVEC_FUSED
+   HYPRE_Int                i, j;
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+   HYPRE_Int                constant_coefficient;
+   HYPRE_Int                si_center, Ai_CC;
+   hypre_Index              center_index;
+
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   HYPRE_Complex           *Apc   = NULL;
+   HYPRE_Int                xoffc = 0;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+
+   hypre_SMV_LIST27(hypre_SMV_DECLARE)
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   si_center = -1;
+   if (constant_coefficient == 2)
+   {
+      hypre_SetIndex(center_index, 0);
+      si_center = hypre_StructStencilElementRank(stencil, center_index);
+   }
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      if (constant_coefficient == 2)
+      {
+         Apc   = hypre_StructMatrixBoxData(A, i, si_center);
+         xoffc = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si_center]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start  = hypre_BoxIMin(compute_box);
+
+         switch (constant_coefficient)
+         {
+            case 0:
+               switch (stencil_size)
+               {
+                  hypre_SMV_CASE_CC0(5)
+                  hypre_SMV_CASE_CC0(7)
+                  hypre_SMV_CASE_CC0(9)
+                  hypre_SMV_CASE_CC0(19)
+                  hypre_SMV_CASE_CC0(27)
+               }
+               break;
+
+            case 1:
+               Ai_CC = 0;
+               switch (stencil_size)
+               {
+                  hypre_SMV_CASE_CC1(5)
+                  hypre_SMV_CASE_CC1(7)
+                  hypre_SMV_CASE_CC1(9)
+                  hypre_SMV_CASE_CC1(19)
+                  hypre_SMV_CASE_CC1(27)
+               }
+               break;
+
+            case 2:
+               Ai_CC = hypre_CCBoxIndexRank(A_data_box, start);
+               switch (stencil_size)
+               {
+                  hypre_SMV_CASE_CC2(5)
+                  hypre_SMV_CASE_CC2(7)
+                  hypre_SMV_CASE_CC2(9)
+                  hypre_SMV_CASE_CC2(19)
+                  hypre_SMV_CASE_CC2(27)
+               }
+               break;
+         }
+      }
+   }
+#else
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Fused struct matvec kernels are not available\n");
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecMulti
+ *
+ * Computes y = beta*y + alpha*A*x on the compute boxes for vectors with
+ * several components.  Any stencil and constant coefficient type is handled.
+ * The components are processed MAX_COMPONENTS at a time, and each matrix
+ * coefficient is read once per group of components instead of once per
+ * component.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecMulti( HYPRE_Complex        alpha,
+                         hypre_StructMatrix  *A,
+                         hypre_StructVector  *x,
+                         HYPRE_Complex        beta,
+                         hypre_StructVector  *y,
+                         hypre_BoxArrayArray *compute_box_aa,
+                         hypre_IndexRef       stride )
+{
+#ifdef HYPRE_STRUCT_MATVEC_FUSED
+   HYPRE_Int                i, j, si, c0;
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+   HYPRE_Int                constant_coefficient;
+   HYPRE_Int                si_center, Ai_CC;
+   hypre_Index              center_index;
+
+   HYPRE_Complex          **Ap;
+   HYPRE_Complex           *AAp;
+   HYPRE_Int               *Avar;
+   HYPRE_Int               *xoff;
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   HYPRE_Int                xvol, yvol;
+   HYPRE_Int                num_components, nc;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   num_components = hypre_StructVectorNumComponents(x);
+
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   si_center = -1;
+   if (constant_coefficient == 2)
+   {
+      hypre_SetIndex(center_index, 0);
+      si_center = hypre_StructStencilElementRank(stencil, center_index);
+   }
+
+   Ap   = hypre_TAlloc(HYPRE_Complex *, stencil_size, HYPRE_MEMORY_HOST);
+   AAp  = hypre_CTAlloc(HYPRE_Complex, stencil_size, HYPRE_MEMORY_HOST);
+   Avar = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+
+   for (si = 0; si < stencil_size; si++)
+   {
+      Avar[si] = (constant_coefficient == 0 || si == si_center);
+   }
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xvol = hypre_BoxVolume(x_data_box);
+      yvol = hypre_BoxVolume(y_data_box);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         Ap[si]   = hypre_StructMatrixBoxData(A, i, si);
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start  = hypre_BoxIMin(compute_box);
+
+         if (constant_coefficient)
+         {
+            Ai_CC = hypre_CCBoxIndexRank(A_data_box, start);
+            for (si = 0; si < stencil_size; si++)
+            {
+               if (!Avar[si])
+               {
+                  AAp[si] = Ap[si][Ai_CC];
+               }
+            }
+         }
+
+         for (c0 = 0; c0 < num_components; c0 += MAX_COMPONENTS)
+         {
+            nc = hypre_min(MAX_COMPONENTS, num_components - c0);
+            xp = hypre_StructVectorBoxDataComponent(x, i, c0);
+            yp = hypre_StructVectorBoxDataComponent(y, i, c0);
+
+            hypre_BoxLoop3Begin(ndim, loop_size,
+                                A_data_box, start, stride, Ai,
+                                x_data_box, start, stride, xi,
+                                y_data_box, start, stride, yi);
+            {
+               HYPRE_Complex sum[MAX_COMPONENTS];
+               HYPRE_Complex a;
+               HYPRE_Int     s, c;
+
+               for (c = 0; c < nc; c++)
+               {
+                  sum[c] = 0.0;
+               }
+               for (s = 0; s < stencil_size; s++)
+               {
+                  a = Avar[s] ? Ap[s][Ai] : AAp[s];
+                  for (c = 0; c < nc; c++)
+                  {
+                     sum[c] += a * xp[xi + xoff[s] + c*xvol];
+                  }
+               }
+               if (beta == 0.0)
+               {
+                  for (c = 0; c < nc; c++)
+                  {
+                     yp[yi + c*yvol] = alpha * sum[c];
+                  }
+               }
+               else
+               {
+                  for (c = 0; c < nc; c++)
+                  {
+                     yp[yi + c*yvol] = beta * yp[yi + c*yvol] + alpha * sum[c];
+                  }
+               }
+            }
+            hypre_BoxLoop3End(Ai, xi, yi);
+         }
+      }
+   }
+
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(AAp, HYPRE_MEMORY_HOST);
+   hypre_TFree(Avar, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+#else
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Multi-component struct matvec kernels are not available\n");
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecDestroy
  *--------------------------------------------------------------------------*/
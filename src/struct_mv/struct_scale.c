@@ -32,7 +32,8 @@ hypre_StructScale( HYPRE_Complex       alpha,
    hypre_IndexRef   start;
    hypre_Index      unit_stride;
 
-   HYPRE_Int        i;
+   HYPRE_Int        num_components = hypre_StructVectorNumComponents(y);
+   HYPRE_Int        i, c;
 
    hypre_SetIndex(unit_stride, 1);
 
@@ -43,18 +44,22 @@ hypre_StructScale( HYPRE_Complex       alpha,
       start = hypre_BoxIMin(box);
 
       y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
-      yp = hypre_StructVectorBoxData(y, i);
 
       hypre_BoxGetSize(box, loop_size);
 
-#define DEVICE_VAR is_device_ptr(yp)
-      hypre_BoxLoop1Begin(hypre_StructVectorNDim(y), loop_size,
-                          y_data_box, start, unit_stride, yi);
+      for (c = 0; c < num_components; c++)
       {
-         yp[yi] *= alpha;
-      }
-      hypre_BoxLoop1End(yi);
+         yp = hypre_StructVectorBoxDataComponent(y, i, c);
+
+#define DEVICE_VAR is_device_ptr(yp)
+         hypre_BoxLoop1Begin(hypre_StructVectorNDim(y), loop_size,
+                             y_data_box, start, unit_stride, yi);
+         {
+            yp[yi] *= alpha;
+         }
+         hypre_BoxLoop1End(yi);
 #undef DEVICE_VAR
+      }
    }
 
    return hypre_error_flag;
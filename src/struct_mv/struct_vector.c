@@ -30,6 +30,7 @@ hypre_StructVectorCreate( MPI_Comm          comm,
    hypre_StructVectorComm(vector)           = comm;
    hypre_StructGridRef(grid, &hypre_StructVectorGrid(vector));
    hypre_StructVectorDataAlloced(vector)    = 1;
+   hypre_StructVectorNumComponents(vector)  = 1;
    hypre_StructVectorBGhostNotClear(vector) = 0;
    hypre_StructVectorRefCount(vector)       = 1;
 
@@ -108,6 +109,7 @@ hypre_StructVectorInitializeShell( hypre_StructVector *vector )
 
    HYPRE_Int            *data_indices;
    HYPRE_Int             data_size;
+   HYPRE_Int             num_components = hypre_StructVectorNumComponents(vector);
 
    HYPRE_Int             i, d;
 
@@ -155,7 +157,7 @@ hypre_StructVectorInitializeShell( hypre_StructVector *vector )
          data_box = hypre_BoxArrayBox(data_space, i);
 
          data_indices[i] = data_size;
-         data_size += hypre_BoxVolume(data_box);
+         data_size += hypre_BoxVolume(data_box) * num_components;
       }
 
       hypre_StructVectorDataIndices(vector) = data_indices;
@@ -168,7 +170,8 @@ hypre_StructVectorInitializeShell( hypre_StructVector *vector )
     * Set total number of nonzero coefficients
     *-----------------------------------------------------------------------*/
 
-   hypre_StructVectorGlobalSize(vector) = hypre_StructGridGlobalSize(grid);
+   hypre_StructVectorGlobalSize(vector) =
+      hypre_StructGridGlobalSize(grid) * num_components;
 
    return hypre_error_flag;
 }
@@ -609,6 +612,37 @@ hypre_StructVectorSetNumGhost( hypre_StructVector *vector,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * Sets the number of vectors stored in 'vector'.  Must be called before the
+ * vector is initialized.  The solver kernels process all components in one
+ * pass, while the box value routines (SetValues, GetBoxValues, ...) access
+ * component 0 only; see hypre_StructVectorCopyComponent.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorSetNumComponents( hypre_StructVector *vector,
+                                    HYPRE_Int           num_components )
+{
+   if (num_components < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   if (hypre_StructVectorDataIndices(vector) != NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Number of components must be set before the vector is initialized\n");
+      return hypre_error_flag;
+   }
+
+   hypre_StructVectorNumComponents(vector) = num_components;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -663,7 +697,8 @@ hypre_StructVectorCopy( hypre_StructVector *x,
    hypre_IndexRef      start;
    hypre_Index         unit_stride;
 
-   HYPRE_Int           i;
+   HYPRE_Int           num_components = hypre_StructVectorNumComponents(x);
+   HYPRE_Int           i, c;
 
    /*-----------------------------------------------------------------------
     * Set the vector coefficients
@@ -679,18 +714,86 @@ hypre_StructVectorCopy( hypre_StructVector *x,
 
       x_data_box =
          hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
-      xp = hypre_StructVectorBoxData(x, i);
-      yp = hypre_StructVectorBoxData(y, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+      for (c = 0; c < num_components; c++)
+      {
+         xp = hypre_StructVectorBoxDataComponent(x, i, c);
+         yp = hypre_StructVectorBoxDataComponent(y, i, c);
+
+#define DEVICE_VAR is_device_ptr(yp,xp)
+         hypre_BoxLoop1Begin(hypre_StructVectorNDim(x), loop_size,
+                             x_data_box, start, unit_stride, vi);
+         {
+            yp[vi] = xp[vi];
+         }
+         hypre_BoxLoop1End(vi);
+#undef DEVICE_VAR
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Copies component x_comp of x into component y_comp of y on the grid boxes.
+ * As in hypre_StructVectorCopy, x and y are assumed to live on the same grid.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorCopyComponent( hypre_StructVector *x,
+                                 HYPRE_Int           x_comp,
+                                 hypre_StructVector *y,
+                                 HYPRE_Int           y_comp )
+{
+   hypre_Box          *x_data_box;
+   hypre_Box          *y_data_box;
+
+   HYPRE_Complex      *xp, *yp;
+
+   hypre_BoxArray     *boxes;
+   hypre_Box          *box;
+   hypre_Index         loop_size;
+   hypre_IndexRef      start;
+   hypre_Index         unit_stride;
+
+   HYPRE_Int           i;
+
+   if (x_comp < 0 || x_comp >= hypre_StructVectorNumComponents(x))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   if (y_comp < 0 || y_comp >= hypre_StructVectorNumComponents(y))
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes( hypre_StructVectorGrid(y) );
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+      xp = hypre_StructVectorBoxDataComponent(x, i, x_comp);
+      yp = hypre_StructVectorBoxDataComponent(y, i, y_comp);
 
       hypre_BoxGetSize(box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-      hypre_BoxLoop1Begin(hypre_StructVectorNDim(x), loop_size,
-                          x_data_box, start, unit_stride, vi);
+      hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                          x_data_box, start, unit_stride, xi,
+                          y_data_box, start, unit_stride, yi);
       {
-         yp[vi] = xp[vi];
+         yp[yi] = xp[xi];
       }
-      hypre_BoxLoop1End(vi);
+      hypre_BoxLoop2End(xi, yi);
 #undef DEVICE_VAR
    }
 
@@ -714,7 +817,8 @@ hypre_StructVectorSetConstantValues( hypre_StructVector *vector,
    hypre_IndexRef      start;
    hypre_Index         unit_stride;
 
-   HYPRE_Int           i;
+   HYPRE_Int           num_components = hypre_StructVectorNumComponents(vector);
+   HYPRE_Int           i, c;
 
    /*-----------------------------------------------------------------------
     * Set the vector coefficients
@@ -730,18 +834,22 @@ hypre_StructVectorSetConstantValues( hypre_StructVector *vector,
 
       v_data_box =
          hypre_BoxArrayBox(hypre_StructVectorDataSpace(vector), i);
-      vp = hypre_StructVectorBoxData(vector, i);
 
       hypre_BoxGetSize(box, loop_size);
 
-#define DEVICE_VAR is_device_ptr(vp)
-      hypre_BoxLoop1Begin(hypre_StructVectorNDim(vector), loop_size,
-                          v_data_box, start, unit_stride, vi);
+      for (c = 0; c < num_components; c++)
       {
-         vp[vi] = values;
-      }
-      hypre_BoxLoop1End(vi);
+         vp = hypre_StructVectorBoxDataComponent(vector, i, c);
+
+#define DEVICE_VAR is_device_ptr(vp)
+         hypre_BoxLoop1Begin(hypre_StructVectorNDim(vector), loop_size,
+                             v_data_box, start, unit_stride, vi);
+         {
+            vp[vi] = values;
+         }
+         hypre_BoxLoop1End(vi);
 #undef DEVICE_VAR
+      }
    }
 
    return hypre_error_flag;
@@ -825,7 +933,8 @@ hypre_StructVectorClearGhostValues( hypre_StructVector *vector )
    hypre_IndexRef      start;
    hypre_Index         unit_stride;
 
-   HYPRE_Int           i, j;
+   HYPRE_Int           num_components = hypre_StructVectorNumComponents(vector);
+   HYPRE_Int           i, j, c;
 
    /*-----------------------------------------------------------------------
     * Set the vector coefficients
@@ -842,22 +951,25 @@ hypre_StructVectorClearGhostValues( hypre_StructVector *vector )
       hypre_BoxArraySetSize(diff_boxes, 0);
       hypre_SubtractBoxes(v_data_box, box, diff_boxes);
 
-      vp = hypre_StructVectorBoxData(vector, i);
-      hypre_ForBoxI(j, diff_boxes)
+      for (c = 0; c < num_components; c++)
       {
-         diff_box = hypre_BoxArrayBox(diff_boxes, j);
-         start = hypre_BoxIMin(diff_box);
+         vp = hypre_StructVectorBoxDataComponent(vector, i, c);
+         hypre_ForBoxI(j, diff_boxes)
+         {
+            diff_box = hypre_BoxArrayBox(diff_boxes, j);
+            start = hypre_BoxIMin(diff_box);
 
-         hypre_BoxGetSize(diff_box, loop_size);
+            hypre_BoxGetSize(diff_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(vp)
-         hypre_BoxLoop1Begin(hypre_StructVectorNDim(vector), loop_size,
-                             v_data_box, start, unit_stride, vi);
-         {
-            vp[vi] = 0.0;
-         }
-         hypre_BoxLoop1End(vi);
+            hypre_BoxLoop1Begin(hypre_StructVectorNDim(vector), loop_size,
+                                v_data_box, start, unit_stride, vi);
+            {
+               vp[vi] = 0.0;
+            }
+            hypre_BoxLoop1End(vi);
 #undef DEVICE_VAR
+         }
       }
    }
    hypre_BoxArrayDestroy(diff_boxes);
@@ -887,7 +999,8 @@ hypre_StructVectorClearBoundGhostValues( hypre_StructVector *vector,
    hypre_BoxArray     *array_of_box;
    hypre_BoxArray     *work_boxarray;
 
-   HYPRE_Int           i, i2;
+   HYPRE_Int           num_components = hypre_StructVectorNumComponents(vector);
+   HYPRE_Int           i, i2, c;
 
    /*-----------------------------------------------------------------------
     * Set the vector coefficients
@@ -907,7 +1020,6 @@ hypre_StructVectorClearBoundGhostValues( hypre_StructVector *vector,
          v_data_box =
             hypre_BoxArrayBox(hypre_StructVectorDataSpace(vector), i);
          hypre_BoxBoundaryG( v_data_box, grid, boundary_boxes );
-         vp = hypre_StructVectorBoxData(vector, i);
 
          /* box is a grid box, no ghost zones.
             v_data_box is vector data box, may or may not have ghost zones
@@ -917,19 +1029,23 @@ hypre_StructVectorClearBoundGhostValues( hypre_StructVector *vector,
          hypre_BoxArrayBoxes(array_of_box)[0] = *box;
          hypre_SubtractBoxArrays( boundary_boxes, array_of_box, work_boxarray );
 
-         hypre_ForBoxI(i2, boundary_boxes)
+         for (c = 0; c < num_components; c++)
          {
-            bbox       = hypre_BoxArrayBox(boundary_boxes, i2);
-            hypre_BoxGetSize(bbox, loop_size);
-            start = hypre_BoxIMin(bbox);
-#define DEVICE_VAR is_device_ptr(vp)
-            hypre_BoxLoop1Begin(hypre_StructVectorNDim(vector), loop_size,
-                                v_data_box, start, stride, vi);
+            vp = hypre_StructVectorBoxDataComponent(vector, i, c);
+            hypre_ForBoxI(i2, boundary_boxes)
             {
-               vp[vi] = 0.0;
-            }
-            hypre_BoxLoop1End(vi);
+               bbox       = hypre_BoxArrayBox(boundary_boxes, i2);
+               hypre_BoxGetSize(bbox, loop_size);
+               start = hypre_BoxIMin(bbox);
+#define DEVICE_VAR is_device_ptr(vp)
+               hypre_BoxLoop1Begin(hypre_StructVectorNDim(vector), loop_size,
+                                   v_data_box, start, stride, vi);
+               {
+                  vp[vi] = 0.0;
+               }
+               hypre_BoxLoop1End(vi);
 #undef DEVICE_VAR
+            }
          }
          hypre_BoxArrayDestroy(boundary_boxes);
          hypre_BoxArrayDestroy(work_boxarray);
@@ -1000,7 +1116,8 @@ hypre_StructVectorGetMigrateCommPkg( hypre_StructVector *from_vector,
                                  &comm_info);
    hypre_CommPkgCreate(comm_info,
                        hypre_StructVectorDataSpace(from_vector),
-                       hypre_StructVectorDataSpace(to_vector), 1, NULL, 0,
+                       hypre_StructVectorDataSpace(to_vector),
+                       hypre_StructVectorNumComponents(from_vector), NULL, 0,
                        hypre_StructVectorComm(from_vector), &comm_pkg);
    hypre_CommInfoDestroy(comm_info);
    /* is this correct for periodic? */
@@ -1087,7 +1204,8 @@ hypre_StructVectorPrint( const char         *filename,
       boxes = hypre_StructGridBoxes(grid);
 
    hypre_fprintf(file, "\nData:\n");
-   hypre_PrintBoxArrayData(file, boxes, data_space, 1,
+   hypre_PrintBoxArrayData(file, boxes, data_space,
+                           hypre_StructVectorNumComponents(vector),
                            hypre_StructGridNDim(grid),
                            hypre_StructVectorData(vector));
 
@@ -1200,6 +1318,7 @@ hypre_StructVectorClone(
    HYPRE_Int            i;
    hypre_StructVector  *y = hypre_StructVectorCreate(comm, grid);
 
+   hypre_StructVectorNumComponents(y) = hypre_StructVectorNumComponents(x);
    hypre_StructVectorDataSize(y) = data_size;
    hypre_StructVectorDataSpace(y) = hypre_BoxArrayDuplicate(data_space);
    hypre_StructVectorData(y) =  hypre_CTAlloc(HYPRE_Complex,  data_size, HYPRE_MEMORY_DEVICE);
@@ -29,6 +29,10 @@ typedef struct hypre_StructVector_struct
    HYPRE_Complex        *data;         /* Pointer to vector data on device*/
    HYPRE_Int             data_alloced; /* Boolean used for freeing data */
    HYPRE_Int             data_size;    /* Size of vector data */
+   HYPRE_Int             num_components; /* Number of vectors stored; the
+                                            components of box b are stored
+                                            one after the other, each over
+                                            the full data box of b */
    HYPRE_Int            *data_indices; /* num-boxes array of indices into
                                           the data array.  data_indices[b]
                                           is the starting index of vector
@@ -55,6 +59,7 @@ typedef struct hypre_StructVector_struct
 #define hypre_StructVectorDataAlloced(vector)   ((vector) -> data_alloced)
 #define hypre_StructVectorDataSize(vector)      ((vector) -> data_size)
 #define hypre_StructVectorDataIndices(vector)   ((vector) -> data_indices)
+#define hypre_StructVectorNumComponents(vector) ((vector) -> num_components)
 #define hypre_StructVectorNumGhost(vector)      ((vector) -> num_ghost)
 #define hypre_StructVectorBGhostNotClear(vector)((vector) -> bghost_not_clear)
 #define hypre_StructVectorGlobalSize(vector)    ((vector) -> global_size)
@@ -69,6 +74,10 @@ hypre_BoxArrayBox(hypre_StructVectorDataSpace(vector), b)
 #define hypre_StructVectorBoxData(vector, b) \
 (hypre_StructVectorData(vector) + hypre_StructVectorDataIndices(vector)[b])
 
+#define hypre_StructVectorBoxDataComponent(vector, b, c) \
+(hypre_StructVectorBoxData(vector, b) + \
+ (c) * hypre_BoxVolume(hypre_StructVectorBox(vector, b)))
+
 #define hypre_StructVectorBoxDataValue(vector, b, index) \
 (hypre_StructVectorBoxData(vector, b) + \
  hypre_BoxIndexRank(hypre_StructVectorBox(vector, b), index))
@@ -0,0 +1,72 @@
+#!/bin/sh
+# Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+# HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+
+TNAME=`basename $0 .sh`
+RTOL=$1
+ATOL=$2
+
+#=============================================================================
+# Profiling must not change the results
+#=============================================================================
+
+for i in 0 2 4
+do
+   grep -E "Iterations|Relative Residual Norm" ${TNAME}.out.$i > ${TNAME}.testdata
+   grep -E "Iterations|Relative Residual Norm" ${TNAME}.out.`expr $i + 1` > ${TNAME}.testdata.temp
+   diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+#=============================================================================
+# The profiled runs print the region tree, and the last one writes one JSON
+# profile and trace per rank and a summary
+#=============================================================================
+
+for i in 1 3 5
+do
+   grep "hypre_BoomerAMGSetup" ${TNAME}.out.$i > ${TNAME}.testdata
+   if [ ! -s ${TNAME}.testdata ]; then
+      echo "No region tree in ${TNAME}.out.$i" >&2
+   fi
+done
+
+for i in summary.json 00000.json 00001.json 00000.trace.json 00001.trace.json
+do
+   if [ ! -s ${TNAME}.prof.$i ]; then
+      echo "Missing ${TNAME}.prof.$i" >&2
+   fi
+done
+
+#=============================================================================
+# compare with baseline case
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.0\
+ ${TNAME}.out.1\
+ ${TNAME}.out.2\
+ ${TNAME}.out.3\
+ ${TNAME}.out.4\
+ ${TNAME}.out.5\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep -E "Iterations|Relative Residual Norm" $i
+done > ${TNAME}.out
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+#=============================================================================
+# remove temporary files
+#=============================================================================
+
+rm -f ${TNAME}.testdata* ${TNAME}.prof.*
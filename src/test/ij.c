@@ -101,6 +101,7 @@ main( hypre_int argc,
    HYPRE_Int           check_constant = 0;
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
+   HYPRE_Int           coo = 0;
    HYPRE_Int           omp_flag = 0;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
@@ -118,11 +119,13 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           pcg_variant = 0;
+   HYPRE_Int           gmres_cgs = 0;
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
    HYPRE_Int           debug_flag;
    HYPRE_Int           ierr = 0;
-   HYPRE_Int           i,j;
+   HYPRE_Int           i,j,k;
    HYPRE_Int           max_levels = 25;
    HYPRE_Int           num_iterations;
    HYPRE_Int           pcg_num_its, dscg_num_its;
@@ -241,6 +244,9 @@ main( hypre_int argc,
    HYPRE_Real   add_trunc_factor = 0;
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
+   HYPRE_Int    mixed_precision = 0;
+   HYPRE_Int    reuse_rap = 0;
+   HYPRE_Int    amg_update = 0;
 #if defined(HYPRE_USING_GPU)
    HYPRE_Int    keepTranspose = 1;
 #else
@@ -295,6 +301,12 @@ main( hypre_int argc,
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
+
+   /* parameters for CAGMRES */
+   HYPRE_Int    s_step = 4;
+   HYPRE_Int    ca_basis = 1;
+   /* parameters for BPCG and BGMRES */
+   HYPRE_Int    num_rhs = 1;
    /* parameters for LGMRES */
    HYPRE_Int    aug_dim;
    /* parameters for GSMG */
@@ -312,6 +324,7 @@ main( hypre_int argc,
    HYPRE_Real   agg_P12_trunc_factor  = 0; /* default value */
 
    HYPRE_Int    print_system = 0;
+   HYPRE_Int    print_binary = 0;
    HYPRE_Int    rel_change = 0;
 
    /* begin lobpcg */
@@ -423,6 +436,12 @@ main( hypre_int argc,
 #if defined(HYPRE_USING_GPU)
    HYPRE_Int spgemm_use_cusparse = 1;
 #endif
+   HYPRE_Int spmv_use_sell = 0;
+   HYPRE_Int matvec_split = 0;
+   HYPRE_Int comm_transport = 0;
+   HYPRE_Int host_pool = 0;
+   HYPRE_Int profile = 0;
+   char     *profile_prefix = NULL;
    HYPRE_ExecutionPolicy default_exec_policy = HYPRE_EXEC_HOST;
    HYPRE_MemoryLocation memory_location = HYPRE_MEMORY_DEVICE;
 
@@ -484,6 +503,12 @@ main( hypre_int argc,
          build_matrix_type      = 0;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-fromparcsrbinary") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = 8;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-fromonecsrfile") == 0 )
       {
          arg_index++;
@@ -563,6 +588,11 @@ main( hypre_int argc,
          arg_index++;
          chunk = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-coo") == 0 )
+      {
+         arg_index++;
+         coo = 1;
+      }
       else if ( strcmp(argv[arg_index], "-off_proc") == 0 )
       {
          arg_index++;
@@ -621,6 +651,12 @@ main( hypre_int argc,
          build_rhs_type      = 7;
          build_rhs_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-rhsparcsrbinary") == 0 )
+      {
+         arg_index++;
+         build_rhs_type      = 8;
+         build_rhs_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-rhsisone") == 0 )
       {
          arg_index++;
@@ -1190,7 +1226,7 @@ main( hypre_int argc,
    if (solver_id == 0 || solver_id == 1 || solver_id == 3 || solver_id == 5
        || solver_id == 9 || solver_id == 13 || solver_id == 14
        || solver_id == 15 || solver_id == 20 || solver_id == 51 || solver_id == 61
-       || solver_id == 16
+       || solver_id == 16 || solver_id == 21 || solver_id == 23 || solver_id == 25
        || solver_id == 70 || solver_id == 71 || solver_id == 72
        || solver_id == 90 || solver_id == 91)
    {
@@ -1245,6 +1281,21 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-s_step") == 0 )
+      {
+         arg_index++;
+         s_step = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ca_basis") == 0 )
+      {
+         arg_index++;
+         ca_basis = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-num_rhs") == 0 )
+      {
+         arg_index++;
+         num_rhs = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1457,6 +1508,16 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pcg_variant") == 0 )
+      {
+         arg_index++;
+         pcg_variant = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-gmres_cgs") == 0 )
+      {
+         arg_index++;
+         gmres_cgs = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -1645,6 +1706,21 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mixed_precision") == 0 )
+      {
+         arg_index++;
+         mixed_precision = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-reuse_rap") == 0 )
+      {
+         arg_index++;
+         reuse_rap = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-amg_update") == 0 )
+      {
+         arg_index++;
+         amg_update = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -1667,6 +1743,41 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-printbinary") == 0 )
+      {
+         arg_index++;
+         print_binary = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-spmv_sell") == 0 )
+      {
+         arg_index++;
+         spmv_use_sell = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-matvec_split") == 0 )
+      {
+         arg_index++;
+         matvec_split = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-comm_transport") == 0 )
+      {
+         arg_index++;
+         comm_transport = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-host_pool") == 0 )
+      {
+         arg_index++;
+         host_pool = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-profile") == 0 )
+      {
+         arg_index++;
+         profile = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-profile_out") == 0 )
+      {
+         arg_index++;
+         profile_prefix = argv[arg_index++];
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -1782,6 +1893,8 @@ main( hypre_int argc,
          hypre_printf("matrix read from multiple files (IJ format)\n");
          hypre_printf("  -fromparcsrfile <filename> : ");
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
+         hypre_printf("  -fromparcsrbinary <filename> : ");
+         hypre_printf("matrix read from a single binary file (ParCSR format)\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
          hypre_printf("matrix read from a single file (CSR format)\n");
          hypre_printf("\n");
@@ -1800,6 +1913,7 @@ main( hypre_int argc,
          hypre_printf("\n");
          hypre_printf("  -exact_size            : inserts immediately into ParCSR structure\n");
          hypre_printf("  -storage_low           : allocates not enough storage for aux struct\n");
+         hypre_printf("  -coo                   : builds the IJ matrix from COO triplets\n");
          hypre_printf("  -concrete_parcsr       : use parcsr matrix type as concrete type\n");
          hypre_printf("\n");
          hypre_printf("  -rhsfromfile           : ");
@@ -1808,6 +1922,8 @@ main( hypre_int argc,
          hypre_printf("rhs read from a single file (CSR format)\n");
          hypre_printf("  -rhsparcsrfile        :  ");
          hypre_printf("rhs read from multiple files (ParCSR format)\n");
+         hypre_printf("  -rhsparcsrbinary       : ");
+         hypre_printf("rhs read from a single binary file (ParCSR format)\n");
          hypre_printf("  -Ffromonefile          : ");
          hypre_printf("list of F points from a single file\n");
          hypre_printf("  -SFfromonefile          : ");
@@ -1844,6 +1960,9 @@ main( hypre_int argc,
          hypre_printf("       14=GSMG-PCG        15=GSMG-GMRES\n");
          hypre_printf("       16=AMG-COGMRES     17=DIAG-COGMRES\n");
          hypre_printf("       18=ParaSails-GMRES\n");
+         hypre_printf("       21=AMG-CAGMRES     22=DS-CAGMRES\n");
+         hypre_printf("       23=AMG-BPCG        24=DS-BPCG\n");
+         hypre_printf("       25=AMG-BGMRES      26=DS-BGMRES\n");
          hypre_printf("       20=Hybrid solver/ DiagScale, AMG \n");
          hypre_printf("       43=Euclid-PCG      44=Euclid-GMRES   \n");
          hypre_printf("       45=Euclid-BICGSTAB 46=Euclid-COGMRES\n");
@@ -1971,6 +2090,15 @@ main( hypre_int argc,
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
+         hypre_printf("  -pcg_variant <val>     : PCG recurrence: 0 standard (default),\n");
+         hypre_printf("                           1 single-reduction, 2 pipelined\n");
+         hypre_printf("  -gmres_cgs <val>       : GMRES, FlexGMRES and LGMRES orthogonalization:\n");
+         hypre_printf("                           0 MGS (default), 1 CGS, 2 CGS2\n");
+         hypre_printf("  -s_step <val>          : CAGMRES basis vectors per block (default 4)\n");
+         hypre_printf("  -ca_basis <val>        : CAGMRES basis: 0 monomial, 1 Newton (default)\n");
+         hypre_printf("  -num_rhs <val>         : BPCG and BGMRES right-hand sides (default 1);\n");
+         hypre_printf("                           all but the first are random; with AMG (solver 0)\n");
+         hypre_printf("                           also solves for a multivector of scaled copies of b\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
@@ -1979,6 +2107,10 @@ main( hypre_int argc,
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
+         hypre_printf("  -mixed_precision       : store the AMG hierarchy in single precision\n");
+         hypre_printf("  -reuse_rap             : keep the symbolic Galerkin products of the setup\n");
+         hypre_printf("  -amg_update <val>      : PCG-AMG only: <val> solves with a scaled diagonal\n");
+         hypre_printf("                           after value-only preconditioner updates\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
@@ -2002,6 +2134,16 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -printbinary           : print out A and b as binary ParCSR files\n");
+         hypre_printf("\n");
+         hypre_printf("  -spmv_sell <val>       : use SELL-C-sigma storage in host matvecs\n");
+         hypre_printf("  -matvec_split <val>    : split host matvecs into interior/boundary rows\n");
+         hypre_printf("  -comm_transport <val>  : ParCSR halo exchange transport\n");
+         hypre_printf("                           0=Isend/Irecv (default), 1=persistent,\n");
+         hypre_printf("                           2=MPI-3 neighborhood collectives\n");
+         hypre_printf("  -host_pool <val>       : use the host memory pool (prints its stats)\n");
+         hypre_printf("  -profile <val>         : region profiler, 1=region tree, 2=also trace\n");
+         hypre_printf("  -profile_out <prefix>  : write profile as JSON (and Chrome trace)\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2189,6 +2331,17 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* storage format of host matvecs */
+   HYPRE_CSRMatrixSetSpMVUseSell(spmv_use_sell);
+   HYPRE_ParCSRSetMatvecSplit(matvec_split);
+   HYPRE_ParCSRSetCommTransport(comm_transport);
+
+   /* host memory pool */
+   HYPRE_SetHostMemoryPool(host_pool);
+
+   /* region profiler */
+   HYPRE_SetProfiling(profile);
+
 #if defined(HYPRE_USING_GPU)
    /* use cuSPARSE for SpGEMM */
    HYPRE_CSRMatrixSetSpGemmUseCusparse(spgemm_use_cusparse);
@@ -2220,6 +2373,20 @@ main( hypre_int argc,
    {
       BuildParFromFile(argc, argv, build_matrix_arg_index, &parcsr_A);
    }
+   else if ( build_matrix_type == 8 )
+   {
+      if (myid == 0)
+      {
+         hypre_printf("  Matrix read from binary file %s\n", argv[build_matrix_arg_index]);
+      }
+      ierr = HYPRE_ParCSRMatrixReadBinary(hypre_MPI_COMM_WORLD, argv[build_matrix_arg_index],
+                                          &parcsr_A);
+      if (!parcsr_A)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         exit(1);
+      }
+   }
    else if ( build_matrix_type == 1 )
    {
       BuildParFromOneFile(argc, argv, build_matrix_arg_index, num_functions,
@@ -2421,18 +2588,22 @@ main( hypre_int argc,
          data[j_indx++]     = 6.0;
       }
 
-      if (sparsity_known == 1)
+      if (coo)
+      {
+         /* COO ingestion needs neither sizes nor initialization */
+      }
+      else if (sparsity_known == 1)
       {
          ierr += HYPRE_IJMatrixSetDiagOffdSizes( ij_A, (const HYPRE_Int *) diag_sizes,
                                                  (const HYPRE_Int *) offdiag_sizes );
+         ierr += HYPRE_IJMatrixInitialize_v2( ij_A, memory_location );
       }
       else
       {
          ierr = HYPRE_IJMatrixSetRowSizes ( ij_A, (const HYPRE_Int *) row_sizes );
+         ierr += HYPRE_IJMatrixInitialize_v2( ij_A, memory_location );
       }
 
-      ierr += HYPRE_IJMatrixInitialize_v2( ij_A, memory_location );
-
       if (omp_flag)
       {
          HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
@@ -2456,7 +2627,24 @@ main( hypre_int argc,
          hypre_TMemcpy(data,     data_h,     HYPRE_Real,   mx_size*num_rows, memory_location, HYPRE_MEMORY_HOST);
       }
 
-      if (chunk)
+      if (coo)
+      {
+         HYPRE_BigInt *coo_rows = hypre_TAlloc(HYPRE_BigInt, j_indx, HYPRE_MEMORY_HOST);
+
+         k = 0;
+         for (i = 0; i < num_rows; i++)
+         {
+            for (j = 0; j < num_cols_h[i]; j++)
+            {
+               coo_rows[k++] = row_nums_h[i];
+            }
+         }
+         ierr += HYPRE_IJMatrixSetValuesCOO(ij_A, j_indx, coo_rows,
+                                            (const HYPRE_BigInt *) col_nums_h,
+                                            (const HYPRE_Real *) data_h);
+         hypre_TFree(coo_rows, HYPRE_MEMORY_HOST);
+      }
+      else if (chunk)
       {
          if (add)
          {
@@ -2513,7 +2701,10 @@ main( hypre_int argc,
          hypre_TFree(row_sizes, HYPRE_MEMORY_HOST);
       }
 
-      ierr += HYPRE_IJMatrixAssemble( ij_A );
+      if (!coo)
+      {
+         ierr += HYPRE_IJMatrixAssemble( ij_A );
+      }
 
       hypre_EndTiming(time_index);
       hypre_PrintTiming("IJ Matrix Setup", hypre_MPI_COMM_WORLD);
@@ -2747,6 +2938,31 @@ main( hypre_int argc,
       ierr = HYPRE_IJVectorGetObject( ij_x, &object );
       x = (HYPRE_ParVector) object;
    }
+   else if (build_rhs_type == 8)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("  RHS vector read from binary file %s\n", argv[build_rhs_arg_index]);
+         hypre_printf("  Initial guess is 0\n");
+      }
+
+      ij_b = NULL;
+      HYPRE_ParVectorReadBinary(hypre_MPI_COMM_WORLD, argv[build_rhs_arg_index], &b);
+      if (!b)
+      {
+         hypre_printf("ERROR: Problem reading in the right-hand side!\n");
+         exit(1);
+      }
+
+      /* initial guess */
+      HYPRE_IJVectorCreate(hypre_MPI_COMM_WORLD, first_local_col, last_local_col, &ij_x);
+      HYPRE_IJVectorSetObjectType(ij_x, HYPRE_PARCSR);
+      HYPRE_IJVectorInitialize(ij_x);
+      HYPRE_IJVectorAssemble(ij_x);
+
+      ierr = HYPRE_IJVectorGetObject( ij_x, &object );
+      x = (HYPRE_ParVector) object;
+   }
    else if ( build_rhs_type == 2 )
    {
       if (myid == 0)
@@ -3225,6 +3441,12 @@ main( hypre_int argc,
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x0");
    }
 
+   if (print_binary)
+   {
+      HYPRE_ParCSRMatrixPrintBinary(parcsr_A, "ParCSR.out.A.bin");
+      HYPRE_ParVectorPrintBinary(b, "ParVec.out.b.bin");
+   }
+
    /*-----------------------------------------------------------
     * Migrate the system to the wanted memory space
     *-----------------------------------------------------------*/
@@ -3553,6 +3775,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, mixed_precision);
+      HYPRE_BoomerAMGSetReuseRAP(amg_solver, reuse_rap);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -3670,6 +3894,63 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      if (solver_id == 0 && num_rhs > 1)
+      {
+         /* solve for num_rhs vectors at once, b_mv(:,j) = (j+1) b */
+         hypre_ParVector *b_mv, *x_mv;
+         HYPRE_Complex   *b_mv_data, *b_data;
+         HYPRE_Int        local_size = hypre_ParVectorActualLocalSize(b);
+
+         b_mv = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParVectorGlobalSize(b),
+                                           hypre_ParVectorPartitioning(b), num_rhs);
+         hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(b_mv)) = 1;
+         hypre_ParVectorInitialize_v2(b_mv, HYPRE_MEMORY_HOST);
+         hypre_ParVectorSetPartitioningOwner(b_mv, 0);
+         x_mv = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParVectorGlobalSize(b),
+                                           hypre_ParVectorPartitioning(b), num_rhs);
+         hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(x_mv)) = 1;
+         hypre_ParVectorInitialize_v2(x_mv, HYPRE_MEMORY_HOST);
+         hypre_ParVectorSetPartitioningOwner(x_mv, 0);
+         hypre_ParVectorSetConstantValues(x_mv, 0.0);
+
+         b_data    = hypre_TAlloc(HYPRE_Complex, local_size, HYPRE_MEMORY_HOST);
+         b_mv_data = hypre_VectorData(hypre_ParVectorLocalVector(b_mv));
+         hypre_TMemcpy(b_data, hypre_VectorData(hypre_ParVectorLocalVector(b)), HYPRE_Complex,
+                       local_size, HYPRE_MEMORY_HOST, hypre_ParVectorMemoryLocation(b));
+         for (i = 0; i < local_size; i++)
+         {
+            for (j = 0; j < num_rhs; j++)
+            {
+               b_mv_data[i * num_rhs + j] = (HYPRE_Complex) (j + 1) * b_data[i];
+            }
+         }
+         hypre_TFree(b_data, HYPRE_MEMORY_HOST);
+
+         time_index = hypre_InitializeTiming("BoomerAMG MultiVector Solve");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, (HYPRE_ParVector) b_mv, (HYPRE_ParVector) x_mv);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("MultiVector solve phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("  %d vectors\n", num_rhs);
+            hypre_printf("BoomerAMG MultiVector Iterations = %d\n", num_iterations);
+            hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+            hypre_printf("\n");
+         }
+
+         hypre_ParVectorDestroy(b_mv);
+         hypre_ParVectorDestroy(x_mv);
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       //HYPRE_ParVectorSetRandomValues(x, 775);
@@ -3857,6 +4138,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, mixed_precision);
+      HYPRE_BoomerAMGSetReuseRAP(amg_solver, reuse_rap);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol-1]);
@@ -3937,6 +4220,7 @@ main( hypre_int argc,
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
       HYPRE_PCGSetRecomputeResidual(pcg_solver, recompute_res);
+      HYPRE_PCGSetVariant(pcg_solver, pcg_variant);
 
       if (solver_id == 1)
       {
@@ -4034,6 +4318,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(pcg_precond, reuse_rap);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4200,6 +4486,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(pcg_precond, reuse_rap);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4360,6 +4648,63 @@ main( hypre_int argc,
       HYPRE_PCGGetNumIterations(pcg_solver, &num_iterations);
       HYPRE_PCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
 
+      /* new values of A with the same pattern, followed by value-only
+         updates of the preconditioner */
+      if (solver_id == 1 && amg_update > 0)
+      {
+         hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(parcsr_A);
+         HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+         HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+         HYPRE_Complex   *A_diag_data = hypre_CSRMatrixData(A_diag);
+         HYPRE_Int        update_iterations;
+         HYPRE_Real       update_res_norm;
+         HYPRE_Int        update_id;
+
+         for (update_id = 1; update_id <= amg_update; update_id++)
+         {
+            for (i = 0; i < hypre_CSRMatrixNumRows(A_diag); i++)
+            {
+               for (j = A_diag_i[i]; j < A_diag_i[i+1]; j++)
+               {
+                  if (A_diag_j[j] == i)
+                  {
+                     A_diag_data[j] *= 1.1;
+                  }
+               }
+            }
+
+            time_index = hypre_InitializeTiming("BoomerAMG SetupUpdate");
+            hypre_BeginTiming(time_index);
+
+            HYPRE_ClearAllErrors();
+            if (HYPRE_BoomerAMGSetupUpdate(pcg_precond, parcsr_A))
+            {
+               if (myid == 0)
+               {
+                  hypre_printf("HYPRE_BoomerAMGSetupUpdate failed, doing a full setup\n");
+               }
+               HYPRE_ClearAllErrors();
+               HYPRE_BoomerAMGSetup(pcg_precond, parcsr_A, b, x);
+            }
+
+            hypre_EndTiming(time_index);
+            hypre_PrintTiming("Update phase times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+
+            HYPRE_ParVectorSetConstantValues(x, 0.0);
+            HYPRE_PCGSolve(pcg_solver, (HYPRE_Matrix)parcsr_A,
+                           (HYPRE_Vector)b, (HYPRE_Vector)x);
+            HYPRE_PCGGetNumIterations(pcg_solver, &update_iterations);
+            HYPRE_PCGGetFinalRelativeResidualNorm(pcg_solver, &update_res_norm);
+            if (myid == 0)
+            {
+               hypre_printf("Update %d: Iterations = %d, Final Relative Residual Norm = %e\n",
+                            update_id, update_iterations, update_res_norm);
+            }
+         }
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -5345,6 +5690,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
       HYPRE_GMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_GMRESSetCGS(pcg_solver, gmres_cgs);
       HYPRE_GMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_GMRESSetTol(pcg_solver, tol);
       HYPRE_GMRESSetAbsoluteTol(pcg_solver, atol);
@@ -5485,6 +5831,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(amg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(amg_precond, reuse_rap);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -5653,6 +6001,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(pcg_precond, reuse_rap);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5851,6 +6201,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRLGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
       HYPRE_LGMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_LGMRESSetCGS(pcg_solver, gmres_cgs);
       HYPRE_LGMRESSetAugDim(pcg_solver, aug_dim);
       HYPRE_LGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_LGMRESSetTol(pcg_solver, tol);
@@ -5953,6 +6304,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(pcg_precond, reuse_rap);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6038,6 +6391,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRFlexGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
       HYPRE_FlexGMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_FlexGMRESSetCGS(pcg_solver, gmres_cgs);
       HYPRE_FlexGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_FlexGMRESSetTol(pcg_solver, tol);
       HYPRE_FlexGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -6139,6 +6493,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(pcg_precond, reuse_rap);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6504,6 +6860,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(pcg_precond, reuse_rap);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6853,6 +7211,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(pcg_precond, reuse_rap);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7059,6 +7419,441 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
    }
+   /*-----------------------------------------------------------
+    * Solve the system using CAGMRES
+    *-----------------------------------------------------------*/
+
+   if (solver_id == 21 || solver_id == 22)
+   {
+      time_index = hypre_InitializeTiming("CAGMRES Setup");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_ParCSRCAGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+      HYPRE_CAGMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_CAGMRESSetSStep(pcg_solver, s_step);
+      HYPRE_CAGMRESSetBasis(pcg_solver, ca_basis);
+      HYPRE_CAGMRESSetMaxIter(pcg_solver, max_iter);
+      HYPRE_CAGMRESSetTol(pcg_solver, tol);
+      HYPRE_CAGMRESSetAbsoluteTol(pcg_solver, atol);
+      HYPRE_CAGMRESSetLogging(pcg_solver, ioutdat);
+      HYPRE_CAGMRESSetPrintLevel(pcg_solver, ioutdat);
+
+      if (solver_id == 21)
+      {
+         /* use BoomerAMG as preconditioner */
+         if (myid == 0) hypre_printf("Solver: AMG-CAGMRES\n");
+         HYPRE_BoomerAMGCreate(&pcg_precond);
+         HYPRE_BoomerAMGSetCGCIts(pcg_precond, cgcits);
+         HYPRE_BoomerAMGSetInterpType(pcg_precond, interp_type);
+         HYPRE_BoomerAMGSetPostInterpType(pcg_precond, post_interp_type);
+         HYPRE_BoomerAMGSetNumSamples(pcg_precond, gsmg_samples);
+         HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
+         HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
+         HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
+         HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
+         HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
+         HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
+         HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
+         HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
+         HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
+         HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
+         HYPRE_BoomerAMGSetPMaxElmts(pcg_precond, P_max_elmts);
+         HYPRE_BoomerAMGSetJacobiTruncThreshold(pcg_precond, jacobi_trunc_threshold);
+         HYPRE_BoomerAMGSetSCommPkgSwitch(pcg_precond, S_commpkg_switch);
+         HYPRE_BoomerAMGSetPrintLevel(pcg_precond, poutdat);
+         HYPRE_BoomerAMGSetPrintFileName(pcg_precond, "driver.out.log");
+         HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
+         HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
+         HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
+         HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
+         HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
+         HYPRE_BoomerAMGSetCRRate(pcg_precond, CR_rate);
+         HYPRE_BoomerAMGSetCRStrongTh(pcg_precond, CR_strong_th);
+         HYPRE_BoomerAMGSetCRUseCG(pcg_precond, CR_use_CG);
+         if (relax_type > -1) HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type);
+         if (relax_down > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_down, 1);
+         if (relax_up > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_up, 2);
+         if (relax_coarse > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_coarse, 3);
+         HYPRE_BoomerAMGSetAddRelaxType(pcg_precond, add_relax_type);
+         HYPRE_BoomerAMGSetAddRelaxWt(pcg_precond, add_relax_wt);
+         HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
+         HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
+         HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
+         HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
+         if (level_w > -1)
+            HYPRE_BoomerAMGSetLevelRelaxWt(pcg_precond, relax_wt_level,level_w);
+         if (level_ow > -1)
+            HYPRE_BoomerAMGSetLevelOuterWt(pcg_precond,outer_wt_level,level_ow);
+         HYPRE_BoomerAMGSetSmoothType(pcg_precond, smooth_type);
+         HYPRE_BoomerAMGSetSmoothNumLevels(pcg_precond, smooth_num_levels);
+         HYPRE_BoomerAMGSetSmoothNumSweeps(pcg_precond, smooth_num_sweeps);
+         HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
+         HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
+         HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
+         HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
+         HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
+         HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
+         HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
+         HYPRE_BoomerAMGSetAggPMaxElmts(pcg_precond, agg_P_max_elmts);
+         HYPRE_BoomerAMGSetAggP12MaxElmts(pcg_precond, agg_P12_max_elmts);
+         HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
+         HYPRE_BoomerAMGSetNodal(pcg_precond, nodal);
+         HYPRE_BoomerAMGSetNodalDiag(pcg_precond, nodal_diag);
+         HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
+         HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
+         HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
+         HYPRE_BoomerAMGSetSchwarzUseNonSymm(pcg_precond, use_nonsymm_schwarz);
+
+         HYPRE_BoomerAMGSetSchwarzRlxWeight(pcg_precond, schwarz_rlx_weight);
+         if (eu_level < 0) eu_level = 0;
+         HYPRE_BoomerAMGSetEuLevel(pcg_precond, eu_level);
+         HYPRE_BoomerAMGSetEuBJ(pcg_precond, eu_bj);
+         HYPRE_BoomerAMGSetEuSparseA(pcg_precond, eu_sparse_A);
+         HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
+         if (num_functions > 1)
+            HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
+         HYPRE_BoomerAMGSetAdditive(pcg_precond, additive);
+         HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
+         HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
+         HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
+         HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
+         HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
+         HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
+         HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(pcg_precond, reuse_rap);
+#ifdef HYPRE_USING_DSUPERLU
+         HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
+#endif
+         if (nongalerk_tol)
+         {
+            HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol-1]);
+            for (i=0; i < nongalerk_num_tol-1; i++)
+               HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
+         }
+         HYPRE_CAGMRESSetMaxIter(pcg_solver, mg_max_iter);
+         HYPRE_CAGMRESSetPrecond(pcg_solver,
+                                 (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve,
+                                 (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSetup,
+                                 pcg_precond);
+      }
+      else if (solver_id == 22)
+      {
+         /* use diagonal scaling as preconditioner */
+         if (myid == 0) hypre_printf("Solver: DS-CAGMRES\n");
+         pcg_precond = NULL;
+
+         HYPRE_CAGMRESSetPrecond(pcg_solver,
+                                 (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScale,
+                                 (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScaleSetup,
+                                 pcg_precond);
+      }
+      HYPRE_CAGMRESSetup(pcg_solver, (HYPRE_Matrix)parcsr_A,
+                         (HYPRE_Vector)b, (HYPRE_Vector)x);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      time_index = hypre_InitializeTiming("CAGMRES Solve");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_CAGMRESSolve(pcg_solver, (HYPRE_Matrix)parcsr_A,
+                         (HYPRE_Vector)b, (HYPRE_Vector)x);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      HYPRE_CAGMRESGetNumIterations(pcg_solver, &num_iterations);
+      HYPRE_CAGMRESGetFinalRelativeResidualNorm(pcg_solver,&final_res_norm);
+#if SECOND_TIME
+      /* run a second time to check for memory leaks */
+      HYPRE_ParVectorSetRandomValues(x, 775);
+      HYPRE_CAGMRESSetup(pcg_solver, (HYPRE_Matrix)parcsr_A,
+                         (HYPRE_Vector)b, (HYPRE_Vector)x);
+      HYPRE_CAGMRESSolve(pcg_solver, (HYPRE_Matrix)parcsr_A,
+                         (HYPRE_Vector)b, (HYPRE_Vector)x);
+#endif
+
+      HYPRE_ParCSRCAGMRESDestroy(pcg_solver);
+
+      if (solver_id == 21)
+      {
+         HYPRE_BoomerAMGDestroy(pcg_precond);
+      }
+      if (myid == 0)
+      {
+         hypre_printf("\n");
+         hypre_printf("CAGMRES Iterations = %d\n", num_iterations);
+         hypre_printf("Final CAGMRES Relative Residual Norm = %e\n", final_res_norm);
+         hypre_printf("\n");
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Solve the system for several right-hand sides using BPCG or BGMRES
+    *-----------------------------------------------------------*/
+
+   if (solver_id == 23 || solver_id == 24 || solver_id == 25 || solver_id == 26)
+   {
+      HYPRE_ParVector      *b_block;
+      HYPRE_ParVector      *x_block;
+      HYPRE_PtrToSolverFcn  block_precond;
+      HYPRE_PtrToSolverFcn  block_precond_setup;
+      HYPRE_Int             block_pcg = (solver_id == 23 || solver_id == 24);
+
+      /* the first system uses the driver's b and x, the others get random
+         right-hand sides and zero initial guesses */
+      if (num_rhs < 1)
+      {
+         num_rhs = 1;
+      }
+      b_block = hypre_CTAlloc(HYPRE_ParVector, num_rhs, HYPRE_MEMORY_HOST);
+      x_block = hypre_CTAlloc(HYPRE_ParVector, num_rhs, HYPRE_MEMORY_HOST);
+      b_block[0] = b;
+      x_block[0] = x;
+      for (j = 1; j < num_rhs; j++)
+      {
+         b_block[j] = hypre_ParVectorCloneDeep_v2(b, hypre_ParVectorMemoryLocation(b));
+         HYPRE_ParVectorSetRandomValues(b_block[j], 22775 + j);
+         x_block[j] = hypre_ParVectorCloneDeep_v2(x, hypre_ParVectorMemoryLocation(x));
+         HYPRE_ParVectorSetConstantValues(x_block[j], 0.0);
+      }
+
+      time_index = hypre_InitializeTiming(block_pcg ? "BPCG Setup" : "BGMRES Setup");
+      hypre_BeginTiming(time_index);
+
+      if (block_pcg)
+      {
+         HYPRE_ParCSRBPCGCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+         HYPRE_BPCGSetMaxIter(pcg_solver, max_iter);
+         HYPRE_BPCGSetTol(pcg_solver, tol);
+         HYPRE_BPCGSetAbsoluteTol(pcg_solver, atol);
+         HYPRE_BPCGSetLogging(pcg_solver, ioutdat);
+         HYPRE_BPCGSetPrintLevel(pcg_solver, ioutdat);
+      }
+      else
+      {
+         HYPRE_ParCSRBGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+         HYPRE_BGMRESSetKDim(pcg_solver, k_dim);
+         HYPRE_BGMRESSetMaxIter(pcg_solver, max_iter);
+         HYPRE_BGMRESSetTol(pcg_solver, tol);
+         HYPRE_BGMRESSetAbsoluteTol(pcg_solver, atol);
+         HYPRE_BGMRESSetLogging(pcg_solver, ioutdat);
+         HYPRE_BGMRESSetPrintLevel(pcg_solver, ioutdat);
+      }
+
+      if (solver_id == 23 || solver_id == 25)
+      {
+         /* use BoomerAMG as preconditioner */
+         if (myid == 0) hypre_printf("Solver: AMG-%s\n", block_pcg ? "BPCG" : "BGMRES");
+         HYPRE_BoomerAMGCreate(&pcg_precond);
+         HYPRE_BoomerAMGSetCGCIts(pcg_precond, cgcits);
+         HYPRE_BoomerAMGSetInterpType(pcg_precond, interp_type);
+         HYPRE_BoomerAMGSetPostInterpType(pcg_precond, post_interp_type);
+         HYPRE_BoomerAMGSetNumSamples(pcg_precond, gsmg_samples);
+         HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
+         HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
+         HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
+         HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
+         HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
+         HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
+         HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
+         HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
+         HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
+         HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
+         HYPRE_BoomerAMGSetPMaxElmts(pcg_precond, P_max_elmts);
+         HYPRE_BoomerAMGSetJacobiTruncThreshold(pcg_precond, jacobi_trunc_threshold);
+         HYPRE_BoomerAMGSetSCommPkgSwitch(pcg_precond, S_commpkg_switch);
+         HYPRE_BoomerAMGSetPrintLevel(pcg_precond, poutdat);
+         HYPRE_BoomerAMGSetPrintFileName(pcg_precond, "driver.out.log");
+         HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
+         HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
+         HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
+         HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
+         HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
+         HYPRE_BoomerAMGSetCRRate(pcg_precond, CR_rate);
+         HYPRE_BoomerAMGSetCRStrongTh(pcg_precond, CR_strong_th);
+         HYPRE_BoomerAMGSetCRUseCG(pcg_precond, CR_use_CG);
+         if (relax_type > -1) HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type);
+         if (relax_down > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_down, 1);
+         if (relax_up > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_up, 2);
+         if (relax_coarse > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_coarse, 3);
+         HYPRE_BoomerAMGSetAddRelaxType(pcg_precond, add_relax_type);
+         HYPRE_BoomerAMGSetAddRelaxWt(pcg_precond, add_relax_wt);
+         HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
+         HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
+         HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
+         HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
+         if (level_w > -1)
+            HYPRE_BoomerAMGSetLevelRelaxWt(pcg_precond, relax_wt_level,level_w);
+         if (level_ow > -1)
+            HYPRE_BoomerAMGSetLevelOuterWt(pcg_precond,outer_wt_level,level_ow);
+         HYPRE_BoomerAMGSetSmoothType(pcg_precond, smooth_type);
+         HYPRE_BoomerAMGSetSmoothNumLevels(pcg_precond, smooth_num_levels);
+         HYPRE_BoomerAMGSetSmoothNumSweeps(pcg_precond, smooth_num_sweeps);
+         HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
+         HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
+         HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
+         HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
+         HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
+         HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
+         HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
+         HYPRE_BoomerAMGSetAggPMaxElmts(pcg_precond, agg_P_max_elmts);
+         HYPRE_BoomerAMGSetAggP12MaxElmts(pcg_precond, agg_P12_max_elmts);
+         HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
+         HYPRE_BoomerAMGSetNodal(pcg_precond, nodal);
+         HYPRE_BoomerAMGSetNodalDiag(pcg_precond, nodal_diag);
+         HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
+         HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
+         HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
+         HYPRE_BoomerAMGSetSchwarzUseNonSymm(pcg_precond, use_nonsymm_schwarz);
+
+         HYPRE_BoomerAMGSetSchwarzRlxWeight(pcg_precond, schwarz_rlx_weight);
+         if (eu_level < 0) eu_level = 0;
+         HYPRE_BoomerAMGSetEuLevel(pcg_precond, eu_level);
+         HYPRE_BoomerAMGSetEuBJ(pcg_precond, eu_bj);
+         HYPRE_BoomerAMGSetEuSparseA(pcg_precond, eu_sparse_A);
+         HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
+         if (num_functions > 1)
+            HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
+         HYPRE_BoomerAMGSetAdditive(pcg_precond, additive);
+         HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
+         HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
+         HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
+         HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
+         HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
+         HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
+         HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(pcg_precond, reuse_rap);
+#ifdef HYPRE_USING_DSUPERLU
+         HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
+#endif
+         if (nongalerk_tol)
+         {
+            HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol-1]);
+            for (i=0; i < nongalerk_num_tol-1; i++)
+               HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
+         }
+         if (block_pcg)
+         {
+            HYPRE_BPCGSetMaxIter(pcg_solver, mg_max_iter);
+         }
+         else
+         {
+            HYPRE_BGMRESSetMaxIter(pcg_solver, mg_max_iter);
+         }
+         block_precond = (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve;
+         block_precond_setup = (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSetup;
+      }
+      else
+      {
+         /* use diagonal scaling as preconditioner */
+         if (myid == 0) hypre_printf("Solver: DS-%s\n", block_pcg ? "BPCG" : "BGMRES");
+         pcg_precond = NULL;
+         block_precond = (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScale;
+         block_precond_setup = (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScaleSetup;
+      }
+      if (myid == 0) hypre_printf("  %d right-hand sides\n", num_rhs);
+
+      if (block_pcg)
+      {
+         HYPRE_BPCGSetPrecond(pcg_solver, block_precond, block_precond_setup, pcg_precond);
+         HYPRE_ParCSRBPCGSetup(pcg_solver, parcsr_A, num_rhs, b_block, x_block);
+      }
+      else
+      {
+         HYPRE_BGMRESSetPrecond(pcg_solver, block_precond, block_precond_setup, pcg_precond);
+         HYPRE_ParCSRBGMRESSetup(pcg_solver, parcsr_A, num_rhs, b_block, x_block);
+      }
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      time_index = hypre_InitializeTiming(block_pcg ? "BPCG Solve" : "BGMRES Solve");
+      hypre_BeginTiming(time_index);
+
+      if (block_pcg)
+      {
+         HYPRE_ParCSRBPCGSolve(pcg_solver, parcsr_A, num_rhs, b_block, x_block);
+      }
+      else
+      {
+         HYPRE_ParCSRBGMRESSolve(pcg_solver, parcsr_A, num_rhs, b_block, x_block);
+      }
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      if (block_pcg)
+      {
+         HYPRE_BPCGGetNumIterations(pcg_solver, &num_iterations);
+         HYPRE_BPCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
+         HYPRE_ParCSRBPCGDestroy(pcg_solver);
+      }
+      else
+      {
+         HYPRE_BGMRESGetNumIterations(pcg_solver, &num_iterations);
+         HYPRE_BGMRESGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
+         HYPRE_ParCSRBGMRESDestroy(pcg_solver);
+      }
+
+      if (solver_id == 23 || solver_id == 25)
+      {
+         HYPRE_BoomerAMGDestroy(pcg_precond);
+      }
+      for (j = 1; j < num_rhs; j++)
+      {
+         HYPRE_ParVectorDestroy(b_block[j]);
+         HYPRE_ParVectorDestroy(x_block[j]);
+      }
+      hypre_TFree(b_block, HYPRE_MEMORY_HOST);
+      hypre_TFree(x_block, HYPRE_MEMORY_HOST);
+
+      if (myid == 0)
+      {
+         hypre_printf("\n");
+         hypre_printf("%s Iterations = %d\n", block_pcg ? "BPCG" : "BGMRES", num_iterations);
+         hypre_printf("Final %s Relative Residual Norm = %e\n", block_pcg ? "BPCG" : "BGMRES",
+                      final_res_norm);
+         hypre_printf("\n");
+      }
+   }
+
    /*-----------------------------------------------------------
     * Solve the system using CGNR
     *-----------------------------------------------------------*/
@@ -7155,6 +7950,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseRAP(pcg_precond, reuse_rap);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7501,7 +8298,7 @@ main( hypre_int argc,
    }
 
    /* for build_rhs_type = 1, 6 or 7, we did not create ij_b  - just b*/
-   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7)
+   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7 || build_rhs_type == 8)
    {
       HYPRE_ParVectorDestroy(b);
    }
@@ -7545,6 +8342,24 @@ main( hypre_int argc,
 
    //hypre_PrintMemoryTracker();
 
+   if (host_pool && myid == 0)
+   {
+      HYPRE_PrintHostMemoryPoolStats();
+   }
+
+   if (profile)
+   {
+      HYPRE_ProfilerPrint(hypre_MPI_COMM_WORLD);
+      if (profile_prefix)
+      {
+         HYPRE_ProfilerWriteJSON(hypre_MPI_COMM_WORLD, profile_prefix);
+         if (profile > 1)
+         {
+            HYPRE_ProfilerWriteChromeTrace(hypre_MPI_COMM_WORLD, profile_prefix);
+         }
+      }
+   }
+
    /* Finalize Hypre */
    HYPRE_Finalize();
 
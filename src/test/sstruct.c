@@ -2242,6 +2242,10 @@ PrintUsage( char *progname,
       hypre_printf("                        2 - GMRES\n");
       hypre_printf("                        3 - BiCGSTAB (only ParCSRHybrid)\n");
       hypre_printf("  -recompute <bool>  : Recompute residual in PCG?\n");
+      hypre_printf("  -pcg_variant <v>   : PCG recurrence: 0 standard (default),\n");
+      hypre_printf("                       1 single-reduction, 2 pipelined\n");
+      hypre_printf("  -gmres_cgs <v>     : GMRES orthogonalization: 0 MGS (default),\n");
+      hypre_printf("                       1 CGS, 2 CGS2\n");
       hypre_printf("  -v <n_pre> <n_post>: SysPFMG and Struct- # of pre and post relax\n");
       hypre_printf("  -skip <s>          : SysPFMG and Struct- skip relaxation (0 or 1)\n");
       hypre_printf("  -rap <r>           : Struct- coarse grid operator type\n");
@@ -2372,6 +2376,8 @@ main( hypre_int argc,
    HYPRE_Int             jump;
    HYPRE_Int             solver_type;
    HYPRE_Int             recompute_res;
+   HYPRE_Int             pcg_variant;
+   HYPRE_Int             gmres_cgs;
 
    HYPRE_Real            cf_tol;
 
@@ -2496,6 +2502,8 @@ main( hypre_int argc,
    jump  = 0;
    solver_type = 1;
    recompute_res = 0;   /* What should be the default here? */
+   pcg_variant = 0;
+   gmres_cgs = 0;
    cf_tol = 0.90;
 
    nparts = global_data.nparts;
@@ -2672,6 +2680,16 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pcg_variant") == 0 )
+      {
+         arg_index++;
+         pcg_variant = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-gmres_cgs") == 0 )
+      {
+         arg_index++;
+         gmres_cgs = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cf") == 0 )
       {
          arg_index++;
@@ -3837,6 +3855,7 @@ main( hypre_int argc,
       HYPRE_PCGSetRelChange( (HYPRE_Solver) solver, 0 );
       HYPRE_PCGSetPrintLevel( (HYPRE_Solver) solver, 1 );
       HYPRE_PCGSetRecomputeResidual( (HYPRE_Solver) solver, recompute_res);
+      HYPRE_PCGSetVariant( (HYPRE_Solver) solver, pcg_variant );
 
       if ((solver_id == 10) || (solver_id == 11))
       {
@@ -4318,6 +4337,7 @@ main( hypre_int argc,
       HYPRE_PCGSetRelChange( par_solver, 0 );
       HYPRE_PCGSetPrintLevel( par_solver, 1 );
       HYPRE_PCGSetRecomputeResidual( (HYPRE_Solver) par_solver, recompute_res);
+      HYPRE_PCGSetVariant( par_solver, pcg_variant );
 
       if (solver_id == 20)
       {
@@ -4413,6 +4433,7 @@ main( hypre_int argc,
 
       HYPRE_SStructGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
       HYPRE_GMRESSetKDim( (HYPRE_Solver) solver, 5 );
+      HYPRE_GMRESSetCGS( (HYPRE_Solver) solver, gmres_cgs );
       HYPRE_GMRESSetMaxIter( (HYPRE_Solver) solver, 100 );
       HYPRE_GMRESSetTol( (HYPRE_Solver) solver, tol );
       HYPRE_GMRESSetPrintLevel( (HYPRE_Solver) solver, 1 );
@@ -4489,6 +4510,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRGMRESCreate(hypre_MPI_COMM_WORLD, &par_solver);
       HYPRE_GMRESSetKDim(par_solver, 5);
+      HYPRE_GMRESSetCGS(par_solver, gmres_cgs);
       HYPRE_GMRESSetMaxIter(par_solver, 100);
       HYPRE_GMRESSetTol(par_solver, tol);
       HYPRE_GMRESSetPrintLevel(par_solver, 1);
@@ -4744,6 +4766,7 @@ main( hypre_int argc,
 
       HYPRE_SStructFlexGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
       HYPRE_FlexGMRESSetKDim( (HYPRE_Solver) solver, 5 );
+      HYPRE_FlexGMRESSetCGS( (HYPRE_Solver) solver, gmres_cgs );
       HYPRE_FlexGMRESSetMaxIter( (HYPRE_Solver) solver, 100 );
       HYPRE_FlexGMRESSetTol( (HYPRE_Solver) solver, tol );
       HYPRE_FlexGMRESSetPrintLevel( (HYPRE_Solver) solver, 1 );
@@ -4820,6 +4843,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRFlexGMRESCreate(hypre_MPI_COMM_WORLD, &par_solver);
       HYPRE_FlexGMRESSetKDim(par_solver, 5);
+      HYPRE_FlexGMRESSetCGS(par_solver, gmres_cgs);
       HYPRE_FlexGMRESSetMaxIter(par_solver, 100);
       HYPRE_FlexGMRESSetTol(par_solver, tol);
       HYPRE_FlexGMRESSetPrintLevel(par_solver, 1);
@@ -4881,6 +4905,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRLGMRESCreate(hypre_MPI_COMM_WORLD, &par_solver);
       HYPRE_LGMRESSetKDim(par_solver, 10);
+      HYPRE_LGMRESSetCGS(par_solver, gmres_cgs);
       HYPRE_LGMRESSetAugDim(par_solver, 2);
       HYPRE_LGMRESSetMaxIter(par_solver, 100);
       HYPRE_LGMRESSetTol(par_solver, tol);
@@ -5252,6 +5277,7 @@ main( hypre_int argc,
       HYPRE_PCGSetRelChange( (HYPRE_Solver)struct_solver, 0 );
       HYPRE_PCGSetPrintLevel( (HYPRE_Solver)struct_solver, 1 );
       HYPRE_PCGSetRecomputeResidual( (HYPRE_Solver)struct_solver, recompute_res);
+      HYPRE_PCGSetVariant( (HYPRE_Solver)struct_solver, pcg_variant );
 
       if (solver_id == 210)
       {
@@ -51,6 +51,11 @@ HYPRE_Int AddValuesVector( hypre_StructGrid  *gridvector,
                            HYPRE_Int          *period,
                            HYPRE_Real         value  )  ;
 
+HYPRE_Int AddValuesVectorComponents( hypre_StructGrid   *gridvector,
+                                     hypre_StructVector *zvector,
+                                     HYPRE_Int          *period,
+                                     HYPRE_Real          value );
+
 /*--------------------------------------------------------------------------
  * Test driver for structured matrix interface (structured storage)
  *--------------------------------------------------------------------------*/
@@ -75,6 +80,8 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type;
    HYPRE_Int           recompute_res;
+   HYPRE_Int           pcg_variant;
+   HYPRE_Int           gmres_cgs;
 
    /*HYPRE_Real          dxyz[3];*/
 
@@ -100,6 +107,10 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           rbsplit;
+   HYPRE_Int           redundant;
+   HYPRE_Int           nrhs;
+   HYPRE_Int           setup_ierr;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -210,6 +221,9 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   rbsplit = 0;
+   redundant = 0;
+   nrhs = 1;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -242,6 +256,8 @@ main( hypre_int argc,
    solver_id = 0;
    solver_type = 1;
    recompute_res = 0;   /* What should be the default here? */
+   pcg_variant = 0;
+   gmres_cgs = 0;
 
    istart[0] = -3;
    istart[1] = -3;
@@ -401,6 +417,21 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-rbsplit") == 0 )
+      {
+         arg_index++;
+         rbsplit = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-redundant") == 0 )
+      {
+         arg_index++;
+         redundant = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-nrhs") == 0 )
+      {
+         arg_index++;
+         nrhs = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -416,6 +447,16 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pcg_variant") == 0 )
+      {
+         arg_index++;
+         pcg_variant = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-gmres_cgs") == 0 )
+      {
+         arg_index++;
+         gmres_cgs = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cf") == 0 )
       {
          arg_index++;
@@ -589,12 +630,24 @@ main( hypre_int argc,
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -rbsplit            : PFMG red/black split storage (relax 2, 3)\n");
+      hypre_printf("  -redundant <n>      : PFMG/SMG direct solve on coarse grids of <= n points\n");
+      hypre_printf("  -nrhs <k>           : solve for k different right-hand sides at once\n");
+      hypre_printf("                        (PFMG with Jacobi relaxation, Jacobi, Krylov)\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
       hypre_printf("                        1 - PCG (default)\n");
       hypre_printf("                        2 - GMRES\n");
       hypre_printf("  -recompute <bool>   : Recompute residual in PCG?\n");
+      hypre_printf("  -pcg_variant <v>    : PCG recurrence (solvers 10-19)\n");
+      hypre_printf("                        0 - standard (default)\n");
+      hypre_printf("                        1 - single-reduction\n");
+      hypre_printf("                        2 - pipelined\n");
+      hypre_printf("  -gmres_cgs <v>      : (L,Flex)GMRES orthogonalization\n");
+      hypre_printf("                        0 - modified Gram-Schmidt (default)\n");
+      hypre_printf("                        1 - classical Gram-Schmidt\n");
+      hypre_printf("                        2 - classical Gram-Schmidt, reorthogonalized\n");
       hypre_printf("  -cf <cf>            : convergence factor for Hybrid\n");
       hypre_printf("\n");
 
@@ -1096,6 +1149,7 @@ main( hypre_int argc,
           *-----------------------------------------------------------*/
 
          HYPRE_StructVectorCreate(hypre_MPI_COMM_WORLD, grid, &b);
+         HYPRE_StructVectorSetNumComponents(b, nrhs);
          HYPRE_StructVectorInitialize(b);
 
          /*-----------------------------------------------------------
@@ -1104,13 +1158,18 @@ main( hypre_int argc,
           *  sink of equal strength.  All other problems have rhs = 1.
           *-----------------------------------------------------------*/
 
-         AddValuesVector(grid,b,periodic,1.0);
+         AddValuesVectorComponents(grid,b,periodic,1.0);
          HYPRE_StructVectorAssemble(b);
 
          HYPRE_StructVectorCreate(hypre_MPI_COMM_WORLD, grid, &x);
+         HYPRE_StructVectorSetNumComponents(x, nrhs);
          HYPRE_StructVectorInitialize(x);
 
          AddValuesVector(grid,x,periodx0,0.0);
+         for (i = 1; i < nrhs; i++)
+         {
+            HYPRE_StructVectorCopyComponent(x, 0, x, i);
+         }
          HYPRE_StructVectorAssemble(x);
 
          HYPRE_StructGridDestroy(grid);
@@ -1352,6 +1411,11 @@ main( hypre_int argc,
 
 #if !HYPRE_MFLOPS
 
+      /* solvers that cannot handle the system (e.g., several right-hand
+         sides) fail in the setup; errors of the system setup are not kept */
+      HYPRE_ClearAllErrors();
+      setup_ierr = 0;
+
       if (solver_id == 0)
       {
          time_index = hypre_InitializeTiming("SMG Setup");
@@ -1364,6 +1428,7 @@ main( hypre_int argc,
          HYPRE_StructSMGSetRelChange(solver, 0);
          HYPRE_StructSMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructSMGSetNumPostRelax(solver, n_post);
+         HYPRE_StructSMGSetRedundantSize(solver, redundant);
          HYPRE_StructSMGSetPrintLevel(solver, 1);
          HYPRE_StructSMGSetLogging(solver, 1);
 #if defined(HYPRE_USING_CUDA)
@@ -1373,7 +1438,7 @@ main( hypre_int argc,
 #if defined(HYPRE_USING_CUDA)
          //hypre_box_print = 0;
 #endif
-         HYPRE_StructSMGSetup(solver, A, b, x);
+         setup_ierr = HYPRE_StructSMGSetup(solver, A, b, x);
 
 #if defined(HYPRE_USING_CUDA)
          //hypre_box_print = 0;
@@ -1392,7 +1457,10 @@ main( hypre_int argc,
          time_index = hypre_InitializeTiming("SMG Solve");
          hypre_BeginTiming(time_index);
 
-         HYPRE_StructSMGSolve(solver, A, b, x);
+         if (!setup_ierr)
+         {
+            HYPRE_StructSMGSolve(solver, A, b, x);
+         }
 
          hypre_EndTiming(time_index);
          if ( reps==1 ) {
@@ -1407,8 +1475,11 @@ main( hypre_int argc,
             hypre_ClearTiming();
          }
 
-         HYPRE_StructSMGGetNumIterations(solver, &num_iterations);
-         HYPRE_StructSMGGetFinalRelativeResidualNorm(solver, &final_res_norm);
+         if (!setup_ierr)
+         {
+            HYPRE_StructSMGGetNumIterations(solver, &num_iterations);
+            HYPRE_StructSMGGetFinalRelativeResidualNorm(solver, &final_res_norm);
+         }
          HYPRE_StructSMGDestroy(solver);
       }
 
@@ -1435,6 +1506,8 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetRBSplitStorage(solver, rbsplit);
+         HYPRE_StructPFMGSetRedundantSize(solver, redundant);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1443,7 +1516,7 @@ main( hypre_int argc,
          //HYPRE_StructPFMGSetDeviceLevel(solver,device_level);
 #endif
 
-         HYPRE_StructPFMGSetup(solver, A, b, x);
+         setup_ierr = HYPRE_StructPFMGSetup(solver, A, b, x);
 
          hypre_EndTiming(time_index);
          if ( reps==1 ) {
@@ -1459,7 +1532,10 @@ main( hypre_int argc,
          hypre_BeginTiming(time_index);
 
 
-         HYPRE_StructPFMGSolve(solver, A, b, x);
+         if (!setup_ierr)
+         {
+            HYPRE_StructPFMGSolve(solver, A, b, x);
+         }
 
          hypre_EndTiming(time_index);
          if ( reps==1 ) {
@@ -1474,8 +1550,11 @@ main( hypre_int argc,
             hypre_ClearTiming();
          }
 
-         HYPRE_StructPFMGGetNumIterations(solver, &num_iterations);
-         HYPRE_StructPFMGGetFinalRelativeResidualNorm(solver, &final_res_norm);
+         if (!setup_ierr)
+         {
+            HYPRE_StructPFMGGetNumIterations(solver, &num_iterations);
+            HYPRE_StructPFMGGetFinalRelativeResidualNorm(solver, &final_res_norm);
+         }
          HYPRE_StructPFMGDestroy(solver);
       }
 
@@ -1502,7 +1581,7 @@ main( hypre_int argc,
          HYPRE_StructSparseMSGSetNumPostRelax(solver, n_post);
          HYPRE_StructSparseMSGSetPrintLevel(solver, 1);
          HYPRE_StructSparseMSGSetLogging(solver, 1);
-         HYPRE_StructSparseMSGSetup(solver, A, b, x);
+         setup_ierr = HYPRE_StructSparseMSGSetup(solver, A, b, x);
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
@@ -1512,16 +1591,22 @@ main( hypre_int argc,
          time_index = hypre_InitializeTiming("SparseMSG Solve");
          hypre_BeginTiming(time_index);
 
-         HYPRE_StructSparseMSGSolve(solver, A, b, x);
+         if (!setup_ierr)
+         {
+            HYPRE_StructSparseMSGSolve(solver, A, b, x);
+         }
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
          hypre_FinalizeTiming(time_index);
          hypre_ClearTiming();
 
-         HYPRE_StructSparseMSGGetNumIterations(solver, &num_iterations);
-         HYPRE_StructSparseMSGGetFinalRelativeResidualNorm(solver,
-                                                           &final_res_norm);
+         if (!setup_ierr)
+         {
+            HYPRE_StructSparseMSGGetNumIterations(solver, &num_iterations);
+            HYPRE_StructSparseMSGGetFinalRelativeResidualNorm(solver,
+                                                              &final_res_norm);
+         }
          HYPRE_StructSparseMSGDestroy(solver);
       }
 
@@ -1537,7 +1622,7 @@ main( hypre_int argc,
          HYPRE_StructJacobiCreate(hypre_MPI_COMM_WORLD, &solver);
          HYPRE_StructJacobiSetMaxIter(solver, 100);
          HYPRE_StructJacobiSetTol(solver, tol);
-         HYPRE_StructJacobiSetup(solver, A, b, x);
+         setup_ierr = HYPRE_StructJacobiSetup(solver, A, b, x);
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
@@ -1547,15 +1632,21 @@ main( hypre_int argc,
          time_index = hypre_InitializeTiming("Jacobi Solve");
          hypre_BeginTiming(time_index);
 
-         HYPRE_StructJacobiSolve(solver, A, b, x);
+         if (!setup_ierr)
+         {
+            HYPRE_StructJacobiSolve(solver, A, b, x);
+         }
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
          hypre_FinalizeTiming(time_index);
          hypre_ClearTiming();
 
-         HYPRE_StructJacobiGetNumIterations(solver, &num_iterations);
-         HYPRE_StructJacobiGetFinalRelativeResidualNorm(solver, &final_res_norm);
+         if (!setup_ierr)
+         {
+            HYPRE_StructJacobiGetNumIterations(solver, &num_iterations);
+            HYPRE_StructJacobiGetFinalRelativeResidualNorm(solver, &final_res_norm);
+         }
          HYPRE_StructJacobiDestroy(solver);
       }
 
@@ -1574,6 +1665,7 @@ main( hypre_int argc,
          HYPRE_PCGSetTwoNorm( (HYPRE_Solver)solver, 1 );
          HYPRE_PCGSetRelChange( (HYPRE_Solver)solver, 0 );
          HYPRE_PCGSetPrintLevel( (HYPRE_Solver)solver, 1 );
+         HYPRE_StructPCGSetVariant(solver, pcg_variant);
 
          if (solver_id == 10)
          {
@@ -1585,6 +1677,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetRedundantSize(precond, redundant);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 
@@ -1613,6 +1706,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBSplitStorage(precond, rbsplit);
+            HYPRE_StructPFMGSetRedundantSize(precond, redundant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1671,8 +1766,8 @@ main( hypre_int argc,
                                  (HYPRE_Solver) precond);
          }
 
-         HYPRE_PCGSetup( (HYPRE_Solver)solver,
-                         (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x );
+         setup_ierr = HYPRE_PCGSetup( (HYPRE_Solver)solver,
+                                      (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x );
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
@@ -1682,8 +1777,11 @@ main( hypre_int argc,
          time_index = hypre_InitializeTiming("PCG Solve");
          hypre_BeginTiming(time_index);
 
-         HYPRE_PCGSolve( (HYPRE_Solver) solver,
-                         (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+         if (!setup_ierr)
+         {
+            HYPRE_PCGSolve( (HYPRE_Solver) solver,
+                            (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+         }
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
@@ -1751,6 +1849,7 @@ main( hypre_int argc,
                HYPRE_StructSMGSetZeroGuess(precond);
                HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+               HYPRE_StructSMGSetRedundantSize(precond, redundant);
                HYPRE_StructSMGSetPrintLevel(precond, 0);
                HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -1778,6 +1877,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetRBSplitStorage(precond, rbsplit);
+               HYPRE_StructPFMGSetRedundantSize(precond, redundant);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1984,6 +2085,7 @@ main( hypre_int argc,
                HYPRE_StructSMGSetZeroGuess(precond);
                HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+               HYPRE_StructSMGSetRedundantSize(precond, redundant);
                HYPRE_StructSMGSetPrintLevel(precond, 0);
                HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2011,6 +2113,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetRBSplitStorage(precond, rbsplit);
+               HYPRE_StructPFMGSetRedundantSize(precond, redundant);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2229,6 +2333,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetRedundantSize(precond, redundant);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2256,6 +2361,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBSplitStorage(precond, rbsplit);
+            HYPRE_StructPFMGSetRedundantSize(precond, redundant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2291,7 +2398,7 @@ main( hypre_int argc,
                                          precond);
          }
 
-         HYPRE_StructHybridSetup(solver, A, b, x);
+         setup_ierr = HYPRE_StructHybridSetup(solver, A, b, x);
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
@@ -2301,7 +2408,11 @@ main( hypre_int argc,
          time_index = hypre_InitializeTiming("Hybrid Solve");
          hypre_BeginTiming(time_index);
 
-         HYPRE_StructHybridSolve(solver, A, b, x);
+         if (!setup_ierr)
+         {
+            /* the hybrid solver sets up its preconditioner during the solve */
+            setup_ierr = HYPRE_StructHybridSolve(solver, A, b, x);
+         }
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
@@ -2337,6 +2448,7 @@ main( hypre_int argc,
 
          HYPRE_StructGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
          HYPRE_GMRESSetKDim( (HYPRE_Solver) solver, 5 );
+         HYPRE_GMRESSetCGS( (HYPRE_Solver) solver, gmres_cgs );
          HYPRE_GMRESSetMaxIter( (HYPRE_Solver)solver, 100 );
          HYPRE_GMRESSetTol( (HYPRE_Solver)solver, tol );
          HYPRE_GMRESSetRelChange( (HYPRE_Solver)solver, 0 );
@@ -2353,6 +2465,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetRedundantSize(precond, redundant);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2380,6 +2493,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBSplitStorage(precond, rbsplit);
+            HYPRE_StructPFMGSetRedundantSize(precond, redundant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2438,8 +2553,8 @@ main( hypre_int argc,
                                    (HYPRE_Solver)precond);
          }
 
-         HYPRE_GMRESSetup
-            ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x );
+         setup_ierr = HYPRE_GMRESSetup
+                         ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x );
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
@@ -2449,8 +2564,11 @@ main( hypre_int argc,
          time_index = hypre_InitializeTiming("GMRES Solve");
          hypre_BeginTiming(time_index);
 
-         HYPRE_GMRESSolve
-            ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+         if (!setup_ierr)
+         {
+            HYPRE_GMRESSolve
+               ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+         }
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
@@ -2504,6 +2622,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetRedundantSize(precond, redundant);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2531,6 +2650,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBSplitStorage(precond, rbsplit);
+            HYPRE_StructPFMGSetRedundantSize(precond, redundant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2589,8 +2710,8 @@ main( hypre_int argc,
                                       (HYPRE_Solver)precond);
          }
 
-         HYPRE_BiCGSTABSetup
-            ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x );
+         setup_ierr = HYPRE_BiCGSTABSetup
+                         ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x );
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
@@ -2600,8 +2721,11 @@ main( hypre_int argc,
          time_index = hypre_InitializeTiming("BiCGSTAB Solve");
          hypre_BeginTiming(time_index);
 
-         HYPRE_BiCGSTABSolve
-            ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+         if (!setup_ierr)
+         {
+            HYPRE_BiCGSTABSolve
+               ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+         }
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
@@ -2640,6 +2764,7 @@ main( hypre_int argc,
 
          HYPRE_StructLGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
          HYPRE_LGMRESSetKDim( (HYPRE_Solver) solver, 5 );
+         HYPRE_LGMRESSetCGS( (HYPRE_Solver) solver, gmres_cgs );
          HYPRE_LGMRESSetMaxIter( (HYPRE_Solver)solver, 100 );
          HYPRE_LGMRESSetTol( (HYPRE_Solver)solver, tol );
          HYPRE_LGMRESSetPrintLevel( (HYPRE_Solver)solver, 1 );
@@ -2655,6 +2780,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetRedundantSize(precond, redundant);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2682,6 +2808,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBSplitStorage(precond, rbsplit);
+            HYPRE_StructPFMGSetRedundantSize(precond, redundant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2694,8 +2822,8 @@ main( hypre_int argc,
                                     (HYPRE_Solver)precond);
          }
 
-         HYPRE_LGMRESSetup
-            ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x );
+         setup_ierr = HYPRE_LGMRESSetup
+                         ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x );
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
@@ -2705,8 +2833,11 @@ main( hypre_int argc,
          time_index = hypre_InitializeTiming("LGMRES Solve");
          hypre_BeginTiming(time_index);
 
-         HYPRE_LGMRESSolve
-            ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+         if (!setup_ierr)
+         {
+            HYPRE_LGMRESSolve
+               ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+         }
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
@@ -2738,6 +2869,7 @@ main( hypre_int argc,
 
          HYPRE_StructFlexGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
          HYPRE_FlexGMRESSetKDim( (HYPRE_Solver) solver, 5 );
+         HYPRE_FlexGMRESSetCGS( (HYPRE_Solver) solver, gmres_cgs );
          HYPRE_FlexGMRESSetMaxIter( (HYPRE_Solver)solver, 100 );
          HYPRE_FlexGMRESSetTol( (HYPRE_Solver)solver, tol );
          HYPRE_FlexGMRESSetPrintLevel( (HYPRE_Solver)solver, 1 );
@@ -2753,6 +2885,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetRedundantSize(precond, redundant);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if defined(HYPRE_USING_CUDA)
@@ -2780,6 +2913,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBSplitStorage(precond, rbsplit);
+            HYPRE_StructPFMGSetRedundantSize(precond, redundant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2792,8 +2927,8 @@ main( hypre_int argc,
                                        (HYPRE_Solver)precond);
          }
 
-         HYPRE_FlexGMRESSetup
-            ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x );
+         setup_ierr = HYPRE_FlexGMRESSetup
+                         ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x );
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
@@ -2803,8 +2938,11 @@ main( hypre_int argc,
          time_index = hypre_InitializeTiming("FlexGMRES Solve");
          hypre_BeginTiming(time_index);
 
-         HYPRE_FlexGMRESSolve
-            ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+         if (!setup_ierr)
+         {
+            HYPRE_FlexGMRESSolve
+               ( (HYPRE_Solver)solver, (HYPRE_Matrix)A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+         }
 
          hypre_EndTiming(time_index);
          hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
@@ -2838,8 +2976,15 @@ main( hypre_int argc,
       if (myid == 0 && rep==reps-1 /* begin lobpcg */ && !lobpcgFlag /* end lobpcg */)
       {
          hypre_printf("\n");
-         hypre_printf("Iterations = %d\n", num_iterations);
-         hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+         if (setup_ierr)
+         {
+            hypre_printf("Solver setup failed with error code %d\n", setup_ierr);
+         }
+         else
+         {
+            hypre_printf("Iterations = %d\n", num_iterations);
+            hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+         }
          hypre_printf("\n");
       }
 
@@ -2912,6 +3057,109 @@ main( hypre_int argc,
    return (0);
 }
 
+/*-------------------------------------------------------------------------
+ * Fill the components of a multi-component vector with different right-hand
+ * sides: component 0 is set as in AddValuesVector, component c > 0 to value
+ * times a piecewise constant pattern in the global index that depends on c
+ * (for fully periodic problems, c+1 times the source/sink of component 0).
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+AddValuesVectorComponents( hypre_StructGrid   *gridvector,
+                           hypre_StructVector *zvector,
+                           HYPRE_Int          *period,
+                           HYPRE_Real          value )
+{
+   HYPRE_Int          num_components = hypre_StructVectorNumComponents(zvector);
+   HYPRE_Int          dim = hypre_StructGridNDim(gridvector);
+   hypre_BoxArray    *gridboxes = hypre_StructGridBoxes(gridvector);
+   hypre_Box         *box;
+   hypre_IndexRef     ilower, iupper;
+   hypre_Index        index;
+   HYPRE_Real        *values, *values_h;
+   HYPRE_Int          ib, c, d, i, volume, pattern;
+   HYPRE_Int          fully_periodic;
+#if defined(HYPRE_USING_CUDA)
+   HYPRE_Int          data_location = hypre_StructGridDataLocation(hypre_StructVectorGrid(zvector));
+#endif
+
+   fully_periodic = ((dim == 2 && period[0] != 0 && period[1] != 0) ||
+                     (dim == 3 && period[0] != 0 && period[1] != 0 && period[2] != 0));
+
+   /* set component 0 last, it is used as staging area for the others */
+   for (c = num_components - 1; c >= 0; c--)
+   {
+      if (c == 0 || fully_periodic)
+      {
+         AddValuesVector(gridvector, zvector, period, value * (c + 1));
+      }
+      else
+      {
+         hypre_ForBoxI(ib, gridboxes)
+         {
+            box      = hypre_BoxArrayBox(gridboxes, ib);
+            volume   = hypre_BoxVolume(box);
+            ilower   = hypre_BoxIMin(box);
+            iupper   = hypre_BoxIMax(box);
+            values_h = hypre_CTAlloc(HYPRE_Real, volume, HYPRE_MEMORY_HOST);
+
+            /* values are ordered with the first index varying fastest */
+            hypre_CopyIndex(ilower, index);
+            for (i = 0; i < volume; i++)
+            {
+               pattern = 0;
+               for (d = 0; d < dim; d++)
+               {
+                  pattern += (d + 1) * index[d];
+               }
+               pattern = ((pattern % (c + 2)) + (c + 2)) % (c + 2);
+               values_h[i] = value * (1.0 + (HYPRE_Real) pattern / (HYPRE_Real) (c + 1));
+
+               for (d = 0; d < dim; d++)
+               {
+                  if (index[d] < iupper[d])
+                  {
+                     index[d]++;
+                     break;
+                  }
+                  index[d] = ilower[d];
+               }
+            }
+
+#if defined(HYPRE_USING_CUDA)
+            if (data_location != HYPRE_MEMORY_HOST)
+            {
+               values = hypre_TAlloc(HYPRE_Real, volume, HYPRE_MEMORY_DEVICE);
+               hypre_TMemcpy(values, values_h, HYPRE_Real, volume,
+                             HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
+            }
+            else
+            {
+               values = values_h;
+            }
+#else
+            values = values_h;
+#endif
+
+            HYPRE_StructVectorSetBoxValues(zvector, ilower, iupper, values);
+
+            if (values != values_h)
+            {
+               hypre_TFree(values, HYPRE_MEMORY_DEVICE);
+            }
+            hypre_TFree(values_h, HYPRE_MEMORY_HOST);
+         }
+      }
+
+      if (c > 0)
+      {
+         HYPRE_StructVectorCopyComponent(zvector, 0, zvector, c);
+      }
+   }
+
+   return 0;
+}
+
 /*-------------------------------------------------------------------------
  * add constant values to a vector. Need to pass the initialized vector, grid,
  * period of grid and the constant value.
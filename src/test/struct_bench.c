@@ -0,0 +1,866 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "_hypre_utilities.h"
+#include "HYPRE_struct_ls.h"
+#include "_hypre_struct_mv.h"
+
+/*--------------------------------------------------------------------------
+ * Benchmark driver for the structured kernels and PFMG
+ *
+ * For every combination of grid size, stencil, constant-coefficient mode and
+ * thread count, the driver times the struct matvec (y = y - Ax), point-Jacobi
+ * relaxation (hypre_PointRelax through the StructJacobi solver) and PFMG
+ * setup and solve, and reports the achieved bandwidth relative to a STREAM
+ * triad measured with the same number of threads.
+ *
+ * Bytes are counted with a simple compulsory-traffic model per grid point:
+ *
+ *    matvec     : A + x + y (read and write)            = A + 24
+ *    pointrelax : A + x + b + t (write and read) + x    = A + 40
+ *    triad      : a = b + s*c                           = 24
+ *
+ * where A is 8 bytes per variable stencil entry (all entries with
+ * constant-coefficient mode 0, only the diagonal with mode 2, none with
+ * mode 1).  PFMG rows report times only; with -profile_out the per-level
+ * setup and cycle breakdown of each configuration is written as JSON by the
+ * region profiler.
+ *--------------------------------------------------------------------------*/
+
+#define BENCH_MAX_LIST 32
+
+typedef struct
+{
+   FILE       *fp;
+   HYPRE_Int   json;
+   HYPRE_Int   num_records;
+   HYPRE_Int   ndim;
+   HYPRE_Int   nprocs;
+} BenchOutput;
+
+/*--------------------------------------------------------------------------
+ * Parse a list of integers following argv[*arg_index] up to the next option
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchParseList( HYPRE_Int   argc,
+                char       *argv[],
+                HYPRE_Int  *arg_index,
+                HYPRE_Int  *list )
+{
+   HYPRE_Int n = 0;
+
+   while ((*arg_index < argc) && (argv[*arg_index][0] != '-') && (n < BENCH_MAX_LIST))
+   {
+      list[n++] = atoi(argv[(*arg_index)++]);
+   }
+
+   return n;
+}
+
+/*--------------------------------------------------------------------------
+ * Build the offsets of a 2D (5, 9) or 3D (7, 19, 27) point stencil, with the
+ * center first.  Returns 0 for an unsupported size.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchStencilOffsets( HYPRE_Int   ndim,
+                     HYPRE_Int   stencil_size,
+                     HYPRE_Int (*offsets)[3] )
+{
+   HYPRE_Int  i, j, k, l1, maxl1, kmax, s;
+
+   if ( (ndim == 2) && (stencil_size == 5) )
+   {
+      maxl1 = 1;
+   }
+   else if ( (ndim == 2) && (stencil_size == 9) )
+   {
+      maxl1 = 2;
+   }
+   else if ( (ndim == 3) && (stencil_size == 7) )
+   {
+      maxl1 = 1;
+   }
+   else if ( (ndim == 3) && (stencil_size == 19) )
+   {
+      maxl1 = 2;
+   }
+   else if ( (ndim == 3) && (stencil_size == 27) )
+   {
+      maxl1 = 3;
+   }
+   else
+   {
+      return 0;
+   }
+
+   offsets[0][0] = 0;
+   offsets[0][1] = 0;
+   offsets[0][2] = 0;
+   s = 1;
+   kmax = (ndim > 2) ? 1 : 0;
+   for (k = -kmax; k <= kmax; k++)
+   {
+      for (j = -1; j <= 1; j++)
+      {
+         for (i = -1; i <= 1; i++)
+         {
+            l1 = hypre_abs(i) + hypre_abs(j) + hypre_abs(k);
+            if ((l1 > 0) && (l1 <= maxl1))
+            {
+               offsets[s][0] = i;
+               offsets[s][1] = j;
+               offsets[s][2] = k;
+               s++;
+            }
+         }
+      }
+   }
+
+   return s;
+}
+
+/*--------------------------------------------------------------------------
+ * Create an M-matrix with -1 off-diagonals and a diagonal equal to the number
+ * of off-diagonals on this rank's box.  With constant_coefficient = 0, the
+ * couplings to points outside of the global grid are zeroed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchBuildMatrix( MPI_Comm             comm,
+                  HYPRE_StructGrid     grid,
+                  HYPRE_Int            ndim,
+                  HYPRE_Int           *ilower,
+                  HYPRE_Int           *iupper,
+                  HYPRE_Int           *global_n,
+                  HYPRE_Int            stencil_size,
+                  HYPRE_Int            constant_coefficient,
+                  HYPRE_StructStencil *stencil_ptr,
+                  HYPRE_StructMatrix  *A_ptr )
+{
+   HYPRE_StructStencil  stencil;
+   HYPRE_StructMatrix   A;
+   HYPRE_Int            offsets[27][3];
+   HYPRE_Int            entries[27];
+   HYPRE_Real           cvalues[27];
+   HYPRE_Real          *values, *values_d;
+   HYPRE_Int            size[3], idx[3];
+   HYPRE_Int            volume, num_entries, s, d, i, j, k, m;
+
+   BenchStencilOffsets(ndim, stencil_size, offsets);
+
+   HYPRE_StructStencilCreate(ndim, stencil_size, &stencil);
+   for (s = 0; s < stencil_size; s++)
+   {
+      HYPRE_StructStencilSetElement(stencil, s, offsets[s]);
+   }
+
+   HYPRE_StructMatrixCreate(comm, grid, stencil, &A);
+   if (constant_coefficient > 0)
+   {
+      /* entry 0 is the center; leaving it out makes the diagonal variable */
+      num_entries = 0;
+      for (s = (constant_coefficient == 1) ? 0 : 1; s < stencil_size; s++)
+      {
+         entries[num_entries++] = s;
+      }
+      hypre_StructMatrixSetConstantEntries(A, num_entries, entries);
+   }
+   HYPRE_StructMatrixSetSymmetric(A, 0);
+   HYPRE_StructMatrixInitialize(A);
+
+   volume = 1;
+   for (d = 0; d < 3; d++)
+   {
+      size[d] = (d < ndim) ? (iupper[d] - ilower[d] + 1) : 1;
+      volume *= size[d];
+   }
+
+   if (constant_coefficient > 0)
+   {
+      num_entries = 0;
+      for (s = (constant_coefficient == 1) ? 0 : 1; s < stencil_size; s++)
+      {
+         entries[num_entries] = s;
+         cvalues[num_entries] = (s == 0) ? (HYPRE_Real) (stencil_size - 1) : -1.0;
+         num_entries++;
+      }
+      HYPRE_StructMatrixSetConstantValues(A, num_entries, entries, cvalues);
+   }
+
+   values   = hypre_CTAlloc(HYPRE_Real, volume, HYPRE_MEMORY_HOST);
+   values_d = hypre_CTAlloc(HYPRE_Real, volume, HYPRE_MEMORY_DEVICE);
+   for (s = 0; s < stencil_size; s++)
+   {
+      if ( (constant_coefficient == 1) || ((constant_coefficient == 2) && (s > 0)) )
+      {
+         continue;
+      }
+
+      m = 0;
+      for (k = 0; k < size[2]; k++)
+      {
+         for (j = 0; j < size[1]; j++)
+         {
+            for (i = 0; i < size[0]; i++)
+            {
+               if (s == 0)
+               {
+                  values[m] = (HYPRE_Real) (stencil_size - 1);
+               }
+               else
+               {
+                  idx[0] = ilower[0] + i + offsets[s][0];
+                  idx[1] = ilower[1] + j + offsets[s][1];
+                  idx[2] = ((ndim > 2) ? ilower[2] : 0) + k + offsets[s][2];
+                  values[m] = -1.0;
+                  for (d = 0; d < ndim; d++)
+                  {
+                     if ((idx[d] < 0) || (idx[d] >= global_n[d]))
+                     {
+                        values[m] = 0.0;
+                     }
+                  }
+               }
+               m++;
+            }
+         }
+      }
+
+      hypre_TMemcpy(values_d, values, HYPRE_Real, volume,
+                    HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
+      HYPRE_StructMatrixSetBoxValues(A, ilower, iupper, 1, &s, values_d);
+   }
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   hypre_TFree(values_d, HYPRE_MEMORY_DEVICE);
+
+   HYPRE_StructMatrixAssemble(A);
+
+   *stencil_ptr = stencil;
+   *A_ptr       = A;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchBuildVector( MPI_Comm             comm,
+                  HYPRE_StructGrid     grid,
+                  HYPRE_Real           value,
+                  HYPRE_StructVector  *vector_ptr )
+{
+   HYPRE_StructVector vector;
+
+   HYPRE_StructVectorCreate(comm, grid, &vector);
+   HYPRE_StructVectorInitialize(vector);
+   HYPRE_StructVectorSetConstantValues(vector, value);
+   HYPRE_StructVectorAssemble(vector);
+
+   *vector_ptr = vector;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Maximum of a time over all ranks
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+BenchMaxTime( MPI_Comm    comm,
+              HYPRE_Real  t )
+{
+   HYPRE_Real tmax;
+
+   hypre_MPI_Allreduce(&t, &tmax, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+   return tmax;
+}
+
+/*--------------------------------------------------------------------------
+ * Best STREAM triad bandwidth in GB/s over all ranks (aggregate)
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+BenchStream( MPI_Comm    comm,
+             HYPRE_Int   n,
+             HYPRE_Int   ntimes,
+             HYPRE_Int   nprocs )
+{
+   HYPRE_Real  *a, *b, *c;
+   HYPRE_Real   scalar = 3.0;
+   HYPRE_Real   t, best = 0.0;
+   HYPRE_Int    i, r;
+
+   a = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   b = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   c = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+
+   /* first touch with the same thread layout as the timed loop */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < n; i++)
+   {
+      a[i] = 0.0;
+      b[i] = 1.0;
+      c[i] = 2.0;
+   }
+
+   for (r = 0; r < ntimes; r++)
+   {
+      hypre_MPI_Barrier(comm);
+      t = hypre_MPI_Wtime();
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         a[i] = b[i] + scalar * c[i];
+      }
+      t = BenchMaxTime(comm, hypre_MPI_Wtime() - t);
+      if ((r == 0) || (t < best))
+      {
+         best = t;
+      }
+   }
+
+   /* keep the result alive */
+   if (a[n / 2] != 7.0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "STREAM triad check failed\n");
+   }
+
+   hypre_TFree(a, HYPRE_MEMORY_HOST);
+   hypre_TFree(b, HYPRE_MEMORY_HOST);
+   hypre_TFree(c, HYPRE_MEMORY_HOST);
+
+   return (24.0 * (HYPRE_Real) n * (HYPRE_Real) nprocs) / best / 1.0e9;
+}
+
+/*--------------------------------------------------------------------------
+ * Time 'reps' matvecs (kernel 0) or Jacobi sweeps (kernel 1); the returned
+ * time is the maximum over all ranks
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+BenchKernel( MPI_Comm             comm,
+             HYPRE_Int            kernel,
+             void                *matvec_data,
+             HYPRE_StructSolver   jacobi,
+             HYPRE_StructMatrix   A,
+             HYPRE_StructVector   b,
+             HYPRE_StructVector   x,
+             HYPRE_StructVector   y,
+             HYPRE_Int            reps )
+{
+   HYPRE_Real t;
+   HYPRE_Int  r;
+
+   hypre_MPI_Barrier(comm);
+   t = hypre_MPI_Wtime();
+   if (kernel == 0)
+   {
+      for (r = 0; r < reps; r++)
+      {
+         hypre_StructMatvecCompute(matvec_data, -1.0, (hypre_StructMatrix *) A,
+                                   (hypre_StructVector *) x, 1.0,
+                                   (hypre_StructVector *) y);
+      }
+   }
+   else
+   {
+      HYPRE_StructJacobiSetMaxIter(jacobi, reps);
+      HYPRE_StructJacobiSolve(jacobi, A, b, x);
+   }
+#if defined(HYPRE_USING_GPU)
+   hypre_SyncDevice();
+#endif
+
+   return BenchMaxTime(comm, hypre_MPI_Wtime() - t);
+}
+
+/*--------------------------------------------------------------------------
+ * Write one result record (rank 0 only)
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchReport( BenchOutput *out,
+             const char  *kernel,
+             HYPRE_Int    n,
+             HYPRE_Int    stencil_size,
+             HYPRE_Int    constant_coefficient,
+             HYPRE_Int    num_threads,
+             HYPRE_Int    reps,
+             HYPRE_Real   seconds,
+             HYPRE_Real   bytes,
+             HYPRE_Real   stream_gbs )
+{
+   HYPRE_Real  gbs  = 0.0;
+   HYPRE_Real  frac = 0.0;
+
+   if (out -> fp == NULL)
+   {
+      return hypre_error_flag;
+   }
+
+   if ((bytes > 0.0) && (seconds > 0.0))
+   {
+      gbs  = bytes / seconds / 1.0e9;
+      frac = (stream_gbs > 0.0) ? gbs / stream_gbs : 0.0;
+   }
+
+   if (out -> json)
+   {
+      hypre_fprintf(out -> fp, "%s\n  {\"kernel\": \"%s\", \"ndim\": %d, \"n\": %d, "
+                    "\"stencil\": %d, \"constant_coefficient\": %d, \"threads\": %d, "
+                    "\"procs\": %d, \"reps\": %d, \"seconds\": %.6e, \"bytes\": %.6e, "
+                    "\"gbs\": %.4f, \"stream_fraction\": %.4f}",
+                    (out -> num_records) ? "," : "",
+                    kernel, out -> ndim, n, stencil_size, constant_coefficient,
+                    num_threads, out -> nprocs, reps, seconds, bytes, gbs, frac);
+   }
+   else
+   {
+      if ((out -> num_records) == 0)
+      {
+         hypre_fprintf(out -> fp, "kernel,ndim,n,stencil,constant_coefficient,threads,"
+                       "procs,reps,seconds,bytes,gbs,stream_fraction\n");
+      }
+      hypre_fprintf(out -> fp, "%s,%d,%d,%d,%d,%d,%d,%d,%.6e,%.6e,%.4f,%.4f\n",
+                    kernel, out -> ndim, n, stencil_size, constant_coefficient,
+                    num_threads, out -> nprocs, reps, seconds, bytes, gbs, frac);
+   }
+   fflush(out -> fp);
+   (out -> num_records)++;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+hypre_int
+main( hypre_int argc,
+      char *argv[] )
+{
+   MPI_Comm            comm = hypre_MPI_COMM_WORLD;
+   HYPRE_Int           arg_index;
+   HYPRE_Int           print_usage;
+   HYPRE_Int           num_procs, myid;
+
+   HYPRE_Int           ndim;
+   HYPRE_Int           P, Q, R, p, q, r;
+   HYPRE_Int           sizes[BENCH_MAX_LIST], num_sizes;
+   HYPRE_Int           stencils[BENCH_MAX_LIST], num_stencils;
+   HYPRE_Int           ccmodes[BENCH_MAX_LIST], num_ccmodes;
+   HYPRE_Int           threads[BENCH_MAX_LIST], num_threads_list;
+   HYPRE_Int           reps_user;
+   HYPRE_Real          min_time;
+   HYPRE_Int           stream_n;
+   HYPRE_Int           do_pfmg;
+   HYPRE_Int           json;
+   char               *out_name;
+   char               *profile_prefix;
+
+   BenchOutput         out;
+   HYPRE_StructGrid    grid;
+   HYPRE_StructStencil stencil;
+   HYPRE_StructMatrix  A;
+   HYPRE_StructVector  b, x, y;
+   HYPRE_StructSolver  solver;
+   void               *matvec_data;
+
+   HYPRE_Int           ilower[3], iupper[3], global_n[3], offsets[27][3];
+   HYPRE_Int           it, in, is, ic, n, d, nthreads, stencil_size, cc, reps;
+   HYPRE_Int           num_iterations;
+   HYPRE_Real          npoints, abytes, stream_gbs, t, t1;
+   char                filename[1024];
+
+   /*-----------------------------------------------------------
+    * Initialize some stuff
+    *-----------------------------------------------------------*/
+
+   hypre_MPI_Init(&argc, &argv);
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   hypre_bind_device(myid, num_procs, comm);
+
+   HYPRE_Init();
+
+   /*-----------------------------------------------------------
+    * Set defaults
+    *-----------------------------------------------------------*/
+
+   ndim = 3;
+   P = num_procs;
+   Q = 1;
+   R = 1;
+   num_sizes = 0;
+   num_stencils = 0;
+   num_ccmodes = 0;
+   num_threads_list = 0;
+   reps_user = 0;
+   min_time = 0.25;
+   stream_n = 1 << 24;
+   do_pfmg = 1;
+   json = 0;
+   out_name = NULL;
+   profile_prefix = NULL;
+
+   /*-----------------------------------------------------------
+    * Parse command line
+    *-----------------------------------------------------------*/
+
+   print_usage = 0;
+   arg_index = 1;
+   while (arg_index < argc)
+   {
+      if ( strcmp(argv[arg_index], "-d") == 0 )
+      {
+         arg_index++;
+         ndim = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-n") == 0 )
+      {
+         arg_index++;
+         num_sizes = BenchParseList(argc, argv, &arg_index, sizes);
+      }
+      else if ( strcmp(argv[arg_index], "-stencil") == 0 )
+      {
+         arg_index++;
+         num_stencils = BenchParseList(argc, argv, &arg_index, stencils);
+      }
+      else if ( strcmp(argv[arg_index], "-cc") == 0 )
+      {
+         arg_index++;
+         num_ccmodes = BenchParseList(argc, argv, &arg_index, ccmodes);
+      }
+      else if ( strcmp(argv[arg_index], "-threads") == 0 )
+      {
+         arg_index++;
+         num_threads_list = BenchParseList(argc, argv, &arg_index, threads);
+      }
+      else if ( strcmp(argv[arg_index], "-P") == 0 )
+      {
+         arg_index++;
+         P = atoi(argv[arg_index++]);
+         Q = atoi(argv[arg_index++]);
+         R = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-reps") == 0 )
+      {
+         arg_index++;
+         reps_user = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mintime") == 0 )
+      {
+         arg_index++;
+         min_time = atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-stream") == 0 )
+      {
+         arg_index++;
+         stream_n = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-nopfmg") == 0 )
+      {
+         arg_index++;
+         do_pfmg = 0;
+      }
+      else if ( strcmp(argv[arg_index], "-json") == 0 )
+      {
+         arg_index++;
+         json = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-o") == 0 )
+      {
+         arg_index++;
+         out_name = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-profile_out") == 0 )
+      {
+         arg_index++;
+         profile_prefix = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-help") == 0 )
+      {
+         print_usage = 1;
+         break;
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   if ((ndim != 2) && (ndim != 3))
+   {
+      print_usage = 1;
+   }
+   if (P*Q*R != num_procs)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Error: Invalid number of processors or processor topology\n");
+      }
+      print_usage = 1;
+   }
+
+   if (print_usage)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("\n");
+         hypre_printf("Usage: %s [<options>]\n", argv[0]);
+         hypre_printf("\n");
+         hypre_printf("  -d <dim>               : problem dimension, 2 or 3 (default 3)\n");
+         hypre_printf("  -n <n> [<n> ...]       : grid sizes per processor and direction\n");
+         hypre_printf("  -stencil <s> [<s> ...] : stencil sizes, 5 9 (2D) or 7 19 27 (3D)\n");
+         hypre_printf("  -cc <c> [<c> ...]      : constant coefficient modes 0, 1, 2\n");
+         hypre_printf("  -threads <t> [<t> ...] : OpenMP thread counts\n");
+         hypre_printf("  -P <Px> <Py> <Pz>      : processor topology\n");
+         hypre_printf("  -reps <r>              : repetitions per kernel (default: auto)\n");
+         hypre_printf("  -mintime <s>           : minimum time per kernel for auto reps\n");
+         hypre_printf("  -stream <n>            : STREAM array length per processor\n");
+         hypre_printf("  -nopfmg                : skip the PFMG setup and solve\n");
+         hypre_printf("  -json                  : write JSON instead of CSV\n");
+         hypre_printf("  -o <file>              : output file (default: stdout)\n");
+         hypre_printf("  -profile_out <prefix>  : write the PFMG region profile of each\n");
+         hypre_printf("                           configuration as JSON\n");
+         hypre_printf("\n");
+      }
+
+      HYPRE_Finalize();
+      hypre_MPI_Finalize();
+      exit(1);
+   }
+
+   if (num_sizes == 0)
+   {
+      sizes[num_sizes++] = (ndim == 3) ? 32 : 256;
+      sizes[num_sizes++] = (ndim == 3) ? 64 : 1024;
+   }
+   if (num_stencils == 0)
+   {
+      stencils[num_stencils++] = (ndim == 3) ? 7 : 5;
+      stencils[num_stencils++] = (ndim == 3) ? 27 : 9;
+   }
+   if (num_ccmodes == 0)
+   {
+      ccmodes[num_ccmodes++] = 0;
+      ccmodes[num_ccmodes++] = 1;
+      ccmodes[num_ccmodes++] = 2;
+   }
+   if (num_threads_list == 0)
+   {
+      threads[num_threads_list++] = hypre_NumThreads();
+   }
+
+   /*-----------------------------------------------------------
+    * Open the output
+    *-----------------------------------------------------------*/
+
+   out.fp          = NULL;
+   out.json        = json;
+   out.num_records = 0;
+   out.ndim        = ndim;
+   out.nprocs      = num_procs;
+   if (myid == 0)
+   {
+      out.fp = (out_name != NULL) ? fopen(out_name, "w") : stdout;
+      if (out.fp == NULL)
+      {
+         hypre_printf("Error: can't open output file %s\n", out_name);
+         hypre_MPI_Abort(comm, 1);
+      }
+      if (json)
+      {
+         hypre_fprintf(out.fp, "{\"results\": [");
+      }
+   }
+
+   p = myid % P;
+   q = (myid / P) % Q;
+   r = myid / (P * Q);
+
+   /*-----------------------------------------------------------
+    * Sweep the configurations
+    *-----------------------------------------------------------*/
+
+   for (it = 0; it < num_threads_list; it++)
+   {
+      hypre_SetNumThreads(threads[it]);
+      nthreads = hypre_NumThreads();
+
+      stream_gbs = BenchStream(comm, stream_n, 10, num_procs);
+      BenchReport(&out, "stream_triad", 0, 0, 0, nthreads, 10,
+                  24.0 * stream_n * num_procs / (stream_gbs * 1.0e9),
+                  24.0 * stream_n * num_procs, stream_gbs);
+
+      for (in = 0; in < num_sizes; in++)
+      {
+         n = sizes[in];
+
+         ilower[0] = p * n;  iupper[0] = ilower[0] + n - 1;
+         ilower[1] = q * n;  iupper[1] = ilower[1] + n - 1;
+         ilower[2] = r * n;  iupper[2] = ilower[2] + n - 1;
+         global_n[0] = P * n;
+         global_n[1] = Q * n;
+         global_n[2] = R * n;
+
+         npoints = (HYPRE_Real) num_procs;
+         for (d = 0; d < ndim; d++)
+         {
+            npoints *= (HYPRE_Real) n;
+         }
+
+         HYPRE_StructGridCreate(comm, ndim, &grid);
+         HYPRE_StructGridSetExtents(grid, ilower, iupper);
+         HYPRE_StructGridAssemble(grid);
+
+         BenchBuildVector(comm, grid, 1.0, &b);
+         BenchBuildVector(comm, grid, 1.0, &x);
+         BenchBuildVector(comm, grid, 0.0, &y);
+
+         for (is = 0; is < num_stencils; is++)
+         {
+            stencil_size = stencils[is];
+            if (BenchStencilOffsets(ndim, stencil_size, offsets) == 0)
+            {
+               if (myid == 0)
+               {
+                  hypre_printf("Warning: skipping unsupported %dD stencil size %d\n",
+                               ndim, stencil_size);
+               }
+               continue;
+            }
+
+            for (ic = 0; ic < num_ccmodes; ic++)
+            {
+               cc = ccmodes[ic];
+               BenchBuildMatrix(comm, grid, ndim, ilower, iupper, global_n,
+                                stencil_size, cc, &stencil, &A);
+
+               switch (cc)
+               {
+                  case 0:  abytes = 8.0 * stencil_size;  break;
+                  case 2:  abytes = 8.0;                 break;
+                  default: abytes = 0.0;                 break;
+               }
+
+               /* matvec */
+               matvec_data = hypre_StructMatvecCreate();
+               hypre_StructMatvecSetup(matvec_data, (hypre_StructMatrix *) A,
+                                       (hypre_StructVector *) x);
+               BenchKernel(comm, 0, matvec_data, NULL, A, b, x, y, 1);
+               t1 = BenchKernel(comm, 0, matvec_data, NULL, A, b, x, y, 1);
+               reps = (reps_user > 0) ? reps_user : hypre_max(3, (HYPRE_Int) (min_time / t1) + 1);
+               t = BenchKernel(comm, 0, matvec_data, NULL, A, b, x, y, reps) / reps;
+               BenchReport(&out, "matvec", n, stencil_size, cc, nthreads, reps, t,
+                           (abytes + 24.0) * npoints, stream_gbs);
+               hypre_StructMatvecDestroy(matvec_data);
+
+               /* point relaxation */
+               HYPRE_StructJacobiCreate(comm, &solver);
+               HYPRE_StructJacobiSetTol(solver, 0.0);
+               HYPRE_StructJacobiSetNonZeroGuess(solver);
+               HYPRE_StructJacobiSetMaxIter(solver, 1);
+               HYPRE_StructJacobiSetup(solver, A, b, x);
+               BenchKernel(comm, 1, NULL, solver, A, b, x, y, 1);
+               t1 = BenchKernel(comm, 1, NULL, solver, A, b, x, y, 1);
+               reps = (reps_user > 0) ? reps_user : hypre_max(3, (HYPRE_Int) (min_time / t1) + 1);
+               t = BenchKernel(comm, 1, NULL, solver, A, b, x, y, reps) / reps;
+               BenchReport(&out, "pointrelax", n, stencil_size, cc, nthreads, reps, t,
+                           (abytes + 40.0) * npoints, stream_gbs);
+               HYPRE_StructJacobiDestroy(solver);
+
+               /* PFMG setup and solve */
+               if (do_pfmg)
+               {
+                  if (profile_prefix)
+                  {
+                     HYPRE_SetProfiling(1);
+                  }
+
+                  HYPRE_StructVectorSetConstantValues(x, 0.0);
+                  HYPRE_StructPFMGCreate(comm, &solver);
+                  HYPRE_StructPFMGSetMaxIter(solver, 50);
+                  HYPRE_StructPFMGSetTol(solver, 1.0e-06);
+                  HYPRE_StructPFMGSetRelaxType(solver, 1);
+                  HYPRE_StructPFMGSetNumPreRelax(solver, 1);
+                  HYPRE_StructPFMGSetNumPostRelax(solver, 1);
+
+                  hypre_MPI_Barrier(comm);
+                  t = hypre_MPI_Wtime();
+                  HYPRE_StructPFMGSetup(solver, A, b, x);
+                  t = BenchMaxTime(comm, hypre_MPI_Wtime() - t);
+                  BenchReport(&out, "pfmg_setup", n, stencil_size, cc, nthreads, 1, t,
+                              0.0, stream_gbs);
+
+                  hypre_MPI_Barrier(comm);
+                  t = hypre_MPI_Wtime();
+                  HYPRE_StructPFMGSolve(solver, A, b, x);
+                  t = BenchMaxTime(comm, hypre_MPI_Wtime() - t);
+                  HYPRE_StructPFMGGetNumIterations(solver, &num_iterations);
+                  BenchReport(&out, "pfmg_cycle", n, stencil_size, cc, nthreads,
+                              num_iterations, t / hypre_max(num_iterations, 1),
+                              0.0, stream_gbs);
+                  HYPRE_StructPFMGDestroy(solver);
+
+                  if (profile_prefix)
+                  {
+                     hypre_sprintf(filename, "%s.d%d_n%d_s%d_cc%d_t%d", profile_prefix,
+                                   ndim, n, stencil_size, cc, nthreads);
+                     HYPRE_ProfilerWriteJSON(comm, filename);
+                     HYPRE_ProfilerFinalize();
+                  }
+
+                  HYPRE_StructVectorSetConstantValues(x, 1.0);
+               }
+
+               HYPRE_StructMatrixDestroy(A);
+               HYPRE_StructStencilDestroy(stencil);
+            }
+         }
+
+         HYPRE_StructVectorDestroy(b);
+         HYPRE_StructVectorDestroy(x);
+         HYPRE_StructVectorDestroy(y);
+         HYPRE_StructGridDestroy(grid);
+      }
+   }
+
+   if (out.fp != NULL)
+   {
+      if (json)
+      {
+         hypre_fprintf(out.fp, "\n]}\n");
+      }
+      if (out.fp != stdout)
+      {
+         fclose(out.fp);
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Finalize things
+    *-----------------------------------------------------------*/
+
+   HYPRE_Finalize();
+   hypre_MPI_Finalize();
+
+   return (0);
+}
@@ -222,6 +222,25 @@ HYPRE_Int HYPRE_SetUmpirePinnedPoolName(const char *pool_name);
 
 HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HYPRE_Int max_bin, size_t max_cached_bytes);
 
+/*--------------------------------------------------------------------------
+ * HYPRE host memory pool
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_SetHostMemoryPool(HYPRE_Int use_pool);
+HYPRE_Int HYPRE_GetHostMemoryPoolStats(size_t *bytes_in_use, size_t *peak_bytes, size_t *reserved_bytes, size_t *num_allocs, size_t *num_reuses);
+HYPRE_Int HYPRE_PrintHostMemoryPoolStats();
+
+/*--------------------------------------------------------------------------
+ * HYPRE region profiler
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_SetProfiling(HYPRE_Int mode);
+HYPRE_Int HYPRE_ProfilerReset();
+HYPRE_Int HYPRE_ProfilerFinalize();
+HYPRE_Int HYPRE_ProfilerPrint(MPI_Comm comm);
+HYPRE_Int HYPRE_ProfilerWriteJSON(MPI_Comm comm, const char *prefix);
+HYPRE_Int HYPRE_ProfilerWriteChromeTrace(MPI_Comm comm, const char *prefix);
+
 #ifdef __cplusplus
 }
 #endif
@@ -40,6 +40,9 @@ typedef unsigned long long int hypre_ulonglongint;
 /* This allows us to consistently avoid 'double' throughout hypre */
 typedef double                 hypre_double;
 
+/* single precision storage, e.g. for mixed-precision AMG hierarchies */
+typedef float                  hypre_float;
+
 /*--------------------------------------------------------------------------
  * Define various functions
  *--------------------------------------------------------------------------*/
@@ -265,6 +268,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -383,6 +387,11 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
 
+/* MPI-3 neighborhood collectives on distributed graph communicators */
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+#define HYPRE_HAVE_MPI_NEIGHBOR_COLL
+#endif
+
 #endif
 
 /******************************************************************************
@@ -436,6 +445,7 @@ HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request , hypre_MPI_Status *status
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count , hypre_MPI_Request *array_of_requests , hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count , hypre_MPI_Request *array_of_requests , HYPRE_Int *index , hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , HYPRE_Int root , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Request_free( hypre_MPI_Request *request );
@@ -447,6 +457,10 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
+#ifdef HYPRE_HAVE_MPI_NEIGHBOR_COLL
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm , HYPRE_Int indegree , HYPRE_Int *sources , HYPRE_Int outdegree , HYPRE_Int *destinations , hypre_MPI_Comm *comm_dist_graph );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+#endif
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
@@ -721,6 +735,14 @@ typedef struct
 
 #endif /* #ifdef HYPRE_USING_MEMORY_TRACKER */
 
+/* host scratch memory, valid until the enclosing hypre_HostScratchEnd;
+ * freed with hypre_TFree(ptr, HYPRE_MEMORY_HOST) */
+#define hypre_TAllocScratch(type, count) \
+( (type *) hypre_HostScratchMAlloc((size_t)(sizeof(type) * (count)), 0) )
+
+#define hypre_CTAllocScratch(type, count) \
+( (type *) hypre_HostScratchMAlloc((size_t)(sizeof(type) * (count)), 1) )
+
 
 /*--------------------------------------------------------------------------
  * Prototypes
@@ -762,6 +784,16 @@ void hypre_MemoryTrackerInsert(const char *action, void *ptr, size_t nbytes, hyp
 HYPRE_Int hypre_PrintMemoryTracker();
 #endif
 
+/* hypre_host_pool.c */
+void * hypre_HostPoolMalloc( size_t size, HYPRE_Int zeroinit );
+HYPRE_Int hypre_HostPoolFree( void *ptr );
+size_t hypre_HostPoolBlockSize( void *ptr );
+void * hypre_HostScratchMAlloc( size_t size, HYPRE_Int zeroinit );
+HYPRE_Int hypre_HostScratchBegin( void );
+HYPRE_Int hypre_HostScratchEnd( void );
+HYPRE_Int hypre_HostPoolRelease( void );
+HYPRE_Int hypre_HostPoolPrintStats( void );
+
 /* memory_dmalloc.c */
 HYPRE_Int hypre_InitMemoryDebugDML( HYPRE_Int id );
 HYPRE_Int hypre_FinalizeMemoryDebugDML( void );
@@ -1127,6 +1159,36 @@ HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts, HYPRE_Int *contact_proc
 
 #endif /* end of header */
 
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header file for the hierarchical region profiler
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PROFILER_HEADER
+#define hypre_PROFILER_HEADER
+
+/* 0: off, 1: region tree, 2: region tree and trace events */
+extern HYPRE_Int hypre__profiler_mode;
+
+/* the test on hypre__profiler_mode keeps the disabled cost to one branch */
+#define hypre_ProfileRegionBegin(name) \
+   do { if (hypre__profiler_mode) { hypre_ProfilerRegionBegin(name); } } while (0)
+#define hypre_ProfileRegionEnd(name) \
+   do { if (hypre__profiler_mode) { hypre_ProfilerRegionEnd(name); } } while (0)
+#define hypre_ProfileLevelBegin(lvl) \
+   do { if (hypre__profiler_mode) { hypre_ProfilerLevelBegin(lvl); } } while (0)
+#define hypre_ProfileLevelEnd(lvl) \
+   do { if (hypre__profiler_mode) { hypre_ProfilerLevelEnd(lvl); } } while (0)
+
+#endif /* hypre_PROFILER_HEADER */
 /******************************************************************************
  * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
  * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
@@ -1138,6 +1200,9 @@ HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts, HYPRE_Int *contact_proc
  *
  * Header file for Caliper instrumentation macros
  *
+ * Without Caliper the annotations feed the hypre region profiler, which
+ * records them once it has been switched on with HYPRE_SetProfiling.
+ *
  *****************************************************************************/
 
 #ifndef CALIPER_INSTRUMENTATION_HEADER
@@ -1161,6 +1226,8 @@ static char hypre__levelname[16];
 
 #define HYPRE_ANNOTATE_FUNC_BEGIN          CALI_MARK_FUNCTION_BEGIN
 #define HYPRE_ANNOTATE_FUNC_END            CALI_MARK_FUNCTION_END
+#define HYPRE_ANNOTATE_REGION_BEGIN(str)   CALI_MARK_BEGIN(str)
+#define HYPRE_ANNOTATE_REGION_END(str)     CALI_MARK_END(str)
 #define HYPRE_ANNOTATE_LOOP_BEGIN(id, str) CALI_MARK_LOOP_BEGIN(id, str)
 #define HYPRE_ANNOTATE_LOOP_END(id)        CALI_MARK_LOOP_END(id)
 #define HYPRE_ANNOTATE_ITER_BEGIN(id, it)  CALI_MARK_ITERATION_BEGIN(id, it)
@@ -1178,14 +1245,16 @@ static char hypre__levelname[16];
 
 #else
 
-#define HYPRE_ANNOTATE_FUNC_BEGIN
-#define HYPRE_ANNOTATE_FUNC_END
+#define HYPRE_ANNOTATE_FUNC_BEGIN          hypre_ProfileRegionBegin(__func__)
+#define HYPRE_ANNOTATE_FUNC_END            hypre_ProfileRegionEnd(__func__)
+#define HYPRE_ANNOTATE_REGION_BEGIN(str)   hypre_ProfileRegionBegin(str)
+#define HYPRE_ANNOTATE_REGION_END(str)     hypre_ProfileRegionEnd(str)
 #define HYPRE_ANNOTATE_LOOP_BEGIN(id, str)
 #define HYPRE_ANNOTATE_LOOP_END(id)
 #define HYPRE_ANNOTATE_ITER_BEGIN(id, it)
 #define HYPRE_ANNOTATE_ITER_END(id)
-#define HYPRE_ANNOTATE_MGLEVEL_BEGIN(lvl)
-#define HYPRE_ANNOTATE_MGLEVEL_END(lvl)
+#define HYPRE_ANNOTATE_MGLEVEL_BEGIN(lvl)  hypre_ProfileLevelBegin(lvl)
+#define HYPRE_ANNOTATE_MGLEVEL_END(lvl)    hypre_ProfileLevelEnd(lvl)
 
 #endif
 
@@ -1215,6 +1284,9 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   HYPRE_Int              spmv_use_sell;
+   HYPRE_Int              matvec_split;
+   HYPRE_Int              comm_transport;
 #if defined(HYPRE_USING_GPU)
    hypre_CudaData        *cuda_data;
 #endif
@@ -1240,6 +1312,9 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpMVUseSell(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleMatvecSplit(hypre_handle)                    ((hypre_handle) -> matvec_split)
+#define hypre_HandleCommTransport(hypre_handle)                  ((hypre_handle) -> comm_transport)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_CudaDataCurandGenerator(hypre_HandleCudaData(hypre_handle))
@@ -1618,6 +1693,12 @@ void hypre_GpuProfilingPushRangeColor(const char *name, HYPRE_Int cid);
 void hypre_GpuProfilingPushRange(const char *name);
 void hypre_GpuProfilingPopRange();
 
+/* hypre_profiler.c */
+HYPRE_Int hypre_ProfilerRegionBegin ( const char *name );
+HYPRE_Int hypre_ProfilerRegionEnd ( const char *name );
+HYPRE_Int hypre_ProfilerLevelBegin ( HYPRE_Int level );
+HYPRE_Int hypre_ProfilerLevelEnd ( HYPRE_Int level );
+
 /* hypre_utilities.c */
 HYPRE_Int hypre_multmod(HYPRE_Int a, HYPRE_Int b, HYPRE_Int mod);
 void hypre_partition1D(HYPRE_Int n, HYPRE_Int p, HYPRE_Int j, HYPRE_Int *s, HYPRE_Int *e);
@@ -9,6 +9,9 @@
  *
  * Header file for Caliper instrumentation macros
  *
+ * Without Caliper the annotations feed the hypre region profiler, which
+ * records them once it has been switched on with HYPRE_SetProfiling.
+ *
  *****************************************************************************/
 
 #ifndef CALIPER_INSTRUMENTATION_HEADER
@@ -32,6 +35,8 @@ static char hypre__levelname[16];
 
 #define HYPRE_ANNOTATE_FUNC_BEGIN          CALI_MARK_FUNCTION_BEGIN
 #define HYPRE_ANNOTATE_FUNC_END            CALI_MARK_FUNCTION_END
+#define HYPRE_ANNOTATE_REGION_BEGIN(str)   CALI_MARK_BEGIN(str)
+#define HYPRE_ANNOTATE_REGION_END(str)     CALI_MARK_END(str)
 #define HYPRE_ANNOTATE_LOOP_BEGIN(id, str) CALI_MARK_LOOP_BEGIN(id, str)
 #define HYPRE_ANNOTATE_LOOP_END(id)        CALI_MARK_LOOP_END(id)
 #define HYPRE_ANNOTATE_ITER_BEGIN(id, it)  CALI_MARK_ITERATION_BEGIN(id, it)
@@ -49,14 +54,16 @@ static char hypre__levelname[16];
 
 #else
 
-#define HYPRE_ANNOTATE_FUNC_BEGIN
-#define HYPRE_ANNOTATE_FUNC_END
+#define HYPRE_ANNOTATE_FUNC_BEGIN          hypre_ProfileRegionBegin(__func__)
+#define HYPRE_ANNOTATE_FUNC_END            hypre_ProfileRegionEnd(__func__)
+#define HYPRE_ANNOTATE_REGION_BEGIN(str)   hypre_ProfileRegionBegin(str)
+#define HYPRE_ANNOTATE_REGION_END(str)     hypre_ProfileRegionEnd(str)
 #define HYPRE_ANNOTATE_LOOP_BEGIN(id, str)
 #define HYPRE_ANNOTATE_LOOP_END(id)
 #define HYPRE_ANNOTATE_ITER_BEGIN(id, it)
 #define HYPRE_ANNOTATE_ITER_END(id)
-#define HYPRE_ANNOTATE_MGLEVEL_BEGIN(lvl)
-#define HYPRE_ANNOTATE_MGLEVEL_END(lvl)
+#define HYPRE_ANNOTATE_MGLEVEL_BEGIN(lvl)  hypre_ProfileLevelBegin(lvl)
+#define HYPRE_ANNOTATE_MGLEVEL_END(lvl)    hypre_ProfileLevelEnd(lvl)
 
 #endif
 
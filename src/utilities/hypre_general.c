@@ -47,6 +47,9 @@ hypre_HandleCreate()
    hypre_Handle *hypre_handle_ = hypre_CTAlloc(hypre_Handle, 1, HYPRE_MEMORY_HOST);
 
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
+   hypre_HandleSpMVUseSell(hypre_handle_) = 0;
+   hypre_HandleMatvecSplit(hypre_handle_) = 0;
+   hypre_HandleCommTransport(hypre_handle_) = 0;
 
 #if defined(HYPRE_USING_GPU)
    hypre_HandleDefaultExecPolicy(hypre_handle_) = HYPRE_EXEC_HOST;
@@ -255,6 +258,10 @@ HYPRE_Finalize()
 
    _hypre_handle = NULL;
 
+   HYPRE_ProfilerFinalize();
+
+   hypre_HostPoolRelease();
+
    hypre_GetDeviceLastError();
 
 #ifdef HYPRE_USING_MEMORY_TRACKER
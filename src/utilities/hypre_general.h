@@ -24,6 +24,9 @@ typedef unsigned long long int hypre_ulonglongint;
 /* This allows us to consistently avoid 'double' throughout hypre */
 typedef double                 hypre_double;
 
+/* single precision storage, e.g. for mixed-precision AMG hierarchies */
+typedef float                  hypre_float;
+
 /*--------------------------------------------------------------------------
  * Define various functions
  *--------------------------------------------------------------------------*/
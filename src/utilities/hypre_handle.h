@@ -23,6 +23,9 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   HYPRE_Int              spmv_use_sell;
+   HYPRE_Int              matvec_split;
+   HYPRE_Int              comm_transport;
 #if defined(HYPRE_USING_GPU)
    hypre_CudaData        *cuda_data;
 #endif
@@ -48,6 +51,9 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpMVUseSell(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleMatvecSplit(hypre_handle)                    ((hypre_handle) -> matvec_split)
+#define hypre_HandleCommTransport(hypre_handle)                  ((hypre_handle) -> comm_transport)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_CudaDataCurandGenerator(hypre_HandleCudaData(hypre_handle))
@@ -0,0 +1,677 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host memory pool used by hypre_MAlloc/hypre_Free for HYPRE_MEMORY_HOST
+ *
+ * Two allocators share one registry of address ranges:
+ *
+ *    1. size-class free lists: requests up to hypre_HOST_POOL_MAX_BLOCK bytes
+ *       are rounded up to a power of two and carved out of slabs holding at
+ *       least hypre_HOST_POOL_SLAB_BLOCKS blocks. Freed blocks go to the free
+ *       list of their class and are never returned to the system while the
+ *       pool is in use.
+ *    2. a scratch arena: hypre_TAllocScratch/hypre_CTAllocScratch hand out
+ *       bump-allocated blocks between hypre_HostScratchBegin and
+ *       hypre_HostScratchEnd. Freeing a scratch block is a no-op (except for
+ *       the last block, which is popped); the outermost End resets the whole
+ *       arena in one shot and keeps its chunks for the next setup.
+ *
+ * hypre_Free looks pointers up in the registry, so blocks obtained from
+ * malloc before the pool was enabled (or too large to be pooled) are still
+ * released with free. The registry and the free lists are plain arrays that
+ * do not go through hypre_TAlloc. Inside OpenMP parallel regions every pool
+ * operation takes a lock; outside of them no locking is done.
+ *
+ * The pool is off by default and switched on with HYPRE_SetHostMemoryPool.
+ * It is not used when host memory is managed by Umpire.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#define hypre_HOST_POOL_MIN_SHIFT   4                          /* 16 B  */
+#define hypre_HOST_POOL_MAX_SHIFT   16                         /* 64 KB */
+#define hypre_HOST_POOL_NUM_CLASSES (hypre_HOST_POOL_MAX_SHIFT - hypre_HOST_POOL_MIN_SHIFT + 1)
+#define hypre_HOST_POOL_MAX_BLOCK   ((size_t) 1 << hypre_HOST_POOL_MAX_SHIFT)
+#define hypre_HOST_POOL_MIN_SLAB    ((size_t) 1 << 16)         /* 64 KB */
+#define hypre_HOST_POOL_SLAB_BLOCKS 16
+#define hypre_HOST_SCRATCH_CHUNK    ((size_t) 1 << 22)         /* 4 MB  */
+#define hypre_HOST_SCRATCH_ALIGN    ((size_t) 16)
+
+/* kind of a registered range: a size class index, or a scratch chunk */
+#define hypre_HOST_POOL_SCRATCH     (-1)
+
+typedef struct
+{
+   char      *base;
+   size_t     size;
+   HYPRE_Int  kind;
+   size_t     offset;      /* scratch chunks only: bump pointer */
+} hypre_HostPoolRange;
+
+typedef struct
+{
+   HYPRE_Int            enabled;
+   HYPRE_Int            lock_initialized;
+#ifdef HYPRE_USING_OPENMP
+   omp_lock_t           lock;
+#endif
+
+   /* registry of slabs and scratch chunks, sorted by base address */
+   HYPRE_Int            num_ranges;
+   HYPRE_Int            max_ranges;
+   hypre_HostPoolRange *ranges;
+
+   /* intrusive free lists, one per size class, and the part of the newest
+    * slab of each class that has not been handed out yet */
+   void                *free_list[hypre_HOST_POOL_NUM_CLASSES];
+   char                *slab_next[hypre_HOST_POOL_NUM_CLASSES];
+   char                *slab_end[hypre_HOST_POOL_NUM_CLASSES];
+
+   /* scratch arena: nesting depth and chunk in use */
+   HYPRE_Int            scratch_depth;
+   hypre_HostPoolRange *scratch_current;
+
+   /* statistics */
+   size_t               class_allocs[hypre_HOST_POOL_NUM_CLASSES];
+   size_t               class_reuses[hypre_HOST_POOL_NUM_CLASSES];
+   size_t               class_in_use[hypre_HOST_POOL_NUM_CLASSES];
+   size_t               class_peak[hypre_HOST_POOL_NUM_CLASSES];
+   size_t               bytes_in_use;
+   size_t               peak_bytes;
+   size_t               reserved_bytes;
+   size_t               num_large_allocs;
+   size_t               scratch_allocs;
+   size_t               scratch_in_use;
+   size_t               scratch_peak;
+   size_t               scratch_reserved;
+} hypre_HostPool;
+
+static hypre_HostPool hypre_host_pool;
+
+/*--------------------------------------------------------------------------
+ * Locking: only inside OpenMP parallel regions
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_HostPoolLock( void )
+{
+#ifdef HYPRE_USING_OPENMP
+   if (hypre_host_pool.lock_initialized && omp_in_parallel())
+   {
+      omp_set_lock(&hypre_host_pool.lock);
+      return 1;
+   }
+#endif
+   return 0;
+}
+
+static inline void
+hypre_HostPoolUnlock( HYPRE_Int locked )
+{
+#ifdef HYPRE_USING_OPENMP
+   if (locked)
+   {
+      omp_unset_lock(&hypre_host_pool.lock);
+   }
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * Registry helpers
+ *--------------------------------------------------------------------------*/
+
+static hypre_HostPoolRange *
+hypre_HostPoolFindRange( void *ptr )
+{
+   hypre_HostPoolRange *ranges = hypre_host_pool.ranges;
+   char                *p      = (char *) ptr;
+   HYPRE_Int            lo = 0, hi = hypre_host_pool.num_ranges - 1, mid;
+
+   /* last range with base <= p */
+   while (lo <= hi)
+   {
+      mid = (lo + hi) / 2;
+      if (ranges[mid].base <= p)
+      {
+         lo = mid + 1;
+      }
+      else
+      {
+         hi = mid - 1;
+      }
+   }
+
+   if (hi >= 0 && p < ranges[hi].base + ranges[hi].size)
+   {
+      return &ranges[hi];
+   }
+
+   return NULL;
+}
+
+static hypre_HostPoolRange *
+hypre_HostPoolAddRange( size_t size, HYPRE_Int kind )
+{
+   hypre_HostPoolRange *ranges;
+   char                *base;
+   HYPRE_Int            i;
+
+   base = (char *) malloc(size);
+   if (!base)
+   {
+      return NULL;
+   }
+
+   if (hypre_host_pool.num_ranges == hypre_host_pool.max_ranges)
+   {
+      HYPRE_Int max_ranges = 2 * hypre_host_pool.max_ranges + 16;
+
+      ranges = (hypre_HostPoolRange *) realloc(hypre_host_pool.ranges,
+                                               max_ranges * sizeof(hypre_HostPoolRange));
+      if (!ranges)
+      {
+         free(base);
+         return NULL;
+      }
+      hypre_host_pool.ranges     = ranges;
+      hypre_host_pool.max_ranges = max_ranges;
+      /* the scratch chunk pointer moved with the array */
+      hypre_host_pool.scratch_current = NULL;
+   }
+
+   ranges = hypre_host_pool.ranges;
+   i = hypre_host_pool.num_ranges;
+   while (i > 0 && ranges[i - 1].base > base)
+   {
+      ranges[i] = ranges[i - 1];
+      i--;
+   }
+   ranges[i].base   = base;
+   ranges[i].size   = size;
+   ranges[i].kind   = kind;
+   ranges[i].offset = 0;
+   hypre_host_pool.num_ranges++;
+   hypre_host_pool.scratch_current = NULL;
+
+   if (kind == hypre_HOST_POOL_SCRATCH)
+   {
+      hypre_host_pool.scratch_reserved += size;
+   }
+   else
+   {
+      hypre_host_pool.reserved_bytes += size;
+   }
+
+   return &ranges[i];
+}
+
+/*--------------------------------------------------------------------------
+ * Size classes
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_HostPoolSizeClass( size_t size )
+{
+   HYPRE_Int k     = 0;
+   size_t    block = (size_t) 1 << hypre_HOST_POOL_MIN_SHIFT;
+
+   while (block < size)
+   {
+      block <<= 1;
+      k++;
+   }
+
+   return k;
+}
+
+static inline size_t
+hypre_HostPoolClassSize( HYPRE_Int k )
+{
+   return (size_t) 1 << (k + hypre_HOST_POOL_MIN_SHIFT);
+}
+
+/* new slab for class k; its blocks are carved on demand */
+static HYPRE_Int
+hypre_HostPoolRefill( HYPRE_Int k )
+{
+   hypre_HostPoolRange *slab;
+   size_t               slab_size;
+
+   slab_size = hypre_max(hypre_HOST_POOL_MIN_SLAB,
+                         hypre_HOST_POOL_SLAB_BLOCKS * hypre_HostPoolClassSize(k));
+   slab = hypre_HostPoolAddRange(slab_size, k);
+   if (!slab)
+   {
+      return 0;
+   }
+
+   hypre_host_pool.slab_next[k] = slab -> base;
+   hypre_host_pool.slab_end[k]  = slab -> base + slab_size;
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolMalloc
+ *
+ * Returns NULL if the pool is off or the request is not pooled; the caller
+ * then falls back to malloc/calloc.
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_HostPoolMalloc( size_t    size,
+                      HYPRE_Int zeroinit )
+{
+   void      *ptr = NULL;
+   HYPRE_Int  k, locked;
+
+   if (!hypre_host_pool.enabled)
+   {
+      return NULL;
+   }
+
+   locked = hypre_HostPoolLock();
+
+   if (size > hypre_HOST_POOL_MAX_BLOCK)
+   {
+      hypre_host_pool.num_large_allocs++;
+      hypre_HostPoolUnlock(locked);
+      return NULL;
+   }
+
+   k = hypre_HostPoolSizeClass(size);
+
+   if (hypre_host_pool.free_list[k])
+   {
+      ptr = hypre_host_pool.free_list[k];
+      hypre_host_pool.free_list[k] = *((void **) ptr);
+      hypre_host_pool.class_reuses[k]++;
+   }
+   else
+   {
+      if (hypre_host_pool.slab_next[k] == hypre_host_pool.slab_end[k] &&
+          !hypre_HostPoolRefill(k))
+      {
+         hypre_HostPoolUnlock(locked);
+         return NULL;
+      }
+      ptr = (void *) hypre_host_pool.slab_next[k];
+      hypre_host_pool.slab_next[k] += hypre_HostPoolClassSize(k);
+   }
+
+   hypre_host_pool.class_allocs[k]++;
+   hypre_host_pool.class_in_use[k]++;
+   hypre_host_pool.class_peak[k] = hypre_max(hypre_host_pool.class_peak[k],
+                                             hypre_host_pool.class_in_use[k]);
+   hypre_host_pool.bytes_in_use += hypre_HostPoolClassSize(k);
+   hypre_host_pool.peak_bytes    = hypre_max(hypre_host_pool.peak_bytes,
+                                             hypre_host_pool.bytes_in_use);
+
+   hypre_HostPoolUnlock(locked);
+
+   if (zeroinit)
+   {
+      memset(ptr, 0, size);
+   }
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolFree
+ *
+ * Returns 1 if ptr belongs to the pool (and has been released), 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostPoolFree( void *ptr )
+{
+   hypre_HostPoolRange *range;
+   HYPRE_Int            k, locked;
+
+   if (!hypre_host_pool.num_ranges)
+   {
+      return 0;
+   }
+
+   locked = hypre_HostPoolLock();
+
+   range = hypre_HostPoolFindRange(ptr);
+   if (!range)
+   {
+      hypre_HostPoolUnlock(locked);
+      return 0;
+   }
+
+   k = range -> kind;
+   if (k == hypre_HOST_POOL_SCRATCH)
+   {
+      /* pop the block if it is the last one of its chunk */
+      size_t nbytes = *((size_t *) ((char *) ptr - hypre_HOST_SCRATCH_ALIGN));
+
+      if ((char *) ptr + nbytes == range -> base + range -> offset)
+      {
+         range -> offset -= nbytes + hypre_HOST_SCRATCH_ALIGN;
+         hypre_host_pool.scratch_in_use -= nbytes + hypre_HOST_SCRATCH_ALIGN;
+      }
+   }
+   else
+   {
+      *((void **) ptr) = hypre_host_pool.free_list[k];
+      hypre_host_pool.free_list[k] = ptr;
+      hypre_host_pool.class_in_use[k]--;
+      hypre_host_pool.bytes_in_use -= hypre_HostPoolClassSize(k);
+   }
+
+   hypre_HostPoolUnlock(locked);
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolBlockSize
+ *
+ * Returns the usable size of a pool block, 0 if ptr is not a pool block.
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_HostPoolBlockSize( void *ptr )
+{
+   hypre_HostPoolRange *range;
+   size_t               size = 0;
+   HYPRE_Int            locked;
+
+   if (!hypre_host_pool.num_ranges)
+   {
+      return 0;
+   }
+
+   locked = hypre_HostPoolLock();
+
+   range = hypre_HostPoolFindRange(ptr);
+   if (range)
+   {
+      if (range -> kind == hypre_HOST_POOL_SCRATCH)
+      {
+         size = *((size_t *) ((char *) ptr - hypre_HOST_SCRATCH_ALIGN));
+      }
+      else
+      {
+         size = hypre_HostPoolClassSize(range -> kind);
+      }
+   }
+
+   hypre_HostPoolUnlock(locked);
+
+   return size;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostScratchMAlloc
+ *
+ * Host allocation whose lifetime ends with the enclosing scratch scope.
+ * Outside of a scope (or with the pool off) this is a regular hypre_MAlloc.
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_HostScratchMAlloc( size_t    size,
+                         HYPRE_Int zeroinit )
+{
+   hypre_HostPoolRange *chunk = NULL;
+   size_t               nbytes, need;
+   void                *ptr;
+   HYPRE_Int            i, locked;
+
+   if (!hypre_host_pool.enabled || !hypre_host_pool.scratch_depth || size == 0)
+   {
+      return zeroinit ? hypre_CAlloc(size, 1, HYPRE_MEMORY_HOST) :
+                        hypre_MAlloc(size, HYPRE_MEMORY_HOST);
+   }
+
+   nbytes = (size + hypre_HOST_SCRATCH_ALIGN - 1) & ~(hypre_HOST_SCRATCH_ALIGN - 1);
+   need   = nbytes + hypre_HOST_SCRATCH_ALIGN;
+
+   locked = hypre_HostPoolLock();
+
+   /* current chunk first, then any chunk with room, then a new chunk */
+   if (hypre_host_pool.scratch_current &&
+       hypre_host_pool.scratch_current -> offset + need <= hypre_host_pool.scratch_current -> size)
+   {
+      chunk = hypre_host_pool.scratch_current;
+   }
+   for (i = 0; !chunk && i < hypre_host_pool.num_ranges; i++)
+   {
+      hypre_HostPoolRange *range = &hypre_host_pool.ranges[i];
+      if (range -> kind == hypre_HOST_POOL_SCRATCH && range -> offset + need <= range -> size)
+      {
+         chunk = range;
+      }
+   }
+   if (!chunk)
+   {
+      chunk = hypre_HostPoolAddRange(hypre_max(need, hypre_HOST_SCRATCH_CHUNK),
+                                     hypre_HOST_POOL_SCRATCH);
+   }
+   if (!chunk)
+   {
+      hypre_HostPoolUnlock(locked);
+      return zeroinit ? hypre_CAlloc(size, 1, HYPRE_MEMORY_HOST) :
+                        hypre_MAlloc(size, HYPRE_MEMORY_HOST);
+   }
+
+   /* the block size is kept in front of the block */
+   *((size_t *) (chunk -> base + chunk -> offset)) = nbytes;
+   ptr = (void *) (chunk -> base + chunk -> offset + hypre_HOST_SCRATCH_ALIGN);
+   chunk -> offset += need;
+   hypre_host_pool.scratch_current = chunk;
+
+   hypre_host_pool.scratch_allocs++;
+   hypre_host_pool.scratch_in_use += need;
+   hypre_host_pool.scratch_peak    = hypre_max(hypre_host_pool.scratch_peak,
+                                               hypre_host_pool.scratch_in_use);
+
+   hypre_HostPoolUnlock(locked);
+
+   if (zeroinit)
+   {
+      memset(ptr, 0, size);
+   }
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostScratchBegin, hypre_HostScratchEnd
+ *
+ * Scopes may nest; only the outermost End resets the arena. Scratch blocks
+ * must not be used after the scope that allocated them has ended.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostScratchBegin( void )
+{
+   hypre_host_pool.scratch_depth++;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_HostScratchEnd( void )
+{
+   HYPRE_Int i;
+
+   if (hypre_host_pool.scratch_depth > 0 && --hypre_host_pool.scratch_depth == 0)
+   {
+      for (i = 0; i < hypre_host_pool.num_ranges; i++)
+      {
+         if (hypre_host_pool.ranges[i].kind == hypre_HOST_POOL_SCRATCH)
+         {
+            hypre_host_pool.ranges[i].offset = 0;
+         }
+      }
+      hypre_host_pool.scratch_current = NULL;
+      hypre_host_pool.scratch_in_use  = 0;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolRelease
+ *
+ * Returns all slabs and scratch chunks to the system. Only done when no
+ * pool block is in use and no scratch scope is open.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostPoolRelease( void )
+{
+   HYPRE_Int i;
+
+   if (hypre_host_pool.bytes_in_use || hypre_host_pool.scratch_depth)
+   {
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i < hypre_host_pool.num_ranges; i++)
+   {
+      free(hypre_host_pool.ranges[i].base);
+   }
+   free(hypre_host_pool.ranges);
+
+   hypre_host_pool.ranges           = NULL;
+   hypre_host_pool.num_ranges       = 0;
+   hypre_host_pool.max_ranges       = 0;
+   hypre_host_pool.scratch_current  = NULL;
+   hypre_host_pool.reserved_bytes   = 0;
+   hypre_host_pool.scratch_reserved = 0;
+   for (i = 0; i < hypre_HOST_POOL_NUM_CLASSES; i++)
+   {
+      hypre_host_pool.free_list[i] = NULL;
+      hypre_host_pool.slab_next[i] = NULL;
+      hypre_host_pool.slab_end[i]  = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostPoolPrintStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostPoolPrintStats( void )
+{
+   HYPRE_Int k;
+
+   hypre_printf("Host memory pool: %s\n", hypre_host_pool.enabled ? "on" : "off");
+   hypre_printf("  in use %zu bytes, peak %zu bytes, reserved %zu bytes, %zu unpooled allocations\n",
+                hypre_host_pool.bytes_in_use, hypre_host_pool.peak_bytes,
+                hypre_host_pool.reserved_bytes, hypre_host_pool.num_large_allocs);
+   hypre_printf("  scratch: %zu allocations, peak %zu bytes, reserved %zu bytes\n",
+                hypre_host_pool.scratch_allocs, hypre_host_pool.scratch_peak,
+                hypre_host_pool.scratch_reserved);
+   hypre_printf("  %10s %12s %12s %10s %10s\n", "block", "allocs", "reused", "in use", "peak");
+   for (k = 0; k < hypre_HOST_POOL_NUM_CLASSES; k++)
+   {
+      if (hypre_host_pool.class_allocs[k])
+      {
+         hypre_printf("  %10zu %12zu %12zu %10zu %10zu\n", hypre_HostPoolClassSize(k),
+                      hypre_host_pool.class_allocs[k], hypre_host_pool.class_reuses[k],
+                      hypre_host_pool.class_in_use[k], hypre_host_pool.class_peak[k]);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetHostMemoryPool
+ *
+ * Turns the host memory pool on (1) or off (0). Turning it off stops new
+ * allocations from the pool; blocks already handed out stay valid.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetHostMemoryPool( HYPRE_Int use_pool )
+{
+#if defined(HYPRE_USING_UMPIRE_HOST)
+   use_pool = 0;
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+   if (use_pool && !hypre_host_pool.lock_initialized)
+   {
+      omp_init_lock(&hypre_host_pool.lock);
+      hypre_host_pool.lock_initialized = 1;
+   }
+#endif
+   hypre_host_pool.enabled = use_pool;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GetHostMemoryPoolStats
+ *
+ * Bytes are those of pooled blocks (rounded to their size class). Any
+ * argument may be NULL.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GetHostMemoryPoolStats( size_t *bytes_in_use,
+                              size_t *peak_bytes,
+                              size_t *reserved_bytes,
+                              size_t *num_allocs,
+                              size_t *num_reuses )
+{
+   HYPRE_Int k;
+
+   if (bytes_in_use)
+   {
+      *bytes_in_use = hypre_host_pool.bytes_in_use;
+   }
+   if (peak_bytes)
+   {
+      *peak_bytes = hypre_host_pool.peak_bytes;
+   }
+   if (reserved_bytes)
+   {
+      *reserved_bytes = hypre_host_pool.reserved_bytes + hypre_host_pool.scratch_reserved;
+   }
+   if (num_allocs)
+   {
+      *num_allocs = hypre_host_pool.scratch_allocs;
+      for (k = 0; k < hypre_HOST_POOL_NUM_CLASSES; k++)
+      {
+         *num_allocs += hypre_host_pool.class_allocs[k];
+      }
+   }
+   if (num_reuses)
+   {
+      *num_reuses = 0;
+      for (k = 0; k < hypre_HOST_POOL_NUM_CLASSES; k++)
+      {
+         *num_reuses += hypre_host_pool.class_reuses[k];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PrintHostMemoryPoolStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PrintHostMemoryPoolStats( void )
+{
+   return hypre_HostPoolPrintStats();
+}
@@ -169,6 +169,12 @@ hypre_HostMalloc(size_t size, HYPRE_Int zeroinit)
       memset(ptr, 0, size);
    }
 #else
+   ptr = hypre_HostPoolMalloc(size, zeroinit);
+   if (ptr)
+   {
+      return ptr;
+   }
+
    if (zeroinit)
    {
       ptr = calloc(size, 1);
@@ -349,7 +355,10 @@ hypre_HostFree(void *ptr)
 #if defined(HYPRE_USING_UMPIRE_HOST)
    hypre_umpire_host_pooled_free(ptr);
 #else
-   free(ptr);
+   if (!hypre_HostPoolFree(ptr))
+   {
+      free(ptr);
+   }
 #endif
 }
 
@@ -840,7 +849,23 @@ hypre_ReAlloc(void *ptr, size_t size, HYPRE_MemoryLocation location)
 #if defined(HYPRE_USING_UMPIRE_HOST)
    ptr = hypre_umpire_host_pooled_realloc(ptr, size);
 #else
-   ptr = realloc(ptr, size);
+   size_t old_size = hypre_HostPoolBlockSize(ptr);
+   if (old_size >= size)
+   {
+      /* pool block still large enough */
+      return ptr;
+   }
+   else if (old_size)
+   {
+      void *new_ptr = hypre_MAlloc(size, location);
+      memcpy(new_ptr, ptr, old_size);
+      hypre_Free(ptr, location);
+      ptr = new_ptr;
+   }
+   else
+   {
+      ptr = realloc(ptr, size);
+   }
 #endif
 
    if (!ptr)
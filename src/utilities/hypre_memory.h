@@ -248,6 +248,14 @@ typedef struct
 
 #endif /* #ifdef HYPRE_USING_MEMORY_TRACKER */
 
+/* host scratch memory, valid until the enclosing hypre_HostScratchEnd;
+ * freed with hypre_TFree(ptr, HYPRE_MEMORY_HOST) */
+#define hypre_TAllocScratch(type, count) \
+( (type *) hypre_HostScratchMAlloc((size_t)(sizeof(type) * (count)), 0) )
+
+#define hypre_CTAllocScratch(type, count) \
+( (type *) hypre_HostScratchMAlloc((size_t)(sizeof(type) * (count)), 1) )
+
 
 /*--------------------------------------------------------------------------
  * Prototypes
@@ -289,6 +297,16 @@ void hypre_MemoryTrackerInsert(const char *action, void *ptr, size_t nbytes, hyp
 HYPRE_Int hypre_PrintMemoryTracker();
 #endif
 
+/* hypre_host_pool.c */
+void * hypre_HostPoolMalloc( size_t size, HYPRE_Int zeroinit );
+HYPRE_Int hypre_HostPoolFree( void *ptr );
+size_t hypre_HostPoolBlockSize( void *ptr );
+void * hypre_HostScratchMAlloc( size_t size, HYPRE_Int zeroinit );
+HYPRE_Int hypre_HostScratchBegin( void );
+HYPRE_Int hypre_HostScratchEnd( void );
+HYPRE_Int hypre_HostPoolRelease( void );
+HYPRE_Int hypre_HostPoolPrintStats( void );
+
 /* memory_dmalloc.c */
 HYPRE_Int hypre_InitMemoryDebugDML( HYPRE_Int id );
 HYPRE_Int hypre_FinalizeMemoryDebugDML( void );
@@ -0,0 +1,724 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Hierarchical region profiler
+ *
+ * Regions are opened and closed with the HYPRE_ANNOTATE_* macros (or
+ * hypre_ProfileRegionBegin/End) and form a tree: a region opened while
+ * another one is open becomes its child, and repeated visits of the same
+ * region under the same parent accumulate into one node. Each node keeps the
+ * number of calls and the total, minimum and maximum inclusive wall time.
+ *
+ * The profiler is always compiled and is switched on at runtime with
+ * HYPRE_SetProfiling. When it is off every annotation costs one branch.
+ * Regions are only recorded by the thread that is outside of an OpenMP
+ * parallel region, so annotations inside threaded loops are ignored.
+ *
+ * Closing a region also closes any region opened after it that was not
+ * closed yet (e.g. because of an early return), and closing a region that
+ * is not open is a no-op.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#define hypre_PROFILER_MAX_EVENTS (1 << 20)
+
+HYPRE_Int hypre__profiler_mode = 0;
+
+typedef struct
+{
+   char       *name;
+   HYPRE_Int   parent;
+   HYPRE_Int   first_child;
+   HYPRE_Int   last_child;
+   HYPRE_Int   next_sibling;
+   HYPRE_Int   depth;
+   HYPRE_Int   count;
+   HYPRE_Int   num_ranks;    /* merged tree only */
+   HYPRE_Real  total;
+   HYPRE_Real  min;          /* per call, or per rank in the merged tree */
+   HYPRE_Real  max;
+   HYPRE_Real  start;
+} hypre_ProfileNode;
+
+typedef struct
+{
+   HYPRE_Int          num_nodes;
+   HYPRE_Int          max_nodes;
+   hypre_ProfileNode *nodes;
+} hypre_ProfileTree;
+
+typedef struct
+{
+   HYPRE_Int   node;
+   HYPRE_Real  start;
+   HYPRE_Real  duration;
+} hypre_ProfileEvent;
+
+typedef struct
+{
+   hypre_ProfileTree   tree;
+   HYPRE_Int           current;
+   HYPRE_Real          t0;
+
+   /* trace events, only recorded with mode 2 */
+   HYPRE_Int           num_events;
+   HYPRE_Int           max_events;
+   HYPRE_Int           num_dropped;
+   hypre_ProfileEvent *events;
+} hypre_Profiler;
+
+static hypre_Profiler hypre_profiler;
+
+/*--------------------------------------------------------------------------
+ * Tree helpers
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ProfileTreeAddNode( hypre_ProfileTree *tree,
+                          HYPRE_Int          parent,
+                          const char        *name )
+{
+   hypre_ProfileNode *node;
+   HYPRE_Int          i = tree -> num_nodes;
+
+   if (tree -> num_nodes == tree -> max_nodes)
+   {
+      HYPRE_Int max_nodes = 2 * tree -> max_nodes + 64;
+
+      tree -> nodes = hypre_TReAlloc(tree -> nodes, hypre_ProfileNode, max_nodes,
+                                     HYPRE_MEMORY_HOST);
+      tree -> max_nodes = max_nodes;
+   }
+
+   node = &(tree -> nodes[i]);
+   node -> name = hypre_TAlloc(char, strlen(name) + 1, HYPRE_MEMORY_HOST);
+   strcpy(node -> name, name);
+   node -> parent       = parent;
+   node -> first_child  = -1;
+   node -> last_child   = -1;
+   node -> next_sibling = -1;
+   node -> depth        = (parent < 0) ? 0 : tree -> nodes[parent].depth + 1;
+   node -> count        = 0;
+   node -> num_ranks    = 0;
+   node -> total        = 0.0;
+   node -> min          = 0.0;
+   node -> max          = 0.0;
+   node -> start        = 0.0;
+   tree -> num_nodes++;
+
+   if (parent >= 0)
+   {
+      if (tree -> nodes[parent].last_child < 0)
+      {
+         tree -> nodes[parent].first_child = i;
+      }
+      else
+      {
+         tree -> nodes[tree -> nodes[parent].last_child].next_sibling = i;
+      }
+      tree -> nodes[parent].last_child = i;
+   }
+
+   return i;
+}
+
+/* child of parent with the given name, created if it does not exist yet */
+static HYPRE_Int
+hypre_ProfileTreeChild( hypre_ProfileTree *tree,
+                        HYPRE_Int          parent,
+                        const char        *name )
+{
+   HYPRE_Int c;
+
+   for (c = tree -> nodes[parent].first_child; c >= 0; c = tree -> nodes[c].next_sibling)
+   {
+      if (strcmp(tree -> nodes[c].name, name) == 0)
+      {
+         return c;
+      }
+   }
+
+   return hypre_ProfileTreeAddNode(tree, parent, name);
+}
+
+static void
+hypre_ProfileTreeDestroy( hypre_ProfileTree *tree )
+{
+   HYPRE_Int i;
+
+   for (i = 0; i < tree -> num_nodes; i++)
+   {
+      hypre_TFree(tree -> nodes[i].name, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(tree -> nodes, HYPRE_MEMORY_HOST);
+   tree -> num_nodes = 0;
+   tree -> max_nodes = 0;
+}
+
+static inline HYPRE_Int
+hypre_ProfilerIgnore( void )
+{
+#ifdef HYPRE_USING_OPENMP
+   if (omp_in_parallel())
+   {
+      return 1;
+   }
+#endif
+   return (hypre_profiler.tree.num_nodes == 0);
+}
+
+static void
+hypre_ProfilerCloseNode( HYPRE_Int  i,
+                         HYPRE_Real now )
+{
+   hypre_ProfileNode *node = &(hypre_profiler.tree.nodes[i]);
+   HYPRE_Real         duration = now - (node -> start);
+
+   if (node -> count == 0 || duration < node -> min)
+   {
+      node -> min = duration;
+   }
+   if (node -> count == 0 || duration > node -> max)
+   {
+      node -> max = duration;
+   }
+   node -> total += duration;
+   node -> count++;
+
+   if (hypre__profiler_mode > 1)
+   {
+      if (hypre_profiler.num_events == hypre_PROFILER_MAX_EVENTS)
+      {
+         hypre_profiler.num_dropped++;
+         return;
+      }
+      if (hypre_profiler.num_events == hypre_profiler.max_events)
+      {
+         HYPRE_Int max_events = hypre_min(2 * hypre_profiler.max_events + 1024,
+                                          hypre_PROFILER_MAX_EVENTS);
+
+         hypre_profiler.events = hypre_TReAlloc(hypre_profiler.events, hypre_ProfileEvent,
+                                                max_events, HYPRE_MEMORY_HOST);
+         hypre_profiler.max_events = max_events;
+      }
+      hypre_profiler.events[hypre_profiler.num_events].node     = i;
+      hypre_profiler.events[hypre_profiler.num_events].start    = node -> start;
+      hypre_profiler.events[hypre_profiler.num_events].duration = duration;
+      hypre_profiler.num_events++;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerRegionBegin
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfilerRegionBegin( const char *name )
+{
+   HYPRE_Int i;
+
+   if (hypre_ProfilerIgnore())
+   {
+      return hypre_error_flag;
+   }
+
+   i = hypre_ProfileTreeChild(&hypre_profiler.tree, hypre_profiler.current, name);
+   hypre_profiler.tree.nodes[i].start = hypre_MPI_Wtime();
+   hypre_profiler.current = i;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerRegionEnd
+ *
+ * Closes the innermost open region with the given name together with all
+ * regions opened inside of it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfilerRegionEnd( const char *name )
+{
+   hypre_ProfileNode *nodes;
+   HYPRE_Real         now;
+   HYPRE_Int          i;
+
+   if (hypre_ProfilerIgnore())
+   {
+      return hypre_error_flag;
+   }
+
+   nodes = hypre_profiler.tree.nodes;
+   for (i = hypre_profiler.current; i > 0; i = nodes[i].parent)
+   {
+      if (strcmp(nodes[i].name, name) == 0)
+      {
+         break;
+      }
+   }
+   if (i <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+   now = hypre_MPI_Wtime();
+   while (hypre_profiler.current != nodes[i].parent)
+   {
+      hypre_ProfilerCloseNode(hypre_profiler.current, now);
+      hypre_profiler.current = nodes[hypre_profiler.current].parent;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfilerLevelBegin, hypre_ProfilerLevelEnd
+ *
+ * Regions for one level of a multigrid hierarchy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfilerLevelBegin( HYPRE_Int level )
+{
+   char name[32];
+
+   hypre_sprintf(name, "level %d", level);
+
+   return hypre_ProfilerRegionBegin(name);
+}
+
+HYPRE_Int
+hypre_ProfilerLevelEnd( HYPRE_Int level )
+{
+   char name[32];
+
+   hypre_sprintf(name, "level %d", level);
+
+   return hypre_ProfilerRegionEnd(name);
+}
+
+/*--------------------------------------------------------------------------
+ * Cross-rank aggregation
+ *
+ * Every rank packs its (non-empty) nodes in preorder as
+ *    depth, calls, total time, name length, name
+ * and rank 0 merges the trees by name path. In the merged tree min and max
+ * are taken over the per-rank totals and num_ranks counts the ranks that
+ * visited the region.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ProfilerPackNode( HYPRE_Int   i,
+                        char      **buf )
+{
+   hypre_ProfileNode *node = &(hypre_profiler.tree.nodes[i]);
+   HYPRE_Int          len = (HYPRE_Int) strlen(node -> name);
+   HYPRE_Int          size, c;
+
+   size = 3 * sizeof(HYPRE_Int) + sizeof(HYPRE_Real) + len;
+   if (buf)
+   {
+      memcpy(*buf, &(node -> depth), sizeof(HYPRE_Int));
+      *buf += sizeof(HYPRE_Int);
+      memcpy(*buf, &(node -> count), sizeof(HYPRE_Int));
+      *buf += sizeof(HYPRE_Int);
+      memcpy(*buf, &(node -> total), sizeof(HYPRE_Real));
+      *buf += sizeof(HYPRE_Real);
+      memcpy(*buf, &len, sizeof(HYPRE_Int));
+      *buf += sizeof(HYPRE_Int);
+      memcpy(*buf, node -> name, len);
+      *buf += len;
+   }
+
+   for (c = node -> first_child; c >= 0; c = hypre_profiler.tree.nodes[c].next_sibling)
+   {
+      if (hypre_profiler.tree.nodes[c].count > 0)
+      {
+         size += hypre_ProfilerPackNode(c, buf);
+      }
+   }
+
+   return size;
+}
+
+static void
+hypre_ProfilerMergeBuffer( hypre_ProfileTree *merged,
+                           char              *buf,
+                           HYPRE_Int          size )
+{
+   char       *end = buf + size;
+   HYPRE_Int  *stack;
+   HYPRE_Int   depth, count, len, i;
+   HYPRE_Real  total;
+   char        name[256];
+
+   stack = hypre_TAlloc(HYPRE_Int, size / (3 * sizeof(HYPRE_Int)) + 2, HYPRE_MEMORY_HOST);
+   stack[0] = 0;
+
+   while (buf < end)
+   {
+      memcpy(&depth, buf, sizeof(HYPRE_Int));
+      buf += sizeof(HYPRE_Int);
+      memcpy(&count, buf, sizeof(HYPRE_Int));
+      buf += sizeof(HYPRE_Int);
+      memcpy(&total, buf, sizeof(HYPRE_Real));
+      buf += sizeof(HYPRE_Real);
+      memcpy(&len, buf, sizeof(HYPRE_Int));
+      buf += sizeof(HYPRE_Int);
+      memcpy(name, buf, hypre_min(len, 255));
+      name[hypre_min(len, 255)] = '\0';
+      buf += len;
+
+      /* the root of each rank only anchors the stack */
+      if (depth == 0)
+      {
+         continue;
+      }
+
+      i = hypre_ProfileTreeChild(merged, stack[depth - 1], name);
+      stack[depth] = i;
+
+      if (merged -> nodes[i].num_ranks == 0 || total < merged -> nodes[i].min)
+      {
+         merged -> nodes[i].min = total;
+      }
+      if (merged -> nodes[i].num_ranks == 0 || total > merged -> nodes[i].max)
+      {
+         merged -> nodes[i].max = total;
+      }
+      merged -> nodes[i].total += total;
+      merged -> nodes[i].count += count;
+      merged -> nodes[i].num_ranks++;
+   }
+
+   hypre_TFree(stack, HYPRE_MEMORY_HOST);
+}
+
+/* collective; the merged tree is only filled on rank 0 */
+static HYPRE_Int
+hypre_ProfilerMerge( MPI_Comm           comm,
+                     hypre_ProfileTree *merged )
+{
+   HYPRE_Int  my_id, num_procs, p;
+   HYPRE_Int  size = 0;
+   HYPRE_Int *sizes = NULL, *displs = NULL;
+   char      *sendbuf = NULL, *recvbuf = NULL;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (hypre_profiler.tree.num_nodes > 0)
+   {
+      char *buf;
+
+      size = hypre_ProfilerPackNode(0, NULL);
+      sendbuf = hypre_TAlloc(char, size, HYPRE_MEMORY_HOST);
+      buf = sendbuf;
+      hypre_ProfilerPackNode(0, &buf);
+   }
+
+   if (my_id == 0)
+   {
+      sizes  = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+      displs = hypre_TAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gather(&size, 1, HYPRE_MPI_INT, sizes, 1, HYPRE_MPI_INT, 0, comm);
+
+   if (my_id == 0)
+   {
+      displs[0] = 0;
+      for (p = 0; p < num_procs; p++)
+      {
+         displs[p + 1] = displs[p] + sizes[p];
+      }
+      recvbuf = hypre_TAlloc(char, displs[num_procs] + 1, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gatherv(sendbuf, size, hypre_MPI_CHAR, recvbuf, sizes, displs,
+                     hypre_MPI_CHAR, 0, comm);
+
+   if (my_id == 0)
+   {
+      merged -> num_nodes = 0;
+      merged -> max_nodes = 0;
+      merged -> nodes     = NULL;
+      hypre_ProfileTreeAddNode(merged, -1, "root");
+      for (p = 0; p < num_procs; p++)
+      {
+         hypre_ProfilerMergeBuffer(merged, recvbuf + displs[p], sizes[p]);
+      }
+   }
+
+   hypre_TFree(sendbuf, HYPRE_MEMORY_HOST);
+   hypre_TFree(recvbuf, HYPRE_MEMORY_HOST);
+   hypre_TFree(sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(displs, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Output helpers
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ProfilerPrintNode( hypre_ProfileTree *tree,
+                         HYPRE_Int          i )
+{
+   hypre_ProfileNode *node = &(tree -> nodes[i]);
+   HYPRE_Int          c;
+
+   if (i > 0)
+   {
+      hypre_printf("%*s%-*s %8d %12.6f %12.6f %12.6f %6d\n",
+                   (hypre_int) (2 * node -> depth - 2), "",
+                   (hypre_int) (42 - 2 * node -> depth), node -> name,
+                   node -> count, node -> min, node -> total / node -> num_ranks,
+                   node -> max, node -> num_ranks);
+   }
+
+   for (c = node -> first_child; c >= 0; c = tree -> nodes[c].next_sibling)
+   {
+      hypre_ProfilerPrintNode(tree, c);
+   }
+}
+
+/* merged == 0: local tree of this rank, merged == 1: aggregated tree */
+static void
+hypre_ProfilerWriteJSONNode( FILE              *fp,
+                             hypre_ProfileTree *tree,
+                             HYPRE_Int          i,
+                             HYPRE_Int          merged )
+{
+   hypre_ProfileNode *node = &(tree -> nodes[i]);
+   HYPRE_Int          c, first = 1;
+
+   hypre_fprintf(fp, "%*s{\"name\": \"%s\", \"calls\": %d, ",
+                 (hypre_int) (2 * node -> depth), "", node -> name, node -> count);
+   if (merged)
+   {
+      hypre_fprintf(fp, "\"ranks\": %d, \"min\": %.9e, \"avg\": %.9e, \"max\": %.9e",
+                    node -> num_ranks, node -> min,
+                    node -> num_ranks ? node -> total / node -> num_ranks : 0.0, node -> max);
+   }
+   else
+   {
+      hypre_fprintf(fp, "\"total\": %.9e, \"min\": %.9e, \"max\": %.9e",
+                    node -> total, node -> min, node -> max);
+   }
+   hypre_fprintf(fp, ", \"children\": [");
+
+   for (c = node -> first_child; c >= 0; c = tree -> nodes[c].next_sibling)
+   {
+      if (!merged && tree -> nodes[c].count == 0)
+      {
+         continue;
+      }
+      hypre_fprintf(fp, first ? "\n" : ",\n");
+      hypre_ProfilerWriteJSONNode(fp, tree, c, merged);
+      first = 0;
+   }
+   if (!first)
+   {
+      hypre_fprintf(fp, "\n%*s", (hypre_int) (2 * node -> depth), "");
+   }
+   hypre_fprintf(fp, "]}");
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetProfiling
+ *
+ * 0: off, 1: collect the region tree, 2: also record a trace event for
+ * every region visit (needed for HYPRE_ProfilerWriteChromeTrace).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetProfiling( HYPRE_Int mode )
+{
+   if (mode && hypre_profiler.tree.num_nodes == 0)
+   {
+      hypre_ProfileTreeAddNode(&hypre_profiler.tree, -1, "root");
+      hypre_profiler.current = 0;
+      hypre_profiler.t0 = hypre_MPI_Wtime();
+   }
+   hypre__profiler_mode = mode;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilerReset
+ *
+ * Clears all timings and trace events. Regions that are open stay open.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfilerReset( void )
+{
+   HYPRE_Int i;
+
+   for (i = 0; i < hypre_profiler.tree.num_nodes; i++)
+   {
+      hypre_profiler.tree.nodes[i].count = 0;
+      hypre_profiler.tree.nodes[i].total = 0.0;
+      hypre_profiler.tree.nodes[i].min   = 0.0;
+      hypre_profiler.tree.nodes[i].max   = 0.0;
+   }
+   hypre_profiler.num_events  = 0;
+   hypre_profiler.num_dropped = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilerFinalize
+ *
+ * Frees the profiler data and turns profiling off.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfilerFinalize( void )
+{
+   hypre__profiler_mode = 0;
+   hypre_ProfileTreeDestroy(&hypre_profiler.tree);
+   hypre_TFree(hypre_profiler.events, HYPRE_MEMORY_HOST);
+   hypre_profiler.current     = 0;
+   hypre_profiler.num_events  = 0;
+   hypre_profiler.max_events  = 0;
+   hypre_profiler.num_dropped = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilerPrint
+ *
+ * Collective. Rank 0 prints the region tree with the number of calls summed
+ * over all ranks and the min/avg/max over ranks of the time per region.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfilerPrint( MPI_Comm comm )
+{
+   hypre_ProfileTree merged;
+   HYPRE_Int         my_id;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_ProfilerMerge(comm, &merged);
+
+   if (my_id == 0)
+   {
+      hypre_printf("\n%-40s %8s %12s %12s %12s %6s\n", "region", "calls",
+                   "min (s)", "avg (s)", "max (s)", "ranks");
+      hypre_ProfilerPrintNode(&merged, 0);
+      hypre_printf("\n");
+      hypre_ProfileTreeDestroy(&merged);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilerWriteJSON
+ *
+ * Collective. Every rank writes its region tree to <prefix>.<rank>.json and
+ * rank 0 writes the aggregated tree to <prefix>.summary.json.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfilerWriteJSON( MPI_Comm    comm,
+                         const char *prefix )
+{
+   hypre_ProfileTree  merged;
+   HYPRE_Int          my_id;
+   char               filename[1024];
+   FILE              *fp;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_ProfilerMerge(comm, &merged);
+
+   if (hypre_profiler.tree.num_nodes > 0)
+   {
+      hypre_sprintf(filename, "%s.%05d.json", prefix, my_id);
+      if ((fp = fopen(filename, "w")) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      }
+      else
+      {
+         hypre_fprintf(fp, "{\"rank\": %d,\n\"regions\":\n", my_id);
+         hypre_ProfilerWriteJSONNode(fp, &hypre_profiler.tree, 0, 0);
+         hypre_fprintf(fp, "\n}\n");
+         fclose(fp);
+      }
+   }
+
+   if (my_id == 0)
+   {
+      hypre_sprintf(filename, "%s.summary.json", prefix);
+      if ((fp = fopen(filename, "w")) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      }
+      else
+      {
+         hypre_fprintf(fp, "{\"regions\":\n");
+         hypre_ProfilerWriteJSONNode(fp, &merged, 0, 1);
+         hypre_fprintf(fp, "\n}\n");
+         fclose(fp);
+      }
+      hypre_ProfileTreeDestroy(&merged);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilerWriteChromeTrace
+ *
+ * Writes the trace events of this rank to <prefix>.<rank>.trace.json in the
+ * Chrome trace event format (chrome://tracing, Perfetto). Requires
+ * HYPRE_SetProfiling(2). Not collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfilerWriteChromeTrace( MPI_Comm    comm,
+                                const char *prefix )
+{
+   hypre_ProfileEvent *event;
+   HYPRE_Int           my_id, e;
+   char                filename[1024];
+   FILE               *fp;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   hypre_sprintf(filename, "%s.%05d.trace.json", prefix, my_id);
+   if ((fp = fopen(filename, "w")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   hypre_fprintf(fp, "{\"otherData\": {\"dropped_events\": %d},\n\"traceEvents\": [\n",
+                 hypre_profiler.num_dropped);
+   for (e = 0; e < hypre_profiler.num_events; e++)
+   {
+      event = &hypre_profiler.events[e];
+      hypre_fprintf(fp, "{\"name\": \"%s\", \"ph\": \"X\", \"pid\": %d, \"tid\": 0, "
+                    "\"ts\": %.3f, \"dur\": %.3f}%s\n",
+                    hypre_profiler.tree.nodes[event -> node].name, my_id,
+                    1.0e6 * (event -> start - hypre_profiler.t0), 1.0e6 * event -> duration,
+                    (e < hypre_profiler.num_events - 1) ? "," : "");
+   }
+   hypre_fprintf(fp, "]}\n");
+   fclose(fp);
+
+   return hypre_error_flag;
+}
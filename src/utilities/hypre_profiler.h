@@ -0,0 +1,30 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header file for the hierarchical region profiler
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PROFILER_HEADER
+#define hypre_PROFILER_HEADER
+
+/* 0: off, 1: region tree, 2: region tree and trace events */
+extern HYPRE_Int hypre__profiler_mode;
+
+/* the test on hypre__profiler_mode keeps the disabled cost to one branch */
+#define hypre_ProfileRegionBegin(name) \
+   do { if (hypre__profiler_mode) { hypre_ProfilerRegionBegin(name); } } while (0)
+#define hypre_ProfileRegionEnd(name) \
+   do { if (hypre__profiler_mode) { hypre_ProfilerRegionEnd(name); } } while (0)
+#define hypre_ProfileLevelBegin(lvl) \
+   do { if (hypre__profiler_mode) { hypre_ProfilerLevelBegin(lvl); } } while (0)
+#define hypre_ProfileLevelEnd(lvl) \
+   do { if (hypre__profiler_mode) { hypre_ProfilerLevelEnd(lvl); } } while (0)
+
+#endif /* hypre_PROFILER_HEADER */
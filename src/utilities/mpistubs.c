@@ -553,6 +553,19 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1181,6 +1194,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
                                     datatype, op, comm);
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   /* no non-blocking collectives before MPI-3: reduce now, nothing to wait on */
+   *request = hypre_MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1303,6 +1336,70 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
+#ifdef HYPRE_HAVE_MPI_NEIGHBOR_COLL
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      hypre_MPI_Comm *comm_dist_graph )
+{
+   hypre_int *mpi_sources;
+   hypre_int *mpi_destinations;
+   hypre_int *mpi_weights;
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   /* one extra entry so that MPI gets valid buffers for degree 0; unit
+    * weights instead of MPI_UNWEIGHTED, which is a sentinel pointer */
+   mpi_sources      = hypre_CTAlloc(hypre_int, indegree + 1,  HYPRE_MEMORY_HOST);
+   mpi_destinations = hypre_CTAlloc(hypre_int, outdegree + 1, HYPRE_MEMORY_HOST);
+   mpi_weights      = hypre_TAlloc(hypre_int, hypre_max(indegree, outdegree) + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < indegree; i++)
+   {
+      mpi_sources[i] = (hypre_int) sources[i];
+   }
+   for (i = 0; i < outdegree; i++)
+   {
+      mpi_destinations[i] = (hypre_int) destinations[i];
+   }
+   for (i = 0; i < hypre_max(indegree, outdegree) + 1; i++)
+   {
+      mpi_weights[i] = 1;
+   }
+
+   /* no reordering: the graph communicator keeps the ranks of comm */
+   ierr = (HYPRE_Int) MPI_Dist_graph_create_adjacent(comm, (hypre_int)indegree, mpi_sources,
+                                                     mpi_weights, (hypre_int)outdegree,
+                                                     mpi_destinations, mpi_weights,
+                                                     MPI_INFO_NULL, 0, comm_dist_graph);
+
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destinations, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_weights, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+   return (HYPRE_Int) MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype,
+                                              recvbuf, recvcounts, rdispls, recvtype,
+                                              comm, request);
+}
+#endif
+
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
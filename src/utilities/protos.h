@@ -264,6 +264,12 @@ void hypre_GpuProfilingPushRangeColor(const char *name, HYPRE_Int cid);
 void hypre_GpuProfilingPushRange(const char *name);
 void hypre_GpuProfilingPopRange();
 
+/* hypre_profiler.c */
+HYPRE_Int hypre_ProfilerRegionBegin ( const char *name );
+HYPRE_Int hypre_ProfilerRegionEnd ( const char *name );
+HYPRE_Int hypre_ProfilerLevelBegin ( HYPRE_Int level );
+HYPRE_Int hypre_ProfilerLevelEnd ( HYPRE_Int level );
+
 /* hypre_utilities.c */
 HYPRE_Int hypre_multmod(HYPRE_Int a, HYPRE_Int b, HYPRE_Int mod);
 void hypre_partition1D(HYPRE_Int n, HYPRE_Int p, HYPRE_Int j, HYPRE_Int *s, HYPRE_Int *e);